@@ -0,0 +1,117 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <thread>
+
+import stl;
+import third_party;
+import config;
+import logger;
+import virtual_store;
+import buffer_manager;
+import buffer_obj;
+import buffer_handle;
+import data_file_worker;
+
+using namespace infinity;
+
+// Throughput of BufferObj Load and Unload from many threads, with all objects in memory and with a memory limit
+// that keeps only part of them resident, so that loads also go through the replacement of the buffer manager.
+
+namespace {
+
+constexpr SizeT kThreadNum = 64;
+constexpr SizeT kObjectNum = 4096;
+constexpr SizeT kObjectSize = 4096;
+constexpr SizeT kLoadTimes = 100000;
+
+void Run(const String &name, SizeT memory_limit, const SharedPtr<String> &data_dir, const SharedPtr<String> &temp_dir) {
+    VirtualStore::CleanupDirectory(*data_dir);
+    VirtualStore::CleanupDirectory(*temp_dir);
+
+    BufferManager buffer_mgr(memory_limit, data_dir, temp_dir, nullptr);
+    buffer_mgr.Start();
+    Vector<BufferObj *> buffer_objs;
+    for (SizeT i = 0; i < kObjectNum; ++i) {
+        auto file_worker = MakeUnique<DataFileWorker>(data_dir,
+                                                      temp_dir,
+                                                      MakeShared<String>(""),
+                                                      MakeShared<String>(fmt::format("file_{}", i)),
+                                                      kObjectSize,
+                                                      buffer_mgr.persistence_manager());
+        auto *buffer_obj = buffer_mgr.AllocateBufferObject(std::move(file_worker));
+        buffer_obj->AddObjRc();
+        {
+            auto handle = buffer_obj->Load();
+            auto *data = static_cast<char *>(handle.GetDataMut());
+            std::fill_n(data, kObjectSize, char('a' + i % 26));
+        }
+        buffer_obj->Save();
+        buffer_objs.push_back(buffer_obj);
+    }
+
+    auto begin = std::chrono::steady_clock::now();
+    Vector<std::thread> threads;
+    for (SizeT i = 0; i < kThreadNum; ++i) {
+        threads.emplace_back([&, i]() {
+            std::mt19937 rng(i);
+            for (SizeT j = 0; j < kLoadTimes; ++j) {
+                BufferObj *buffer_obj = buffer_objs[rng() % kObjectNum];
+                BufferHandle handle = buffer_obj->Load();
+                [[maybe_unused]] volatile char c = static_cast<const char *>(handle.GetData())[0];
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    f64 seconds = std::chrono::duration<f64>(end - begin).count();
+    BufferLoadStats stats = buffer_mgr.GetLoadStats();
+    std::cout << fmt::format("-> {}: {} threads, {:.0f} load/unload per second, {} loads from file",
+                             name,
+                             kThreadNum,
+                             kThreadNum * kLoadTimes / seconds,
+                             stats.load_count_)
+              << std::endl;
+
+    for (auto *buffer_obj : buffer_objs) {
+        buffer_obj->PickForCleanup();
+    }
+    buffer_mgr.Stop();
+}
+
+} // namespace
+
+int main() {
+    Config config;
+    config.Init(nullptr, nullptr);
+    Logger::Initialize(&config);
+
+    auto data_dir = MakeShared<String>("/var/infinity/buffer_manager_benchmark/data");
+    auto temp_dir = MakeShared<String>("/var/infinity/buffer_manager_benchmark/temp");
+
+    std::cout << ">>> Buffer Manager Benchmark Start <<<" << std::endl;
+    Run("All resident", kObjectNum * kObjectSize, data_dir, temp_dir);
+    Run("Half resident", kObjectNum * kObjectSize / 2, data_dir, temp_dir);
+    std::cout << ">>> Buffer Manager Benchmark End <<<" << std::endl;
+
+    VirtualStore::RemoveDirectory("/var/infinity/buffer_manager_benchmark");
+    Logger::Shutdown();
+    return 0;
+}
@@ -0,0 +1,129 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <random>
+
+import stl;
+import infinity;
+import third_party;
+import query_options;
+import query_result;
+import constant_expr;
+import insert_row_expr;
+import virtual_store;
+
+using namespace infinity;
+
+// Throughput of inserting rows of (INT, EMBEDDING(FLOAT, 1024)) through the row based Insert,
+// where every value is a ConstantExpr, and through InsertColumns, where every column is one raw buffer.
+
+namespace {
+
+constexpr SizeT kDimension = 1024;
+constexpr SizeT kBatchRowCount = 8192;
+constexpr SizeT kBatchCount = 16;
+
+void RunQuery(const SharedPtr<Infinity> &infinity, const String &sql) {
+    QueryResult result = infinity->Query(sql);
+    if (!result.IsOk()) {
+        std::cout << "Query: " << sql << " failed: " << result.ErrorMsg() << std::endl;
+    }
+}
+
+f64 RowInsert(const SharedPtr<Infinity> &infinity, const Vector<f32> &embeddings) {
+    auto begin = std::chrono::steady_clock::now();
+    for (SizeT batch = 0; batch < kBatchCount; ++batch) {
+        auto *insert_rows = new Vector<InsertRowExpr *>();
+        insert_rows->reserve(kBatchRowCount);
+        for (SizeT row = 0; row < kBatchRowCount; ++row) {
+            auto insert_row = MakeUnique<InsertRowExpr>();
+            insert_row->columns_ = {"c1", "c2"};
+            auto value1 = MakeUnique<ConstantExpr>(LiteralType::kInteger);
+            value1->integer_value_ = batch * kBatchRowCount + row;
+            insert_row->values_.emplace_back(std::move(value1));
+            auto value2 = MakeUnique<ConstantExpr>(LiteralType::kDoubleArray);
+            const f32 *embedding = embeddings.data() + row * kDimension;
+            value2->double_array_.assign(embedding, embedding + kDimension);
+            insert_row->values_.emplace_back(std::move(value2));
+            insert_rows->emplace_back(insert_row.release());
+        }
+        QueryResult result = infinity->Insert("default_db", "row_insert", insert_rows);
+        if (!result.IsOk()) {
+            std::cout << "Insert failed: " << result.ErrorMsg() << std::endl;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<f64>(end - begin).count();
+}
+
+f64 ColumnarInsert(const SharedPtr<Infinity> &infinity, const Vector<f32> &embeddings) {
+    auto begin = std::chrono::steady_clock::now();
+    for (SizeT batch = 0; batch < kBatchCount; ++batch) {
+        // The client side cost of building the buffers is counted as well
+        String ids(kBatchRowCount * sizeof(i32), '\0');
+        auto *id_ptr = reinterpret_cast<i32 *>(ids.data());
+        for (SizeT row = 0; row < kBatchRowCount; ++row) {
+            id_ptr[row] = batch * kBatchRowCount + row;
+        }
+        String vectors(reinterpret_cast<const char *>(embeddings.data()), embeddings.size() * sizeof(f32));
+        QueryResult result = infinity->InsertColumns("default_db", "columnar_insert", {"c1", "c2"}, {std::move(ids), std::move(vectors)}, kBatchRowCount);
+        if (!result.IsOk()) {
+            std::cout << "InsertColumns failed: " << result.ErrorMsg() << std::endl;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<f64>(end - begin).count();
+}
+
+} // namespace
+
+int main() {
+    String path = "/var/infinity";
+    VirtualStore::CleanupDirectory(path);
+    Infinity::LocalInit(path);
+
+    std::cout << ">>> Columnar Insert Benchmark Start <<<" << std::endl;
+
+    Vector<f32> embeddings(kBatchRowCount * kDimension);
+    {
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<f32> dist(-1.0f, 1.0f);
+        for (auto &value : embeddings) {
+            value = dist(rng);
+        }
+    }
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    RunQuery(infinity, fmt::format("CREATE TABLE row_insert (c1 INT, c2 EMBEDDING(FLOAT, {}))", kDimension));
+    RunQuery(infinity, fmt::format("CREATE TABLE columnar_insert (c1 INT, c2 EMBEDDING(FLOAT, {}))", kDimension));
+
+    SizeT total_row_count = kBatchRowCount * kBatchCount;
+    f64 row_seconds = RowInsert(infinity, embeddings);
+    std::cout << fmt::format("-> Insert: {} rows in {:.3f}s, {:.0f} rows/s", total_row_count, row_seconds, total_row_count / row_seconds)
+              << std::endl;
+    f64 columnar_seconds = ColumnarInsert(infinity, embeddings);
+    std::cout << fmt::format("-> InsertColumns: {} rows in {:.3f}s, {:.0f} rows/s",
+                             total_row_count,
+                             columnar_seconds,
+                             total_row_count / columnar_seconds)
+              << std::endl;
+    infinity->LocalDisconnect();
+
+    Infinity::LocalUnInit();
+    std::cout << ">>> Columnar Insert Benchmark End <<<" << std::endl;
+    return 0;
+}
@@ -32,6 +32,7 @@ enum class ModeType : i8 {
     BUILD,
     QUERY,
     COMPRESS,
+    BUILD_BENCH,
 };
 
 enum class BenchmarkType : i8 {
@@ -74,7 +75,7 @@ public:
     }
 
     void Parse(int argc, char *argv[]) {
-        Map<String, ModeType> mode_map = {{"build", ModeType::BUILD}, {"query", ModeType::QUERY}, {"compress", ModeType::COMPRESS}};
+        Map<String, ModeType> mode_map = {{"build", ModeType::BUILD}, {"query", ModeType::QUERY}, {"compress", ModeType::COMPRESS}, {"build_bench", ModeType::BUILD_BENCH}};
         Map<String, BenchmarkType> benchmark_type_map = {{"sift", BenchmarkType::SIFT}, {"gist", BenchmarkType::GIST}};
         Map<String, BuildType> build_type_map = {{"plain", BuildType::PLAIN}, {"lvq", BuildType::LVQ}, {"clvq", BuildType::CompressToLVQ}};
 
@@ -84,6 +85,7 @@ public:
             ->transform(CLI::CheckedTransformer(benchmark_type_map, CLI::ignore_case));
         app_.add_option("--build_type", build_type_, "build type")->required()->transform(CLI::CheckedTransformer(build_type_map, CLI::ignore_case));
         app_.add_option("--thread_n", thread_n_, "thread number")->required(false);
+        app_.add_option("--build_threads", build_threads_, "thread numbers to compare in build_bench mode")->required(false);
 
         app_.add_option("--chunk_size", chunk_size_, "chunk size")->required(false);
         app_.add_option("--max_chunk_num", max_chunk_num_, "max chunk size")->required(false);
@@ -125,6 +127,7 @@ public:
     BenchmarkType benchmark_type_;
     BuildType build_type_;
     SizeT thread_n_ = std::thread::hardware_concurrency();
+    Vector<SizeT> build_threads_ = {1, 2, 4, 8};
 
     SizeT chunk_size_ = 8192;
     SizeT max_chunk_num_ = 1024;
@@ -149,30 +152,21 @@ using LabelT = i32;
 using Hnsw = KnnHnsw<PlainL2VecStoreType<float>, LabelT>;
 using HnswLVQ = KnnHnsw<LVQL2VecStoreType<float, i8>, LabelT>;
 
-template <typename HnswT, typename HnswT2>
-void Build(const BenchmarkOption &option) {
-    BaseProfiler profiler;
-
-    auto [vec_num, dim, data] = benchmark::DecodeFvecsDataset<float>(option.data_path_);
-
-    profiler.Begin();
-    auto hnsw = HnswT::Make(option.chunk_size_, option.max_chunk_num_, dim, option.M_, option.ef_construction_);
-    DenseVectorIter<float, LabelT> iter(data.get(), dim, vec_num);
-    hnsw->StoreData(iter);
-    data.reset();
-
+// build the stored vertices [0, vec_num) concurrently on thread_n threads
+template <typename HnswT>
+void BuildConcurrently(HnswT &hnsw, SizeT vec_num, SizeT thread_n, bool print_progress) {
     Vector<std::thread> build_threads;
     const SizeT kBuildBucketSize = 1024;
-    SizeT bucket_size = std::max(kBuildBucketSize, vec_num / option.thread_n_);
+    SizeT bucket_size = std::max(kBuildBucketSize, (vec_num - 1) / thread_n + 1);
     SizeT bucket_num = (vec_num - 1) / bucket_size + 1;
-    assert(bucket_num <= option.thread_n_);
+    assert(bucket_num <= thread_n);
 
     for (SizeT i = 0; i < bucket_num; ++i) {
         SizeT i1 = i * bucket_size;
         SizeT i2 = std::min(i1 + bucket_size, vec_num);
         build_threads.emplace_back([&, i1, i2] {
             for (SizeT j = i1; j < i2; ++j) {
-                if (j % 10000 == 0) {
+                if (print_progress && j % 10000 == 0) {
                     std::cout << fmt::format("Build {} / {}", j, vec_num) << std::endl;
                 }
                 hnsw->Build(j);
@@ -182,7 +176,21 @@ void Build(const BenchmarkOption &option) {
     for (auto &thread : build_threads) {
         thread.join();
     }
-    build_threads.clear();
+}
+
+template <typename HnswT, typename HnswT2>
+void Build(const BenchmarkOption &option) {
+    BaseProfiler profiler;
+
+    auto [vec_num, dim, data] = benchmark::DecodeFvecsDataset<float>(option.data_path_);
+
+    profiler.Begin();
+    auto hnsw = HnswT::Make(option.chunk_size_, option.max_chunk_num_, dim, option.M_, option.ef_construction_);
+    DenseVectorIter<float, LabelT> iter(data.get(), dim, vec_num);
+    hnsw->StoreData(iter);
+    data.reset();
+
+    BuildConcurrently(hnsw, vec_num, option.thread_n_, true);
 
     profiler.End();
     std::cout << "Build time: " << profiler.ElapsedToString(1000) << std::endl;
@@ -202,6 +210,33 @@ void Build(const BenchmarkOption &option) {
     }
 }
 
+// build the same index with each thread number of --build_threads and compare the build time, the index is not saved
+template <typename HnswT>
+void BuildBench(const BenchmarkOption &option) {
+    auto [vec_num, dim, data] = benchmark::DecodeFvecsDataset<float>(option.data_path_);
+
+    f64 base_time = 0;
+    for (SizeT thread_n : option.build_threads_) {
+        if (thread_n == 0) {
+            UnrecoverableError("build thread number should be positive");
+        }
+        BaseProfiler profiler("build_bench");
+        profiler.Begin();
+        auto hnsw = HnswT::Make(option.chunk_size_, option.max_chunk_num_, dim, option.M_, option.ef_construction_);
+        DenseVectorIter<float, LabelT> iter(data.get(), dim, vec_num);
+        hnsw->StoreData(iter);
+        BuildConcurrently(hnsw, vec_num, thread_n, false);
+        profiler.End();
+
+        const f64 build_time = profiler.Elapsed() / 1e9;
+        if (base_time == 0) {
+            base_time = build_time;
+        }
+        std::cout << fmt::format("build threads: {}, build time: {:.3f}s, speedup: {:.2f}", thread_n, build_time, base_time / build_time)
+                  << std::endl;
+    }
+}
+
 template <typename HnswT>
 void Query(const BenchmarkOption &option) {
     BaseProfiler profiler;
@@ -326,6 +361,20 @@ int main(int argc, char *argv[]) {
             Compress<Hnsw, HnswLVQ>(option);
             break;
         }
+        case ModeType::BUILD_BENCH: {
+            switch (option.build_type_) {
+                case BuildType::PLAIN:
+                case BuildType::CompressToLVQ: {
+                    BuildBench<Hnsw>(option);
+                    break;
+                }
+                case BuildType::LVQ: {
+                    BuildBench<HnswLVQ>(option);
+                    break;
+                }
+            }
+            break;
+        }
     }
     return 0;
 }
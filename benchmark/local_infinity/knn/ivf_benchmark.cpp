@@ -0,0 +1,308 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Compare QPS and recall of IVF storage types on sift / gist:
+//   sq8      : scalar quantization, 8 bits
+//   pq8      : product quantization, 8-bit codes, scanned with scalar table lookups
+//   pq4      : product quantization, 4-bit codes, scanned with the PQ fast scan kernels
+// usage: ivf_benchmark --benchmark_type sift --storage pq4 --nprobe 16 --refine_factor 4
+
+#include "hnsw_benchmark_util.h"
+#include <cassert>
+#include <cstring>
+#include <set>
+
+import stl;
+import third_party;
+import compilation_config;
+import virtual_store;
+import infinity_exception;
+import profiler;
+import infinity;
+import internal_types;
+import logical_type;
+import embedding_info;
+import create_index_info;
+import query_options;
+import query_result;
+import extra_ddl_info;
+import knn_expr;
+import column_expr;
+import column_def;
+import parsed_expr;
+import search_expr;
+import function_expr;
+import statement_common;
+import data_type;
+
+using namespace infinity;
+
+enum class BenchmarkType : i8 {
+    SIFT,
+    GIST,
+};
+
+enum class StorageType : i8 {
+    SQ8,
+    PQ8,
+    PQ4,
+};
+
+String StorageTypeToString(StorageType storage_type) {
+    switch (storage_type) {
+        case StorageType::SQ8:
+            return "sq8";
+        case StorageType::PQ8:
+            return "pq8";
+        case StorageType::PQ4:
+            return "pq4";
+    }
+}
+
+struct BenchmarkOption {
+public:
+    BenchmarkOption() : app_("ivf_benchmark") {}
+
+    void Parse(int argc, char *argv[]) {
+        Map<String, BenchmarkType> benchmark_type_map = {{"sift", BenchmarkType::SIFT}, {"gist", BenchmarkType::GIST}};
+        Map<String, StorageType> storage_type_map = {{"sq8", StorageType::SQ8}, {"pq8", StorageType::PQ8}, {"pq4", StorageType::PQ4}};
+
+        app_.add_option("--benchmark_type", benchmark_type_, "benchmark type")
+            ->required()
+            ->transform(CLI::CheckedTransformer(benchmark_type_map, CLI::ignore_case));
+        app_.add_option("--storage", storage_types_, "storage types to compare")
+            ->required(false)
+            ->transform(CLI::CheckedTransformer(storage_type_map, CLI::ignore_case));
+        app_.add_option("--data_dir", data_dir_, "test data directory")->required(false);
+        app_.add_option("--infinity_path", infinity_path_, "infinity data path")->required(false);
+        app_.add_option("--nprobe", nprobe_, "nprobe")->required(false);
+        app_.add_option("--refine_factor", refine_factor_, "refine factor, 0 means no refine")->required(false);
+        app_.add_option("--test_n", test_n_, "test n")->required(false);
+
+        try {
+            app_.parse(argc, argv);
+        } catch (const CLI::ParseError &e) {
+            UnrecoverableError(e.what());
+        }
+        ParseInner();
+    }
+
+    void ParseInner() {
+        switch (benchmark_type_) {
+            case BenchmarkType::SIFT: {
+                dimension_ = 128;
+                table_name_ = "ivf_sift_benchmark";
+                data_path_ = data_dir_ / "benchmark/sift_1m/sift_base.fvecs";
+                query_path_ = data_dir_ / "benchmark/sift_1m/sift_query.fvecs";
+                groundtruth_path_ = data_dir_ / "benchmark/sift_1m/sift_groundtruth.ivecs";
+                break;
+            }
+            case BenchmarkType::GIST: {
+                dimension_ = 960;
+                table_name_ = "ivf_gist_benchmark";
+                data_path_ = data_dir_ / "benchmark/gist_1m/gist_base.fvecs";
+                query_path_ = data_dir_ / "benchmark/gist_1m/gist_query.fvecs";
+                groundtruth_path_ = data_dir_ / "benchmark/gist_1m/gist_groundtruth.ivecs";
+                break;
+            }
+        }
+        if (storage_types_.empty()) {
+            storage_types_ = {StorageType::SQ8, StorageType::PQ8, StorageType::PQ4};
+        }
+    }
+
+public:
+    BenchmarkType benchmark_type_;
+    Vector<StorageType> storage_types_;
+    Path data_dir_ = test_data_path();
+    String infinity_path_ = "/var/infinity";
+    SizeT nprobe_ = 16;
+    SizeT refine_factor_ = 0;
+    SizeT test_n_ = 1;
+
+public:
+    SizeT dimension_ = 0;
+    String table_name_;
+    Path data_path_;
+    Path query_path_;
+    Path groundtruth_path_;
+
+private:
+    CLI::App app_;
+};
+
+Vector<InitParameter *> *IndexParams(StorageType storage_type, SizeT dimension) {
+    auto *index_param_list = new Vector<InitParameter *>();
+    index_param_list->emplace_back(new InitParameter("metric", "l2"));
+    switch (storage_type) {
+        case StorageType::SQ8: {
+            index_param_list->emplace_back(new InitParameter("storage_type", "scalar_quantization"));
+            index_param_list->emplace_back(new InitParameter("scalar_quantization_bits", "8"));
+            break;
+        }
+        case StorageType::PQ8: {
+            index_param_list->emplace_back(new InitParameter("storage_type", "product_quantization"));
+            index_param_list->emplace_back(new InitParameter("product_quantization_subspace_num", std::to_string(dimension / 4)));
+            index_param_list->emplace_back(new InitParameter("product_quantization_subspace_bits", "8"));
+            break;
+        }
+        case StorageType::PQ4: {
+            // same code size as pq8
+            index_param_list->emplace_back(new InitParameter("storage_type", "product_quantization"));
+            index_param_list->emplace_back(new InitParameter("product_quantization_subspace_num", std::to_string(dimension / 2)));
+            index_param_list->emplace_back(new InitParameter("product_quantization_subspace_bits", "4"));
+            break;
+        }
+    }
+    return index_param_list;
+}
+
+int main(int argc, char *argv[]) {
+    BenchmarkOption option;
+    option.Parse(argc, argv);
+
+    for (const auto &path : {option.data_path_, option.query_path_, option.groundtruth_path_}) {
+        if (!VirtualStore::Exists(path.string())) {
+            std::cerr << "File: " << path << " doesn't exist" << std::endl;
+            return 1;
+        }
+    }
+    const SizeT dimension = option.dimension_;
+    const String db_name = "default_db";
+    const String &table_name = option.table_name_;
+    const String col_name = "col1";
+    const String index_name = "ivf_index";
+    constexpr i64 topk = 100;
+
+    auto [query_count, query_dim, queries] = benchmark::DecodeFvecsDataset<f32>(option.query_path_);
+    assert(query_dim == (i32)dimension);
+    Vector<HashSet<u64>> ground_truth_sets_10(query_count), ground_truth_sets_100(query_count);
+    {
+        auto [gt_count, gt_top_k, gt] = benchmark::DecodeFvecsDataset<i32>(option.groundtruth_path_);
+        assert(gt_count == query_count && gt_top_k == topk);
+        for (SizeT i = 0; i < gt_count; ++i) {
+            for (i32 j = 0; j < gt_top_k; ++j) {
+                const auto x = gt[i * gt_top_k + j];
+                if (j < 10) {
+                    ground_truth_sets_10[i].insert(x);
+                }
+                ground_truth_sets_100[i].insert(x);
+            }
+        }
+    }
+
+    Infinity::LocalInit(option.infinity_path_);
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    {
+        Vector<ColumnDef *> column_defs;
+        auto col_type = MakeShared<DataType>(LogicalType::kEmbedding, MakeShared<EmbeddingInfo>(EmbeddingDataType::kElemFloat, dimension));
+        column_defs.emplace_back(new ColumnDef(0, col_type, col_name, std::set<ConstraintType>()));
+        CreateTableOptions create_tb_options;
+        create_tb_options.conflict_type_ = ConflictType::kError;
+        if (infinity->CreateTable(db_name, table_name, std::move(column_defs), Vector<TableConstraint *>{}, std::move(create_tb_options)).IsOk()) {
+            ImportOptions import_options;
+            import_options.copy_file_type_ = CopyFileType::kFVECS;
+            BaseProfiler profiler;
+            profiler.Begin();
+            infinity->Import(db_name, table_name, option.data_path_.string(), import_options);
+            profiler.End();
+            std::cout << "Import data cost: " << profiler.ElapsedToString() << std::endl;
+        }
+    }
+
+    Vector<String> results;
+    for (const auto storage_type : option.storage_types_) {
+        const auto storage_name = StorageTypeToString(storage_type);
+        {
+            DropIndexOptions drop_index_options;
+            drop_index_options.conflict_type_ = ConflictType::kIgnore;
+            infinity->DropIndex(db_name, table_name, index_name, drop_index_options);
+            auto *index_info = new IndexInfo();
+            index_info->index_type_ = IndexType::kIVF;
+            index_info->column_name_ = col_name;
+            index_info->index_param_list_ = IndexParams(storage_type, dimension);
+            BaseProfiler profiler;
+            profiler.Begin();
+            auto query_result = infinity->CreateIndex(db_name, table_name, index_name, "", index_info, CreateIndexOptions());
+            profiler.End();
+            if (!query_result.IsOk()) {
+                std::cerr << "Fail to create " << storage_name << " index: " << query_result.ErrorMsg() << std::endl;
+                continue;
+            }
+            std::cout << "Create " << storage_name << " index cost: " << profiler.ElapsedToString() << std::endl;
+        }
+        for (SizeT times = 0; times < option.test_n_; ++times) {
+            Vector<Vector<u64>> query_results(query_count);
+            BaseProfiler profiler;
+            profiler.Begin();
+            for (SizeT query_idx = 0; query_idx < query_count; ++query_idx) {
+                auto *knn_expr = new KnnExpr();
+                knn_expr->dimension_ = dimension;
+                knn_expr->distance_type_ = KnnDistanceType::kL2;
+                knn_expr->topn_ = topk;
+                knn_expr->opt_params_ = new Vector<InitParameter *>();
+                knn_expr->opt_params_->push_back(new InitParameter("nprobe", std::to_string(option.nprobe_)));
+                if (option.refine_factor_ > 0) {
+                    knn_expr->opt_params_->push_back(new InitParameter("refine_factor", std::to_string(option.refine_factor_)));
+                }
+                knn_expr->embedding_data_type_ = EmbeddingDataType::kElemFloat;
+                auto *embedding_data_ptr = new f32[dimension];
+                std::memcpy(embedding_data_ptr, queries.get() + query_idx * dimension, dimension * sizeof(f32));
+                knn_expr->embedding_data_ptr_ = embedding_data_ptr;
+                auto *column_expr = new ColumnExpr();
+                column_expr->names_.emplace_back(col_name);
+                knn_expr->column_expr_ = column_expr;
+                auto *exprs = new Vector<ParsedExpr *>();
+                exprs->emplace_back(knn_expr);
+                auto *search_expr = new SearchExpr();
+                search_expr->SetExprs(exprs);
+
+                auto *output_columns = new Vector<ParsedExpr *>();
+                auto *select_rowid_expr = new FunctionExpr();
+                select_rowid_expr->func_name_ = "row_id";
+                output_columns->emplace_back(select_rowid_expr);
+                auto result =
+                    infinity->Search(db_name, table_name, search_expr, nullptr, nullptr, nullptr, output_columns, nullptr, nullptr, nullptr, false);
+                auto &column = *result.result_table_->GetDataBlockById(0)->column_vectors[0];
+                const auto *data = reinterpret_cast<const RowID *>(column.data());
+                for (SizeT i = 0; i < column.Size(); ++i) {
+                    query_results[query_idx].emplace_back(data[i].ToUint64());
+                }
+            }
+            profiler.End();
+            const f64 elapsed_s = profiler.Elapsed() / 1'000'000'000.0;
+            SizeT correct_10 = 0, correct_100 = 0;
+            for (SizeT query_idx = 0; query_idx < query_count; ++query_idx) {
+                const auto &result = query_results[query_idx];
+                for (SizeT i = 0; i < result.size(); ++i) {
+                    correct_10 += (i < 10 && ground_truth_sets_10[query_idx].contains(result[i]));
+                    correct_100 += ground_truth_sets_100[query_idx].contains(result[i]);
+                }
+            }
+            results.push_back(fmt::format("{}: nprobe = {}, refine_factor = {}, QPS = {:.1f}, R@10 = {:.3f}, R@100 = {:.3f}",
+                                          storage_name,
+                                          option.nprobe_,
+                                          option.refine_factor_,
+                                          query_count / elapsed_s,
+                                          f32(correct_10) / f32(query_count * 10),
+                                          f32(correct_100) / f32(query_count * 100)));
+        }
+    }
+
+    std::cout << ">>> IVF Benchmark End <<<" << std::endl;
+    for (const auto &item : results) {
+        std::cout << item << std::endl;
+    }
+    Infinity::LocalUnInit();
+}
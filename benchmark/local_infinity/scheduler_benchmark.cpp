@@ -0,0 +1,139 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <thread>
+
+import stl;
+import infinity;
+import third_party;
+import query_options;
+import query_result;
+import statement_common;
+import virtual_store;
+
+using namespace infinity;
+
+// Latency of short point queries while long scan and aggregate queries keep all workers busy.
+// A short query must not wait behind the long queries queued on the worker it was assigned to.
+
+namespace {
+
+constexpr SizeT kLongRowCount = 4 * 1000 * 1000;
+constexpr SizeT kShortRowCount = 1000;
+constexpr SizeT kLongThreadNum = 4;
+constexpr SizeT kShortThreadNum = 4;
+constexpr SizeT kShortQueryTimes = 2000;
+
+void RunQuery(const SharedPtr<Infinity> &infinity, const String &sql) {
+    QueryResult result = infinity->Query(sql);
+    if (!result.IsOk()) {
+        std::cout << "Query: " << sql << " failed: " << result.ErrorMsg() << std::endl;
+    }
+}
+
+void ImportRows(const SharedPtr<Infinity> &infinity, const String &table_name, SizeT row_count, const String &csv_path) {
+    {
+        std::mt19937 rng(0);
+        std::ofstream csv(csv_path);
+        for (SizeT i = 0; i < row_count; ++i) {
+            csv << i << ',' << rng() % 1000 << '\n';
+        }
+    }
+    RunQuery(infinity, fmt::format("CREATE TABLE {} (c1 INT, c2 INT)", table_name));
+    ImportOptions import_options;
+    import_options.copy_file_type_ = CopyFileType::kCSV;
+    QueryResult result = infinity->Import("default_db", table_name, csv_path, import_options);
+    if (!result.IsOk()) {
+        std::cout << "Import " << table_name << " failed: " << result.ErrorMsg() << std::endl;
+    }
+}
+
+f64 Percentile(Vector<f64> &latencies, f64 percentile) {
+    SizeT idx = std::min(latencies.size() - 1, static_cast<SizeT>(latencies.size() * percentile));
+    std::nth_element(latencies.begin(), latencies.begin() + idx, latencies.end());
+    return latencies[idx];
+}
+
+} // namespace
+
+int main() {
+    String path = "/var/infinity";
+    VirtualStore::CleanupDirectory(path);
+    Infinity::LocalInit(path);
+
+    std::cout << ">>> Scheduler Benchmark Start <<<" << std::endl;
+    {
+        SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+        ImportRows(infinity, "long_table", kLongRowCount, "/var/infinity/scheduler_benchmark_long.csv");
+        ImportRows(infinity, "short_table", kShortRowCount, "/var/infinity/scheduler_benchmark_short.csv");
+        infinity->LocalDisconnect();
+    }
+
+    std::atomic_bool stop{false};
+    std::atomic<SizeT> long_query_count{0};
+    Vector<std::thread> long_threads;
+    for (SizeT i = 0; i < kLongThreadNum; ++i) {
+        long_threads.emplace_back([&]() {
+            SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+            while (!stop) {
+                RunQuery(infinity, "SELECT c2, SUM(c1) FROM long_table WHERE c1 % 7 = 3 GROUP BY c2");
+                ++long_query_count;
+            }
+            infinity->LocalDisconnect();
+        });
+    }
+
+    Vector<Vector<f64>> thread_latencies(kShortThreadNum);
+    Vector<std::thread> short_threads;
+    for (SizeT i = 0; i < kShortThreadNum; ++i) {
+        short_threads.emplace_back([&, i]() {
+            SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+            for (SizeT j = 0; j < kShortQueryTimes / kShortThreadNum; ++j) {
+                auto begin = std::chrono::steady_clock::now();
+                RunQuery(infinity, fmt::format("SELECT c2 FROM short_table WHERE c1 = {}", j % kShortRowCount));
+                auto end = std::chrono::steady_clock::now();
+                thread_latencies[i].push_back(std::chrono::duration<f64, std::milli>(end - begin).count());
+            }
+            infinity->LocalDisconnect();
+        });
+    }
+    for (auto &thread : short_threads) {
+        thread.join();
+    }
+    stop = true;
+    for (auto &thread : long_threads) {
+        thread.join();
+    }
+
+    Vector<f64> latencies;
+    for (auto &thread_latency : thread_latencies) {
+        latencies.insert(latencies.end(), thread_latency.begin(), thread_latency.end());
+    }
+    std::cout << fmt::format("-> Long queries finished: {}", long_query_count.load()) << std::endl;
+    std::cout << fmt::format("-> Short query latency p50: {:.3f}ms, p99: {:.3f}ms, max: {:.3f}ms",
+                             Percentile(latencies, 0.5),
+                             Percentile(latencies, 0.99),
+                             *std::max_element(latencies.begin(), latencies.end()))
+              << std::endl;
+
+    Infinity::LocalUnInit();
+    std::cout << ">>> Scheduler Benchmark End <<<" << std::endl;
+    return 0;
+}
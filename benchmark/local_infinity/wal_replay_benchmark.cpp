@@ -0,0 +1,119 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+
+import stl;
+import infinity;
+import third_party;
+import query_result;
+import virtual_store;
+
+using namespace infinity;
+
+// Startup time of replaying the same wal with different wal_replay_threads.
+// Checkpoints are disabled, so all the committed transactions are replayed from the wal at startup.
+
+namespace {
+
+constexpr SizeT kTableCount = 8;
+constexpr SizeT kTxnCountPerTable = 2000;
+constexpr SizeT kRowCountPerTxn = 16;
+
+const String kPath = "/var/infinity/wal_replay_benchmark";
+const String kBackupPath = "/var/infinity/wal_replay_benchmark_backup";
+
+String WriteConfig(i64 replay_threads) {
+    String config_path = fmt::format("/var/infinity/wal_replay_benchmark_{}.toml", replay_threads);
+    std::ofstream config(config_path);
+    config << "[general]\nversion = \"0.5.0\"\ntime_zone = \"utc-8\"\n\n";
+    config << "[network]\n\n";
+    config << fmt::format("[log]\nlog_dir = \"{}/log\"\nlog_to_stdout = false\nlog_level = \"warning\"\n\n", kPath);
+    config << fmt::format("[storage]\npersistence_dir = \"{0}/persistence\"\ndata_dir = \"{0}/data\"\n\n", kPath);
+    config << fmt::format("[buffer]\ntemp_dir = \"{}/tmp\"\n\n", kPath);
+    config << fmt::format("[wal]\nwal_dir = \"{}/wal\"\n", kPath);
+    config << "delta_checkpoint_interval = \"0s\"\nfull_checkpoint_interval = \"0s\"\n";
+    config << fmt::format("wal_replay_threads = {}\n\n", replay_threads);
+    config << fmt::format("[resource]\nresource_dir = \"{}/resource\"\n", kPath);
+    return config_path;
+}
+
+void RunQuery(const SharedPtr<Infinity> &infinity, const String &sql) {
+    QueryResult result = infinity->Query(sql);
+    if (!result.IsOk()) {
+        std::cout << "Query: " << sql << " failed: " << result.ErrorMsg() << std::endl;
+    }
+}
+
+void GenerateWal(const String &config_path) {
+    Infinity::LocalInit(kPath, config_path);
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    for (SizeT table_idx = 0; table_idx < kTableCount; ++table_idx) {
+        RunQuery(infinity, fmt::format("CREATE TABLE tb{} (c1 INT, c2 VARCHAR)", table_idx));
+    }
+    // interleave the tables, the transactions of different tables are replayed in parallel
+    for (SizeT txn_idx = 0; txn_idx < kTxnCountPerTable; ++txn_idx) {
+        for (SizeT table_idx = 0; table_idx < kTableCount; ++table_idx) {
+            String sql = fmt::format("INSERT INTO tb{} VALUES ", table_idx);
+            for (SizeT row = 0; row < kRowCountPerTxn; ++row) {
+                sql += fmt::format("{}({}, 'value_{}')", row == 0 ? "" : ", ", txn_idx * kRowCountPerTxn + row, row);
+            }
+            RunQuery(infinity, sql);
+        }
+    }
+    infinity->LocalDisconnect();
+    Infinity::LocalUnInit();
+}
+
+f64 Replay(const String &config_path) {
+    // every round replays the wal generated by GenerateWal
+    VirtualStore::CleanupDirectory(kPath);
+    filesystem::copy(kBackupPath, kPath, filesystem::copy_options::recursive);
+
+    auto begin = std::chrono::steady_clock::now();
+    Infinity::LocalInit(kPath, config_path);
+    auto end = std::chrono::steady_clock::now();
+
+    SharedPtr<Infinity> infinity = Infinity::LocalConnect();
+    RunQuery(infinity, fmt::format("SELECT COUNT(*) FROM tb{}", kTableCount - 1));
+    infinity->LocalDisconnect();
+    Infinity::LocalUnInit();
+    return std::chrono::duration<f64>(end - begin).count();
+}
+
+} // namespace
+
+int main() {
+    VirtualStore::CleanupDirectory(kPath);
+    VirtualStore::CleanupDirectory(kBackupPath);
+
+    std::cout << ">>> WAL Replay Benchmark Start <<<" << std::endl;
+    SizeT txn_count = kTableCount * kTxnCountPerTable;
+    GenerateWal(WriteConfig(1));
+    filesystem::copy(kPath, kBackupPath, filesystem::copy_options::recursive);
+    std::cout << fmt::format("-> Generated wal of {} transactions, {} rows", txn_count, txn_count * kRowCountPerTxn) << std::endl;
+
+    for (i64 replay_threads : {1, 2, 4, 8}) {
+        f64 seconds = Replay(WriteConfig(replay_threads));
+        std::cout << fmt::format("-> wal_replay_threads = {}: startup in {:.3f}s, {:.0f} txns/s", replay_threads, seconds, txn_count / seconds)
+                  << std::endl;
+    }
+
+    VirtualStore::CleanupDirectory(kPath);
+    VirtualStore::CleanupDirectory(kBackupPath);
+    std::cout << ">>> WAL Replay Benchmark End <<<" << std::endl;
+    return 0;
+}
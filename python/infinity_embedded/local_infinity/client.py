@@ -190,6 +190,21 @@ class LocalInfinityClient:
                 retry += 1
         return PyErrorCode.TOO_MANY_CONNECTIONS, "insert failed with exception: " + str(inner_ex)
 
+    def insert_columns(self, db_name: str, table_name: str, column_names: list[str], column_buffers: list[bytes],
+                       row_count: int):
+        if self.client is None:
+            raise Exception("Local infinity is not connected")
+        retry = 0
+        inner_ex = None
+        while retry <= 2:
+            try:
+                res = self.client.InsertColumns(db_name, table_name, column_names, column_buffers, row_count)
+                return self.convert_res(res)
+            except Exception as ex:
+                inner_ex = ex
+                retry += 1
+        return PyErrorCode.TOO_MANY_CONNECTIONS, "insert columns failed with exception: " + str(inner_ex)
+
     def import_data(self, db_name: str, table_name: str, file_name: str, import_options):
         if self.client is None:
             raise Exception("Local infinity is not connected")
@@ -27,6 +27,7 @@ from infinity_embedded.local_infinity.query_builder import Query, InfinityLocalQ
 from infinity_embedded.local_infinity.types import build_result
 from infinity_embedded.local_infinity.utils import traverse_conditions, select_res_to_polars
 from infinity_embedded.local_infinity.utils import get_local_constant_expr_from_python_value
+from infinity_embedded.local_infinity.utils import get_column_buffer_from_python_value
 from infinity_embedded.local_infinity.utils import name_validity_check, check_valid_name, get_ordinary_info
 from infinity_embedded.table import ExplainType
 from infinity_embedded.index import InitParameter
@@ -177,6 +178,30 @@ class LocalTable():
         else:
             raise InfinityException(res.error_code, res.error_msg)
 
+    def insert_columns(self, data: dict[str, Any]):
+        # {"c1": np.array([1, 2], dtype=np.int32), "c2": ["a", "b"], "c3": np.zeros((2, 1024), dtype=np.float32)}
+        # every column is sent as one raw buffer, so no constant expression is built per value
+        column_names = []
+        column_buffers = []
+        row_count = None
+        for column_name, values in data.items():
+            column_buffer, column_row_count = get_column_buffer_from_python_value(values)
+            if row_count is not None and row_count != column_row_count:
+                raise InfinityException(ErrorCode.INVALID_PARAMETER_VALUE,
+                                        f"Column {column_name} has {column_row_count} rows, expect {row_count}")
+            row_count = column_row_count
+            column_names.append(column_name)
+            column_buffers.append(column_buffer)
+        if row_count is None:
+            raise InfinityException(ErrorCode.INSERT_WITHOUT_VALUES, "Insert without values")
+
+        res = self._conn.insert_columns(db_name=self._db_name, table_name=self._table_name, column_names=column_names,
+                                        column_buffers=column_buffers, row_count=row_count)
+        if res.error_code == ErrorCode.OK:
+            return res
+        else:
+            raise InfinityException(res.error_code, res.error_msg)
+
     def import_data(self, file_path: str, import_options: {} = None):
         options = ImportOptions()
         options.header = False
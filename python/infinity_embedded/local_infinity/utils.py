@@ -13,6 +13,7 @@
 # limitations under the License.
 
 import re
+import struct
 import functools
 import inspect
 from typing import Any
@@ -223,6 +224,26 @@ def get_search_optional_filter_from_opt_params(opt_params: dict):
     return optional_filter
 
 
+def get_column_buffer_from_python_value(values) -> tuple[bytes, int]:
+    # encode one column of insert_columns, returns (buffer, row_count)
+    # numpy arrays are sent as little-endian raw values, one row per entry of the first axis,
+    # list of strings as int32 byte length followed by the utf-8 bytes of each string
+    if isinstance(values, np.ndarray):
+        if values.ndim == 0 or values.shape[0] == 0:
+            raise InfinityException(ErrorCode.INSERT_WITHOUT_VALUES, "Column values are empty")
+        values = np.ascontiguousarray(values, dtype=values.dtype.newbyteorder('<'))
+        return values.tobytes(), values.shape[0]
+    if isinstance(values, list) and len(values) > 0 and all(isinstance(v, str) for v in values):
+        parts = []
+        for v in values:
+            encoded = v.encode('utf-8')
+            parts.append(struct.pack('<i', len(encoded)))
+            parts.append(encoded)
+        return b''.join(parts), len(values)
+    raise InfinityException(ErrorCode.INVALID_PARAMETER_VALUE,
+                            f"Column values should be a numpy array or a list of strings, but get {type(values)}")
+
+
 def get_local_constant_expr_from_python_value(value) -> WrapConstantExpr:
     # convert numpy types
     if isinstance(value, np.integer):
@@ -1,5 +1,6 @@
 import re
 import time
+import base64
 
 import requests
 import logging
@@ -599,6 +600,20 @@ class table_http:
         self.net.raise_exception(r)
         return database_result()
 
+    def insert_columns(self, data={}):
+        from infinity.remote_thrift.utils import get_column_buffer_from_python_value
+        columns = []
+        row_count = 0
+        for column_name, column_values in data.items():
+            column_buffer, row_count = get_column_buffer_from_python_value(column_values)
+            columns.append({"name": column_name, "data": base64.b64encode(column_buffer).decode("ascii")})
+
+        url = f"databases/{self.database_name}/tables/{self.table_name}/columnar_docs"
+        h = self.net.set_up_header(["accept", "content-type"])
+        r = self.net.request(url, "post", h, {"row_count": row_count, "columns": columns})
+        self.net.raise_exception(r)
+        return database_result()
+
     def import_data(self, data_path="/home/infiniflow/Documents/development/infinity/test/data/csv/pysdk_test.csv",
                     import_options={}):
         data = {}
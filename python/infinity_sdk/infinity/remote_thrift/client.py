@@ -244,6 +244,18 @@ class ThriftInfinityClient:
             )
         )
 
+    @retry_wrapper
+    def insert_columns(self, db_name: str, table_name: str, column_fields: list[ColumnField], row_count: int):
+        return self.client.ColumnarInsert(
+            ColumnarInsertRequest(
+                session_id=self.session_id,
+                db_name=db_name,
+                table_name=table_name,
+                column_fields=column_fields,
+                row_count=row_count,
+            )
+        )
+
     @retry_wrapper
     def import_data(self, db_name: str, table_name: str, file_name: str, import_options):
         return self.client.Import(ImportRequest(session_id=self.session_id,
@@ -6147,6 +6147,120 @@ class InsertRequest(object):
         return not (self == other)
 
 
+class ColumnarInsertRequest(object):
+    """
+    Attributes:
+     - db_name
+     - table_name
+     - column_fields
+     - row_count
+     - session_id
+
+    """
+
+
+    def __init__(self, db_name=None, table_name=None, column_fields=[
+    ], row_count=None, session_id=None,):
+        self.db_name = db_name
+        self.table_name = table_name
+        if column_fields is self.thrift_spec[3][4]:
+            column_fields = [
+            ]
+        self.column_fields = column_fields
+        self.row_count = row_count
+        self.session_id = session_id
+
+    def read(self, iprot):
+        if iprot._fast_decode is not None and isinstance(iprot.trans, TTransport.CReadableTransport) and self.thrift_spec is not None:
+            iprot._fast_decode(self, iprot, [self.__class__, self.thrift_spec])
+            return
+        iprot.readStructBegin()
+        while True:
+            (fname, ftype, fid) = iprot.readFieldBegin()
+            if ftype == TType.STOP:
+                break
+            if fid == 1:
+                if ftype == TType.STRING:
+                    self.db_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 2:
+                if ftype == TType.STRING:
+                    self.table_name = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 3:
+                if ftype == TType.LIST:
+                    self.column_fields = []
+                    (_etype311, _size308) = iprot.readListBegin()
+                    for _i312 in range(_size308):
+                        _elem313 = ColumnField()
+                        _elem313.read(iprot)
+                        self.column_fields.append(_elem313)
+                    iprot.readListEnd()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 4:
+                if ftype == TType.I64:
+                    self.row_count = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            elif fid == 5:
+                if ftype == TType.I64:
+                    self.session_id = iprot.readI64()
+                else:
+                    iprot.skip(ftype)
+            else:
+                iprot.skip(ftype)
+            iprot.readFieldEnd()
+        iprot.readStructEnd()
+
+    def write(self, oprot):
+        if oprot._fast_encode is not None and self.thrift_spec is not None:
+            oprot.trans.write(oprot._fast_encode(self, [self.__class__, self.thrift_spec]))
+            return
+        oprot.writeStructBegin('ColumnarInsertRequest')
+        if self.db_name is not None:
+            oprot.writeFieldBegin('db_name', TType.STRING, 1)
+            oprot.writeString(self.db_name.encode('utf-8') if sys.version_info[0] == 2 else self.db_name)
+            oprot.writeFieldEnd()
+        if self.table_name is not None:
+            oprot.writeFieldBegin('table_name', TType.STRING, 2)
+            oprot.writeString(self.table_name.encode('utf-8') if sys.version_info[0] == 2 else self.table_name)
+            oprot.writeFieldEnd()
+        if self.column_fields is not None:
+            oprot.writeFieldBegin('column_fields', TType.LIST, 3)
+            oprot.writeListBegin(TType.STRUCT, len(self.column_fields))
+            for iter314 in self.column_fields:
+                iter314.write(oprot)
+            oprot.writeListEnd()
+            oprot.writeFieldEnd()
+        if self.row_count is not None:
+            oprot.writeFieldBegin('row_count', TType.I64, 4)
+            oprot.writeI64(self.row_count)
+            oprot.writeFieldEnd()
+        if self.session_id is not None:
+            oprot.writeFieldBegin('session_id', TType.I64, 5)
+            oprot.writeI64(self.session_id)
+            oprot.writeFieldEnd()
+        oprot.writeFieldStop()
+        oprot.writeStructEnd()
+
+    def validate(self):
+        return
+
+    def __repr__(self):
+        L = ['%s=%r' % (key, value)
+             for key, value in self.__dict__.items()]
+        return '%s(%s)' % (self.__class__.__name__, ', '.join(L))
+
+    def __eq__(self, other):
+        return isinstance(other, self.__class__) and self.__dict__ == other.__dict__
+
+    def __ne__(self, other):
+        return not (self == other)
+
+
 class ImportRequest(object):
     """
     Attributes:
@@ -6292,10 +6406,10 @@ class ExportRequest(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.columns = []
-                    (_etype311, _size308) = iprot.readListBegin()
-                    for _i312 in range(_size308):
-                        _elem313 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.columns.append(_elem313)
+                    (_etype318, _size315) = iprot.readListBegin()
+                    for _i319 in range(_size315):
+                        _elem320 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.columns.append(_elem320)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -6336,8 +6450,8 @@ class ExportRequest(object):
         if self.columns is not None:
             oprot.writeFieldBegin('columns', TType.LIST, 3)
             oprot.writeListBegin(TType.STRING, len(self.columns))
-            for iter314 in self.columns:
-                oprot.writeString(iter314.encode('utf-8') if sys.version_info[0] == 2 else iter314)
+            for iter321 in self.columns:
+                oprot.writeString(iter321.encode('utf-8') if sys.version_info[0] == 2 else iter321)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.file_name is not None:
@@ -6448,22 +6562,22 @@ class ExplainRequest(object):
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.select_list = []
-                    (_etype318, _size315) = iprot.readListBegin()
-                    for _i319 in range(_size315):
-                        _elem320 = ParsedExpr()
-                        _elem320.read(iprot)
-                        self.select_list.append(_elem320)
+                    (_etype325, _size322) = iprot.readListBegin()
+                    for _i326 in range(_size322):
+                        _elem327 = ParsedExpr()
+                        _elem327.read(iprot)
+                        self.select_list.append(_elem327)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 5:
                 if ftype == TType.LIST:
                     self.highlight_list = []
-                    (_etype324, _size321) = iprot.readListBegin()
-                    for _i325 in range(_size321):
-                        _elem326 = ParsedExpr()
-                        _elem326.read(iprot)
-                        self.highlight_list.append(_elem326)
+                    (_etype331, _size328) = iprot.readListBegin()
+                    for _i332 in range(_size328):
+                        _elem333 = ParsedExpr()
+                        _elem333.read(iprot)
+                        self.highlight_list.append(_elem333)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -6482,11 +6596,11 @@ class ExplainRequest(object):
             elif fid == 8:
                 if ftype == TType.LIST:
                     self.group_by_list = []
-                    (_etype330, _size327) = iprot.readListBegin()
-                    for _i331 in range(_size327):
-                        _elem332 = ParsedExpr()
-                        _elem332.read(iprot)
-                        self.group_by_list.append(_elem332)
+                    (_etype337, _size334) = iprot.readListBegin()
+                    for _i338 in range(_size334):
+                        _elem339 = ParsedExpr()
+                        _elem339.read(iprot)
+                        self.group_by_list.append(_elem339)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -6511,11 +6625,11 @@ class ExplainRequest(object):
             elif fid == 12:
                 if ftype == TType.LIST:
                     self.order_by_list = []
-                    (_etype336, _size333) = iprot.readListBegin()
-                    for _i337 in range(_size333):
-                        _elem338 = OrderByExpr()
-                        _elem338.read(iprot)
-                        self.order_by_list.append(_elem338)
+                    (_etype343, _size340) = iprot.readListBegin()
+                    for _i344 in range(_size340):
+                        _elem345 = OrderByExpr()
+                        _elem345.read(iprot)
+                        self.order_by_list.append(_elem345)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -6549,15 +6663,15 @@ class ExplainRequest(object):
         if self.select_list is not None:
             oprot.writeFieldBegin('select_list', TType.LIST, 4)
             oprot.writeListBegin(TType.STRUCT, len(self.select_list))
-            for iter339 in self.select_list:
-                iter339.write(oprot)
+            for iter346 in self.select_list:
+                iter346.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.highlight_list is not None:
             oprot.writeFieldBegin('highlight_list', TType.LIST, 5)
             oprot.writeListBegin(TType.STRUCT, len(self.highlight_list))
-            for iter340 in self.highlight_list:
-                iter340.write(oprot)
+            for iter347 in self.highlight_list:
+                iter347.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.search_expr is not None:
@@ -6571,8 +6685,8 @@ class ExplainRequest(object):
         if self.group_by_list is not None:
             oprot.writeFieldBegin('group_by_list', TType.LIST, 8)
             oprot.writeListBegin(TType.STRUCT, len(self.group_by_list))
-            for iter341 in self.group_by_list:
-                iter341.write(oprot)
+            for iter348 in self.group_by_list:
+                iter348.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.having_expr is not None:
@@ -6590,8 +6704,8 @@ class ExplainRequest(object):
         if self.order_by_list is not None:
             oprot.writeFieldBegin('order_by_list', TType.LIST, 12)
             oprot.writeListBegin(TType.STRUCT, len(self.order_by_list))
-            for iter342 in self.order_by_list:
-                iter342.write(oprot)
+            for iter349 in self.order_by_list:
+                iter349.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.explain_type is not None:
@@ -6663,22 +6777,22 @@ class ExplainResponse(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.column_defs = []
-                    (_etype346, _size343) = iprot.readListBegin()
-                    for _i347 in range(_size343):
-                        _elem348 = ColumnDef()
-                        _elem348.read(iprot)
-                        self.column_defs.append(_elem348)
+                    (_etype353, _size350) = iprot.readListBegin()
+                    for _i354 in range(_size350):
+                        _elem355 = ColumnDef()
+                        _elem355.read(iprot)
+                        self.column_defs.append(_elem355)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.column_fields = []
-                    (_etype352, _size349) = iprot.readListBegin()
-                    for _i353 in range(_size349):
-                        _elem354 = ColumnField()
-                        _elem354.read(iprot)
-                        self.column_fields.append(_elem354)
+                    (_etype359, _size356) = iprot.readListBegin()
+                    for _i360 in range(_size356):
+                        _elem361 = ColumnField()
+                        _elem361.read(iprot)
+                        self.column_fields.append(_elem361)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -6703,15 +6817,15 @@ class ExplainResponse(object):
         if self.column_defs is not None:
             oprot.writeFieldBegin('column_defs', TType.LIST, 3)
             oprot.writeListBegin(TType.STRUCT, len(self.column_defs))
-            for iter355 in self.column_defs:
-                iter355.write(oprot)
+            for iter362 in self.column_defs:
+                iter362.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.column_fields is not None:
             oprot.writeFieldBegin('column_fields', TType.LIST, 4)
             oprot.writeListBegin(TType.STRUCT, len(self.column_fields))
-            for iter356 in self.column_fields:
-                iter356.write(oprot)
+            for iter363 in self.column_fields:
+                iter363.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         oprot.writeFieldStop()
@@ -6810,22 +6924,22 @@ class SelectRequest(object):
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.select_list = []
-                    (_etype360, _size357) = iprot.readListBegin()
-                    for _i361 in range(_size357):
-                        _elem362 = ParsedExpr()
-                        _elem362.read(iprot)
-                        self.select_list.append(_elem362)
+                    (_etype367, _size364) = iprot.readListBegin()
+                    for _i368 in range(_size364):
+                        _elem369 = ParsedExpr()
+                        _elem369.read(iprot)
+                        self.select_list.append(_elem369)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 5:
                 if ftype == TType.LIST:
                     self.highlight_list = []
-                    (_etype366, _size363) = iprot.readListBegin()
-                    for _i367 in range(_size363):
-                        _elem368 = ParsedExpr()
-                        _elem368.read(iprot)
-                        self.highlight_list.append(_elem368)
+                    (_etype373, _size370) = iprot.readListBegin()
+                    for _i374 in range(_size370):
+                        _elem375 = ParsedExpr()
+                        _elem375.read(iprot)
+                        self.highlight_list.append(_elem375)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -6844,11 +6958,11 @@ class SelectRequest(object):
             elif fid == 8:
                 if ftype == TType.LIST:
                     self.group_by_list = []
-                    (_etype372, _size369) = iprot.readListBegin()
-                    for _i373 in range(_size369):
-                        _elem374 = ParsedExpr()
-                        _elem374.read(iprot)
-                        self.group_by_list.append(_elem374)
+                    (_etype379, _size376) = iprot.readListBegin()
+                    for _i380 in range(_size376):
+                        _elem381 = ParsedExpr()
+                        _elem381.read(iprot)
+                        self.group_by_list.append(_elem381)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -6873,11 +6987,11 @@ class SelectRequest(object):
             elif fid == 12:
                 if ftype == TType.LIST:
                     self.order_by_list = []
-                    (_etype378, _size375) = iprot.readListBegin()
-                    for _i379 in range(_size375):
-                        _elem380 = OrderByExpr()
-                        _elem380.read(iprot)
-                        self.order_by_list.append(_elem380)
+                    (_etype385, _size382) = iprot.readListBegin()
+                    for _i386 in range(_size382):
+                        _elem387 = OrderByExpr()
+                        _elem387.read(iprot)
+                        self.order_by_list.append(_elem387)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -6911,15 +7025,15 @@ class SelectRequest(object):
         if self.select_list is not None:
             oprot.writeFieldBegin('select_list', TType.LIST, 4)
             oprot.writeListBegin(TType.STRUCT, len(self.select_list))
-            for iter381 in self.select_list:
-                iter381.write(oprot)
+            for iter388 in self.select_list:
+                iter388.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.highlight_list is not None:
             oprot.writeFieldBegin('highlight_list', TType.LIST, 5)
             oprot.writeListBegin(TType.STRUCT, len(self.highlight_list))
-            for iter382 in self.highlight_list:
-                iter382.write(oprot)
+            for iter389 in self.highlight_list:
+                iter389.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.search_expr is not None:
@@ -6933,8 +7047,8 @@ class SelectRequest(object):
         if self.group_by_list is not None:
             oprot.writeFieldBegin('group_by_list', TType.LIST, 8)
             oprot.writeListBegin(TType.STRUCT, len(self.group_by_list))
-            for iter383 in self.group_by_list:
-                iter383.write(oprot)
+            for iter390 in self.group_by_list:
+                iter390.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.having_expr is not None:
@@ -6952,8 +7066,8 @@ class SelectRequest(object):
         if self.order_by_list is not None:
             oprot.writeFieldBegin('order_by_list', TType.LIST, 12)
             oprot.writeListBegin(TType.STRUCT, len(self.order_by_list))
-            for iter384 in self.order_by_list:
-                iter384.write(oprot)
+            for iter391 in self.order_by_list:
+                iter391.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.total_hits_count is not None:
@@ -7027,22 +7141,22 @@ class SelectResponse(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.column_defs = []
-                    (_etype388, _size385) = iprot.readListBegin()
-                    for _i389 in range(_size385):
-                        _elem390 = ColumnDef()
-                        _elem390.read(iprot)
-                        self.column_defs.append(_elem390)
+                    (_etype395, _size392) = iprot.readListBegin()
+                    for _i396 in range(_size392):
+                        _elem397 = ColumnDef()
+                        _elem397.read(iprot)
+                        self.column_defs.append(_elem397)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.column_fields = []
-                    (_etype394, _size391) = iprot.readListBegin()
-                    for _i395 in range(_size391):
-                        _elem396 = ColumnField()
-                        _elem396.read(iprot)
-                        self.column_fields.append(_elem396)
+                    (_etype401, _size398) = iprot.readListBegin()
+                    for _i402 in range(_size398):
+                        _elem403 = ColumnField()
+                        _elem403.read(iprot)
+                        self.column_fields.append(_elem403)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -7072,15 +7186,15 @@ class SelectResponse(object):
         if self.column_defs is not None:
             oprot.writeFieldBegin('column_defs', TType.LIST, 3)
             oprot.writeListBegin(TType.STRUCT, len(self.column_defs))
-            for iter397 in self.column_defs:
-                iter397.write(oprot)
+            for iter404 in self.column_defs:
+                iter404.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.column_fields is not None:
             oprot.writeFieldBegin('column_fields', TType.LIST, 4)
             oprot.writeListBegin(TType.STRUCT, len(self.column_fields))
-            for iter398 in self.column_fields:
-                iter398.write(oprot)
+            for iter405 in self.column_fields:
+                iter405.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.extra_result is not None:
@@ -7326,11 +7440,11 @@ class UpdateRequest(object):
             elif fid == 4:
                 if ftype == TType.LIST:
                     self.update_expr_array = []
-                    (_etype402, _size399) = iprot.readListBegin()
-                    for _i403 in range(_size399):
-                        _elem404 = UpdateExpr()
-                        _elem404.read(iprot)
-                        self.update_expr_array.append(_elem404)
+                    (_etype409, _size406) = iprot.readListBegin()
+                    for _i410 in range(_size406):
+                        _elem411 = UpdateExpr()
+                        _elem411.read(iprot)
+                        self.update_expr_array.append(_elem411)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -7364,8 +7478,8 @@ class UpdateRequest(object):
         if self.update_expr_array is not None:
             oprot.writeFieldBegin('update_expr_array', TType.LIST, 4)
             oprot.writeListBegin(TType.STRUCT, len(self.update_expr_array))
-            for iter405 in self.update_expr_array:
-                iter405.write(oprot)
+            for iter412 in self.update_expr_array:
+                iter412.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.session_id is not None:
@@ -7433,11 +7547,11 @@ class AddColumnsRequest(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.column_defs = []
-                    (_etype409, _size406) = iprot.readListBegin()
-                    for _i410 in range(_size406):
-                        _elem411 = ColumnDef()
-                        _elem411.read(iprot)
-                        self.column_defs.append(_elem411)
+                    (_etype416, _size413) = iprot.readListBegin()
+                    for _i417 in range(_size413):
+                        _elem418 = ColumnDef()
+                        _elem418.read(iprot)
+                        self.column_defs.append(_elem418)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -7467,8 +7581,8 @@ class AddColumnsRequest(object):
         if self.column_defs is not None:
             oprot.writeFieldBegin('column_defs', TType.LIST, 3)
             oprot.writeListBegin(TType.STRUCT, len(self.column_defs))
-            for iter412 in self.column_defs:
-                iter412.write(oprot)
+            for iter419 in self.column_defs:
+                iter419.write(oprot)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.session_id is not None:
@@ -7536,10 +7650,10 @@ class DropColumnsRequest(object):
             elif fid == 3:
                 if ftype == TType.LIST:
                     self.column_names = []
-                    (_etype416, _size413) = iprot.readListBegin()
-                    for _i417 in range(_size413):
-                        _elem418 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
-                        self.column_names.append(_elem418)
+                    (_etype423, _size420) = iprot.readListBegin()
+                    for _i424 in range(_size420):
+                        _elem425 = iprot.readString().decode('utf-8', errors='replace') if sys.version_info[0] == 2 else iprot.readString()
+                        self.column_names.append(_elem425)
                     iprot.readListEnd()
                 else:
                     iprot.skip(ftype)
@@ -7569,8 +7683,8 @@ class DropColumnsRequest(object):
         if self.column_names is not None:
             oprot.writeFieldBegin('column_names', TType.LIST, 3)
             oprot.writeListBegin(TType.STRING, len(self.column_names))
-            for iter419 in self.column_names:
-                oprot.writeString(iter419.encode('utf-8') if sys.version_info[0] == 2 else iter419)
+            for iter426 in self.column_names:
+                oprot.writeString(iter426.encode('utf-8') if sys.version_info[0] == 2 else iter426)
             oprot.writeListEnd()
             oprot.writeFieldEnd()
         if self.session_id is not None:
@@ -9424,6 +9538,16 @@ InsertRequest.thrift_spec = (
     ], ),  # 3
     (4, TType.I64, 'session_id', None, None, ),  # 4
 )
+all_structs.append(ColumnarInsertRequest)
+ColumnarInsertRequest.thrift_spec = (
+    None,  # 0
+    (1, TType.STRING, 'db_name', 'UTF8', None, ),  # 1
+    (2, TType.STRING, 'table_name', 'UTF8', None, ),  # 2
+    (3, TType.LIST, 'column_fields', (TType.STRUCT, [ColumnField, None], False), [
+    ], ),  # 3
+    (4, TType.I64, 'row_count', None, None, ),  # 4
+    (5, TType.I64, 'session_id', None, None, ),  # 5
+)
 all_structs.append(ImportRequest)
 ImportRequest.thrift_spec = (
     None,  # 0
@@ -29,6 +29,7 @@ from infinity.remote_thrift.utils import (
     select_res_to_polars,
     check_valid_name,
     get_remote_constant_expr_from_python_value,
+    get_column_buffer_from_python_value,
     get_ordinary_info,
 )
 from infinity.table import ExplainType
@@ -194,6 +195,32 @@ class RemoteTable():
         else:
             raise InfinityException(res.error_code, res.error_msg)
 
+    def insert_columns(self, data: dict[str, Any]):
+        # {"c1": np.array([1, 2], dtype=np.int32), "c2": ["a", "b"], "c3": np.zeros((2, 1024), dtype=np.float32)}
+        # every column is sent as one raw buffer, so no constant expression is built per value
+        column_names = []
+        column_buffers = []
+        row_count = None
+        for column_name, values in data.items():
+            column_buffer, column_row_count = get_column_buffer_from_python_value(values)
+            if row_count is not None and row_count != column_row_count:
+                raise InfinityException(ErrorCode.INVALID_PARAMETER_VALUE,
+                                        f"Column {column_name} has {column_row_count} rows, expect {row_count}")
+            row_count = column_row_count
+            column_names.append(column_name)
+            column_buffers.append(column_buffer)
+        if row_count is None:
+            raise InfinityException(ErrorCode.INSERT_WITHOUT_VALUES, "Insert without values")
+
+        column_fields = [ttypes.ColumnField(column_name=column_name, column_vectors=[column_buffer])
+                         for column_name, column_buffer in zip(column_names, column_buffers)]
+        res = self._conn.insert_columns(db_name=self._db_name, table_name=self._table_name,
+                                        column_fields=column_fields, row_count=row_count)
+        if res.error_code == ErrorCode.OK:
+            return res
+        else:
+            raise InfinityException(res.error_code, res.error_msg)
+
     def import_data(self, file_path: str, import_options: {} = None):
         options = ttypes.ImportOption()
         options.has_header = False
@@ -0,0 +1,64 @@
+import infinity
+from infinity_runner import InfinityRunner, infinity_runner_decorator_factory
+from common import common_values
+from infinity import index
+from infinity.common import ConflictType
+
+
+class TestDiskAnn:
+    def test_restart_after_diskann_checkpoint(self, infinity_runner: InfinityRunner):
+        table_name = "test_diskann"
+        config = "test/data/config/restart_test/test_diskann/1.toml"
+        uri = common_values.TEST_LOCAL_HOST
+        infinity_runner.clear()
+
+        decorator = infinity_runner_decorator_factory(config, uri, infinity_runner)
+
+        # more rows than the 256 pq centers, so the segment is built into a diskann chunk instead of searched by brute force
+        row_count = 300
+        query = [100.2, 100.2, 100.2, 100.2]
+
+        def check_search(table_obj):
+            data_dict, _, _ = (
+                table_obj.output(["c1"])
+                .match_dense("c2", query, "float", "l2", 3, {"search_l": "50", "beam_width": "2"})
+                .to_result()
+            )
+            assert data_dict["c1"] == [100, 101, 99]
+
+        @decorator
+        def part1(infinity_obj):
+            db_obj = infinity_obj.get_database("default_db")
+            db_obj.drop_table(table_name, ConflictType.Ignore)
+            table_obj = db_obj.create_table(
+                table_name,
+                {"c1": {"type": "int"}, "c2": {"type": "vector,4,float"}},
+            )
+            table_obj.insert([{"c1": i, "c2": [float(i)] * 4} for i in range(row_count)])
+            res = table_obj.create_index(
+                "idx1",
+                index.IndexInfo(
+                    "c2",
+                    index.IndexType.DiskAnn,
+                    {"R": "16", "L": "50", "num_pq_chunks": "4", "metric": "l2"},
+                ),
+            )
+            assert res.error_code == infinity.ErrorCode.OK
+            check_search(table_obj)
+
+            # save the index file, the index is loaded from it after restart
+            infinity_obj.flush_data()
+
+        part1()
+
+        @decorator
+        def part2(infinity_obj):
+            db_obj = infinity_obj.get_database("default_db")
+            table_obj = db_obj.get_table(table_name)
+            data_dict, _, _ = table_obj.output(["count(*)"]).to_result()
+            assert data_dict["count(star)"] == [row_count]
+            check_search(table_obj)
+
+            db_obj.drop_table(table_name)
+
+        part2()
@@ -694,6 +694,42 @@ class TestInfinity:
         res = db_obj.drop_table("python_test_insert_rows_mismatch"+suffix, ConflictType.Error)
         assert res.error_code == ErrorCode.OK
 
+    def test_insert_columns(self, suffix):
+        db_obj = self.infinity_obj.get_database("default_db")
+        db_obj.drop_table("python_test_insert_columns" + suffix, ConflictType.Ignore)
+        table_obj = db_obj.create_table("python_test_insert_columns" + suffix,
+                                        {"num": {"type": "integer"},
+                                         "body": {"type": "varchar"},
+                                         "vec": {"type": "vector,2,float"}},
+                                        ConflictType.Error)
+        assert table_obj
+        res = table_obj.insert_columns({"num": np.array([1, 2, 3], dtype=np.int32),
+                                        "body": ["a", "", "unicode 中文"],
+                                        "vec": np.array([[1.0, 2.0], [3.0, 4.0], [5.0, 6.0]], dtype=np.float32)})
+        assert res.error_code == ErrorCode.OK
+        res, extra_result = table_obj.output(["*"]).to_df()
+        print(res)
+        pd.testing.assert_frame_equal(res, pd.DataFrame(
+            {'num': (1, 2, 3), 'body': ("a", "", "unicode 中文"), 'vec': ([1.0, 2.0], [3.0, 4.0], [5.0, 6.0])}).astype(
+            {'num': dtype('int32')}))
+
+        # row count of the columns differs
+        with pytest.raises(InfinityException) as e:
+            table_obj.insert_columns({"num": np.array([1, 2], dtype=np.int32),
+                                      "body": ["a", "b", "c"],
+                                      "vec": np.zeros((2, 2), dtype=np.float32)})
+        assert e.value.args[0] == ErrorCode.INVALID_PARAMETER_VALUE
+
+        # buffer size doesn't match the column type
+        with pytest.raises(InfinityException) as e:
+            table_obj.insert_columns({"num": np.array([1, 2], dtype=np.int64),
+                                      "body": ["a", "b"],
+                                      "vec": np.zeros((2, 2), dtype=np.float32)})
+        assert e.value.args[0] == ErrorCode.INVALID_PARAMETER_VALUE
+
+        res = db_obj.drop_table("python_test_insert_columns" + suffix, ConflictType.Error)
+        assert res.error_code == ErrorCode.OK
+
     @pytest.mark.parametrize("types", ["vector,16384,int", "vector,16384,float"])
     @pytest.mark.parametrize("types_examples", [[{"c1": [1] * 16384}],
                                                 [{"c1": [4] * 16384}],
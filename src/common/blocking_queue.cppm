@@ -135,6 +135,20 @@ public:
         full_cv_.notify_one();
     }
 
+    // Wait at most `timeout` for the queue to be non-empty, return false if nothing was dequeued.
+    bool DequeueBulkFor(Deque<T> &output_array, MilliSeconds timeout) {
+        {
+            std::unique_lock<std::mutex> lock(queue_mutex_);
+            if (!empty_cv_.wait_for(lock, timeout, [this] { return !queue_.empty(); })) {
+                return false;
+            }
+            output_array.swap(queue_);
+            queue_.clear();
+        }
+        full_cv_.notify_one();
+        return true;
+    }
+
     bool TryDequeue(T &task) {
         {
             std::unique_lock<std::mutex> lock(queue_mutex_);
@@ -69,6 +69,11 @@ export {
     constexpr u64 SEGMENT_MASK_IN_DOCID = 0x7FFFFF;         // it should be adjusted together with DEFAULT_SEGMENT_CAPACITY
     constexpr u32 INVALID_SEGMENT_ID = std::numeric_limits<u32>::max();
 
+    // import related constants, a big input is split into partitions which are loaded concurrently, each into its own segments
+    constexpr SizeT MIN_IMPORT_PARTITION_SIZE = 32 * 1024 * 1024;           // 32MB of csv / jsonl
+    constexpr std::string_view MIN_IMPORT_PARTITION_SIZE_STR = "32MB";      // 32MB of csv / jsonl
+    constexpr SizeT MIN_IMPORT_PARTITION_ROWS = 64 * DEFAULT_BLOCK_CAPACITY; // 512K rows of parquet
+
     // queue related constants, TODO: double check the necessary
     constexpr SizeT BG_GROUND_TASK_QUEUE_SIZE = 65536;
     constexpr SizeT EXECUTOR_TASK_QUEUE_SIZE = 1024;
@@ -116,6 +121,10 @@ export {
     constexpr std::string_view DEFAULT_WAL_FILE_SIZE_THRESHOLD_STR = "1GB";              // 1GB
     constexpr i64 MAX_WAL_FILE_SIZE_THRESHOLD = 1024l * DEFAULT_WAL_FILE_SIZE_THRESHOLD; // 1TB
 
+    constexpr i64 MIN_WAL_REPLAY_THREADS = 1;
+    constexpr i64 DEFAULT_WAL_REPLAY_THREADS = 1; // replay one by one
+    constexpr i64 MAX_WAL_REPLAY_THREADS = 256;
+
     constexpr i64 MIN_FULL_CHECKPOINT_INTERVAL_SEC = 0;                          // 0 means disable full checkpoint
     constexpr i64 DEFAULT_FULL_CHECKPOINT_INTERVAL_SEC = 30;                     // 30 seconds
     constexpr std::string_view DEFAULT_FULL_CHECKPOINT_INTERVAL_SEC_STR = "30s"; // 30 seconds
@@ -133,6 +142,8 @@ export {
 
     constexpr std::string_view WAL_FILE_TEMP_FILE = "wal.log";
     constexpr std::string_view WAL_FILE_PREFIX = "wal.log";
+    constexpr SizeT WAL_STAGING_BUFFER_SIZE = 4 * 1024l * 1024l;      // 4MB
+    constexpr SizeT WAL_STAGING_BUFFER_MAX_SIZE = 64 * 1024l * 1024l; // 64MB, shrink back after a larger batch
     constexpr std::string_view CATALOG_FILE_DIR = "catalog";
 
     constexpr std::string_view SYSTEM_DB_NAME = "system";
@@ -164,6 +175,9 @@ export {
     constexpr SizeT DISKANN_MAX_GRAPH_DEGREE = 512;   // SSD index max degree
     constexpr SizeT DISKANN_SECTOR_LEN = 4096u;       // SSD index sector size
     constexpr SizeT DISKANN_MAX_N_SECTOR_READS = 128; // SSD index max sector reads
+    constexpr u32 DISKANN_SEARCH_L = 100;             // default candidates list length of search
+    constexpr u32 DISKANN_BEAM_WIDTH = 2;             // default sectors read per search hop
+    constexpr u32 DISKANN_SEARCH_SCRATCH_NUM = 8;     // concurrent searches on one disk index
 
     // default hnsw parameter
     constexpr SizeT HNSW_M = 16;
@@ -187,11 +201,17 @@ export {
 
     constexpr SizeT DEFAULT_BUFFER_MANAGER_SIZE = 8 * 1024lu * 1024lu * 1024lu; // 8Gib
     constexpr SizeT DEFAULT_BUFFER_MANAGER_LRU_COUNT = 7;
+    constexpr SizeT DEFAULT_BUFFER_MANAGER_MAP_SHARD_COUNT = 64;
+    constexpr SizeT DEFAULT_BUFFER_PREFETCH_THREAD_NUM = 4;
+    constexpr SizeT DEFAULT_SCAN_READ_AHEAD_BLOCK_NUM = 2;
     constexpr std::string_view DEFAULT_BUFFER_MANAGER_SIZE_STR = "8GB"; // 8Gib
 
     constexpr SizeT DEFAULT_MEMINDEX_MEMORY_QUOTA = 4 * 1024lu * 1024lu * 1024lu; // 4GB
     constexpr std::string_view DEFAULT_MEMINDEX_MEMORY_QUOTA_STR = "4GB";         // 4GB
 
+    constexpr SizeT DEFAULT_JOIN_MEMORY_BUDGET = 1024lu * 1024lu * 1024lu; // 1GB
+    constexpr std::string_view DEFAULT_JOIN_MEMORY_BUDGET_STR = "1GB";     // 1GB
+
     constexpr SizeT DEFAULT_LOG_FILE_SIZE = 64 * 1024lu * 1024lu;  // 64MB
     constexpr std::string_view DEFAULT_LOG_FILE_SIZE_STR = "64MB"; // 64MB
 
@@ -199,6 +219,8 @@ export {
 
     constexpr std::string_view DEFAULT_RESULT_CACHE = "off";
     constexpr SizeT DEFAULT_CACHE_RESULT_CAPACITY = 10000;
+    constexpr SizeT DEFAULT_CACHE_RESULT_MEMORY = 1024lu * 1024lu * 1024lu; // 1GB
+    constexpr std::string_view DEFAULT_CACHE_RESULT_MEMORY_STR = "1GB";     // 1GB
 
     // default persistence parameter
     constexpr std::string_view DEFAULT_PERSISTENCE_DIR = "/var/infinity/persistence"; // Empty means disabled
@@ -210,6 +232,7 @@ export {
     constexpr std::string_view DEFAULT_OBJECT_STORAGE_DISK_CACHE_DIR = "/var/infinity/localdiskcache";
     constexpr std::string_view DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT_STR = "128GB"; // 128GB
     constexpr SizeT DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT = 128 * 1024lu * 1024lu * 1024lu; // 128GB
+    constexpr SizeT DEFAULT_OBJECT_STORAGE_DOWNLOAD_THREAD_NUM = 4;
 
     // network
     constexpr SizeT DEFAULT_HTTP_PORT = 23820;
@@ -276,8 +299,11 @@ export {
     constexpr std::string_view LRU_NUM_OPTION_NAME = "lru_num";
     constexpr std::string_view TEMP_DIR_OPTION_NAME = "temp_dir";
     constexpr std::string_view MEMINDEX_MEMORY_QUOTA_OPTION_NAME = "memindex_memory_quota";
+    constexpr std::string_view JOIN_MEMORY_BUDGET_OPTION_NAME = "join_memory_budget";
+    constexpr std::string_view IMPORT_PARTITION_SIZE_OPTION_NAME = "import_partition_size";
     constexpr std::string_view RESULT_CACHE_OPTION_NAME = "result_cache";
     constexpr std::string_view CACHE_RESULT_CAPACITY_OPTION_NAME = "cache_result_capacity";
+    constexpr std::string_view CACHE_RESULT_MEMORY_OPTION_NAME = "cache_result_memory";
     constexpr std::string_view DENSE_INDEX_BUILDING_WORKER_OPTION_NAME = "dense_index_building_worker";
     constexpr std::string_view SPARSE_INDEX_BUILDING_WORKER_OPTION_NAME = "sparse_index_building_worker";
     constexpr std::string_view FULLTEXT_INDEX_BUILDING_WORKER_OPTION_NAME = "fulltext_index_building_worker";
@@ -289,6 +315,7 @@ export {
     constexpr std::string_view DELTA_CHECKPOINT_INTERVAL_OPTION_NAME = "delta_checkpoint_interval";
     constexpr std::string_view DELTA_CHECKPOINT_THRESHOLD_OPTION_NAME = "delta_checkpoint_threshold";
     constexpr std::string_view WAL_FLUSH_OPTION_NAME = "wal_flush";
+    constexpr std::string_view WAL_REPLAY_THREADS_OPTION_NAME = "wal_replay_threads";
     constexpr std::string_view RESOURCE_DIR_OPTION_NAME = "resource_dir";
 
     constexpr std::string_view RECORD_RUNNING_QUERY_OPTION_NAME = "record_running_query";
@@ -319,8 +346,11 @@ export {
     constexpr std::string_view CPU_USAGE_VAR_NAME = "cpu_usage";                             // global
     constexpr std::string_view FOLLOWER_NUMBER_VAR_NAME = "follower_number";                          // global
     constexpr std::string_view CACHE_RESULT_NUM_VAR_NAME = "cache_result_num";               // global
+    constexpr std::string_view CACHE_RESULT_STATS_VAR_NAME = "cache_result_stats";                    // global
     constexpr std::string_view MEMORY_CACHE_MISS_VAR_NAME = "memory_cache_miss";                      // global
     constexpr std::string_view DISK_CACHE_MISS_VAR_NAME = "disk_cache_miss";                          // global
+    constexpr std::string_view WAL_FLUSH_STATS_VAR_NAME = "wal_flush_stats";                          // global
+    constexpr std::string_view BUFFER_LOAD_STATS_VAR_NAME = "buffer_load_stats";                      // global
 
     // IO related
     constexpr SizeT DEFAULT_READ_BUFFER_SIZE = 4096;
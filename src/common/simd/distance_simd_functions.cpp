@@ -85,6 +85,26 @@ f32 HammingDistance_common(const u8 *x, const u8 *y, SizeT d) {
     return result;
 }
 
+#if defined(__AVX512BW__)
+
+f32 HammingDistance_avx512(const u8 *x, const u8 *y, SizeT d) {
+    __m512i sum = _mm512_setzero_si512();
+    SizeT pos = 0;
+    // 8 * 64 = 512
+    for (; pos + 64 <= d; pos += 64) {
+        __m512i xor_result = _mm512_xor_si512(_mm512_loadu_si512(x + pos), _mm512_loadu_si512(y + pos));
+        sum = _mm512_add_epi64(sum, popcount_epi64_avx512(xor_result));
+    }
+    if (pos < d) {
+        const __mmask64 mask = (u64(1) << (d - pos)) - 1;
+        __m512i xor_result = _mm512_xor_si512(_mm512_maskz_loadu_epi8(mask, x + pos), _mm512_maskz_loadu_epi8(mask, y + pos));
+        sum = _mm512_add_epi64(sum, popcount_epi64_avx512(xor_result));
+    }
+    return _mm512_reduce_add_epi64(sum);
+}
+
+#endif // defined (__AVX512BW__)
+
 #if defined(__AVX2__)
 
 f32 HammingDistance_avx2(const u8 *x, const u8 *y, SizeT d) {
@@ -28,6 +28,10 @@ export f32 CosineDistance_common(const f32 *x, const f32 *y, SizeT d);
 
 export f32 HammingDistance_common(const u8 *x, const u8 *y, SizeT d);
 
+#if defined(__AVX512BW__)
+export f32 HammingDistance_avx512(const u8 *vector1, const u8 *vector2, SizeT dimension);
+#endif
+
 #if defined(__AVX2__)
 export f32 L2Distance_avx2(const f32 *vector1, const f32 *vector2, SizeT dimension);
 
@@ -0,0 +1,127 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include "simd_common_intrin_include.h"
+export module pq_fast_scan_simd_funcs;
+import stl;
+
+namespace infinity {
+
+// 4-bit PQ fast scan
+// codes are packed in blocks of 32 vectors, each subspace pair p occupies 32 bytes of a block:
+//   byte [k]      : code(vec k, subspace 2p)     | code(vec k + 16, subspace 2p) << 4,     k in [0, 16)
+//   byte [16 + k] : code(vec k, subspace 2p + 1) | code(vec k + 16, subspace 2p + 1) << 4, k in [0, 16)
+// lut holds 16 quantized u8 entries per subspace, with the same pair layout (32 bytes per subspace pair).
+// output: 32 u16 accumulated distances, one for each vector in the block.
+export constexpr u32 PQ_FAST_SCAN_BLOCK_SIZE = 32;
+
+export inline u32 PQFastScanBlockBytes(const u32 subspace_pair_num) { return subspace_pair_num * PQ_FAST_SCAN_BLOCK_SIZE; }
+
+#if defined(__AVX2__)
+
+inline void StoreU16Sum256(const __m256i acc, u16 *output) {
+    const __m128i sum = _mm_add_epi16(_mm256_castsi256_si128(acc), _mm256_extracti128_si256(acc, 1));
+    _mm_storeu_si128((__m128i *)output, sum);
+}
+
+export void PQFastScanAVX2(const u8 *codes, const u8 *lut, const u32 subspace_pair_num, u16 *distances) {
+    const __m256i low_mask = _mm256_set1_epi8(0x0f);
+    const __m256i zero = _mm256_setzero_si256();
+    // accumulators for vec [0, 8), [8, 16), [16, 24), [24, 32)
+    __m256i acc_0 = _mm256_setzero_si256();
+    __m256i acc_1 = _mm256_setzero_si256();
+    __m256i acc_2 = _mm256_setzero_si256();
+    __m256i acc_3 = _mm256_setzero_si256();
+    for (u32 p = 0; p < subspace_pair_num; ++p) {
+        const __m256i c = _mm256_loadu_si256((const __m256i *)(codes + p * 32));
+        const __m256i table = _mm256_loadu_si256((const __m256i *)(lut + p * 32));
+        const __m256i c_lo = _mm256_and_si256(c, low_mask);
+        const __m256i c_hi = _mm256_and_si256(_mm256_srli_epi16(c, 4), low_mask);
+        const __m256i d_lo = _mm256_shuffle_epi8(table, c_lo);
+        const __m256i d_hi = _mm256_shuffle_epi8(table, c_hi);
+        acc_0 = _mm256_add_epi16(acc_0, _mm256_unpacklo_epi8(d_lo, zero));
+        acc_1 = _mm256_add_epi16(acc_1, _mm256_unpackhi_epi8(d_lo, zero));
+        acc_2 = _mm256_add_epi16(acc_2, _mm256_unpacklo_epi8(d_hi, zero));
+        acc_3 = _mm256_add_epi16(acc_3, _mm256_unpackhi_epi8(d_hi, zero));
+    }
+    // the two 128-bit lanes hold the even and odd subspaces of the pair
+    StoreU16Sum256(acc_0, distances);
+    StoreU16Sum256(acc_1, distances + 8);
+    StoreU16Sum256(acc_2, distances + 16);
+    StoreU16Sum256(acc_3, distances + 24);
+}
+
+#endif
+
+#if defined(__AVX512BW__)
+
+inline void StoreU16Sum512(const __m512i acc, u16 *output) {
+    const __m256i sum_256 = _mm256_add_epi16(_mm512_castsi512_si256(acc), _mm512_extracti64x4_epi64(acc, 1));
+    const __m128i sum = _mm_add_epi16(_mm256_castsi256_si128(sum_256), _mm256_extracti128_si256(sum_256, 1));
+    _mm_storeu_si128((__m128i *)output, sum);
+}
+
+export void PQFastScanAVX512BW(const u8 *codes, const u8 *lut, const u32 subspace_pair_num, u16 *distances) {
+    const __m512i low_mask = _mm512_set1_epi8(0x0f);
+    const __m512i zero = _mm512_setzero_si512();
+    __m512i acc_0 = _mm512_setzero_si512();
+    __m512i acc_1 = _mm512_setzero_si512();
+    __m512i acc_2 = _mm512_setzero_si512();
+    __m512i acc_3 = _mm512_setzero_si512();
+    auto accumulate = [&](const __m512i c, const __m512i table) {
+        const __m512i c_lo = _mm512_and_si512(c, low_mask);
+        const __m512i c_hi = _mm512_and_si512(_mm512_srli_epi16(c, 4), low_mask);
+        const __m512i d_lo = _mm512_shuffle_epi8(table, c_lo);
+        const __m512i d_hi = _mm512_shuffle_epi8(table, c_hi);
+        acc_0 = _mm512_add_epi16(acc_0, _mm512_unpacklo_epi8(d_lo, zero));
+        acc_1 = _mm512_add_epi16(acc_1, _mm512_unpackhi_epi8(d_lo, zero));
+        acc_2 = _mm512_add_epi16(acc_2, _mm512_unpacklo_epi8(d_hi, zero));
+        acc_3 = _mm512_add_epi16(acc_3, _mm512_unpackhi_epi8(d_hi, zero));
+    };
+    // two subspace pairs per iteration
+    u32 p = 0;
+    for (; p + 2 <= subspace_pair_num; p += 2) {
+        accumulate(_mm512_loadu_si512(codes + p * 32), _mm512_loadu_si512(lut + p * 32));
+    }
+    if (p < subspace_pair_num) {
+        // the upper half is zeroed, so the masked lut contributes nothing
+        constexpr __mmask64 tail_mask = 0xffffffffull;
+        accumulate(_mm512_maskz_loadu_epi8(tail_mask, codes + p * 32), _mm512_maskz_loadu_epi8(tail_mask, lut + p * 32));
+    }
+    StoreU16Sum512(acc_0, distances);
+    StoreU16Sum512(acc_1, distances + 8);
+    StoreU16Sum512(acc_2, distances + 16);
+    StoreU16Sum512(acc_3, distances + 24);
+}
+
+#endif
+
+export void PQFastScanSimple(const u8 *codes, const u8 *lut, const u32 subspace_pair_num, u16 *distances) {
+    for (u32 k = 0; k < PQ_FAST_SCAN_BLOCK_SIZE; ++k) {
+        const u32 byte_id = k & 15;
+        const u32 shift = (k >> 4) << 2;
+        u32 sum = 0;
+        for (u32 p = 0; p < subspace_pair_num; ++p) {
+            const u8 *pair_codes = codes + p * 32;
+            const u8 *pair_lut = lut + p * 32;
+            sum += pair_lut[(pair_codes[byte_id] >> shift) & 0xf];
+            sum += pair_lut[16 + ((pair_codes[16 + byte_id] >> shift) & 0xf)];
+        }
+        distances[k] = static_cast<u16>(sum);
+    }
+}
+
+} // namespace infinity
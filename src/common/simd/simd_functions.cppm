@@ -70,6 +70,9 @@ export struct SIMD_FUNCTIONS {
 
     // Batch BM25
     BatchBM25FuncType BatchBM25_func_ptr_ = GetBatchBM25FuncPtr();
+
+    // PQ fast scan
+    PQFastScanFuncType PQFastScan_func_ptr_ = GetPQFastScanFuncPtr();
 };
 
 export const SIMD_FUNCTIONS &GetSIMD_FUNCTIONS() {
@@ -22,6 +22,7 @@ import maxsim_simd_funcs;
 import emvb_simd_funcs;
 import search_top_1_sgemm;
 import batch_bm25_simd_funcs;
+import pq_fast_scan_simd_funcs;
 
 namespace infinity {
 
@@ -68,6 +69,11 @@ F32DistanceFuncType GetCosineDistanceFuncPtr() {
 }
 
 U8HammingDistanceFuncType GetHammingDistanceFuncPtr() {
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        return &HammingDistance_avx512;
+    }
+#endif
 #ifdef __AVX2__
     return &HammingDistance_avx2;
 #endif
@@ -607,4 +613,18 @@ BatchBM25FuncType GetBatchBM25FuncPtr() {
     return &BatchBM25Simple;
 }
 
+PQFastScanFuncType GetPQFastScanFuncPtr() {
+#if defined(__AVX512BW__)
+    if (IsAVX512BWSupported()) {
+        return &PQFastScanAVX512BW;
+    }
+#endif
+#if defined(__AVX2__)
+    if (IsAVX2Supported()) {
+        return &PQFastScanAVX2;
+    }
+#endif
+    return &PQFastScanSimple;
+}
+
 } // namespace infinity
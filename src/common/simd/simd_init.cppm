@@ -40,6 +40,7 @@ export using MaxSimI64BitIPFuncType = i64(*)(const i64 *, const u8 *, SizeT);
 export using FilterScoresOutputIdsFuncType = u32 * (*)(u32 *, f32, const f32 *, u32);
 export using SearchTop1WithDisF32U32FuncType = void(*)(u32, u32, const f32 *, u32, const f32 *, u32 *, f32 *);
 export using BatchBM25FuncType = void(*)(u32, u32, const f32 *, const f32 *, const f32 *, const u32 *, const u32 *, u32 *, f32 *);
+export using PQFastScanFuncType = void(*)(const u8 *, const u8 *, u32, u16 *);
 
 // F32 distance functions
 export F32DistanceFuncType GetL2DistanceFuncPtr();
@@ -86,5 +87,7 @@ export FilterScoresOutputIdsFuncType GetFilterScoresOutputIdsFuncPtr();
 export SearchTop1WithDisF32U32FuncType GetSearchTop1WithDisF32U32FuncPtr();
 // Batch BM25
 export BatchBM25FuncType GetBatchBM25FuncPtr();
+// PQ fast scan
+export PQFastScanFuncType GetPQFastScanFuncPtr();
 
 } // namespace infinity
@@ -42,6 +42,7 @@ module;
 #include "parallel_hashmap/phmap.h"
 #include "pgm/pgm_index.hpp"
 
+#include "oatpp/encoding/Base64.hpp"
 #include "oatpp/network/Server.hpp"
 #include "oatpp/network/tcp/server/ConnectionProvider.hpp"
 #include "oatpp/web/server/HttpConnectionHandler.hpp"
@@ -84,6 +85,8 @@ namespace minio {
         export using minio::s3::CopyObjectResponse;
         export using minio::s3::DownloadObjectArgs;
         export using minio::s3::DownloadObjectResponse;
+        export using minio::s3::GetObjectArgs;
+        export using minio::s3::GetObjectResponse;
         export using minio::s3::UploadObjectArgs;
         export using minio::s3::UploadObjectResponse;
         export using minio::s3::PutObjectArgs;
@@ -98,6 +101,10 @@ namespace minio {
         export using minio::creds::StaticProvider;
     } // namespace creds
 
+    namespace http {
+        export using minio::http::DataFunctionArgs;
+    } // namespace http
+
 } // namespace minio
 
 namespace fmt {
@@ -230,6 +237,15 @@ export using ParquetFileReaderBuilder = parquet::arrow::FileReaderBuilder;
 export using ArrowWriterProperties = parquet::ArrowWriterProperties;
 export using ParquetReaderProperties = parquet::ReaderProperties;
 export using ParquetArrowReaderProperties = parquet::ArrowReaderProperties;
+// Row count of each row group, read from the file metadata
+export std::vector<int64_t> ParquetRowGroupRows(ParquetFileReader *reader) {
+    std::shared_ptr<parquet::FileMetaData> metadata = reader->parquet_reader()->metadata();
+    std::vector<int64_t> row_group_rows;
+    for (int i = 0; i < metadata->num_row_groups(); ++i) {
+        row_group_rows.push_back(metadata->RowGroup(i)->num_rows());
+    }
+    return row_group_rows;
+}
 } // namespace arrow
 
 namespace parquet {
@@ -331,6 +347,7 @@ export using WebServer = oatpp::network::Server;
 export using WebEnvironment = oatpp::base::Environment;
 export using WebAddress = oatpp::network::Address;
 export using HTTPStatus = oatpp::web::protocol::http::Status;
+export using Base64 = oatpp::encoding::Base64;
 
 // Python
 export using PyObject = PyObject;
@@ -933,6 +933,19 @@ WrapQueryResult WrapInsert(Infinity &instance, const String &db_name, const Stri
     return WrapQueryResult(query_result.ErrorCode(), query_result.ErrorMsg());
 }
 
+WrapQueryResult WrapInsertColumns(Infinity &instance,
+                                  const String &db_name,
+                                  const String &table_name,
+                                  Vector<String> column_names,
+                                  Vector<String> column_buffers,
+                                  SizeT row_count) {
+    if (column_buffers.empty() || row_count == 0) {
+        return WrapQueryResult(ErrorCode::kInsertWithoutValues, "insert values is empty");
+    }
+    auto query_result = instance.InsertColumns(db_name, table_name, std::move(column_names), std::move(column_buffers), row_count);
+    return WrapQueryResult(query_result.ErrorCode(), query_result.ErrorMsg());
+}
+
 WrapQueryResult WrapImport(Infinity &instance, const String &db_name, const String &table_name, const String &path, ImportOptions import_options) {
     auto query_result = instance.Import(db_name, table_name, path, import_options);
     return WrapQueryResult(query_result.ErrorCode(), query_result.ErrorMsg());
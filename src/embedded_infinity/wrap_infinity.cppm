@@ -395,6 +395,13 @@ export WrapQueryResult WrapShowCurrentNode(Infinity &instance);
 
 export WrapQueryResult WrapInsert(Infinity &instance, const String &db_name, const String &table_name, Vector<WrapInsertRowExpr> &insert_rows);
 
+export WrapQueryResult WrapInsertColumns(Infinity &instance,
+                                         const String &db_name,
+                                         const String &table_name,
+                                         Vector<String> column_names,
+                                         Vector<String> column_buffers,
+                                         SizeT row_count);
+
 export WrapQueryResult
 WrapImport(Infinity &instance, const String &db_name, const String &table_name, const String &path, ImportOptions import_options);
 
@@ -296,6 +296,21 @@ NB_MODULE(embedded_infinity_ext, m) {
         .def("ShowCurrentNode", &WrapShowCurrentNode)
 
         .def("Insert", &WrapInsert)
+        .def("InsertColumns",
+             [](Infinity &instance,
+                const String &db_name,
+                const String &table_name,
+                Vector<String> column_names,
+                const Vector<nb::bytes> &column_buffers,
+                SizeT row_count) {
+                 // Python bytes are copied into the strings consumed by the planner
+                 Vector<String> buffers;
+                 buffers.reserve(column_buffers.size());
+                 for (const auto &column_buffer : column_buffers) {
+                     buffers.emplace_back(column_buffer.c_str(), column_buffer.size());
+                 }
+                 return WrapInsertColumns(instance, db_name, table_name, std::move(column_names), std::move(buffers), row_count);
+             })
         .def("Import", &WrapImport)
         .def("Export", &WrapExport)
         .def("Delete", &WrapDelete, nb::arg("db_name"), nb::arg("table_name"), nb::arg("filter") = nullptr)
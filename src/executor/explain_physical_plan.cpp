@@ -61,6 +61,7 @@ import physical_merge_parallel_aggregate;
 import physical_intersect;
 import physical_except;
 import physical_hash;
+import join_reference;
 import physical_merge_hash;
 import physical_merge_limit;
 import physical_merge_top;
@@ -1849,9 +1850,44 @@ void ExplainPhysicalPlan::Explain(const PhysicalDummyScan *, SharedPtr<Vector<Sh
     RecoverableError(status);
 }
 
-void ExplainPhysicalPlan::Explain(const PhysicalHashJoin *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
-    Status status = Status::NotSupport("Not implemented");
-    RecoverableError(status);
+void ExplainPhysicalPlan::Explain(const PhysicalHashJoin *join_node, SharedPtr<Vector<SharedPtr<String>>> &result, i64 intent_size) {
+    String join_header;
+    if (intent_size != 0) {
+        join_header = String(intent_size - 2, ' ') + "-> HASH JOIN ";
+    } else {
+        join_header = "HASH JOIN ";
+    }
+
+    join_header += "(" + std::to_string(join_node->node_id()) + ")";
+    result->emplace_back(MakeShared<String>(join_header));
+
+    // Join type and build side
+    {
+        String join_type_str = String(intent_size, ' ') + " - type: " + JoinReference::ToString(join_node->join_type());
+        result->emplace_back(MakeShared<String>(join_type_str));
+
+        String build_side_str = String(intent_size, ' ') + " - build side: " + (join_node->build_left() ? "left" : "right");
+        result->emplace_back(MakeShared<String>(build_side_str));
+    }
+
+    // Other conditions
+    if (join_node->condition().get() != nullptr) {
+        String condition_str = String(intent_size, ' ') + " - filter: ";
+        ExplainLogicalPlan::Explain(join_node->condition().get(), condition_str);
+        result->emplace_back(MakeShared<String>(condition_str));
+    }
+
+    // Output column
+    {
+        String output_columns_str = String(intent_size, ' ') + " - output columns: [";
+        SharedPtr<Vector<String>> output_columns = join_node->GetOutputNames();
+        SizeT column_count = output_columns->size();
+        for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+            output_columns_str += output_columns->at(idx) + ", ";
+        }
+        output_columns_str += output_columns->back() + "]";
+        result->emplace_back(MakeShared<String>(output_columns_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalSortMergeJoin *, SharedPtr<Vector<SharedPtr<String>>> &, i64) {
@@ -2197,7 +2233,6 @@ void ExplainPhysicalPlan::Explain(const PhysicalSink *sink_node, SharedPtr<Vecto
 
 void ExplainPhysicalPlan::Explain(const PhysicalParallelAggregate *parallel_aggregate_node,
                                   SharedPtr<Vector<SharedPtr<String>>> &result,
-
                                   i64 intent_size) {
     String explain_header_str;
     if (intent_size != 0) {
@@ -2207,11 +2242,49 @@ void ExplainPhysicalPlan::Explain(const PhysicalParallelAggregate *parallel_aggr
     }
     explain_header_str += "(" + std::to_string(parallel_aggregate_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Aggregate Table index
+    {
+        String aggregate_table_index =
+            String(intent_size, ' ') + " - aggregate table index: #" + std::to_string(parallel_aggregate_node->AggregateTableIndex());
+        result->emplace_back(MakeShared<String>(aggregate_table_index));
+    }
+
+    // Aggregate expressions
+    SizeT aggregates_count = parallel_aggregate_node->aggregates_.size();
+    {
+        String aggregate_expression_str = String(intent_size, ' ') + " - aggregate: [";
+        if (aggregates_count != 0) {
+            for (SizeT idx = 0; idx < aggregates_count - 1; ++idx) {
+                ExplainLogicalPlan::Explain(parallel_aggregate_node->aggregates_[idx].get(), aggregate_expression_str);
+                aggregate_expression_str += ", ";
+            }
+            ExplainLogicalPlan::Explain(parallel_aggregate_node->aggregates_.back().get(), aggregate_expression_str);
+        }
+        aggregate_expression_str += "]";
+        result->emplace_back(MakeShared<String>(aggregate_expression_str));
+    }
+
+    // Group by expressions
+    SizeT groups_count = parallel_aggregate_node->groups_.size();
+    if (groups_count != 0) {
+        String group_table_index =
+            String(intent_size, ' ') + " - group by table index: #" + std::to_string(parallel_aggregate_node->GroupTableIndex());
+        result->emplace_back(MakeShared<String>(group_table_index));
+
+        String group_by_expression_str = String(intent_size, ' ') + " - group by: [";
+        for (SizeT idx = 0; idx < groups_count - 1; ++idx) {
+            ExplainLogicalPlan::Explain(parallel_aggregate_node->groups_[idx].get(), group_by_expression_str);
+            group_by_expression_str += ", ";
+        }
+        ExplainLogicalPlan::Explain(parallel_aggregate_node->groups_.back().get(), group_by_expression_str);
+        group_by_expression_str += "]";
+        result->emplace_back(MakeShared<String>(group_by_expression_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalMergeParallelAggregate *merge_parallel_aggregate_node,
                                   SharedPtr<Vector<SharedPtr<String>>> &result,
-
                                   i64 intent_size) {
     String explain_header_str;
     if (intent_size != 0) {
@@ -2221,6 +2294,20 @@ void ExplainPhysicalPlan::Explain(const PhysicalMergeParallelAggregate *merge_pa
     }
     explain_header_str += "(" + std::to_string(merge_parallel_aggregate_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Output columns
+    String output_columns = String(intent_size, ' ') + " - output columns: [";
+    SizeT column_count = merge_parallel_aggregate_node->GetOutputNames()->size();
+    if (column_count == 0) {
+        String error_message = "No column in merge parallel aggregate node.";
+        UnrecoverableError(error_message);
+    }
+    for (SizeT idx = 0; idx < column_count - 1; ++idx) {
+        output_columns += merge_parallel_aggregate_node->GetOutputNames()->at(idx) + ", ";
+    }
+    output_columns += merge_parallel_aggregate_node->GetOutputNames()->back();
+    output_columns += "]";
+    result->emplace_back(MakeShared<String>(output_columns));
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalIntersect *intersect_node,
@@ -2260,6 +2347,21 @@ void ExplainPhysicalPlan::Explain(const PhysicalHash *hash_node, SharedPtr<Vecto
     }
     explain_header_str += "(" + std::to_string(hash_node->node_id()) + ")";
     result->emplace_back(MakeShared<String>(explain_header_str));
+
+    // Hash keys
+    {
+        String keys_str = String(intent_size, ' ') + " - keys: [";
+        const Vector<SharedPtr<BaseExpression>> &hash_keys = hash_node->hash_keys();
+        SizeT key_count = hash_keys.size();
+        for (SizeT idx = 0; idx < key_count; ++idx) {
+            ExplainLogicalPlan::Explain(hash_keys[idx].get(), keys_str);
+            if (idx + 1 < key_count) {
+                keys_str += ", ";
+            }
+        }
+        keys_str += "]";
+        result->emplace_back(MakeShared<String>(keys_str));
+    }
 }
 
 void ExplainPhysicalPlan::Explain(const PhysicalMergeHash *merge_hash_node,
@@ -53,6 +53,20 @@ SizeT ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
     return output_true_select->Size();
 }
 
+SharedPtr<Selection> ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
+                                                SharedPtr<ExpressionState> &state,
+                                                const DataBlock *input_data_block,
+                                                SizeT count) {
+    this->input_data_ = input_data_block;
+    SharedPtr<Selection> input_select = nullptr;
+    SharedPtr<Selection> output_true_select = MakeShared<Selection>();
+    output_true_select->Initialize(count);
+    SharedPtr<Selection> output_false_select = nullptr;
+
+    Select(expr, state, count, input_select, output_true_select, output_false_select);
+    return output_true_select;
+}
+
 void ExpressionSelector::Select(const SharedPtr<BaseExpression> &expr,
                                 SharedPtr<ExpressionState> &state,
                                 SizeT count,
@@ -33,6 +33,9 @@ public:
                  DataBlock *output_data_block,
                  SizeT count);
 
+    // Only compute the rows of the input data block which satisfy `expr`, without copying any column.
+    SharedPtr<Selection> Select(const SharedPtr<BaseExpression> &expr, SharedPtr<ExpressionState> &state, const DataBlock *input_data_block, SizeT count);
+
     void Select(const SharedPtr<BaseExpression> &expr,
                 SharedPtr<ExpressionState> &state,
                 SizeT count,
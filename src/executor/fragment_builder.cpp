@@ -150,7 +150,53 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
             }
             return;
         }
-        case PhysicalOperatorType::kParallelAggregate:
+        case PhysicalOperatorType::kParallelAggregate: {
+            current_fragment_ptr->AddOperator(phys_op);
+            if (phys_op->left() == nullptr) {
+                String error_message = "No input node of parallel aggregate operator";
+                UnrecoverableError(error_message);
+            }
+            BuildFragments(phys_op->left(), current_fragment_ptr);
+            current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+            return;
+        }
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            // Unlike the other merge operators, the merge fragment runs one task per partition of the parallel aggregate.
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kLocalQueue, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            if (phys_op->left() == nullptr) {
+                String error_message = fmt::format("No input node of {}", phys_op->GetName());
+                UnrecoverableError(error_message);
+            }
+            current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+
+            auto next_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+            next_plan_fragment->SetSinkNode(query_context_ptr_,
+                                            SinkType::kLocalQueue,
+                                            phys_op->left()->GetOutputNames(),
+                                            phys_op->left()->GetOutputTypes());
+            BuildFragments(phys_op->left(), next_plan_fragment.get());
+            current_fragment_ptr->AddChild(std::move(next_plan_fragment));
+            return;
+        }
+        case PhysicalOperatorType::kJoinHash: {
+            // Join task i receives partition i of both inputs, each input is hashed in its own fragment.
+            current_fragment_ptr->AddOperator(phys_op);
+            current_fragment_ptr->SetSourceNode(query_context_ptr_, SourceType::kLocalQueue, phys_op->GetOutputNames(), phys_op->GetOutputTypes());
+            if (phys_op->left() == nullptr || phys_op->right() == nullptr) {
+                String error_message = fmt::format("No input node of {}", phys_op->GetName());
+                UnrecoverableError(error_message);
+            }
+            current_fragment_ptr->SetFragmentType(FragmentType::kParallelMaterialize);
+
+            for (PhysicalOperator *child_op : {phys_op->left(), phys_op->right()}) {
+                auto next_plan_fragment = MakeUnique<PlanFragment>(GetFragmentId());
+                next_plan_fragment->SetSinkNode(query_context_ptr_, SinkType::kLocalQueue, child_op->GetOutputNames(), child_op->GetOutputTypes());
+                BuildFragments(child_op, next_plan_fragment.get());
+                current_fragment_ptr->AddChild(std::move(next_plan_fragment));
+            }
+            return;
+        }
         case PhysicalOperatorType::kFilter:
         case PhysicalOperatorType::kHash:
         case PhysicalOperatorType::kLimit: {
@@ -252,7 +298,6 @@ void FragmentBuilder::BuildFragments(PhysicalOperator *phys_op, PlanFragment *cu
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
         case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
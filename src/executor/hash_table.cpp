@@ -14,111 +14,485 @@
 
 module;
 
-#include <string>
-import stl;
+module hash_table;
 
+import stl;
 import column_vector;
-
+import roaring_bitmap;
+import internal_types;
+import data_type;
+import logical_type;
+import status;
 import infinity_exception;
+import third_party;
 
-module hash_table;
-
-#if 0
 namespace infinity {
 
-void HashTable::Init(const Vector<DataType> &types) {
-    types_ = types;
-    SizeT type_count = types.size();
-    for (SizeT idx = 0; idx < type_count; ++idx) {
-        const DataType &data_type = types[idx];
-        switch (data_type.type()) {
-            case kBoolean:
-            case kTinyInt:
-            case kSmallInt:
-            case kInteger:
-            case kBigInt:
-            case kHugeInt:
-            case kFloat:
-            case kDouble:
-            case kDecimal:
-            case kVarchar:
-            case kDate:
-            case kTime:
-            case kDateTime:
-            case kMixed: {
+namespace {
+
+constexpr SizeT kInitialSlotCount = 1024;
+constexpr u64 kNullHash = 0xbf58476d1ce4e5b9ULL;
+
+// Finalizer of murmur3
+inline u64 HashMix(u64 h) {
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+inline u64 HashBytes(const char *data, SizeT len) {
+    u64 h = 0x9e3779b97f4a7c15ULL ^ len;
+    SizeT i = 0;
+    for (; i + sizeof(u64) <= len; i += sizeof(u64)) {
+        u64 word;
+        std::memcpy(&word, data + i, sizeof(u64));
+        h = HashMix(h ^ word);
+    }
+    if (i < len) {
+        u64 word = 0;
+        std::memcpy(&word, data + i, len - i);
+        h = HashMix(h ^ word);
+    }
+    return h;
+}
+
+inline u64 CombineHash(u64 seed, u64 h) { return seed ^ (h + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2)); }
+
+template <SizeT WIDTH>
+void HashFixedWidthColumn(const ColumnVector &column, SizeT row_count, u64 *hashes) {
+    const char *data = column.data();
+    const Bitmask &nulls = *column.nulls_ptr_;
+    if (column.vector_type() == ColumnVectorType::kConstant) {
+        const u64 h = nulls.IsTrue(0) ? HashBytes(data, WIDTH) : kNullHash;
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            hashes[row_idx] = CombineHash(hashes[row_idx], h);
+        }
+        return;
+    }
+    if (nulls.IsAllTrue()) {
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            hashes[row_idx] = CombineHash(hashes[row_idx], HashBytes(data + row_idx * WIDTH, WIDTH));
+        }
+        return;
+    }
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        const u64 h = nulls.IsTrue(row_idx) ? HashBytes(data + row_idx * WIDTH, WIDTH) : kNullHash;
+        hashes[row_idx] = CombineHash(hashes[row_idx], h);
+    }
+}
+
+inline bool IsFloatKey(const LogicalType type) {
+    return type == LogicalType::kFloat || type == LogicalType::kDouble || type == LogicalType::kFloat16 || type == LogicalType::kBFloat16;
+}
+
+// SQL equality treats -0.0 and +0.0 as the same value, and grouping folds all NaNs into one group,
+// so float keys are rewritten to +0.0 and one quiet NaN before they are hashed and compared bytewise.
+inline void CanonicalizeFloatKey(const LogicalType type, char *value_ptr) {
+    switch (type) {
+        case LogicalType::kFloat: {
+            f32 value;
+            std::memcpy(&value, value_ptr, sizeof(value));
+            if (value == 0.0f) {
+                value = 0.0f;
+            } else if (std::isnan(value)) {
+                value = std::numeric_limits<f32>::quiet_NaN();
+            }
+            std::memcpy(value_ptr, &value, sizeof(value));
+            break;
+        }
+        case LogicalType::kDouble: {
+            f64 value;
+            std::memcpy(&value, value_ptr, sizeof(value));
+            if (value == 0.0) {
+                value = 0.0;
+            } else if (std::isnan(value)) {
+                value = std::numeric_limits<f64>::quiet_NaN();
+            }
+            std::memcpy(value_ptr, &value, sizeof(value));
+            break;
+        }
+        case LogicalType::kFloat16:
+        case LogicalType::kBFloat16: {
+            // exponent mask, mantissa mask and quiet NaN of the 16-bit formats
+            const bool is_f16 = type == LogicalType::kFloat16;
+            const u16 exponent_mask = is_f16 ? 0x7c00 : 0x7f80;
+            const u16 mantissa_mask = is_f16 ? 0x03ff : 0x007f;
+            const u16 quiet_nan = is_f16 ? 0x7e00 : 0x7fc0;
+            u16 bits;
+            std::memcpy(&bits, value_ptr, sizeof(bits));
+            if ((bits & 0x7fff) == 0) {
+                bits = 0;
+            } else if ((bits & exponent_mask) == exponent_mask && (bits & mantissa_mask) != 0) {
+                bits = quiet_nan;
+            }
+            std::memcpy(value_ptr, &bits, sizeof(bits));
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+template <SizeT WIDTH>
+void HashFloatColumn(const ColumnVector &column, const LogicalType type, SizeT row_count, u64 *hashes) {
+    const char *data = column.data();
+    const Bitmask &nulls = *column.nulls_ptr_;
+    const bool is_constant = column.vector_type() == ColumnVectorType::kConstant;
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        SizeT idx = is_constant ? 0 : row_idx;
+        u64 h = kNullHash;
+        if (nulls.IsTrue(idx)) {
+            char value[WIDTH];
+            std::memcpy(value, data + idx * WIDTH, WIDTH);
+            CanonicalizeFloatKey(type, value);
+            h = HashBytes(value, WIDTH);
+        }
+        hashes[row_idx] = CombineHash(hashes[row_idx], h);
+    }
+}
+
+inline SizeT KeyValueSize(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean: {
+            return 1;
+        }
+        case LogicalType::kVarchar: {
+            // length prefix, the payload is counted per row
+            return sizeof(u32);
+        }
+        default: {
+            return data_type.Size();
+        }
+    }
+}
+
+} // namespace
+
+void HashTable::Init(const Vector<SharedPtr<DataType>> &types) {
+    for (const auto &data_type : types) {
+        switch (data_type->type()) {
+            case LogicalType::kBoolean:
+            case LogicalType::kTinyInt:
+            case LogicalType::kSmallInt:
+            case LogicalType::kInteger:
+            case LogicalType::kBigInt:
+            case LogicalType::kHugeInt:
+            case LogicalType::kFloat:
+            case LogicalType::kDouble:
+            case LogicalType::kFloat16:
+            case LogicalType::kBFloat16:
+            case LogicalType::kDecimal:
+            case LogicalType::kVarchar:
+            case LogicalType::kDate:
+            case LogicalType::kTime:
+            case LogicalType::kDateTime:
+            case LogicalType::kTimestamp:
+            case LogicalType::kInterval: {
                 break; // All these type can be hashed.
             }
-            case kTimestamp:
-            case kInterval:
-            case kArray:
-            case kTuple:
-            case kPoint:
-            case kLine:
-            case kLineSeg:
-            case kBox:
-//            case kPath:
-//            case kPolygon:
-            case kCircle:
-//            case kBitmap:
-            case kUuid:
-//            case kBlob:
-            case kEmbedding:
-            case kRowID:
-            case kNull:
-            case kMissing:
-            case kInvalid: {
-                RecoverableError(Status::NotSupport(fmt::format("Attempt to construct hash key for type: {}", data_type.ToString())));
-            }
-        }
-
-        SizeT type_size = data_type.Size();
-        key_size_ += type_size;
-    }
-
-    // Key layout: col1\0col2\0col3\0.
-    key_size_ += type_count;
-}
-
-void HashTable::Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT block_id, SizeT row_count) {
-    UniquePtr<char[]> hash_key = MakeUnique<char[]>(key_size_);
-    SizeT column_count = columns.size();
-    for (SizeT row_id = 0; row_id < row_count; ++row_id) {
-        std::memset(hash_key.get(), 0, key_size_);
-        SizeT offset = 0;
-
-        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-            char *target_ptr = hash_key.get() + offset;
-            if (!columns[column_id]->nulls_ptr_->IsTrue(row_id)) {
-                *(target_ptr) = '\0';
-                offset += 2;
-                continue;
+            default: {
+                Status status = Status::NotSupport(fmt::format("Attempt to construct hash key for type: {}", data_type->ToString()));
+                RecoverableError(status);
+            }
+        }
+    }
+    types_ = types;
+
+    slots_.clear();
+    slots_.resize(kInitialSlotCount);
+    slot_mask_ = kInitialSlotCount - 1;
+
+    group_keys_.clear();
+    group_key_offsets_.assign(1, 0);
+    group_hashes_.clear();
+}
+
+void HashTable::Hash(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u64> &hashes) const {
+    hashes.assign(row_count, 0);
+    SizeT column_count = types_.size();
+    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+        const ColumnVector &column = *columns[column_id];
+        switch (types_[column_id]->type()) {
+            case LogicalType::kBoolean: {
+                const bool is_constant = column.vector_type() == ColumnVectorType::kConstant;
+                for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                    SizeT idx = is_constant ? 0 : row_idx;
+                    u64 h = column.nulls_ptr_->IsTrue(idx) ? HashMix(column.buffer_->GetCompactBit(idx) ? 1 : 2) : kNullHash;
+                    hashes[row_idx] = CombineHash(hashes[row_idx], h);
+                }
+                break;
+            }
+            case LogicalType::kVarchar: {
+                const bool is_constant = column.vector_type() == ColumnVectorType::kConstant;
+                for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                    SizeT idx = is_constant ? 0 : row_idx;
+                    u64 h = kNullHash;
+                    if (column.nulls_ptr_->IsTrue(idx)) {
+                        Span<const char> data = column.GetVarchar(idx);
+                        h = HashBytes(data.data(), data.size());
+                    }
+                    hashes[row_idx] = CombineHash(hashes[row_idx], h);
+                }
+                break;
+            }
+            case LogicalType::kFloat16:
+            case LogicalType::kBFloat16: {
+                HashFloatColumn<2>(column, types_[column_id]->type(), row_count, hashes.data());
+                break;
+            }
+            case LogicalType::kFloat: {
+                HashFloatColumn<4>(column, types_[column_id]->type(), row_count, hashes.data());
+                break;
+            }
+            case LogicalType::kDouble: {
+                HashFloatColumn<8>(column, types_[column_id]->type(), row_count, hashes.data());
+                break;
             }
+            default: {
+                switch (types_[column_id]->Size()) {
+                    case 1: {
+                        HashFixedWidthColumn<1>(column, row_count, hashes.data());
+                        break;
+                    }
+                    case 2: {
+                        HashFixedWidthColumn<2>(column, row_count, hashes.data());
+                        break;
+                    }
+                    case 4: {
+                        HashFixedWidthColumn<4>(column, row_count, hashes.data());
+                        break;
+                    }
+                    case 8: {
+                        HashFixedWidthColumn<8>(column, row_count, hashes.data());
+                        break;
+                    }
+                    case 16: {
+                        HashFixedWidthColumn<16>(column, row_count, hashes.data());
+                        break;
+                    }
+                    default: {
+                        String error_message = fmt::format("Unexpected hash key width: {}", types_[column_id]->Size());
+                        UnrecoverableError(error_message);
+                    }
+                }
+                break;
+            }
+        }
+    }
+}
+
+void HashTable::SerializeKeys(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count) {
+    SizeT column_count = types_.size();
 
-            DataType &data_type = types_[column_id];
-            if (data_type.type() == kMixed) {
-                // Only float/boolean/integer/string can be built as hash key. Array/Tuple will be treated as null
-                RecoverableError(Status::NotSupport("Attempt to construct hash key for heterogeneous type"));
+    // 1. Key length of each row: one null flag and the fixed part for each column, plus the varchar payloads
+    SizeT fixed_size = 0;
+    for (const auto &data_type : types_) {
+        fixed_size += 1 + KeyValueSize(*data_type);
+    }
+    key_offsets_.assign(row_count + 1, fixed_size);
+    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+        if (types_[column_id]->type() != LogicalType::kVarchar) {
+            continue;
+        }
+        const ColumnVector &column = *columns[column_id];
+        const bool is_constant = column.vector_type() == ColumnVectorType::kConstant;
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            SizeT idx = is_constant ? 0 : row_idx;
+            if (column.nulls_ptr_->IsTrue(idx)) {
+                key_offsets_[row_idx] += column.GetVarchar(idx).size();
             }
+        }
+    }
+    SizeT total_size = 0;
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        SizeT key_size = key_offsets_[row_idx];
+        key_offsets_[row_idx] = total_size;
+        total_size += key_size;
+    }
+    key_offsets_[row_count] = total_size;
+    key_buffer_.resize(total_size);
 
-            if (data_type.type() == kVarchar) {
-                VarcharT *vchar_ptr = &((VarcharT *)(columns[column_id]->data_ptr_))[row_id];
-                if (vchar_ptr->IsInlined()) {
-                    std::memcpy(target_ptr, vchar_ptr->prefix, vchar_ptr->length);
-                } else {
-                    std::memcpy(target_ptr, vchar_ptr->ptr, vchar_ptr->length);
+    // 2. Write the keys column by column
+    Vector<SizeT> cursors(key_offsets_.begin(), key_offsets_.end() - 1);
+    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+        const ColumnVector &column = *columns[column_id];
+        const bool is_constant = column.vector_type() == ColumnVectorType::kConstant;
+        const LogicalType type = types_[column_id]->type();
+        const SizeT value_size = KeyValueSize(*types_[column_id]);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            SizeT idx = is_constant ? 0 : row_idx;
+            char *target_ptr = key_buffer_.data() + cursors[row_idx];
+            if (!column.nulls_ptr_->IsTrue(idx)) {
+                std::memset(target_ptr, 0, 1 + value_size);
+                cursors[row_idx] += 1 + value_size;
+                continue;
+            }
+            *target_ptr = 1;
+            ++target_ptr;
+            switch (type) {
+                case LogicalType::kBoolean: {
+                    *target_ptr = column.buffer_->GetCompactBit(idx) ? 1 : 0;
+                    cursors[row_idx] += 1 + value_size;
+                    break;
+                }
+                case LogicalType::kVarchar: {
+                    Span<const char> data = column.GetVarchar(idx);
+                    u32 length = data.size();
+                    std::memcpy(target_ptr, &length, sizeof(u32));
+                    std::memcpy(target_ptr + sizeof(u32), data.data(), length);
+                    cursors[row_idx] += 1 + value_size + length;
+                    break;
+                }
+                default: {
+                    std::memcpy(target_ptr, column.data() + idx * value_size, value_size);
+                    if (IsFloatKey(type)) {
+                        CanonicalizeFloatKey(type, target_ptr);
+                    }
+                    cursors[row_idx] += 1 + value_size;
+                    break;
                 }
-                offset += (vchar_ptr->length + 1);
-            } else {
-                SizeT type_size = types_[column_id].Size();
-                std::memcpy(target_ptr, columns[column_id]->data_ptr_ + type_size * row_id, type_size);
-                offset += (type_size + 1);
             }
         }
+    }
+}
+
+bool HashTable::KeyEquals(u32 group_id, SizeT row_idx) const {
+    SizeT group_key_size = group_key_offsets_[group_id + 1] - group_key_offsets_[group_id];
+    SizeT row_key_size = key_offsets_[row_idx + 1] - key_offsets_[row_idx];
+    if (group_key_size != row_key_size) {
+        return false;
+    }
+    return std::memcmp(group_keys_.data() + group_key_offsets_[group_id], key_buffer_.data() + key_offsets_[row_idx], row_key_size) == 0;
+}
+
+u32 HashTable::AddGroup(u64 hash, SizeT row_idx) {
+    u32 group_id = group_hashes_.size();
+    group_keys_.insert(group_keys_.end(), key_buffer_.begin() + key_offsets_[row_idx], key_buffer_.begin() + key_offsets_[row_idx + 1]);
+    group_key_offsets_.emplace_back(group_keys_.size());
+    group_hashes_.emplace_back(hash);
+    return group_id;
+}
 
-        String key(hash_key.get(), key_size_);
-        hash_table_[key][block_id].emplace_back(row_id);
+void HashTable::Grow() {
+    SizeT new_slot_count = slots_.size() * 2;
+    slots_.clear();
+    slots_.resize(new_slot_count);
+    slot_mask_ = new_slot_count - 1;
+    SizeT group_count = GroupCount();
+    for (u32 group_id = 0; group_id < group_count; ++group_id) {
+        u64 hash = group_hashes_[group_id];
+        SizeT pos = hash & slot_mask_;
+        while (slots_[pos].group_id_ != kEmptySlot) {
+            pos = (pos + 1) & slot_mask_;
+        }
+        slots_[pos].hash_ = hash;
+        slots_[pos].group_id_ = group_id;
+    }
+}
+
+void HashTable::FindOrInsert(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u32> &group_ids) {
+    group_ids.resize(row_count);
+    if (row_count == 0) {
+        return;
+    }
+    Hash(columns, row_count, hashes_);
+    SerializeKeys(columns, row_count);
+
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        // Keep the load factor under 0.5
+        if ((GroupCount() + 1) * 2 > slots_.size()) {
+            Grow();
+        }
+        const u64 hash = hashes_[row_idx];
+        SizeT pos = hash & slot_mask_;
+        while (true) {
+            Slot &slot = slots_[pos];
+            if (slot.group_id_ == kEmptySlot) {
+                slot.hash_ = hash;
+                slot.group_id_ = AddGroup(hash, row_idx);
+                group_ids[row_idx] = slot.group_id_;
+                break;
+            }
+            if (slot.hash_ == hash && KeyEquals(slot.group_id_, row_idx)) {
+                group_ids[row_idx] = slot.group_id_;
+                break;
+            }
+            pos = (pos + 1) & slot_mask_;
+        }
+    }
+}
+
+void HashTable::Find(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u32> &group_ids) {
+    group_ids.resize(row_count);
+    if (row_count == 0) {
+        return;
+    }
+    Hash(columns, row_count, hashes_);
+    SerializeKeys(columns, row_count);
+
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        const u64 hash = hashes_[row_idx];
+        SizeT pos = hash & slot_mask_;
+        group_ids[row_idx] = kEmptySlot;
+        while (slots_[pos].group_id_ != kEmptySlot) {
+            const Slot &slot = slots_[pos];
+            if (slot.hash_ == hash && KeyEquals(slot.group_id_, row_idx)) {
+                group_ids[row_idx] = slot.group_id_;
+                break;
+            }
+            pos = (pos + 1) & slot_mask_;
+        }
+    }
+}
+
+void HashTable::GetGroupKeys(const Vector<SharedPtr<ColumnVector>> &output_columns, SizeT group_start, SizeT group_count) const {
+    for (SizeT group_id = group_start; group_id < group_start + group_count; ++group_id) {
+        AppendGroupKey(output_columns, group_id);
+    }
+}
+
+void HashTable::GetGroupKeys(const Vector<SharedPtr<ColumnVector>> &output_columns, const u32 *group_ids, SizeT group_count) const {
+    for (SizeT idx = 0; idx < group_count; ++idx) {
+        AppendGroupKey(output_columns, group_ids[idx]);
+    }
+}
+
+void HashTable::AppendGroupKey(const Vector<SharedPtr<ColumnVector>> &output_columns, u32 group_id) const {
+    SizeT column_count = types_.size();
+    const char *key_ptr = group_keys_.data() + group_key_offsets_[group_id];
+    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
+        ColumnVector &column = *output_columns[column_id];
+        const bool is_valid = *key_ptr != 0;
+        ++key_ptr;
+        switch (types_[column_id]->type()) {
+            case LogicalType::kBoolean: {
+                BooleanT value = *key_ptr != 0;
+                column.AppendByPtr(reinterpret_cast<const_ptr_t>(&value));
+                key_ptr += 1;
+                break;
+            }
+            case LogicalType::kVarchar: {
+                u32 length = 0;
+                std::memcpy(&length, key_ptr, sizeof(u32));
+                key_ptr += sizeof(u32);
+                column.AppendVarchar(Span<const char>(key_ptr, length));
+                key_ptr += length;
+                break;
+            }
+            default: {
+                column.AppendByPtr(key_ptr);
+                key_ptr += types_[column_id]->Size();
+                break;
+            }
+        }
+        if (!is_valid) {
+            column.nulls_ptr_->SetFalse(column.Size() - 1);
+        }
     }
 }
 
 } // namespace infinity
-#endif
\ No newline at end of file
@@ -23,18 +23,72 @@ import data_type;
 
 namespace infinity {
 
+// Open-addressing hash table which maps the key columns of each row to a dense group id.
+// Group ids are assigned in insertion order, so group `i` is the i-th distinct key seen by the table.
+// Keys are serialized as (null flag, value) for each column and stored back to back in one arena:
+// fixed-width values are copied as is, varchar values are prefixed with their u32 length.
 export class HashTable {
 public:
-    void Init(const Vector<DataType> &types);
+    static constexpr u32 kEmptySlot = std::numeric_limits<u32>::max();
 
-    void Append(const Vector<SharedPtr<ColumnVector>> &columns, SizeT block_id, SizeT row_count);
+    void Init(const Vector<SharedPtr<DataType>> &types);
 
-public:
-    Vector<DataType> types_{};
-    SizeT key_size_{};
+    // Hash `row_count` rows of the key columns, one column at a time.
+    void Hash(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u64> &hashes) const;
+
+    // Look up `row_count` rows of the key columns, inserting the keys not seen before.
+    // group_ids[i] is set to the group id of row i.
+    void FindOrInsert(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u32> &group_ids);
+
+    // Look up `row_count` rows of the key columns without inserting. group_ids[i] is kEmptySlot if row i has no match.
+    void Find(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count, Vector<u32> &group_ids);
+
+    // Append the keys of groups [group_start, group_start + group_count) to the output column vectors.
+    void GetGroupKeys(const Vector<SharedPtr<ColumnVector>> &output_columns, SizeT group_start, SizeT group_count) const;
+
+    // Append the keys of the `group_count` groups listed in group_ids to the output column vectors.
+    void GetGroupKeys(const Vector<SharedPtr<ColumnVector>> &output_columns, const u32 *group_ids, SizeT group_count) const;
+
+    // Partition of a key hash, the high bits are used since the low bits pick the slot of the hash table.
+    static inline SizeT PartitionOf(u64 hash, SizeT partition_count) { return ((hash >> 32) * partition_count) >> 32; }
+
+    [[nodiscard]] inline SizeT GroupCount() const { return group_hashes_.size(); }
+
+    [[nodiscard]] inline u64 GroupHash(u32 group_id) const { return group_hashes_[group_id]; }
+
+    [[nodiscard]] inline const Vector<SharedPtr<DataType>> &types() const { return types_; }
+
+private:
+    struct Slot {
+        u64 hash_{};
+        u32 group_id_{kEmptySlot};
+    };
+
+    // Serialize the key of each row into key_buffer_, key_offsets_[i] is the start of row i.
+    void SerializeKeys(const Vector<SharedPtr<ColumnVector>> &columns, SizeT row_count);
+
+    [[nodiscard]] bool KeyEquals(u32 group_id, SizeT row_idx) const;
+
+    void AppendGroupKey(const Vector<SharedPtr<ColumnVector>> &output_columns, u32 group_id) const;
+
+    u32 AddGroup(u64 hash, SizeT row_idx);
+
+    void Grow();
+
+    Vector<SharedPtr<DataType>> types_{};
+
+    Vector<Slot> slots_{};
+    SizeT slot_mask_{};
+
+    // Serialized keys of the groups, group i is [group_key_offsets_[i], group_key_offsets_[i + 1])
+    Vector<char> group_keys_{};
+    Vector<SizeT> group_key_offsets_{};
+    Vector<u64> group_hashes_{};
 
-    // Key -> (block id -> row array)
-    HashMap<String, HashMap<SizeT, Vector<SizeT>>> hash_table_{};
+    // Scratch buffers of the current input batch
+    Vector<u64> hashes_{};
+    Vector<char> key_buffer_{};
+    Vector<SizeT> key_offsets_{};
 };
 
 } // namespace infinity
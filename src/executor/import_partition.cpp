@@ -0,0 +1,59 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module import_partition;
+
+import stl;
+
+namespace infinity {
+
+SizeT ImportPartitionSize(SizeT total_size, SizeT thread_count, SizeT min_size, SizeT max_size) {
+    thread_count = std::max(thread_count, SizeT(1));
+    SizeT partition_size = (total_size + thread_count - 1) / thread_count;
+    return std::max(SizeT(1), std::min(std::max(partition_size, min_size), max_size));
+}
+
+Vector<ImportByteRange> PartitionLines(SizeT file_size, SizeT partition_size, const std::function<SizeT(SizeT)> &next_line_start) {
+    partition_size = std::max(partition_size, SizeT(1));
+    Vector<ImportByteRange> ranges;
+    SizeT begin = 0;
+    while (begin < file_size) {
+        SizeT end = file_size;
+        if (file_size - begin > partition_size) {
+            end = next_line_start(begin + partition_size - 1);
+        }
+        ranges.push_back({begin, end});
+        begin = end;
+    }
+    return ranges;
+}
+
+Vector<Vector<int>> PartitionRowGroups(const Vector<i64> &row_group_rows, SizeT partition_rows) {
+    Vector<Vector<int>> partitions;
+    SizeT rows = 0;
+    for (SizeT row_group_idx = 0; row_group_idx < row_group_rows.size(); ++row_group_idx) {
+        SizeT row_group_row_count = row_group_rows[row_group_idx];
+        if (partitions.empty() || (rows > 0 && rows + row_group_row_count > partition_rows)) {
+            partitions.emplace_back();
+            rows = 0;
+        }
+        partitions.back().push_back(row_group_idx);
+        rows += row_group_row_count;
+    }
+    return partitions;
+}
+
+} // namespace infinity
@@ -0,0 +1,39 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module import_partition;
+
+import stl;
+
+namespace infinity {
+
+// Bytes [begin_, end_) of a line based import file
+export struct ImportByteRange {
+    SizeT begin_{};
+    SizeT end_{};
+};
+
+// Size of one import partition: the input split evenly across thread_count, at least min_size and at most max_size.
+export SizeT ImportPartitionSize(SizeT total_size, SizeT thread_count, SizeT min_size, SizeT max_size);
+
+// Split the bytes [0, file_size) into ranges of about partition_size bytes, each range except the last one ends right after a line break.
+// next_line_start(offset) returns the offset just past the first line break at or after offset, or file_size if there is none.
+export Vector<ImportByteRange> PartitionLines(SizeT file_size, SizeT partition_size, const std::function<SizeT(SizeT)> &next_line_start);
+
+// Group consecutive row groups into partitions of at most partition_rows rows, a bigger row group is a partition alone.
+export Vector<Vector<int>> PartitionRowGroups(const Vector<i64> &row_group_rows, SizeT partition_rows);
+
+} // namespace infinity
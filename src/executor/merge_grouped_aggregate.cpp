@@ -0,0 +1,151 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+module merge_grouped_aggregate;
+
+import stl;
+import third_party;
+import data_block;
+import column_vector;
+import hash_table;
+import base_expression;
+import aggregate_expression;
+import data_type;
+import logical_type;
+import internal_types;
+import infinity_exception;
+import default_values;
+
+namespace infinity {
+
+namespace {
+
+// Merge the partial results of the rows in merge_rows into the output rows of their groups.
+template <typename T>
+void MergeGroupedColumn(const String &function_name,
+                        const DataBlock *input_block,
+                        Vector<UniquePtr<DataBlock>> &output_blocks,
+                        SizeT col_idx,
+                        const Vector<Pair<SizeT, u32>> &merge_rows) {
+    std::function<T(T, T)> operation;
+    if (function_name == "COUNT" || function_name == "SUM") {
+        operation = [](T a, T b) -> T { return a + b; };
+    } else if (function_name == "MIN") {
+        operation = [](T a, T b) -> T { return (a < b) ? a : b; };
+    } else if (function_name == "MAX") {
+        operation = [](T a, T b) -> T { return (a > b) ? a : b; };
+    } else if (function_name == "FIRST" || function_name == "COUNT_STAR") {
+        // keep the value of the first partial result
+        return;
+    } else {
+        String error_message = fmt::format("Function type {} not Implement.", function_name);
+        UnrecoverableError(error_message);
+    }
+
+    const auto *input_data = (const T *)(input_block->column_vectors[col_idx]->data());
+    for (const auto &[row_idx, group_id] : merge_rows) {
+        auto *output_data = (T *)(output_blocks[group_id / DEFAULT_VECTOR_SIZE]->column_vectors[col_idx]->data());
+        T &output = output_data[group_id % DEFAULT_VECTOR_SIZE];
+        output = operation(input_data[row_idx], output);
+    }
+}
+
+} // namespace
+
+void MergeGroupedPartialResults(const Vector<SharedPtr<BaseExpression>> &aggregates,
+                                SizeT group_count,
+                                const Vector<SharedPtr<DataType>> &output_types,
+                                const DataBlock *input_block,
+                                UniquePtr<HashTable> &hash_table,
+                                Vector<u32> &group_ids,
+                                Vector<UniquePtr<DataBlock>> &output_blocks) {
+    if (hash_table.get() == nullptr) {
+        Vector<SharedPtr<DataType>> group_types(output_types.begin(), output_types.begin() + group_count);
+        hash_table = MakeUnique<HashTable>();
+        hash_table->Init(group_types);
+        output_blocks.emplace_back(DataBlock::MakeUniquePtr());
+        output_blocks.back()->Init(output_types);
+    }
+    if (input_block == nullptr) {
+        return;
+    }
+
+    SizeT row_count = input_block->row_count();
+    Vector<SharedPtr<ColumnVector>> key_columns(input_block->column_vectors.begin(), input_block->column_vectors.begin() + group_count);
+
+    SizeT output_row_count = hash_table->GroupCount();
+    hash_table->FindOrInsert(key_columns, row_count, group_ids);
+
+    Vector<Pair<SizeT, u32>> merge_rows;
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        u32 group_id = group_ids[row_idx];
+        if (group_id != output_row_count) {
+            merge_rows.emplace_back(row_idx, group_id);
+            continue;
+        }
+        DataBlock *output_block = output_blocks.back().get();
+        if (output_block->column_vectors[0]->Size() == output_block->capacity()) {
+            output_blocks.emplace_back(DataBlock::MakeUniquePtr());
+            output_block = output_blocks.back().get();
+            output_block->Init(output_types);
+        }
+        output_block->AppendWith(input_block, row_idx, 1);
+        ++output_row_count;
+    }
+    if (merge_rows.empty()) {
+        return;
+    }
+
+    SizeT aggs_size = aggregates.size();
+    for (SizeT agg_idx = 0; agg_idx < aggs_size; ++agg_idx) {
+        auto *agg_expression = static_cast<AggregateExpression *>(aggregates[agg_idx].get());
+        const String function_name = agg_expression->aggregate_function_.GetFuncName();
+        SizeT col_idx = group_count + agg_idx;
+
+        switch (agg_expression->aggregate_function_.return_type_.type()) {
+            case LogicalType::kTinyInt: {
+                MergeGroupedColumn<TinyIntT>(function_name, input_block, output_blocks, col_idx, merge_rows);
+                break;
+            }
+            case LogicalType::kSmallInt: {
+                MergeGroupedColumn<SmallIntT>(function_name, input_block, output_blocks, col_idx, merge_rows);
+                break;
+            }
+            case LogicalType::kInteger: {
+                MergeGroupedColumn<IntegerT>(function_name, input_block, output_blocks, col_idx, merge_rows);
+                break;
+            }
+            case LogicalType::kBigInt: {
+                MergeGroupedColumn<BigIntT>(function_name, input_block, output_blocks, col_idx, merge_rows);
+                break;
+            }
+            case LogicalType::kFloat: {
+                MergeGroupedColumn<FloatT>(function_name, input_block, output_blocks, col_idx, merge_rows);
+                break;
+            }
+            case LogicalType::kDouble: {
+                MergeGroupedColumn<DoubleT>(function_name, input_block, output_blocks, col_idx, merge_rows);
+                break;
+            }
+            default: {
+                String error_message = "Input value type not Implement";
+                UnrecoverableError(error_message);
+            }
+        }
+    }
+}
+
+} // namespace infinity
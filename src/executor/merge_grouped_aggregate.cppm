@@ -0,0 +1,38 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module merge_grouped_aggregate;
+
+import stl;
+import data_block;
+import hash_table;
+import base_expression;
+import data_type;
+
+namespace infinity {
+
+// Merge a block of grouped partial aggregate results, laid out as (group keys..., aggregate results...), into output_blocks.
+// Group ids are assigned in insertion order, so group i is written to the i-th output row: the first row of a new group is
+// copied to the output, the others are merged into the output row of their group. hash_table is initialized on the first call.
+export void MergeGroupedPartialResults(const Vector<SharedPtr<BaseExpression>> &aggregates,
+                                       SizeT group_count,
+                                       const Vector<SharedPtr<DataType>> &output_types,
+                                       const DataBlock *input_block,
+                                       UniquePtr<HashTable> &hash_table,
+                                       Vector<u32> &group_ids,
+                                       Vector<UniquePtr<DataBlock>> &output_blocks);
+
+} // namespace infinity
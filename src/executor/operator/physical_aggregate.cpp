@@ -24,7 +24,6 @@ import stl;
 import txn;
 import query_context;
 import table_def;
-import data_table;
 
 import operator_state;
 import data_block;
@@ -38,6 +37,8 @@ import default_values;
 import expression_state;
 import expression_evaluator;
 import aggregate_expression;
+import aggregate_function;
+import hash_table;
 import status;
 import logical_type;
 import internal_types;
@@ -45,547 +46,177 @@ import column_def;
 
 namespace infinity {
 
+namespace {
+
+// Number of group states in each chunk of AggregateOperatorState::group_states_
+constexpr SizeT kGroupStateChunkSize = 1024;
+
+} // namespace
+
 void PhysicalAggregate::Init() {}
 
 bool PhysicalAggregate::Execute(QueryContext *query_context, OperatorState *operator_state) {
     OperatorState *prev_op_state = operator_state->prev_op_state_;
     auto *aggregate_operator_state = static_cast<AggregateOperatorState *>(operator_state);
 
-    // 1. Execute group-by expressions to generate unique key.
-    // ExpressionEvaluator groupby_executor;
-    // groupby_executor.Init(groups_);
-
-    Vector<SharedPtr<ColumnDef>> groupby_columns;
     SizeT group_count = groups_.size();
 
+    bool result = false;
     if (group_count == 0) {
         // Aggregate without group by expression
         // e.g. SELECT count(a) FROM table;
-        auto result = SimpleAggregateExecute(prev_op_state->data_block_array_,
-                                             aggregate_operator_state->data_block_array_,
-                                             aggregate_operator_state->states_,
-                                             prev_op_state->Complete());
-        prev_op_state->data_block_array_.clear();
-        if (prev_op_state->Complete()) {
-            aggregate_operator_state->SetComplete();
-        }
-        return result;
+        result = SimpleAggregateExecute(prev_op_state->data_block_array_,
+                                        aggregate_operator_state->data_block_array_,
+                                        aggregate_operator_state->states_,
+                                        prev_op_state->Complete());
+    } else {
+        // Aggregate with group by expression
+        // e.g. SELECT a, count(b) FROM table GROUP BY a;
+        result = GroupByAggregateExecute(prev_op_state->data_block_array_, aggregate_operator_state, prev_op_state->Complete());
     }
-#if 0
-    groupby_columns.reserve(group_count);
-
-    Vector<DataType> types;
-    types.reserve(group_count);
-
-    for(i64 idx = 0; auto& expr: groups_) {
-        SharedPtr<ColumnDef> col_def = MakeShared<ColumnDef>(idx,
-                                                             MakeShared<DataType>(expr->Type()),
-                                                             expr->Name(),
-                                                             std::set<ConstraintType>());
-        groupby_columns.emplace_back(col_def);
-        types.emplace_back(expr->Type());
-        ++ idx;
+    prev_op_state->data_block_array_.clear();
+    if (prev_op_state->Complete()) {
+        aggregate_operator_state->SetComplete();
     }
+    return result;
+}
 
-    SharedPtr<TableDef> groupby_tabledef = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("groupby"), groupby_columns);
-    SharedPtr<DataTable> groupby_table = DataTable::Make(groupby_tabledef, TableType::kIntermediate);
-
-    groupby_executor.Execute(input_table_, groupby_table);
-
-    // 2. Use the unique key to get the row list of the same key.
-    hash_table_.Init(types);
-
-    SizeT block_count = groupby_table->DataBlockCount();
-    for(SizeT block_id = 0; block_id < block_count; ++ block_id) {
-        const SharedPtr<DataBlock>& block_ptr = groupby_table->GetDataBlockById(block_id);
-        hash_table_.Append(block_ptr->column_vectors, block_id, block_ptr->row_count());
+bool PhysicalAggregate::GroupByAggregateExecute(const Vector<UniquePtr<DataBlock>> &input_blocks,
+                                                AggregateOperatorState *aggregate_operator_state,
+                                                bool task_completed) {
+    if (aggregate_operator_state->hash_table_.get() == nullptr) {
+        aggregate_operator_state->hash_table_ = MakeUnique<HashTable>();
+        aggregate_operator_state->hash_table_->Init(GroupTypes(groups_));
+        aggregate_operator_state->group_states_.resize(aggregates_.size());
     }
+    HashTable *hash_table = aggregate_operator_state->hash_table_.get();
+    GroupByAccumulate(groups_, aggregates_, input_blocks, hash_table, aggregate_operator_state->group_states_);
 
-    // 3. forlop each aggregates function on each group by bucket, to calculate the result according to the row list
-    SharedPtr<DataTable> output_groupby_table = DataTable::Make(groupby_tabledef, TableType::kIntermediate);
-    GenerateGroupByResult(groupby_table, output_groupby_table);
-
-
-    // input table after group by, each block belong to one group. This is the prerequisites to execute aggregate function.
-    SharedPtr<DataTable> grouped_input_table;
-    {
-        SizeT column_count = input_table_->ColumnCount();
-        Vector<SharedPtr<ColumnDef>> columns;
-        columns.reserve(column_count);
-        for(SizeT idx = 0; idx < column_count; ++ idx) {
-            SharedPtr<DataType> col_type = input_table_->GetColumnTypeById(idx);
-            String col_name = input_table_->GetColumnNameById(idx);
-
-            SharedPtr<ColumnDef> col_def = MakeShared<ColumnDef>(idx, col_type, col_name, std::set<ConstraintType>());
-            columns.emplace_back(col_def);
-        }
-
-        SharedPtr<TableDef> table_def = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("grouped_input"), columns);
-
-        grouped_input_table = DataTable::Make(table_def, TableType::kGroupBy);
+    if (!task_completed) {
+        return true;
     }
-    GroupByInputTable(input_table_, grouped_input_table);
-
-    // generate output aggregate table
-    SizeT aggregates_count = aggregates_.size();
-    if(aggregates_count > 0) {
-        SharedPtr<DataTable> output_aggregate_table{};
-
-        // Prepare the output table columns
-        Vector<SharedPtr<ColumnDef>> aggregate_columns;
-        aggregate_columns.reserve(aggregates_count);
-
-        // Prepare the expression states
-        Vector<SharedPtr<ExpressionState>> expr_states;
-        expr_states.reserve(aggregates_.size());
-
-        // Prepare the output block
-        Vector<SharedPtr<DataType>> output_types;
-        output_types.reserve(aggregates_count);
-
-        for(i64 idx = 0; auto& expr: aggregates_) {
-            // expression state
-            expr_states.emplace_back(ExpressionState::CreateState(expr));
-            SharedPtr<DataType> data_type = MakeShared<DataType>(expr->Type());
-
-            // column definition
-            SharedPtr<ColumnDef> col_def = MakeShared<ColumnDef>(idx,
-                                                                 data_type,
-                                                                 expr->Name(),
-                                                                 std::set<ConstraintType>());
-            aggregate_columns.emplace_back(col_def);
-
-            // for output block
-            output_types.emplace_back(data_type);
-
-            ++ idx;
-        }
-
-        // output aggregate table definition
-        SharedPtr<TableDef> aggregate_tabledef = TableDef::Make(MakeShared<String>("default_db"),
-                                                                MakeShared<String>("aggregate"),
-                                                                aggregate_columns);
-        output_aggregate_table = DataTable::Make(aggregate_tabledef, TableType::kAggregate);
-
-        // Loop blocks
-        HashMap<u64, SharedPtr<DataBlock>> block_map;
-        SizeT input_data_block_count = grouped_input_table->DataBlockCount();
-        for(SizeT block_idx = 0; block_idx < input_data_block_count; ++ block_idx) {
-            SharedPtr<DataBlock> output_data_block = DataBlock::Make();
-            output_data_block->Init(output_types);
-            Vector<SharedPtr<DataBlock>> input_blocks{grouped_input_table->GetDataBlockById(block_idx)};
-//            block_map[groupby_index_] = block_ptr;
-//            block_map[input_table_index_] = block_ptr;
-            // Loop aggregate expression
-            ExpressionEvaluator evaluator;
-            evaluator.Init(input_blocks);
-            for(SizeT expr_idx = 0; expr_idx < aggregates_count; ++ expr_idx) {
-                Vector<SharedPtr<ColumnVector>> blocks_column;
-                blocks_column.emplace_back(output_data_block->column_vectors[expr_idx]);
-                evaluator.Execute(aggregates_[expr_idx],
-                                  expr_states[expr_idx],
-                                  blocks_column);
-                if(blocks_column[0].get() != output_data_block->column_vectors[expr_idx].get()) {
-                    // column vector in blocks column might be changed to the column vector from column reference.
-                    // This check and assignment is to make sure the right column vector are assign to output_data_block
-                    output_data_block->column_vectors[expr_idx] = blocks_column[0];
-                }
-            }
 
-            output_data_block->Finalize();
-            output_aggregate_table->Append(output_data_block);
-        }
-
-        // Union output group by table with aggregate table
-        output_groupby_table->UnionWith(output_aggregate_table);
-    }
+    // Output the group keys followed by the finalized aggregates. At least one block is sent, so the merge operator can see this task
+    // is completed even if there is no group.
+    SizeT total_group_count = hash_table->GroupCount();
+    SharedPtr<Vector<SharedPtr<DataType>>> output_types = GetOutputTypes();
+    Vector<u32> group_ids;
+    SizeT group_start = 0;
+    do {
+        SizeT output_group_count = std::min(total_group_count - group_start, (SizeT)DEFAULT_VECTOR_SIZE);
+        group_ids.resize(output_group_count);
+        std::iota(group_ids.begin(), group_ids.end(), group_start);
+
+        auto output_block = DataBlock::MakeUniquePtr();
+        output_block->Init(*output_types);
+        AppendGroupResults(groups_.size(), aggregates_, *hash_table, aggregate_operator_state->group_states_, group_ids.data(), output_group_count, output_block.get());
+        aggregate_operator_state->data_block_array_.emplace_back(std::move(output_block));
+        group_start += output_group_count;
+    } while (group_start < total_group_count);
 
-    // 4. generate the result to output
-    this->output_ = output_groupby_table;
-#endif
     return true;
 }
 
-void PhysicalAggregate::GroupByInputTable(const SharedPtr<DataTable> &input_table, SharedPtr<DataTable> &grouped_input_table) {
-    SizeT column_count = input_table->ColumnCount();
-
-    // 1. Get output table column types.
-    Vector<SharedPtr<DataType>> types;
-    types.reserve(column_count);
-    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-        SharedPtr<DataType> input_type = input_table->GetColumnTypeById(column_id);
-        SharedPtr<DataType> output_type = grouped_input_table->GetColumnTypeById(column_id);
-        if (*input_type != *output_type) {
-            Status status = Status::DataTypeMismatch(input_type->ToString(), output_type->ToString());
-            RecoverableError(status);
-        }
-        types.emplace_back(input_type);
+Vector<SharedPtr<DataType>> PhysicalAggregate::GroupTypes(const Vector<SharedPtr<BaseExpression>> &groups) {
+    Vector<SharedPtr<DataType>> group_types;
+    group_types.reserve(groups.size());
+    for (const auto &expr : groups) {
+        group_types.emplace_back(MakeShared<DataType>(expr->Type()));
     }
+    return group_types;
+}
 
-    // 2. Generate data blocks and append it into output table according to the group by hash table.
-    const Vector<SharedPtr<DataBlock>> &input_datablocks = input_table->data_blocks_;
-    for (const auto &item : hash_table_.hash_table_) {
-
-        // 2.1 Each hash bucket will be insert in to one data block
-        SharedPtr<DataBlock> output_datablock = DataBlock::Make();
-        SizeT datablock_size = 0;
-        for (const auto &vec_pair : item.second) {
-            datablock_size += vec_pair.second.size();
-        }
-        SizeT datablock_capacity = Utility::NextPowerOfTwo(datablock_size);
-        output_datablock->Init(types, datablock_capacity);
-
-        // Loop each block
-        SizeT output_row_idx = 0;
-        for (const auto &vec_pair : item.second) {
-            SizeT input_block_id = vec_pair.first;
-
-            // Loop each row of same block
-            for (const auto input_offset : vec_pair.second) {
-
-                // Forloop each column
-                for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-                    switch (types[column_id]->type()) {
-                        case LogicalType::kBoolean: {
-                            ((BooleanT *)(output_datablock->column_vectors[column_id]->data()))[output_row_idx] =
-                                ((BooleanT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                            break;
-                        }
-                        case LogicalType::kTinyInt: {
-                            ((TinyIntT *)(output_datablock->column_vectors[column_id]->data()))[output_row_idx] =
-                                ((TinyIntT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                            break;
-                        }
-                        case LogicalType::kSmallInt: {
-                            ((SmallIntT *)(output_datablock->column_vectors[column_id]->data()))[output_row_idx] =
-                                ((SmallIntT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                            break;
-                        }
-                        case LogicalType::kInteger: {
-                            ((IntegerT *)(output_datablock->column_vectors[column_id]->data()))[output_row_idx] =
-                                ((IntegerT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                            break;
-                        }
-                        case LogicalType::kBigInt: {
-                            ((BigIntT *)(output_datablock->column_vectors[column_id]->data()))[output_row_idx] =
-                                ((BigIntT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                            break;
-                        }
-                        case LogicalType::kHugeInt: {
-                            String error_message = "Not implement: HugeInt data shuffle";
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                        case LogicalType::kFloat: {
-                            ((FloatT *)(output_datablock->column_vectors[column_id]->data()))[output_row_idx] =
-                                ((FloatT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                            break;
-                        }
-                        case LogicalType::kDouble: {
-                            ((DoubleT *)(output_datablock->column_vectors[column_id]->data()))[output_row_idx] =
-                                ((DoubleT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                            break;
-                        }
-                        case LogicalType::kDecimal: {
-                            String error_message = "Not implement: data shuffle.";
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                        case LogicalType::kVarchar: {
-                            String error_message = "Not implement: data shuffle.";
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                        case LogicalType::kDate: {
-                            ((DateT *)(output_datablock->column_vectors[column_id]->data()))[output_row_idx] =
-                                ((DateT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                            break;
-                        }
-                        case LogicalType::kTime: {
-                            String error_message = "Not implement: data shuffle.";
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                        case LogicalType::kDateTime: {
-                            String error_message = "Not implement: data shuffle.";
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                        case LogicalType::kTimestamp: {
-                            String error_message = "Not implement: data shuffle.";
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                        case LogicalType::kInterval: {
-                            String error_message = "Not implement: data shuffle.";
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                        case LogicalType::kMixed: {
-                            String error_message = "Not implement: data shuffle.";
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                        default: {
-                            String error_message = "Not implement: data shuffle.";
-                            UnrecoverableError(error_message);
-                            break;
-                        }
-                    }
-                }
-
-                ++output_row_idx;
-            }
+void PhysicalAggregate::GroupByAccumulate(const Vector<SharedPtr<BaseExpression>> &groups,
+                                          const Vector<SharedPtr<BaseExpression>> &aggregates,
+                                          const Vector<UniquePtr<DataBlock>> &input_blocks,
+                                          HashTable *hash_table,
+                                          Vector<Vector<UniquePtr<char[]>>> &group_states) {
+    SizeT group_count = groups.size();
+    SizeT aggregates_count = aggregates.size();
+    const Vector<SharedPtr<DataType>> &group_types = hash_table->types();
+
+    Vector<u32> group_ids;
+    Vector<ptr_t> row_states;
+    for (const auto &input_block : input_blocks) {
+        SizeT row_count = input_block->row_count();
+        if (row_count == 0) {
+            continue;
         }
 
-        if (output_row_idx != datablock_size) {
-            String error_message = fmt::format("Expected block size: {}, but only copied data size: {}", datablock_size, output_row_idx);
-            UnrecoverableError(error_message);
-            break;
+        ExpressionEvaluator evaluator;
+        evaluator.Init(input_block.get());
+
+        // 1. Evaluate the group by expressions and map each row to its group.
+        DataBlock group_block;
+        group_block.Init(group_types, input_block->capacity());
+        for (SizeT group_idx = 0; group_idx < group_count; ++group_idx) {
+            SharedPtr<ExpressionState> group_state = ExpressionState::CreateState(groups[group_idx]);
+            evaluator.Execute(groups[group_idx], group_state, group_block.column_vectors[group_idx]);
         }
+        SizeT old_group_count = hash_table->GroupCount();
+        hash_table->FindOrInsert(group_block.column_vectors, row_count, group_ids);
+        InitGroupStates(aggregates, group_states, old_group_count, hash_table->GroupCount());
+
+        // 2. Accumulate the argument of each aggregate into the states of the groups.
+        row_states.resize(row_count);
+        for (SizeT agg_idx = 0; agg_idx < aggregates_count; ++agg_idx) {
+            auto *agg_expr = static_cast<AggregateExpression *>(aggregates[agg_idx].get());
+            SizeT state_stride = agg_expr->aggregate_function_.GroupStateStride();
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                row_states[row_idx] = GroupState(group_states, agg_idx, group_ids[row_idx], state_stride);
+            }
 
-        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-            output_datablock->column_vectors[column_id]->Finalize(datablock_size);
+            SharedPtr<BaseExpression> &argument_expr = agg_expr->arguments()[0];
+            SharedPtr<ExpressionState> argument_state = ExpressionState::CreateState(argument_expr);
+            SharedPtr<ColumnVector> &argument_column = argument_state->OutputColumnVector();
+            evaluator.Execute(argument_expr, argument_state, argument_column);
+            agg_expr->aggregate_function_.grouped_update_func_(row_states.data(), argument_column, row_count);
         }
-
-        output_datablock->Finalize();
-        grouped_input_table->Append(output_datablock);
     }
 }
 
-void PhysicalAggregate::GenerateGroupByResult(const SharedPtr<DataTable> &input_table, SharedPtr<DataTable> &output_table) {
-
-    SizeT column_count = input_table->ColumnCount();
-    Vector<SharedPtr<DataType>> types;
-    types.reserve(column_count);
-    for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-        SharedPtr<DataType> input_type = input_table->GetColumnTypeById(column_id);
-        SharedPtr<DataType> output_type = output_table->GetColumnTypeById(column_id);
-        if (*input_type != *output_type) {
-            Status status = Status::DataTypeMismatch(input_type->ToString(), output_type->ToString());
-            RecoverableError(status);
+void PhysicalAggregate::AppendGroupResults(SizeT group_count,
+                                           const Vector<SharedPtr<BaseExpression>> &aggregates,
+                                           const HashTable &hash_table,
+                                           Vector<Vector<UniquePtr<char[]>>> &group_states,
+                                           const u32 *group_ids,
+                                           SizeT output_group_count,
+                                           DataBlock *output_block) {
+    Vector<SharedPtr<ColumnVector>> key_columns(output_block->column_vectors.begin(), output_block->column_vectors.begin() + group_count);
+    hash_table.GetGroupKeys(key_columns, group_ids, output_group_count);
+    SizeT aggregates_count = aggregates.size();
+    for (SizeT agg_idx = 0; agg_idx < aggregates_count; ++agg_idx) {
+        auto *agg_expr = static_cast<AggregateExpression *>(aggregates[agg_idx].get());
+        SizeT state_stride = agg_expr->aggregate_function_.GroupStateStride();
+        ColumnVector &output_column = *output_block->column_vectors[group_count + agg_idx];
+        for (SizeT idx = 0; idx < output_group_count; ++idx) {
+            const_ptr_t result_ptr = agg_expr->aggregate_function_.finalize_func_(GroupState(group_states, agg_idx, group_ids[idx], state_stride));
+            output_column.AppendByPtr(result_ptr);
         }
-        types.emplace_back(input_type);
     }
+    output_block->Finalize();
+}
 
-    SharedPtr<DataBlock> output_datablock = nullptr;
-    const Vector<SharedPtr<DataBlock>> &input_datablocks = input_table->data_blocks_;
-//    SizeT row_count = hash_table_.hash_table_.size();
-#if 1
-    for (SizeT block_row_idx = 0; const auto &item : hash_table_.hash_table_) {
-        // Each hash bucket will generate one data block.
-        output_datablock = DataBlock::Make();
-        output_datablock->Init(types);
-
-        // Only get the first row(block id and row offset of the block) of the bucket
-        SizeT input_block_id = item.second.begin()->first;
-        SizeT input_offset = item.second.begin()->second.front();
-
-        // Only the first position of the column vector has value.
-        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-            switch (types[column_id]->type()) {
-                case LogicalType::kBoolean: {
-                    ((BooleanT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((BooleanT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kTinyInt: {
-                    ((TinyIntT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((TinyIntT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kSmallInt: {
-                    ((SmallIntT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((SmallIntT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kInteger: {
-                    ((IntegerT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((IntegerT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kBigInt: {
-                    ((BigIntT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((BigIntT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kHugeInt: {
-                    String error_message = "Not implement: data shuffle.";
-                    UnrecoverableError(error_message);
-                    break;
-                }
-                case LogicalType::kFloat: {
-                    ((FloatT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((FloatT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kDouble: {
-                    ((DoubleT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((DoubleT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kDecimal: {
-                    String error_message = "Not implement: data shuffle.";
-                    UnrecoverableError(error_message);
-                    break;
-                }
-                case LogicalType::kVarchar: {
-                    String error_message = "Not implement: data shuffle.";
-                    UnrecoverableError(error_message);
-                    break;
-                }
-                case LogicalType::kDate: {
-                    ((DateT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((DateT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kTime: {
-                    String error_message = "Not implement: data shuffle.";
-                    UnrecoverableError(error_message);
-                    break;
-                }
-                case LogicalType::kDateTime: {
-                    String error_message = "Not implement: data shuffle.";
-                    UnrecoverableError(error_message);
-                    break;
-                }
-                case LogicalType::kTimestamp: {
-                    String error_message = "Not implement: data shuffle.";
-                    UnrecoverableError(error_message);
-                    break;
-                }
-                case LogicalType::kInterval: {
-                    String error_message = "Not implement: data shuffle.";
-                    UnrecoverableError(error_message);
-                    break;
-                }
-                case LogicalType::kMixed: {
-                    String error_message = "Not implement: data shuffle.";
-                    UnrecoverableError(error_message);
-                    break;
-                }
-                default: {
-                    String error_message = "Not implement: data shuffle.";
-                    UnrecoverableError(error_message);
-                    break;
-                }
-            }
-
-            output_datablock->column_vectors[column_id]->Finalize(block_row_idx + 1);
-        }
-
-        output_datablock->Finalize();
-        output_table->Append(output_datablock);
-    }
-#else
-    for (SizeT row_id = 0, block_row_idx = 0; const auto &item : hash_table_.hash_table_) {
-        // DEFAULT VECTOR SIZE buckets will generate one data block.
-        if (row_id % DEFAULT_VECTOR_SIZE == 0) {
-            if (output_datablock.get() != nullptr) {
-                for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-                    output_datablock->column_vectors[column_id]->tail_index_ = block_row_idx;
-                }
-
-                output_datablock->Finalize();
-                output_table->Append(output_datablock);
-                block_row_idx = 0;
-            }
-
-            output_datablock = DataBlock::Make();
-            output_datablock->Init(types);
-        }
-
-        SizeT input_block_id = item.second.begin()->first;
-        SizeT input_offset = item.second.begin()->second.front();
-
-        for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-            switch (types[column_id].type()) {
-                case LogicalType::kBoolean: {
-                    ((BooleanT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((BooleanT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kTinyInt: {
-                    ((TinyIntT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((TinyIntT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kSmallInt: {
-                    ((SmallIntT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((SmallIntT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kInteger: {
-                    ((IntegerT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((IntegerT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kBigInt: {
-                    ((BigIntT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((BigIntT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kHugeInt: {
-                    NotImplementError("HugeInt data shuffle isn't implemented.")
-                }
-                case LogicalType::kFloat: {
-                    ((FloatT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((FloatT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kDouble: {
-                    ((DoubleT *)(output_datablock->column_vectors[column_id]->data()))[block_row_idx] =
-                        ((DoubleT *)(input_datablocks[input_block_id]->column_vectors[column_id]->data()))[input_offset];
-                    break;
-                }
-                case LogicalType::kDecimal: {
-                    NotImplementError("Decimal data shuffle isn't implemented.")
-                }
-                case LogicalType::kVarchar: {
-                    NotImplementError("Varchar data shuffle isn't implemented.")
-                }
-                case LogicalType::kDate: {
-                    NotImplementError("Date data shuffle isn't implemented.")
-                }
-                case LogicalType::kTime: {
-                    NotImplementError("Time data shuffle isn't implemented.")
-                }
-                case LogicalType::kDateTime: {
-                    NotImplementError("Datetime data shuffle isn't implemented.")
-                }
-                case LogicalType::kTimestamp: {
-                    NotImplementError("Timestamp data shuffle isn't implemented.")
-                }
-                case LogicalType::kTimestampTZ: {
-                    NotImplementError("TimestampTZ data shuffle isn't implemented.")
-                }
-                case LogicalType::kInterval: {
-                    NotImplementError("Interval data shuffle isn't implemented.")
-                }
-                case LogicalType::kMixed: {
-                    NotImplementError("Heterogeneous data shuffle isn't implemented.")
-                }
-                default: {
-                    ExecutorError("Unexpected data type")
-                }
-            }
+void PhysicalAggregate::InitGroupStates(const Vector<SharedPtr<BaseExpression>> &aggregates,
+                                        Vector<Vector<UniquePtr<char[]>>> &group_states,
+                                        SizeT group_begin,
+                                        SizeT group_end) {
+    SizeT aggregates_count = aggregates.size();
+    for (SizeT agg_idx = 0; agg_idx < aggregates_count; ++agg_idx) {
+        const AggregateFunction &aggregate_function = static_cast<AggregateExpression *>(aggregates[agg_idx].get())->aggregate_function_;
+        SizeT state_stride = aggregate_function.GroupStateStride();
+        Vector<UniquePtr<char[]>> &state_chunks = group_states[agg_idx];
+        while (state_chunks.size() * kGroupStateChunkSize < group_end) {
+            state_chunks.emplace_back(MakeUnique<char[]>(state_stride * kGroupStateChunkSize));
         }
-
-        ++block_row_idx;
-        ++row_id;
-
-        if (row_id == row_count) {
-            // All hash table data are checked
-            for (SizeT column_id = 0; column_id < column_count; ++column_id) {
-                output_datablock->column_vectors[column_id]->tail_index_ = block_row_idx;
-            }
-
-            output_datablock->Finalize();
-            output_table->Append(output_datablock);
-            break;
+        for (SizeT group_id = group_begin; group_id < group_end; ++group_id) {
+            aggregate_function.init_func_(GroupState(group_states, agg_idx, group_id, state_stride));
         }
     }
-#endif
+}
+
+ptr_t PhysicalAggregate::GroupState(Vector<Vector<UniquePtr<char[]>>> &group_states, SizeT agg_idx, SizeT group_id, SizeT state_stride) {
+    return group_states[agg_idx][group_id / kGroupStateChunkSize].get() + (group_id % kGroupStateChunkSize) * state_stride;
 }
 
 bool PhysicalAggregate::SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>> &input_blocks,
@@ -22,8 +22,6 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
-import data_table;
-import hash_table;
 import base_expression;
 import load_meta;
 import infinity_exception;
@@ -31,6 +29,7 @@ import data_block;
 import internal_types;
 import data_type;
 import logger;
+import hash_table;
 
 namespace infinity {
 
@@ -57,25 +56,40 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    SizeT TaskletCount() override {
-        String error_message = "Not implement: TaskletCount not Implement";
-        UnrecoverableError(error_message);
-        return 0;
-    }
-
-    void GroupByInputTable(const SharedPtr<DataTable> &input_table, SharedPtr<DataTable> &output_table);
-
-    void GenerateGroupByResult(const SharedPtr<DataTable> &input_table, SharedPtr<DataTable> &output_table);
+    // The serial aggregate emits a single stream
+    SizeT TaskletCount() override { return 1; }
 
     Vector<SharedPtr<BaseExpression>> groups_{};
     Vector<SharedPtr<BaseExpression>> aggregates_{};
-    HashTable hash_table_;
 
     bool SimpleAggregateExecute(const Vector<UniquePtr<DataBlock>> &input_blocks,
                                 Vector<UniquePtr<DataBlock>> &output_blocks,
                                 Vector<UniquePtr<char[]>> &states,
                                 bool task_completed);
 
+    // Hash aggregation: rows are mapped to groups by HashTable, and each aggregate is accumulated into per group states.
+    // The output is only generated when the task is completed.
+    bool GroupByAggregateExecute(const Vector<UniquePtr<DataBlock>> &input_blocks, AggregateOperatorState *aggregate_operator_state, bool task_completed);
+
+    // The helpers below are shared with PhysicalParallelAggregate, which keeps the same hash table and group states per task.
+    static Vector<SharedPtr<DataType>> GroupTypes(const Vector<SharedPtr<BaseExpression>> &groups);
+
+    // Map the rows of input_blocks to groups of hash_table and accumulate the aggregates into their group states.
+    static void GroupByAccumulate(const Vector<SharedPtr<BaseExpression>> &groups,
+                                  const Vector<SharedPtr<BaseExpression>> &aggregates,
+                                  const Vector<UniquePtr<DataBlock>> &input_blocks,
+                                  HashTable *hash_table,
+                                  Vector<Vector<UniquePtr<char[]>>> &group_states);
+
+    // Append the keys and the finalized aggregates of the listed groups to output_block.
+    static void AppendGroupResults(SizeT group_count,
+                                   const Vector<SharedPtr<BaseExpression>> &aggregates,
+                                   const HashTable &hash_table,
+                                   Vector<Vector<UniquePtr<char[]>>> &group_states,
+                                   const u32 *group_ids,
+                                   SizeT output_group_count,
+                                   DataBlock *output_block);
+
     inline u64 GroupTableIndex() const { return groupby_index_; }
 
     inline u64 AggregateTableIndex() const { return aggregate_index_; }
@@ -89,7 +103,13 @@ public:
     Vector<HashRange> GetHashRanges(i64 parallel_count) const;
 
 private:
-    SharedPtr<DataTable> input_table_{};
+    static void InitGroupStates(const Vector<SharedPtr<BaseExpression>> &aggregates,
+                                Vector<Vector<UniquePtr<char[]>>> &group_states,
+                                SizeT group_begin,
+                                SizeT group_end);
+
+    static ptr_t GroupState(Vector<Vector<UniquePtr<char[]>>> &group_states, SizeT agg_idx, SizeT group_id, SizeT state_stride);
+
     u64 groupby_index_{};
     u64 aggregate_index_{};
 };
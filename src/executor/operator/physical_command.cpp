@@ -196,6 +196,25 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
                             cache_mgr->ResetCacheNumCapacity(cache_num);
                             break;
                         }
+                        case GlobalOptionIndex::kCacheResultMemory: {
+                            if (set_command->value_type() != SetVarType::kInteger) {
+                                Status status = Status::DataTypeMismatch("Integer", set_command->value_type_str());
+                                RecoverableError(status);
+                            }
+                            i64 cache_memory = set_command->value_int();
+                            ResultCacheManager *cache_mgr = query_context->storage()->GetResultCacheManagerPtr();
+                            const String &result_cache_status = config->ResultCache();
+                            if (result_cache_status == "off") {
+                                Status status = Status::InvalidCommand(fmt::format("Result cache manager is off"));
+                                RecoverableError(status);
+                            }
+                            if (cache_memory < 0) {
+                                Status status = Status::InvalidCommand(fmt::format("Attempt to set cache result memory: {}", cache_memory));
+                                RecoverableError(status);
+                            }
+                            cache_mgr->ResetCacheMemoryCapacity(cache_memory);
+                            break;
+                        }
                         case GlobalOptionIndex::kLogLevel: {
                             if (set_command->value_type() != SetVarType::kString) {
                                 Status status = Status::DataTypeMismatch("String", set_command->value_type_str());
@@ -324,6 +343,32 @@ bool PhysicalCommand::Execute(QueryContext *query_context, OperatorState *operat
                             config->SetOptimizeInterval(interval);
                             break;
                         }
+                        case GlobalOptionIndex::kJoinMemoryBudget: {
+                            if (set_command->value_type() != SetVarType::kInteger) {
+                                Status status = Status::DataTypeMismatch("Integer", set_command->value_type_str());
+                                RecoverableError(status);
+                            }
+                            i64 join_memory_budget = set_command->value_int();
+                            if (join_memory_budget < 0) {
+                                Status status = Status::InvalidCommand(fmt::format("Attempt to set join memory budget: {}", join_memory_budget));
+                                RecoverableError(status);
+                            }
+                            config->SetJoinMemoryBudget(join_memory_budget);
+                            break;
+                        }
+                        case GlobalOptionIndex::kImportPartitionSize: {
+                            if (set_command->value_type() != SetVarType::kInteger) {
+                                Status status = Status::DataTypeMismatch("Integer", set_command->value_type_str());
+                                RecoverableError(status);
+                            }
+                            i64 import_partition_size = set_command->value_int();
+                            if (import_partition_size <= 0) {
+                                Status status = Status::InvalidCommand(fmt::format("Attempt to set import partition size: {}", import_partition_size));
+                                RecoverableError(status);
+                            }
+                            config->SetImportPartitionSize(import_partition_size);
+                            break;
+                        }
                         case GlobalOptionIndex::kInvalid: {
                             Status status = Status::InvalidCommand(fmt::format("Unknown config: {}", set_command->var_name()));
                             RecoverableError(status);
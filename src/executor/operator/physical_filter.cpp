@@ -27,6 +27,7 @@ import operator_state;
 import expression_state;
 import expression_selector;
 import data_block;
+import selection;
 import logger;
 import third_party;
 
@@ -67,20 +68,21 @@ bool PhysicalFilter::Execute(QueryContext *, OperatorState *operator_state) {
     SizeT input_block_count = prev_op_state->data_block_array_.size();
 
     for(SizeT block_idx = 0; block_idx < input_block_count; ++ block_idx) {
-
-        // create uninitialized data block for output
-        UniquePtr<DataBlock> data_block = DataBlock::MakeUniquePtr();
-        DataBlock* output_data_block = data_block.get();
-        operator_state->data_block_array_.emplace_back(std::move(data_block));
-
+        UniquePtr<DataBlock> &input_data_block = prev_op_state->data_block_array_[block_idx];
+        if (input_data_block->HasSelection()) {
+            // Columns loaded after the previous filter are only valid on the selected rows.
+            input_data_block->MaterializeSelection();
+        }
         SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition_);
-        DataBlock* input_data_block = prev_op_state->data_block_array_[block_idx].get();
 
+        // Only the selection of the input data block is computed, the columns are gathered when a later operator needs them.
         // selector contains a pointer to input data, which should not be shared by multiple tasks
         ExpressionSelector selector;
-        SizeT selected_count = selector.Select(condition_, condition_state, input_data_block, output_data_block, input_data_block->row_count());
+        SharedPtr<Selection> selection = selector.Select(condition_, condition_state, input_data_block.get(), input_data_block->row_count());
+        input_data_block->SetSelection(selection);
 
-        LOG_TRACE(fmt::format("{} rows after filter", selected_count));
+        LOG_TRACE(fmt::format("{} rows after filter", selection->Size()));
+        operator_state->data_block_array_.emplace_back(std::move(input_data_block));
     }
 
     // Clean input data block array;
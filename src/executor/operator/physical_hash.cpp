@@ -14,15 +14,130 @@
 
 module;
 
+module physical_hash;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_hash;
+import base_expression;
+import data_block;
+import column_vector;
+import selection;
+import hash_table;
+import expression_evaluator;
+import expression_state;
+import infinity_exception;
+import internal_types;
+import data_type;
 
 namespace infinity {
 
 void PhysicalHash::Init() {}
 
-bool PhysicalHash::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalHash::Execute(QueryContext *, OperatorState *operator_state) {
+    OperatorState *prev_op_state = operator_state->prev_op_state_;
+    auto *hash_operator_state = static_cast<HashOperatorState *>(operator_state);
+    SizeT partition_count = hash_operator_state->partition_count_;
+    Vector<Vector<UniquePtr<DataBlock>>> &partition_blocks = hash_operator_state->partition_blocks_;
+    partition_blocks.resize(partition_count);
+
+    if (partition_count > 1 && hash_operator_state->hash_table_.get() == nullptr) {
+        // The table only hashes the keys, no key is inserted into it.
+        Vector<SharedPtr<DataType>> key_types;
+        key_types.reserve(hash_keys_.size());
+        for (const auto &hash_key : hash_keys_) {
+            key_types.emplace_back(MakeShared<DataType>(hash_key->Type()));
+        }
+        hash_operator_state->hash_table_ = MakeUnique<HashTable>();
+        hash_operator_state->hash_table_->Init(key_types);
+    }
+
+    Vector<u64> hashes;
+    Vector<SharedPtr<Selection>> partition_selects(partition_count);
+    for (auto &input_block : prev_op_state->data_block_array_) {
+        SizeT row_count = input_block->row_count();
+        if (row_count == 0) {
+            continue;
+        }
+        if (partition_count == 1) {
+            partition_blocks[0].emplace_back(std::move(input_block));
+            continue;
+        }
+
+        DataBlock key_block;
+        EvaluateHashKeys(hash_keys_, input_block.get(), key_block);
+        hash_operator_state->hash_table_->Hash(key_block.column_vectors, row_count, hashes);
+
+        for (auto &partition_select : partition_selects) {
+            partition_select = MakeShared<Selection>();
+            partition_select->Initialize(row_count);
+        }
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            partition_selects[HashTable::PartitionOf(hashes[row_idx], partition_count)]->Append(row_idx);
+        }
+        for (SizeT partition_idx = 0; partition_idx < partition_count; ++partition_idx) {
+            if (partition_selects[partition_idx]->Size() > 0) {
+                partition_blocks[partition_idx].emplace_back(GatherRows(input_block.get(), partition_selects[partition_idx]));
+            }
+        }
+    }
+    prev_op_state->data_block_array_.clear();
+
+    if (prev_op_state->Complete()) {
+        // Every partition ends with at least one block, so every join task can see this task is completed.
+        for (auto &blocks : partition_blocks) {
+            if (blocks.empty()) {
+                auto empty_block = DataBlock::MakeUniquePtr();
+                empty_block->Init(*GetOutputTypes());
+                empty_block->Finalize();
+                blocks.emplace_back(std::move(empty_block));
+            }
+        }
+        hash_operator_state->hash_table_.reset();
+        hash_operator_state->SetComplete();
+    }
+    return true;
+}
+
+void PhysicalHash::EvaluateHashKeys(const Vector<SharedPtr<BaseExpression>> &hash_keys, const DataBlock *input_block, DataBlock &key_block) {
+    Vector<SharedPtr<DataType>> key_types;
+    key_types.reserve(hash_keys.size());
+    for (const auto &hash_key : hash_keys) {
+        key_types.emplace_back(MakeShared<DataType>(hash_key->Type()));
+    }
+    key_block.Init(key_types, input_block->capacity());
+
+    ExpressionEvaluator evaluator;
+    evaluator.Init(input_block);
+    for (SizeT key_idx = 0; key_idx < hash_keys.size(); ++key_idx) {
+        SharedPtr<ExpressionState> key_state = ExpressionState::CreateState(hash_keys[key_idx]);
+        evaluator.Execute(hash_keys[key_idx], key_state, key_block.column_vectors[key_idx]);
+    }
+}
+
+UniquePtr<DataBlock> PhysicalHash::GatherRows(const DataBlock *input_block, const SharedPtr<Selection> &input_select) {
+    auto output_block = DataBlock::MakeUniquePtr();
+    output_block->Init(input_block, input_select);
+
+    // ColumnVector::Initialize only copies the values of the selected rows
+    SizeT select_count = input_select->Size();
+    for (SizeT column_idx = 0; column_idx < input_block->column_count(); ++column_idx) {
+        const ColumnVector &input_column = *input_block->column_vectors[column_idx];
+        if (input_column.vector_type() == ColumnVectorType::kConstant || input_column.nulls_ptr_->IsAllTrue()) {
+            continue;
+        }
+        ColumnVector &output_column = *output_block->column_vectors[column_idx];
+        for (SizeT idx = 0; idx < select_count; ++idx) {
+            if (!input_column.nulls_ptr_->IsTrue(input_select->Get(idx))) {
+                output_column.nulls_ptr_->SetFalse(idx);
+            }
+        }
+    }
+    return output_block;
+}
+
+SharedPtr<Vector<String>> PhysicalHash::GetOutputNames() const { return left_->GetOutputNames(); }
+
+SharedPtr<Vector<SharedPtr<DataType>>> PhysicalHash::GetOutputTypes() const { return left_->GetOutputTypes(); }
 
 } // namespace infinity
@@ -22,6 +22,9 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import base_expression;
+import data_block;
+import selection;
 import load_meta;
 import infinity_exception;
 import internal_types;
@@ -30,14 +33,12 @@ import logger;
 
 namespace infinity {
 
+// Hash exchange of a hash join input. The rows are partitioned by the hash of the join keys into one partition per
+// PhysicalHashJoin task, so the matching rows of both join sides always meet in the same join task.
 export class PhysicalHash final : public PhysicalOperator {
 public:
-    explicit PhysicalHash(SharedPtr<Vector<String>> output_names,
-                          SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                          u64 id,
-                          SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kHash, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+    explicit PhysicalHash(u64 id, UniquePtr<PhysicalOperator> left, Vector<SharedPtr<BaseExpression>> hash_keys, SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kHash, std::move(left), nullptr, id, load_metas), hash_keys_(std::move(hash_keys)) {}
 
     ~PhysicalHash() override = default;
 
@@ -45,19 +46,22 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    SharedPtr<Vector<String>> GetOutputNames() const final;
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
-    SizeT TaskletCount() override {
-        String error_message = "Not implement: TaskletCount not Implement";
-        UnrecoverableError(error_message);
-        return 0;
-    }
+    SizeT TaskletCount() override { return left_->TaskletCount(); }
+
+    inline const Vector<SharedPtr<BaseExpression>> &hash_keys() const { return hash_keys_; }
+
+    // Evaluate the hash key expressions of the input block into key_block.
+    static void EvaluateHashKeys(const Vector<SharedPtr<BaseExpression>> &hash_keys, const DataBlock *input_block, DataBlock &key_block);
+
+    // Copy the selected rows of the input block, including their null flags.
+    static UniquePtr<DataBlock> GatherRows(const DataBlock *input_block, const SharedPtr<Selection> &input_select);
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    Vector<SharedPtr<BaseExpression>> hash_keys_{};
 };
 
 } // namespace infinity
@@ -14,23 +14,516 @@
 
 module;
 
-#include <string>
+module physical_hash_join;
+
+import stl;
 import query_context;
 import operator_state;
-import stl;
+import physical_hash;
+import base_expression;
+import data_block;
+import column_vector;
+import selection;
+import hash_table;
+import expression_evaluator;
+import expression_state;
+import expression_selector;
+import join_reference;
+import storage;
+import buffer_manager;
+import virtual_store;
+import local_file_handle;
+import random;
+import default_values;
+import config;
+import status;
+import infinity_exception;
+import logical_type;
+import internal_types;
+import data_type;
+import logger;
+import third_party;
 
+namespace infinity {
 
-module physical_hash_join;
+namespace {
 
-namespace infinity {
+// Spill partitions of a join task. They take the hash bits right below the bits of the partition of the join task.
+constexpr SizeT kSpillPartitionCount = 16;
+
+inline SizeT SpillPartitionOf(u64 hash) { return (hash >> 40) % kSpillPartitionCount; }
+
+void AppendNullRows(ColumnVector &column, SizeT row_count) {
+    SizeT row_start = column.Size();
+    const DataType &data_type = *column.data_type();
+    if (data_type.type() == LogicalType::kVarchar) {
+        for (SizeT idx = 0; idx < row_count; ++idx) {
+            column.AppendVarchar({});
+        }
+    } else if (data_type.Plain() || data_type.type() == LogicalType::kBoolean) {
+        Vector<char> zero_value(data_type.Size(), 0);
+        for (SizeT idx = 0; idx < row_count; ++idx) {
+            column.AppendByPtr(zero_value.data());
+        }
+    } else {
+        RecoverableError(Status::NotSupport(fmt::format("Null padding of {} column in hash join", data_type.ToString())));
+    }
+    for (SizeT idx = 0; idx < row_count; ++idx) {
+        column.nulls_ptr_->SetFalse(row_start + idx);
+    }
+}
+
+// Columns of `row_count` null rows, which pad the side of the unmatched rows of an outer join.
+Vector<SharedPtr<ColumnVector>> MakeNullColumns(const Vector<SharedPtr<DataType>> &column_types, SizeT row_count) {
+    Vector<SharedPtr<ColumnVector>> null_columns;
+    null_columns.reserve(column_types.size());
+    for (const auto &column_type : column_types) {
+        auto null_column = ColumnVector::Make(column_type);
+        null_column->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+        AppendNullRows(*null_column, row_count);
+        null_columns.emplace_back(std::move(null_column));
+    }
+    return null_columns;
+}
+
+Vector<SharedPtr<DataBlock>> ReadSpillFile(const String &spill_path) {
+    auto [spill_file, status] = VirtualStore::Open(spill_path, FileAccessMode::kRead);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    i64 file_size = spill_file->FileSize();
+    Vector<char> buffer(file_size);
+    auto [read_size, read_status] = spill_file->Read(buffer.data(), file_size);
+    if (!read_status.ok()) {
+        RecoverableError(read_status);
+    }
+    if ((i64)read_size != file_size) {
+        UnrecoverableError(fmt::format("Hash join spill file {} is truncated, read {} of {} bytes", spill_path, read_size, file_size));
+    }
+
+    // Each record is the size of the block followed by the serialized block
+    Vector<SharedPtr<DataBlock>> blocks;
+    const char *ptr = buffer.data();
+    const char *const end = ptr + file_size;
+    while (ptr < end) {
+        i32 block_size = 0;
+        std::memcpy(&block_size, ptr, sizeof(i32));
+        ptr += sizeof(i32);
+        const char *block_ptr = ptr;
+        blocks.emplace_back(DataBlock::ReadAdv(block_ptr, block_size));
+        ptr += block_size;
+    }
+    return blocks;
+}
+
+} // namespace
 
 void PhysicalHashJoin::Init() {}
 
-bool PhysicalHashJoin::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalHashJoin::Execute(QueryContext *query_context, OperatorState *operator_state) {
+    auto *hash_join_state = static_cast<HashJoinOperatorState *>(operator_state);
+    UniquePtr<DataBlock> input_block = std::move(hash_join_state->input_data_block_);
+    const bool spilled = !hash_join_state->spill_paths_.empty();
+
+    if (input_block.get() != nullptr && input_block->row_count() > 0) {
+        if (spilled) {
+            SpillBlock(hash_join_state, input_block.get(), hash_join_state->input_is_build_);
+        } else if (hash_join_state->input_is_build_) {
+            hash_join_state->build_bytes_ += input_block->GetSizeInBytes();
+            hash_join_state->build_blocks_.emplace_back(std::move(input_block));
+
+            i64 memory_budget = query_context->global_config()->JoinMemoryBudget();
+            if (memory_budget > 0 && hash_join_state->build_bytes_ > (SizeT)memory_budget) {
+                StartSpill(query_context, hash_join_state, memory_budget);
+            }
+        } else {
+            hash_join_state->probe_blocks_.emplace_back(std::move(input_block));
+        }
+    }
+
+    if (hash_join_state->spill_paths_.empty() && hash_join_state->build_complete_) {
+        // The whole build partition is in memory, probe the buffered blocks and then every new probe block as it arrives.
+        if (hash_join_state->hash_table_.get() == nullptr) {
+            BuildHashTable(hash_join_state);
+        }
+        for (const auto &probe_block : hash_join_state->probe_blocks_) {
+            Probe(hash_join_state, probe_block.get());
+        }
+        hash_join_state->probe_blocks_.clear();
+    }
+
+    if (hash_join_state->input_complete_) {
+        if (!hash_join_state->spill_paths_.empty()) {
+            JoinSpillPartitions(hash_join_state);
+        } else if (join_type_ == JoinType::kFull) {
+            OutputUnmatchedBuildRows(hash_join_state);
+        }
+        hash_join_state->hash_table_.reset();
+        hash_join_state->build_blocks_.clear();
+        hash_join_state->SetComplete();
+    }
+    return true;
+}
+
+void PhysicalHashJoin::BuildHashTable(HashJoinOperatorState *hash_join_state) const {
+    const Vector<SharedPtr<BaseExpression>> &build_keys = build_side()->hash_keys();
+    Vector<SharedPtr<DataType>> key_types;
+    key_types.reserve(build_keys.size());
+    for (const auto &build_key : build_keys) {
+        key_types.emplace_back(MakeShared<DataType>(build_key->Type()));
+    }
+    hash_join_state->hash_table_ = MakeUnique<HashTable>();
+    hash_join_state->hash_table_->Init(key_types);
+    hash_join_state->group_heads_.clear();
+    hash_join_state->build_row_next_.clear();
+    hash_join_state->build_rows_.clear();
+    hash_join_state->build_matched_.clear();
+
+    Vector<u32> group_ids;
+    SizeT build_block_count = hash_join_state->build_blocks_.size();
+    for (SizeT block_idx = 0; block_idx < build_block_count; ++block_idx) {
+        const DataBlock *build_block = hash_join_state->build_blocks_[block_idx].get();
+        SizeT row_count = build_block->row_count();
+        if (join_type_ == JoinType::kFull) {
+            hash_join_state->build_matched_.emplace_back(row_count, false);
+        }
+        DataBlock key_block;
+        PhysicalHash::EvaluateHashKeys(build_keys, build_block, key_block);
+        hash_join_state->hash_table_->FindOrInsert(key_block.column_vectors, row_count, group_ids);
+        hash_join_state->group_heads_.resize(hash_join_state->hash_table_->GroupCount(), HashTable::kEmptySlot);
+
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            // A null key never equals any key, so the row can't be matched.
+            bool null_key = false;
+            for (const auto &key_column : key_block.column_vectors) {
+                SizeT key_row = key_column->vector_type() == ColumnVectorType::kConstant ? 0 : row_idx;
+                if (!key_column->nulls_ptr_->IsTrue(key_row)) {
+                    null_key = true;
+                    break;
+                }
+            }
+            if (null_key) {
+                continue;
+            }
+            u32 build_row = hash_join_state->build_rows_.size();
+            hash_join_state->build_rows_.emplace_back(block_idx, row_idx);
+            hash_join_state->build_row_next_.emplace_back(hash_join_state->group_heads_[group_ids[row_idx]]);
+            hash_join_state->group_heads_[group_ids[row_idx]] = build_row;
+        }
+    }
+}
+
+void PhysicalHashJoin::Probe(HashJoinOperatorState *hash_join_state, const DataBlock *probe_block) const {
+    SizeT row_count = probe_block->row_count();
+    if (row_count == 0) {
+        return;
+    }
+    DataBlock key_block;
+    PhysicalHash::EvaluateHashKeys(probe_side()->hash_keys(), probe_block, key_block);
+    Vector<u32> group_ids;
+    hash_join_state->hash_table_->Find(key_block.column_vectors, row_count, group_ids);
+
+    // The group of null keys has no build row, so a probe row with null key has no match either.
+    const Vector<u32> &group_heads = hash_join_state->group_heads_;
+    Vector<bool> probe_matched(row_count, false);
+    const bool exists_only = join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti;
+    if (exists_only && condition_.get() == nullptr) {
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            probe_matched[row_idx] = group_ids[row_idx] != HashTable::kEmptySlot && group_heads[group_ids[row_idx]] != HashTable::kEmptySlot;
+        }
+    } else {
+        Vector<u32> probe_rows;
+        Vector<u32> build_rows;
+        probe_rows.reserve(DEFAULT_VECTOR_SIZE);
+        build_rows.reserve(DEFAULT_VECTOR_SIZE);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            if (group_ids[row_idx] == HashTable::kEmptySlot) {
+                continue;
+            }
+            for (u32 build_row = group_heads[group_ids[row_idx]]; build_row != HashTable::kEmptySlot;
+                 build_row = hash_join_state->build_row_next_[build_row]) {
+                probe_rows.emplace_back(row_idx);
+                build_rows.emplace_back(build_row);
+                if (probe_rows.size() == DEFAULT_VECTOR_SIZE) {
+                    JoinPairs(hash_join_state, probe_block, probe_rows, build_rows, probe_matched);
+                }
+            }
+        }
+        JoinPairs(hash_join_state, probe_block, probe_rows, build_rows, probe_matched);
+    }
+
+    switch (join_type_) {
+        case JoinType::kLeft:
+        case JoinType::kRight:
+        case JoinType::kFull: {
+            OutputProbeRows(hash_join_state, probe_block, probe_matched, false, true);
+            break;
+        }
+        case JoinType::kSemi: {
+            OutputProbeRows(hash_join_state, probe_block, probe_matched, true, false);
+            break;
+        }
+        case JoinType::kAnti: {
+            OutputProbeRows(hash_join_state, probe_block, probe_matched, false, false);
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+}
+
+void PhysicalHashJoin::JoinPairs(HashJoinOperatorState *hash_join_state,
+                                 const DataBlock *probe_block,
+                                 Vector<u32> &probe_rows,
+                                 Vector<u32> &build_rows,
+                                 Vector<bool> &probe_matched) const {
+    SizeT pair_count = probe_rows.size();
+    if (pair_count == 0) {
+        return;
+    }
+
+    // 1. Gather the probe side rows with a selection and the build side rows one by one
+    auto probe_select = MakeShared<Selection>();
+    probe_select->Initialize(pair_count);
+    for (u32 probe_row : probe_rows) {
+        probe_select->Append(probe_row);
+    }
+    UniquePtr<DataBlock> probe_part = PhysicalHash::GatherRows(probe_block, probe_select);
+
+    SharedPtr<Vector<SharedPtr<DataType>>> build_types = build_side()->GetOutputTypes();
+    Vector<SharedPtr<ColumnVector>> build_columns;
+    build_columns.reserve(build_types->size());
+    for (SizeT column_idx = 0; column_idx < build_types->size(); ++column_idx) {
+        auto build_column = ColumnVector::Make((*build_types)[column_idx]);
+        build_column->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+        for (SizeT idx = 0; idx < pair_count; ++idx) {
+            auto [block_idx, row_idx] = hash_join_state->build_rows_[build_rows[idx]];
+            const ColumnVector &input_column = *hash_join_state->build_blocks_[block_idx]->column_vectors[column_idx];
+            build_column->AppendWith(input_column, row_idx, 1);
+            if (!input_column.nulls_ptr_->IsTrue(row_idx)) {
+                build_column->nulls_ptr_->SetFalse(idx);
+            }
+        }
+        build_columns.emplace_back(std::move(build_column));
+    }
+    UniquePtr<DataBlock> joined_block = MakeJoinedBlock(probe_part->column_vectors, std::move(build_columns));
+
+    // 2. Filter the pairs by the non-equi conditions
+    const bool output_pairs = join_type_ != JoinType::kSemi && join_type_ != JoinType::kAnti;
+    const bool track_build = join_type_ == JoinType::kFull;
+    if (condition_.get() == nullptr) {
+        for (u32 probe_row : probe_rows) {
+            probe_matched[probe_row] = true;
+        }
+        if (track_build) {
+            for (u32 build_row : build_rows) {
+                auto [block_idx, row_idx] = hash_join_state->build_rows_[build_row];
+                hash_join_state->build_matched_[block_idx][row_idx] = true;
+            }
+        }
+        if (output_pairs) {
+            hash_join_state->data_block_array_.emplace_back(std::move(joined_block));
+        }
+    } else {
+        ExpressionEvaluator evaluator;
+        evaluator.Init(joined_block.get());
+        SharedPtr<ExpressionState> condition_state = ExpressionState::CreateState(condition_);
+        SharedPtr<ColumnVector> &condition_column = condition_state->OutputColumnVector();
+        evaluator.Execute(condition_, condition_state, condition_column);
+
+        auto true_select = MakeShared<Selection>();
+        true_select->Initialize(pair_count);
+        ExpressionSelector::Select(condition_column, pair_count, true_select, true);
+        SizeT true_count = true_select->Size();
+        for (SizeT idx = 0; idx < true_count; ++idx) {
+            SizeT pair_idx = true_select->Get(idx);
+            probe_matched[probe_rows[pair_idx]] = true;
+            if (track_build) {
+                auto [block_idx, row_idx] = hash_join_state->build_rows_[build_rows[pair_idx]];
+                hash_join_state->build_matched_[block_idx][row_idx] = true;
+            }
+        }
+        if (output_pairs && true_count == pair_count) {
+            hash_join_state->data_block_array_.emplace_back(std::move(joined_block));
+        } else if (output_pairs && true_count > 0) {
+            hash_join_state->data_block_array_.emplace_back(PhysicalHash::GatherRows(joined_block.get(), true_select));
+        }
+    }
+    probe_rows.clear();
+    build_rows.clear();
+}
+
+void PhysicalHashJoin::OutputProbeRows(HashJoinOperatorState *hash_join_state,
+                                       const DataBlock *probe_block,
+                                       const Vector<bool> &probe_matched,
+                                       bool matched,
+                                       bool pad_build_side) const {
+    SizeT row_count = probe_block->row_count();
+    auto probe_select = MakeShared<Selection>();
+    probe_select->Initialize(row_count);
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        if (probe_matched[row_idx] == matched) {
+            probe_select->Append(row_idx);
+        }
+    }
+    SizeT output_count = probe_select->Size();
+    if (output_count == 0) {
+        return;
+    }
+    UniquePtr<DataBlock> probe_part = PhysicalHash::GatherRows(probe_block, probe_select);
+    if (!pad_build_side) {
+        hash_join_state->data_block_array_.emplace_back(std::move(probe_part));
+        return;
+    }
+
+    Vector<SharedPtr<ColumnVector>> build_columns = MakeNullColumns(*build_side()->GetOutputTypes(), output_count);
+    hash_join_state->data_block_array_.emplace_back(MakeJoinedBlock(probe_part->column_vectors, std::move(build_columns)));
+}
+
+void PhysicalHashJoin::OutputUnmatchedBuildRows(HashJoinOperatorState *hash_join_state) const {
+    SharedPtr<Vector<SharedPtr<DataType>>> probe_types = probe_side()->GetOutputTypes();
+    SizeT build_block_count = hash_join_state->build_blocks_.size();
+    for (SizeT block_idx = 0; block_idx < build_block_count; ++block_idx) {
+        const DataBlock *build_block = hash_join_state->build_blocks_[block_idx].get();
+        const Vector<bool> &build_matched = hash_join_state->build_matched_[block_idx];
+        SizeT row_count = build_block->row_count();
+        auto build_select = MakeShared<Selection>();
+        build_select->Initialize(row_count);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            if (!build_matched[row_idx]) {
+                build_select->Append(row_idx);
+            }
+        }
+        SizeT output_count = build_select->Size();
+        if (output_count == 0) {
+            continue;
+        }
+        UniquePtr<DataBlock> build_part = PhysicalHash::GatherRows(build_block, build_select);
+        Vector<SharedPtr<ColumnVector>> probe_columns = MakeNullColumns(*probe_types, output_count);
+        hash_join_state->data_block_array_.emplace_back(MakeJoinedBlock(std::move(probe_columns), build_part->column_vectors));
+    }
+}
+
+UniquePtr<DataBlock> PhysicalHashJoin::MakeJoinedBlock(Vector<SharedPtr<ColumnVector>> probe_columns,
+                                                       Vector<SharedPtr<ColumnVector>> build_columns) const {
+    // The output is always the left columns followed by the right columns
+    Vector<SharedPtr<ColumnVector>> &output_columns = build_left_ ? build_columns : probe_columns;
+    Vector<SharedPtr<ColumnVector>> &right_columns = build_left_ ? probe_columns : build_columns;
+    output_columns.insert(output_columns.end(), right_columns.begin(), right_columns.end());
+
+    auto joined_block = DataBlock::MakeUniquePtr();
+    joined_block->Init(output_columns);
+    return joined_block;
+}
+
+void PhysicalHashJoin::StartSpill(QueryContext *query_context, HashJoinOperatorState *hash_join_state, i64 memory_budget) const {
+    String temp_dir = *query_context->storage()->buffer_manager()->GetTempDir();
+    String spill_prefix = fmt::format("{}/hash_join_{}", temp_dir, RandomString(DEFAULT_RANDOM_NAME_LEN));
+    LOG_INFO(fmt::format("Hash join build side exceeds the memory budget {}, spill to {}", memory_budget, spill_prefix));
+
+    for (SizeT spill_idx = 0; spill_idx < 2 * kSpillPartitionCount; ++spill_idx) {
+        String spill_path =
+            fmt::format("{}_{}_{}", spill_prefix, spill_idx < kSpillPartitionCount ? "build" : "probe", spill_idx % kSpillPartitionCount);
+        auto [spill_file, status] = VirtualStore::Open(spill_path, FileAccessMode::kWrite);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        hash_join_state->spill_paths_.emplace_back(std::move(spill_path));
+        hash_join_state->spill_files_.emplace_back(std::move(spill_file));
+    }
+
+    // The table hashes the keys of the spilled blocks until the spill partitions are joined
+    const Vector<SharedPtr<BaseExpression>> &build_keys = build_side()->hash_keys();
+    Vector<SharedPtr<DataType>> key_types;
+    key_types.reserve(build_keys.size());
+    for (const auto &build_key : build_keys) {
+        key_types.emplace_back(MakeShared<DataType>(build_key->Type()));
+    }
+    hash_join_state->hash_table_ = MakeUnique<HashTable>();
+    hash_join_state->hash_table_->Init(key_types);
+
+    for (const auto &build_block : hash_join_state->build_blocks_) {
+        SpillBlock(hash_join_state, build_block.get(), true);
+    }
+    for (const auto &probe_block : hash_join_state->probe_blocks_) {
+        SpillBlock(hash_join_state, probe_block.get(), false);
+    }
+    hash_join_state->build_blocks_.clear();
+    hash_join_state->probe_blocks_.clear();
+    hash_join_state->build_bytes_ = 0;
+}
+
+void PhysicalHashJoin::SpillBlock(HashJoinOperatorState *hash_join_state, const DataBlock *input_block, bool is_build) const {
+    SizeT row_count = input_block->row_count();
+    DataBlock key_block;
+    PhysicalHash::EvaluateHashKeys(is_build ? build_side()->hash_keys() : probe_side()->hash_keys(), input_block, key_block);
+    Vector<u64> hashes;
+    hash_join_state->hash_table_->Hash(key_block.column_vectors, row_count, hashes);
+
+    Vector<SharedPtr<Selection>> spill_selects(kSpillPartitionCount);
+    for (auto &spill_select : spill_selects) {
+        spill_select = MakeShared<Selection>();
+        spill_select->Initialize(row_count);
+    }
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        spill_selects[SpillPartitionOf(hashes[row_idx])]->Append(row_idx);
+    }
+
+    Vector<char> buffer;
+    for (SizeT spill_idx = 0; spill_idx < kSpillPartitionCount; ++spill_idx) {
+        if (spill_selects[spill_idx]->Size() == 0) {
+            continue;
+        }
+        UniquePtr<DataBlock> spill_block = PhysicalHash::GatherRows(input_block, spill_selects[spill_idx]);
+        buffer.resize(sizeof(i32) + spill_block->GetSizeInBytes());
+        char *ptr = buffer.data() + sizeof(i32);
+        spill_block->WriteAdv(ptr);
+        i32 block_size = ptr - (buffer.data() + sizeof(i32));
+        std::memcpy(buffer.data(), &block_size, sizeof(i32));
+
+        LocalFileHandle *spill_file = hash_join_state->spill_files_[is_build ? spill_idx : spill_idx + kSpillPartitionCount].get();
+        Status status = spill_file->Append(buffer.data(), sizeof(i32) + block_size);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+    }
+}
+
+void PhysicalHashJoin::JoinSpillPartitions(HashJoinOperatorState *hash_join_state) const {
+    // Close the spill files before reading them back
+    hash_join_state->spill_files_.clear();
+
+    // A spill partition is joined in memory even if it still exceeds the memory budget.
+    for (SizeT spill_idx = 0; spill_idx < kSpillPartitionCount; ++spill_idx) {
+        hash_join_state->build_blocks_ = ReadSpillFile(hash_join_state->spill_paths_[spill_idx]);
+        BuildHashTable(hash_join_state);
+        Vector<SharedPtr<DataBlock>> probe_blocks = ReadSpillFile(hash_join_state->spill_paths_[spill_idx + kSpillPartitionCount]);
+        for (const auto &probe_block : probe_blocks) {
+            Probe(hash_join_state, probe_block.get());
+        }
+        if (join_type_ == JoinType::kFull) {
+            OutputUnmatchedBuildRows(hash_join_state);
+        }
+    }
+
+    for (const auto &spill_path : hash_join_state->spill_paths_) {
+        Status status = VirtualStore::DeleteFile(spill_path);
+        if (!status.ok()) {
+            LOG_WARN(fmt::format("Fail to delete hash join spill file {}: {}", spill_path, status.message()));
+        }
+    }
+    hash_join_state->spill_paths_.clear();
+}
 
 SharedPtr<Vector<String>> PhysicalHashJoin::GetOutputNames() const {
     SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
     SharedPtr<Vector<String>> left_output_names = left_->GetOutputNames();
+    if (join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti) {
+        // Semi and anti join only output the left columns
+        *result = *left_output_names;
+        return result;
+    }
     SharedPtr<Vector<String>> right_output_names = right_->GetOutputNames();
 
     result->reserve(left_output_names->size() + right_output_names->size());
@@ -48,6 +541,10 @@ SharedPtr<Vector<String>> PhysicalHashJoin::GetOutputNames() const {
 SharedPtr<Vector<SharedPtr<DataType>>> PhysicalHashJoin::GetOutputTypes() const {
     SharedPtr<Vector<SharedPtr<DataType>>> result = MakeShared<Vector<SharedPtr<DataType>>>();
     SharedPtr<Vector<SharedPtr<DataType>>> left_output_types = left_->GetOutputTypes();
+    if (join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti) {
+        *result = *left_output_types;
+        return result;
+    }
     SharedPtr<Vector<SharedPtr<DataType>>> right_output_types = right_->GetOutputTypes();
 
     result->reserve(left_output_types->size() + right_output_types->size());
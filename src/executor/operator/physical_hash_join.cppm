@@ -22,18 +22,37 @@ import query_context;
 import operator_state;
 import physical_operator;
 import physical_operator_type;
+import physical_hash;
+import base_expression;
+import data_block;
+import column_vector;
 import load_meta;
 import infinity_exception;
 import internal_types;
+import join_reference;
 import data_type;
 import logger;
 
 namespace infinity {
 
+// Partitioned hash join. Both children are PhysicalHash exchanges on the join keys, so join task i receives partition i of
+// both sides. Every task builds a hash table on its partition of the build side, which is the left input of a right join,
+// the smaller input of an inner join and the right input otherwise, and probes it with the blocks of the other side. A
+// full join outputs the unmatched build rows once its partition is probed. When the buffered build side of a task
+// exceeds the join memory budget, both sides are partitioned again into spill files and joined one spill partition at a
+// time once the input is complete.
 export class PhysicalHashJoin : public PhysicalOperator {
 public:
-    explicit PhysicalHashJoin(u64 id, SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kJoinHash, nullptr, nullptr, id, load_metas) {}
+    explicit PhysicalHashJoin(u64 id,
+                              JoinType join_type,
+                              UniquePtr<PhysicalOperator> left,
+                              UniquePtr<PhysicalOperator> right,
+                              SharedPtr<BaseExpression> condition,
+                              bool build_left,
+                              SizeT task_count,
+                              SharedPtr<Vector<LoadMeta>> load_metas)
+        : PhysicalOperator(PhysicalOperatorType::kJoinHash, std::move(left), std::move(right), id, load_metas), join_type_(join_type),
+          condition_(std::move(condition)), build_left_(build_left), task_count_(task_count) {}
 
     ~PhysicalHashJoin() override = default;
 
@@ -45,11 +64,53 @@ public:
 
     SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
-    SizeT TaskletCount() override {
-        String error_message = "Not implement: TaskletCount not Implement";
-        UnrecoverableError(error_message);
-        return 0;
-    }
+    SizeT TaskletCount() override { return task_count_; }
+
+    inline JoinType join_type() const { return join_type_; }
+
+    // Non-equi join conditions, evaluated on the left ++ right columns of the rows with equal keys. nullptr if there is none.
+    inline const SharedPtr<BaseExpression> &condition() const { return condition_; }
+
+    inline bool build_left() const { return build_left_; }
+
+    inline PhysicalHash *build_side() const { return static_cast<PhysicalHash *>(build_left_ ? left_.get() : right_.get()); }
+
+    inline PhysicalHash *probe_side() const { return static_cast<PhysicalHash *>(build_left_ ? right_.get() : left_.get()); }
+
+private:
+    void BuildHashTable(HashJoinOperatorState *hash_join_state) const;
+
+    void Probe(HashJoinOperatorState *hash_join_state, const DataBlock *probe_block) const;
+
+    // Join the probe rows with the build rows of the same key, the i-th pair is (probe_rows[i], build_rows[i]).
+    void JoinPairs(HashJoinOperatorState *hash_join_state,
+                   const DataBlock *probe_block,
+                   Vector<u32> &probe_rows,
+                   Vector<u32> &build_rows,
+                   Vector<bool> &probe_matched) const;
+
+    // Output the probe rows whose probe_matched flag is `matched`, padded with null build columns if `pad_build_side`.
+    void OutputProbeRows(HashJoinOperatorState *hash_join_state,
+                         const DataBlock *probe_block,
+                         const Vector<bool> &probe_matched,
+                         bool matched,
+                         bool pad_build_side) const;
+
+    // Output the build rows that matched no probe row, padded with null probe columns. Only for a full join.
+    void OutputUnmatchedBuildRows(HashJoinOperatorState *hash_join_state) const;
+
+    UniquePtr<DataBlock> MakeJoinedBlock(Vector<SharedPtr<ColumnVector>> probe_columns, Vector<SharedPtr<ColumnVector>> build_columns) const;
+
+    void StartSpill(QueryContext *query_context, HashJoinOperatorState *hash_join_state, i64 memory_budget) const;
+
+    void SpillBlock(HashJoinOperatorState *hash_join_state, const DataBlock *input_block, bool is_build) const;
+
+    void JoinSpillPartitions(HashJoinOperatorState *hash_join_state) const;
+
+    JoinType join_type_{JoinType::kInner};
+    SharedPtr<BaseExpression> condition_{};
+    bool build_left_{false};
+    SizeT task_count_{1};
 };
 
 } // namespace infinity
@@ -19,9 +19,12 @@ module;
 // #include "zsv/common.h"
 // }
 
+#include <algorithm>
 #include <cerrno>
 #include <cstdio>
 #include <cstring>
+#include <exception>
+#include <future>
 
 #include <vector>
 
@@ -67,6 +70,9 @@ import virtual_store;
 import local_file_handle;
 import wal_manager;
 import infinity_context;
+import config;
+import import_partition;
+import task_scheduler;
 
 namespace infinity {
 
@@ -500,7 +506,212 @@ void PhysicalImport::ImportCSR(QueryContext *query_context, ImportOperatorState
     }
 }
 
+ImportSegmentBuilder::ImportSegmentBuilder(TableEntry *table_entry, Txn *txn, SegmentID first_segment_id) : table_entry_(table_entry), txn_(txn) {
+    segment_entry_ = SegmentEntry::NewSegmentEntry(table_entry_, first_segment_id, txn_);
+    NewBlock();
+}
+
+void ImportSegmentBuilder::NewBlock() {
+    block_entry_ = BlockEntry::NewBlockEntry(segment_entry_.get(), segment_entry_->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn_);
+    column_vectors_.clear();
+    for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
+        column_vectors_.emplace_back(block_entry_->GetColumnVector(txn_->buffer_mgr(), i));
+    }
+}
+
+SizeT ImportSegmentBuilder::BlockRoom() { return block_entry_->GetAvailableCapacity(); }
+
+void ImportSegmentBuilder::AddRows(SizeT row_count) {
+    block_entry_->IncreaseRowCount(row_count);
+    row_count_ += row_count;
+    if (block_entry_->GetAvailableCapacity() > 0) {
+        return;
+    }
+    LOG_DEBUG(fmt::format("Block {} saved, total rows: {}", block_entry_->block_id(), row_count_));
+    segment_entry_->AppendBlockEntry(std::move(block_entry_));
+    // we have already used all space of the segment
+    if (segment_entry_->Room() <= 0) {
+        LOG_DEBUG(fmt::format("Segment {} saved, total rows: {}", segment_entry_->segment_id(), row_count_));
+        segment_entry_->FlushNewData();
+        segments_.push_back(std::move(segment_entry_));
+        segment_entry_ = SegmentEntry::NewSegmentEntry(table_entry_, Catalog::GetNextSegmentID(table_entry_), txn_);
+    }
+    NewBlock();
+}
+
+void ImportSegmentBuilder::Finish() {
+    column_vectors_.clear();
+    if (block_entry_->row_count() > 0) {
+        segment_entry_->AppendBlockEntry(std::move(block_entry_));
+    } else {
+        std::move(*block_entry_).Cleanup();
+        block_entry_.reset();
+    }
+    if (segment_entry_->row_count() > 0) {
+        LOG_DEBUG(fmt::format("Last segment {} saved, total rows: {}", segment_entry_->segment_id(), row_count_));
+        segment_entry_->FlushNewData();
+        segments_.push_back(std::move(segment_entry_));
+    } else {
+        std::move(*segment_entry_).Cleanup();
+        segment_entry_.reset();
+    }
+}
+
+void ImportSegmentBuilder::Abort() {
+    column_vectors_.clear();
+    if (block_entry_.get() != nullptr) {
+        std::move(*block_entry_).Cleanup();
+        block_entry_.reset();
+    }
+    if (segment_entry_.get() != nullptr) {
+        std::move(*segment_entry_).Cleanup();
+        segment_entry_.reset();
+    }
+}
+
+namespace {
+
+SizeT ImportThreadCount() { return InfinityContext::instance().task_scheduler()->worker_count(); }
+
+// Offset just past the first line break at or after offset
+SizeT NextLineStart(FILE *fp, SizeT offset, SizeT file_size) {
+    char buffer[4096];
+    fseek(fp, offset, SEEK_SET);
+    while (offset < file_size) {
+        SizeT read_size = fread(buffer, 1, sizeof(buffer), fp);
+        if (read_size == 0) {
+            break;
+        }
+        if (const char *line_break = static_cast<const char *>(std::memchr(buffer, '\n', read_size)); line_break != nullptr) {
+            return offset + (line_break - buffer) + 1;
+        }
+        offset += read_size;
+    }
+    return file_size;
+}
+
+// Split a csv / jsonl file into line aligned byte ranges, a range holds about one segment of rows.
+// A csv file with quotes is not split since a line break inside a quoted field can't be told from a row break.
+Vector<ImportByteRange> PartitionLineFile(const String &file_path, bool check_quotes) {
+    FILE *fp = fopen(file_path.c_str(), "rb");
+    if (!fp) {
+        UnrecoverableError(strerror(errno));
+    }
+    DeferFn close_file([&]() { fclose(fp); });
+
+    fseek(fp, 0, SEEK_END);
+    SizeT file_size = ftell(fp);
+    if (file_size == 0) {
+        return {};
+    }
+    SizeT thread_count = ImportThreadCount();
+    SizeT min_partition_size = InfinityContext::instance().config()->ImportPartitionSize();
+    if (thread_count <= 1 || file_size < 2 * min_partition_size) {
+        return {ImportByteRange{0, file_size}};
+    }
+
+    // Estimate the bytes of one segment from the lines at the head of the file
+    Vector<char> buffer(1 << 20);
+    fseek(fp, 0, SEEK_SET);
+    SizeT sample_size = fread(buffer.data(), 1, buffer.size(), fp);
+    SizeT sample_lines = std::max<SizeT>(1, std::count(buffer.begin(), buffer.begin() + sample_size, '\n'));
+    SizeT segment_size = sample_size * DEFAULT_SEGMENT_CAPACITY / sample_lines;
+
+    if (check_quotes) {
+        fseek(fp, 0, SEEK_SET);
+        for (SizeT read_size; (read_size = fread(buffer.data(), 1, buffer.size(), fp)) > 0;) {
+            if (std::memchr(buffer.data(), '"', read_size) != nullptr) {
+                return {ImportByteRange{0, file_size}};
+            }
+        }
+    }
+
+    SizeT partition_size = ImportPartitionSize(file_size, thread_count, min_partition_size, segment_size);
+    return PartitionLines(file_size, partition_size, [&](SizeT offset) { return NextLineStart(fp, offset, file_size); });
+}
+
+// Input of the zsv parser limited to the byte range of one partition, zsv reads it like fread(buffer, 1, size, stream)
+struct CSVPartitionStream {
+    FILE *fp_{};
+    SizeT remaining_{};
+};
+
+size_t ReadCSVPartition(void *buffer, size_t n, size_t size, void *stream) {
+    auto *partition_stream = static_cast<CSVPartitionStream *>(stream);
+    size_t read_size = fread(buffer, 1, std::min(n * size, partition_stream->remaining_), partition_stream->fp_);
+    partition_stream->remaining_ -= read_size;
+    return read_size;
+}
+
+} // namespace
+
+SizeT PhysicalImport::LoadPartitions(Txn *txn, SizeT partition_count, const std::function<void(SizeT, ImportSegmentBuilder &)> &load_partition) {
+    // Segment ids of the partitions are taken in file order, so a scan returns the rows in the order of the file
+    Vector<UniquePtr<ImportSegmentBuilder>> builders;
+    for (SizeT partition_idx = 0; partition_idx < partition_count; ++partition_idx) {
+        builders.emplace_back(MakeUnique<ImportSegmentBuilder>(table_entry_, txn, Catalog::GetNextSegmentID(table_entry_)));
+    }
+    auto load = [&](SizeT partition_idx) {
+        ImportSegmentBuilder &builder = *builders[partition_idx];
+        try {
+            load_partition(partition_idx, builder);
+            builder.Finish();
+        } catch (...) {
+            builder.Abort();
+            throw;
+        }
+    };
+
+    std::exception_ptr error{};
+    if (partition_count == 1) {
+        try {
+            load(0);
+        } catch (...) {
+            error = std::current_exception();
+        }
+    } else if (partition_count > 1) {
+        SizeT thread_count = std::min(partition_count, ImportThreadCount());
+        ThreadPool load_pool(thread_count);
+        Vector<std::future<void>> futs;
+        futs.reserve(partition_count);
+        for (SizeT partition_idx = 0; partition_idx < partition_count; ++partition_idx) {
+            futs.emplace_back(load_pool.push([&load, partition_idx](int id) { load(partition_idx); }));
+        }
+        for (auto &fut : futs) {
+            try {
+                fut.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+    }
+
+    // Segments of a failed import are still handed to the transaction, its rollback removes them
+    SizeT row_count = 0;
+    for (auto &builder : builders) {
+        for (auto &segment_entry : builder->segments()) {
+            txn->Import(table_entry_, std::move(segment_entry));
+        }
+        row_count += builder->row_count();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+    return row_count;
+}
 void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    Vector<ImportByteRange> ranges = PartitionLineFile(file_path_, true);
+    SizeT row_count = LoadPartitions(query_context->GetTxn(), ranges.size(), [&](SizeT partition_idx, ImportSegmentBuilder &builder) {
+        ImportCSVPartition(ranges[partition_idx], header_ && partition_idx == 0, builder);
+    });
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
+
+void PhysicalImport::ImportCSVPartition(const ImportByteRange &range, bool header, ImportSegmentBuilder &builder) {
     // opts, parser and parser_context points to each other.
     // opt -> parser_context
     // parser->opt
@@ -509,148 +720,64 @@ void PhysicalImport::ImportCSV(QueryContext *query_context, ImportOperatorState
     if (!fp) {
         UnrecoverableError(strerror(errno));
     }
+    DeferFn close_file([&]() { fclose(fp); });
+    fseek(fp, range.begin_, SEEK_SET);
+    CSVPartitionStream partition_stream{fp, range.end_ - range.begin_};
 
-    UniquePtr<ZxvParserCtx> parser_context = nullptr;
-    Txn *txn = query_context->GetTxn();
-    {
-        auto *buffer_mgr = txn->buffer_mgr();
-        u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-        SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-        UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
-        Vector<ColumnVector> column_vectors;
-        int column_count = table_entry_->ColumnCount();
-        for (int i = 0; i < column_count; ++i) {
-            column_vectors.emplace_back(block_entry->GetColumnVector(buffer_mgr, i));
-        }
-        parser_context = MakeUnique<ZxvParserCtx>(table_entry_, txn, segment_entry, std::move(block_entry), std::move(column_vectors), delimiter_);
-    }
+    ZxvParserCtx parser_context(table_entry_, &builder, delimiter_);
 
     auto opts = MakeUnique<ZsvOpts>();
-    if (header_) {
+    if (header) {
         opts->row_handler = CSVHeaderHandler;
     } else {
         opts->row_handler = CSVRowHandler;
     }
     opts->delimiter = delimiter_;
-    opts->stream = fp;
-    opts->ctx = parser_context.get();
+    opts->read = ReadCSVPartition;
+    opts->stream = &partition_stream;
+    opts->ctx = &parser_context;
     opts->buffsize = (1 << 20); // default buffer size 256k, we use 1M
 
-    parser_context->parser_ = ZsvParser(opts.get());
+    parser_context.parser_ = ZsvParser(opts.get());
 
     ZsvStatus csv_parser_status;
-    try {
-        while ((csv_parser_status = parser_context->parser_.ParseMore()) == zsv_status_ok) {
-            ;
-        }
-    } catch (const ParserException &e) {
-        parser_context->column_vectors_.clear();
-        std::move(*parser_context->block_entry_).Cleanup();
-        std::move(*parser_context->segment_entry_).Cleanup();
-        throw;
-    } catch (const RecoverableException &e) {
-        parser_context->column_vectors_.clear();
-        std::move(*parser_context->block_entry_).Cleanup();
-        std::move(*parser_context->segment_entry_).Cleanup();
-        throw;
-    }
-    parser_context->parser_.Finish();
-
-    { // add the last segment entry
-        auto segment_entry = parser_context->segment_entry_;
-        auto &block_entry = parser_context->block_entry_;
-        if (block_entry->row_count() > 0) {
-            segment_entry->AppendBlockEntry(std::move(block_entry));
-        } else {
-            parser_context->column_vectors_.clear();
-            std::move(*block_entry).Cleanup();
-        }
-        if (segment_entry->row_count() == 0) {
-            parser_context->column_vectors_.clear();
-            std::move(*segment_entry).Cleanup();
-        } else {
-            SaveSegmentData(table_entry_, txn, segment_entry);
-        }
+    while ((csv_parser_status = parser_context.parser_.ParseMore()) == zsv_status_ok) {
+        ;
     }
-    fclose(fp);
+    parser_context.parser_.Finish();
 
     if (csv_parser_status != zsv_status_no_more_input) {
-        if (parser_context->err_msg_.get() != nullptr) {
-            UnrecoverableError(*parser_context->err_msg_);
+        if (parser_context.err_msg_.get() != nullptr) {
+            UnrecoverableError(*parser_context.err_msg_);
         } else {
             String err_msg = ZsvParser::ParseStatusDesc(csv_parser_status);
             UnrecoverableError(err_msg);
         }
     }
-
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", parser_context->row_count_));
-    import_op_state->result_msg_ = std::move(result_msg);
 }
 
 void PhysicalImport::ImportJSONL(QueryContext *query_context, ImportOperatorState *import_op_state) {
-    UniquePtr<StreamReader> stream_reader = VirtualStore::OpenStreamReader(file_path_);
-
-    Txn *txn = query_context->GetTxn();
-    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-    UniquePtr<BlockEntry> block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), 0, 0, table_entry_->ColumnCount(), txn);
+    Vector<ImportByteRange> ranges = PartitionLineFile(file_path_, false);
+    SizeT row_count = LoadPartitions(query_context->GetTxn(), ranges.size(), [&](SizeT partition_idx, ImportSegmentBuilder &builder) {
+        ImportJSONLPartition(ranges[partition_idx], builder);
+    });
 
-    Vector<ColumnVector> column_vectors;
-    for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-        column_vectors.emplace_back(block_entry->GetColumnVector(txn->buffer_mgr(), i));
-    }
-
-    SizeT row_count{0};
-    while (true) {
-        String json_str;
-        if (stream_reader->ReadLine(json_str)) {
-            nlohmann::json line_json = nlohmann::json::parse(json_str);
-            try {
-                JSONLRowHandler(line_json, column_vectors);
-            } catch (const RecoverableException &e) {
-                column_vectors.clear();
-                std::move(*block_entry).Cleanup();
-                std::move(*segment_entry).Cleanup();
-                throw;
-            }
-            block_entry->IncreaseRowCount(1);
-            ++row_count;
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
 
-            if (block_entry->GetAvailableCapacity() <= 0) {
-                LOG_DEBUG(fmt::format("Block {} saved, total rows: {}", block_entry->block_id(), row_count));
-                segment_entry->AppendBlockEntry(std::move(block_entry));
-                if (segment_entry->Room() <= 0) {
-                    LOG_DEBUG(fmt::format("Segment {} saved, total rows: {}", segment_entry->segment_id(), row_count));
-                    SaveSegmentData(table_entry_, txn, segment_entry);
-                    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-                    segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-                }
+void PhysicalImport::ImportJSONLPartition(const ImportByteRange &range, ImportSegmentBuilder &builder) {
+    UniquePtr<StreamReader> stream_reader = VirtualStore::OpenStreamReader(file_path_);
+    stream_reader->Seek(range.begin_);
 
-                block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-                column_vectors.clear();
-                for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-                    column_vectors.emplace_back(block_entry->GetColumnVector(txn->buffer_mgr(), i));
-                }
-            }
-        } else {
-            if (block_entry->row_count() == 0) {
-                column_vectors.clear();
-                std::move(*block_entry).Cleanup();
-            } else {
-                segment_entry->AppendBlockEntry(std::move(block_entry));
-            }
-            if (segment_entry->row_count() == 0) {
-                std::move(*segment_entry).Cleanup();
-            } else {
-                SaveSegmentData(table_entry_, txn, segment_entry);
-                LOG_DEBUG(fmt::format("Last segment {} saved, total rows: {}", segment_entry->segment_id(), row_count));
-            }
-            break;
-        }
+    SizeT offset = range.begin_;
+    String json_str;
+    while (offset < range.end_ && stream_reader->ReadLine(json_str)) {
+        offset += json_str.size() + 1;
+        nlohmann::json line_json = nlohmann::json::parse(json_str);
+        JSONLRowHandler(line_json, builder.column_vectors());
+        builder.AddRows(1);
     }
-
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
-    import_op_state->result_msg_ = std::move(result_msg);
 }
 
 void PhysicalImport::ImportJSON(QueryContext *query_context, ImportOperatorState *import_op_state) {
@@ -771,12 +898,7 @@ void PhysicalImport::CSVRowHandler(void *context) {
 
     auto *table_entry = parser_context->table_entry_;
     SizeT column_count = parser_context->parser_.CellCount();
-
-    auto *txn = parser_context->txn_;
-    auto *buffer_mgr = txn->buffer_mgr();
-
-    auto segment_entry = parser_context->segment_entry_;
-    UniquePtr<BlockEntry> &block_entry = parser_context->block_entry_;
+    Vector<ColumnVector> &column_vectors = parser_context->builder_->column_vectors();
 
     // if column count is larger than columns defined from schema, extra columns are abandoned
     if (column_count > table_entry->ColumnCount()) {
@@ -800,12 +922,12 @@ void PhysicalImport::CSVRowHandler(void *context) {
         auto column_def = table_entry->GetColumnDefByIdx(column_idx);
         if (cell.len) {
             str_view = std::string_view((char *)cell.str, cell.len);
-            auto &column_vector = parser_context->column_vectors_[column_idx];
+            auto &column_vector = column_vectors[column_idx];
             column_vector.AppendByStringView(str_view);
         } else {
             if (column_def->has_default_value()) {
                 auto const_expr = dynamic_cast<ConstantExpr *>(column_def->default_expr_.get());
-                auto &column_vector = parser_context->column_vectors_[column_idx];
+                auto &column_vector = column_vectors[column_idx];
                 column_vector.AppendByConstantExpr(const_expr);
             } else {
                 Status status = Status::ImportFileFormatError(
@@ -816,7 +938,7 @@ void PhysicalImport::CSVRowHandler(void *context) {
     }
     for (SizeT column_idx = column_count; column_idx < table_entry->ColumnCount(); ++column_idx) {
         auto column_def = table_entry->GetColumnDefByIdx(column_idx);
-        auto &column_vector = parser_context->column_vectors_[column_idx];
+        auto &column_vector = column_vectors[column_idx];
         if (column_def->has_default_value()) {
             auto const_expr = dynamic_cast<ConstantExpr *>(column_def->default_expr_.get());
             column_vector.AppendByConstantExpr(const_expr);
@@ -830,30 +952,8 @@ void PhysicalImport::CSVRowHandler(void *context) {
             RecoverableError(status);
         }
     }
-    block_entry->IncreaseRowCount(1);
+    parser_context->builder_->AddRows(1);
     ++parser_context->row_count_;
-
-    if (block_entry->GetAvailableCapacity() <= 0) {
-        LOG_DEBUG(fmt::format("Block {} saved", block_entry->block_id()));
-        segment_entry->AppendBlockEntry(std::move(block_entry));
-        // we have already used all space of the segment
-        if (segment_entry->Room() <= 0) {
-            LOG_DEBUG(fmt::format("Segment {} saved", segment_entry->segment_id()));
-            SaveSegmentData(table_entry, txn, segment_entry);
-            u64 segment_id = Catalog::GetNextSegmentID(parser_context->table_entry_);
-            segment_entry = SegmentEntry::NewSegmentEntry(table_entry, segment_id, txn);
-            parser_context->segment_entry_ = segment_entry;
-        }
-
-        block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry->ColumnCount(), txn);
-        parser_context->column_vectors_.clear();
-        for (SizeT i = 0; i < column_count; ++i) {
-            parser_context->column_vectors_.emplace_back(block_entry->GetColumnVector(buffer_mgr, i));
-        }
-    }
-
-    // set parser context
-    parser_context->block_entry_ = std::move(block_entry);
 }
 
 SharedPtr<ConstantExpr> BuildConstantExprFromJson(const nlohmann::json &json_object) {
@@ -1310,9 +1410,7 @@ Status CheckParquetColumns(TableEntry *table_entry, arrow::ParquetFileReader *ar
     return Status::OK();
 }
 
-} // namespace
-
-void PhysicalImport::ImportPARQUET(QueryContext *query_context, ImportOperatorState *import_op_state) {
+std::unique_ptr<arrow::ParquetFileReader> OpenParquetReader(const String &file_path) {
     arrow::MemoryPool *pool = arrow::DefaultMemoryPool();
 
     // Configure general Parquet reader settings
@@ -1324,7 +1422,7 @@ void PhysicalImport::ImportPARQUET(QueryContext *query_context, ImportOperatorSt
     arrow_reader_props.set_batch_size(DEFAULT_BLOCK_CAPACITY);
 
     arrow::ParquetFileReaderBuilder reader_builder;
-    if (const auto status = reader_builder.OpenFile(file_path_, /*memory_map=*/true, reader_properties); !status.ok()) {
+    if (const auto status = reader_builder.OpenFile(file_path, /*memory_map=*/true, reader_properties); !status.ok()) {
         RecoverableError(Status::IOError(status.ToString()));
     }
     reader_builder.memory_pool(pool);
@@ -1334,78 +1432,66 @@ void PhysicalImport::ImportPARQUET(QueryContext *query_context, ImportOperatorSt
     if (!build_result.ok()) {
         RecoverableError(Status::ImportFileFormatError(build_result.status().ToString()));
     }
-    std::unique_ptr<arrow::ParquetFileReader> arrow_reader = build_result.MoveValueUnsafe();
+    return build_result.MoveValueUnsafe();
+}
 
-    if (Status status = CheckParquetColumns(table_entry_, arrow_reader.get()); !status.ok()) {
-        RecoverableError(status);
+} // namespace
+
+void PhysicalImport::ImportPARQUET(QueryContext *query_context, ImportOperatorState *import_op_state) {
+    Vector<Vector<int>> partitions;
+    {
+        std::unique_ptr<arrow::ParquetFileReader> arrow_reader = OpenParquetReader(file_path_);
+        if (Status status = CheckParquetColumns(table_entry_, arrow_reader.get()); !status.ok()) {
+            RecoverableError(status);
+        }
+
+        // Row groups are grouped into partitions of about one segment, rounded to whole blocks
+        std::vector<int64_t> row_group_rows = arrow::ParquetRowGroupRows(arrow_reader.get());
+        SizeT total_rows = std::accumulate(row_group_rows.begin(), row_group_rows.end(), SizeT(0));
+        SizeT partition_rows = ImportPartitionSize(total_rows, ImportThreadCount(), MIN_IMPORT_PARTITION_ROWS, DEFAULT_SEGMENT_CAPACITY);
+        partition_rows = (partition_rows + DEFAULT_BLOCK_CAPACITY - 1) / DEFAULT_BLOCK_CAPACITY * DEFAULT_BLOCK_CAPACITY;
+        partitions = PartitionRowGroups(Vector<i64>(row_group_rows.begin(), row_group_rows.end()), partition_rows);
     }
 
+    SizeT row_count = LoadPartitions(query_context->GetTxn(), partitions.size(), [&](SizeT partition_idx, ImportSegmentBuilder &builder) {
+        ImportPARQUETPartition(partitions[partition_idx], builder);
+    });
+
+    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
+    import_op_state->result_msg_ = std::move(result_msg);
+}
+
+void PhysicalImport::ImportPARQUETPartition(const Vector<int> &row_groups, ImportSegmentBuilder &builder) {
+    std::unique_ptr<arrow::ParquetFileReader> arrow_reader = OpenParquetReader(file_path_);
+
     std::shared_ptr<arrow::RecordBatchReader> rb_reader;
-    if (auto status = arrow_reader->GetRecordBatchReader(&rb_reader); !status.ok()) {
+    if (auto status = arrow_reader->GetRecordBatchReader(row_groups, &rb_reader); !status.ok()) {
         RecoverableError(Status::ImportFileFormatError(status.ToString()));
     }
 
-    Txn *txn = query_context->GetTxn();
-    u64 segment_id = Catalog::GetNextSegmentID(table_entry_);
-    SizeT row_count = 0;
-    SharedPtr<SegmentEntry> segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-    UniquePtr<BlockEntry> block_entry{};
-    Vector<ColumnVector> column_vectors;
-    auto init_column_vectors_and_block_entry = [&] {
-        block_entry = BlockEntry::NewBlockEntry(segment_entry.get(), segment_entry->GetNextBlockID(), 0, table_entry_->ColumnCount(), txn);
-        column_vectors.clear();
-        for (SizeT i = 0; i < table_entry_->ColumnCount(); ++i) {
-            column_vectors.emplace_back(block_entry->GetColumnVector(txn->buffer_mgr(), i));
-        }
-    };
-    init_column_vectors_and_block_entry();
-
     for (arrow::ArrowResult<std::shared_ptr<arrow::RecordBatch>> maybe_batch : *rb_reader) {
-        // Operate on each batch...
-        if (maybe_batch.ok()) {
-            auto batch = maybe_batch.MoveValueUnsafe();
-            const auto batch_row_count = batch->num_rows();
-            const auto batch_col_count = batch->num_columns();
-            for (i64 batch_row_id = 0; batch_row_id < batch_row_count; ++batch_row_id) {
-                for (int column_idx = 0; column_idx < batch_col_count; ++column_idx) {
-                    SharedPtr<arrow::Array> column = batch->column(column_idx);
-                    if (column->length() != batch_row_count) {
-                        UnrecoverableError("column length mismatch");
-                    }
-                    try {
-                        ParquetValueHandler(column, column_vectors[column_idx], batch_row_id);
-                    } catch (const RecoverableException &) {
-                        column_vectors.clear();
-                        std::move(*block_entry).Cleanup();
-                        std::move(*segment_entry).Cleanup();
-                        throw;
-                    }
-                }
-
-                block_entry->IncreaseRowCount(1);
-                if (block_entry->GetAvailableCapacity() <= 0) {
-                    segment_entry->AppendBlockEntry(std::move(block_entry));
-                    if (segment_entry->Room() <= 0) {
-                        SaveSegmentData(table_entry_, txn, segment_entry);
-                        segment_id = Catalog::GetNextSegmentID(table_entry_);
-                        segment_entry = SegmentEntry::NewSegmentEntry(table_entry_, segment_id, txn);
-                    }
-                    init_column_vectors_and_block_entry();
-                }
+        if (!maybe_batch.ok()) {
+            RecoverableError(Status::ImportFileFormatError(maybe_batch.status().ToString()));
+        }
+        auto batch = maybe_batch.MoveValueUnsafe();
+        const i64 batch_row_count = batch->num_rows();
+        const int batch_col_count = batch->num_columns();
+        for (int column_idx = 0; column_idx < batch_col_count; ++column_idx) {
+            if (batch->column(column_idx)->length() != batch_row_count) {
+                UnrecoverableError("column length mismatch");
             }
-            row_count += batch_row_count;
+        }
+        // A batch is appended column by column, in pieces which fit in the current block
+        for (i64 batch_row_id = 0; batch_row_id < batch_row_count;) {
+            const i64 append_count = std::min<i64>(batch_row_count - batch_row_id, builder.BlockRoom());
+            Vector<ColumnVector> &column_vectors = builder.column_vectors();
+            for (int column_idx = 0; column_idx < batch_col_count; ++column_idx) {
+                ParquetColumnHandler(batch->column(column_idx), column_vectors[column_idx], batch_row_id, append_count);
+            }
+            builder.AddRows(append_count);
+            batch_row_id += append_count;
         }
     }
-
-    if (block_entry->row_count() > 0) {
-        segment_entry->AppendBlockEntry(std::move(block_entry));
-    }
-    if (segment_entry->row_count() > 0) {
-        SaveSegmentData(table_entry_, txn, segment_entry);
-    }
-
-    auto result_msg = MakeUnique<String>(fmt::format("IMPORT {} Rows", row_count));
-    import_op_state->result_msg_ = std::move(result_msg);
 }
 
 template <typename IndexType, typename IndexArray, typename DataType, typename DataArray>
@@ -1908,6 +1994,95 @@ void PhysicalImport::ParquetValueHandler(const SharedPtr<arrow::Array> &array, C
     }
 }
 
+namespace {
+
+// Values of a fixed width arrow array which can be copied into a column of the given type as they are
+template <typename ArrowArrayType>
+const void *FixedWidthValues(const arrow::Array &array, i64 offset) {
+    const auto &typed_array = static_cast<const ArrowArrayType &>(array);
+    return typed_array.raw_values() + offset;
+}
+
+const void *EmbeddingValues(const arrow::Array &array, EmbeddingDataType element_type, i64 offset) {
+    switch (element_type) {
+        case EmbeddingDataType::kElemInt8: {
+            return FixedWidthValues<arrow::Int8Array>(array, offset);
+        }
+        case EmbeddingDataType::kElemUInt8: {
+            return FixedWidthValues<arrow::UInt8Array>(array, offset);
+        }
+        case EmbeddingDataType::kElemInt16: {
+            return FixedWidthValues<arrow::Int16Array>(array, offset);
+        }
+        case EmbeddingDataType::kElemInt32: {
+            return FixedWidthValues<arrow::Int32Array>(array, offset);
+        }
+        case EmbeddingDataType::kElemInt64: {
+            return FixedWidthValues<arrow::Int64Array>(array, offset);
+        }
+        case EmbeddingDataType::kElemFloat: {
+            return FixedWidthValues<arrow::FloatArray>(array, offset);
+        }
+        case EmbeddingDataType::kElemDouble: {
+            return FixedWidthValues<arrow::DoubleArray>(array, offset);
+        }
+        default: {
+            return nullptr;
+        }
+    }
+}
+
+} // namespace
+
+void PhysicalImport::ParquetColumnHandler(const SharedPtr<arrow::Array> &array, ColumnVector &column_vector, i64 offset, i64 count) {
+    const void *values = nullptr;
+    switch (column_vector.data_type()->type()) {
+        case LogicalType::kTinyInt: {
+            values = FixedWidthValues<arrow::Int8Array>(*array, offset);
+            break;
+        }
+        case LogicalType::kSmallInt: {
+            values = FixedWidthValues<arrow::Int16Array>(*array, offset);
+            break;
+        }
+        case LogicalType::kInteger: {
+            values = FixedWidthValues<arrow::Int32Array>(*array, offset);
+            break;
+        }
+        case LogicalType::kBigInt: {
+            values = FixedWidthValues<arrow::Int64Array>(*array, offset);
+            break;
+        }
+        case LogicalType::kFloat: {
+            values = FixedWidthValues<arrow::FloatArray>(*array, offset);
+            break;
+        }
+        case LogicalType::kDouble: {
+            values = FixedWidthValues<arrow::DoubleArray>(*array, offset);
+            break;
+        }
+        case LogicalType::kEmbedding: {
+            // Only a fixed size list holds the embeddings back to back, the element type is checked against the column by CheckParquetColumns
+            const auto *embedding_info = static_cast<const EmbeddingInfo *>(column_vector.data_type()->type_info().get());
+            const auto *list_array = dynamic_cast<const arrow::FixedSizeListArray *>(array.get());
+            if (list_array != nullptr && list_array->value_length() == static_cast<i32>(embedding_info->Dimension())) {
+                values = EmbeddingValues(*list_array->values(), embedding_info->Type(), list_array->value_offset(offset));
+            }
+            break;
+        }
+        default: {
+            break;
+        }
+    }
+    if (values != nullptr) {
+        column_vector.AppendFixedWidth(static_cast<const_ptr_t>(values), count);
+        return;
+    }
+    for (i64 value_idx = offset; value_idx < offset + count; ++value_idx) {
+        ParquetValueHandler(array, column_vector, value_idx);
+    }
+}
+
 void PhysicalImport::SaveSegmentData(TableEntry *table_entry, Txn *txn, SharedPtr<SegmentEntry> segment_entry) {
     segment_entry->FlushNewData();
     txn->Import(table_entry, std::move(segment_entry));
@@ -38,30 +38,58 @@ import statement_common;
 import data_type;
 import logger;
 import sparse_info;
+import import_partition;
 
 namespace infinity {
 
-class ZxvParserCtx {
+// Appends the rows of one import partition to new segments, starting a new block or segment when the current one is full.
+// Full segments are flushed right away, they are imported into the transaction by the caller once all partitions are loaded.
+class ImportSegmentBuilder {
 public:
-    ZsvParser parser_;
-    SizeT row_count_{};
-    SharedPtr<String> err_msg_{};
+    ImportSegmentBuilder(TableEntry *table_entry, Txn *txn, SegmentID first_segment_id);
+
+    // Column vectors of the current block, rows are appended to them and then counted by AddRows()
+    inline Vector<ColumnVector> &column_vectors() { return column_vectors_; }
+
+    // Rows which still fit in the current block
+    SizeT BlockRoom();
+
+    void AddRows(SizeT row_count);
+
+    // Seal and flush the last block and segment
+    void Finish();
+
+    // Drop the current block and segment after a failure, the full segments are kept
+    void Abort();
+
+    inline Vector<SharedPtr<SegmentEntry>> &segments() { return segments_; }
+
+    inline SizeT row_count() const { return row_count_; }
+
+private:
+    void NewBlock();
+
     TableEntry *const table_entry_{};
     Txn *const txn_{};
     SharedPtr<SegmentEntry> segment_entry_{};
     UniquePtr<BlockEntry> block_entry_{};
     Vector<ColumnVector> column_vectors_{};
+    Vector<SharedPtr<SegmentEntry>> segments_{};
+    SizeT row_count_{};
+};
+
+class ZxvParserCtx {
+public:
+    ZsvParser parser_;
+    SizeT row_count_{};
+    SharedPtr<String> err_msg_{};
+    TableEntry *const table_entry_{};
+    ImportSegmentBuilder *const builder_{};
     const char delimiter_{};
 
 public:
-    ZxvParserCtx(TableEntry *table_entry,
-                 Txn *txn,
-                 SharedPtr<SegmentEntry> segment_entry,
-                 UniquePtr<BlockEntry> block_entry,
-                 Vector<ColumnVector> &&column_vectors,
-                 char delimiter)
-        : row_count_(0), err_msg_(nullptr), table_entry_(table_entry), txn_(txn), segment_entry_(segment_entry), block_entry_(std::move(block_entry)),
-          column_vectors_(std::move(column_vectors)), delimiter_(delimiter) {}
+    ZxvParserCtx(TableEntry *table_entry, ImportSegmentBuilder *builder, char delimiter)
+        : row_count_(0), err_msg_(nullptr), table_entry_(table_entry), builder_(builder), delimiter_(delimiter) {}
 };
 
 export class PhysicalImport : public PhysicalOperator {
@@ -129,6 +157,19 @@ private:
 
     void ParquetValueHandler(const SharedPtr<arrow::Array> &array, ColumnVector &column_vector, u64 value_idx);
 
+    // Append rows [offset, offset + count) of the array, fixed width values and embeddings are copied in one go.
+    void ParquetColumnHandler(const SharedPtr<arrow::Array> &array, ColumnVector &column_vector, i64 offset, i64 count);
+
+    void ImportCSVPartition(const ImportByteRange &range, bool header, ImportSegmentBuilder &builder);
+
+    void ImportJSONLPartition(const ImportByteRange &range, ImportSegmentBuilder &builder);
+
+    void ImportPARQUETPartition(const Vector<int> &row_groups, ImportSegmentBuilder &builder);
+
+    // Load every partition into its own builder, concurrently when there are several of them.
+    // The segments are imported into the transaction in partition order, also when a partition failed.
+    SizeT LoadPartitions(Txn *txn, SizeT partition_count, const std::function<void(SizeT, ImportSegmentBuilder &)> &load_partition);
+
 private:
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
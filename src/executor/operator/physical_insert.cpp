@@ -57,6 +57,18 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
         return true;
     }
 
+    if (!data_blocks_.empty()) {
+        // Columnar insert, the rows were decoded straight into column vectors by the planner.
+        SizeT inserted_row_count = 0;
+        auto *txn = query_context->GetTxn();
+        for (const auto &data_block : data_blocks_) {
+            inserted_row_count += data_block->row_count();
+            txn->Append(table_entry_, data_block);
+        }
+        SetResultMessage(operator_state, inserted_row_count);
+        return true;
+    }
+
     SizeT row_count = value_list_.size();
     SizeT column_count = value_list_[0].size();
     SizeT table_collection_column_count = table_entry_->ColumnCount();
@@ -97,7 +109,12 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
     auto *txn = query_context->GetTxn();
     txn->Append(table_entry_, output_block);
 
-    UniquePtr<String> result_msg = MakeUnique<String>(fmt::format("INSERTED {} Rows", output_block->row_count()));
+    SetResultMessage(operator_state, output_block->row_count());
+    return true;
+}
+
+void PhysicalInsert::SetResultMessage(OperatorState *operator_state, SizeT row_count) {
+    UniquePtr<String> result_msg = MakeUnique<String>(fmt::format("INSERTED {} Rows", row_count));
     if (operator_state == nullptr) {
         // Generate the result table
         Vector<SharedPtr<ColumnDef>> column_defs;
@@ -110,7 +127,6 @@ bool PhysicalInsert::Execute(QueryContext *query_context, OperatorState *operato
         insert_operator_state->result_msg_ = std::move(result_msg);
     }
     operator_state->SetComplete();
-    return true;
 }
 
 } // namespace infinity
@@ -29,6 +29,7 @@ import table_entry;
 import internal_types;
 import data_type;
 import logger;
+import data_block;
 
 namespace infinity {
 
@@ -52,6 +53,9 @@ public:
 
     inline const Vector<Vector<SharedPtr<BaseExpression>>> &value_list() const { return value_list_; }
 
+    // Data blocks of a columnar insert, they are appended to the table as is.
+    inline void set_data_blocks(Vector<SharedPtr<DataBlock>> data_blocks) { data_blocks_ = std::move(data_blocks); }
+
     inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
 
     inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
@@ -62,10 +66,14 @@ public:
         return 0;
     }
 
+private:
+    void SetResultMessage(OperatorState *operator_state, SizeT row_count);
+
 private:
     TableEntry *table_entry_{};
     u64 table_index_{};
     Vector<Vector<SharedPtr<BaseExpression>>> value_list_{};
+    Vector<SharedPtr<DataBlock>> data_blocks_{};
 
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
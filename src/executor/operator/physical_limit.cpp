@@ -29,6 +29,7 @@ import default_values;
 import physical_operator_type;
 import operator_state;
 import data_block;
+import selection;
 import status;
 import infinity_exception;
 import expression_type;
@@ -170,7 +171,7 @@ bool PhysicalLimit::Execute(QueryContext *query_context,
     SizeT input_row_count = 0;
 
     for (SizeT block_id = 0; block_id < input_blocks.size(); ++block_id) {
-        input_row_count += input_blocks[block_id]->row_count();
+        input_row_count += input_blocks[block_id]->selected_row_count();
     }
 
     SizeT offset = counter->Offset(input_row_count);
@@ -182,7 +183,7 @@ bool PhysicalLimit::Execute(QueryContext *query_context,
     SizeT block_start_idx = input_blocks.size();
 
     for (SizeT block_id = 0; block_id < input_blocks.size(); ++block_id) {
-        if (const SizeT row_count = input_blocks[block_id]->row_count(); offset >= row_count) {
+        if (const SizeT row_count = input_blocks[block_id]->selected_row_count(); offset >= row_count) {
             offset -= row_count;
         } else {
             block_start_idx = block_id;
@@ -193,15 +194,26 @@ bool PhysicalLimit::Execute(QueryContext *query_context,
     const auto output_types = input_blocks.front()->types();
     for (SizeT block_id = block_start_idx; block_id < input_blocks.size(); ++block_id) {
         auto &input_block = input_blocks[block_id];
-        auto row_count = input_block->row_count();
+        SizeT row_count = input_block->selected_row_count();
         if (row_count == 0) {
             continue;
         }
         const auto append_count = std::min(row_count - offset, limit);
         auto block = DataBlock::MakeUniquePtr();
-        block->Init(output_types);
-        block->AppendWith(input_block.get(), offset, append_count);
-        block->Finalize();
+        if (input_block->HasSelection()) {
+            // Narrow the selection instead of copying the rows, the columns are shared with the input block.
+            auto selection = MakeShared<Selection>();
+            selection->Initialize(append_count);
+            for (SizeT idx = offset; idx < offset + append_count; ++idx) {
+                selection->Append(input_block->SelectedRowIndex(idx));
+            }
+            block->Init(input_block->column_vectors);
+            block->SetSelection(std::move(selection));
+        } else {
+            block->Init(output_types);
+            block->AppendWith(input_block.get(), offset, append_count);
+            block->Finalize();
+        }
         output_blocks.push_back(std::move(block));
         offset = 0;
         limit -= append_count;
@@ -115,6 +115,8 @@ public:
 
     SizeT TaskletCount() override { return left_->TaskletCount(); }
 
+    bool AcceptsSelection() const override { return true; }
+
     [[nodiscard]] inline const SharedPtr<BaseExpression> &limit_expr() const { return limit_expr_; }
 
     [[nodiscard]] inline const SharedPtr<BaseExpression> &offset_expr() const { return offset_expr_; }
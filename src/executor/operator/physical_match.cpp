@@ -71,6 +71,8 @@ import result_cache_manager;
 import cached_match;
 import filter_iterator;
 import score_threshold_iterator;
+import infinity_context;
+import task_scheduler;
 
 namespace infinity {
 
@@ -141,13 +143,23 @@ void ASSERT_FLOAT_EQ(const float bar, const u32 i, const float a, const float b)
     }
 }
 
-u32 ExecuteFTSearch(DocIterator *iter, FullTextScoreResultHeap &result_heap) {
+// raise the score threshold shared by concurrent searches, it only ever grows
+void RaiseScoreThreshold(Atomic<float> &shared_threshold, const float threshold) {
+    float current = shared_threshold.load(std::memory_order_relaxed);
+    while (current < threshold && !shared_threshold.compare_exchange_weak(current, threshold, std::memory_order_relaxed)) {
+    }
+}
+
+// If shared_threshold is given, iter only covers part of the segments. The top-k threshold of any part is a lower bound
+// of the final one, so every search publishes its own threshold and prunes with the highest one published so far.
+u32 ExecuteFTSearch(DocIterator *iter, FullTextScoreResultHeap &result_heap, Atomic<float> *shared_threshold = nullptr) {
     u32 loop_cnt = 0;
     // iter is nullptr if fulltext index is present but there's no data
     if (!iter) {
         LOG_DEBUG("iter is nullptr");
         return loop_cnt;
     }
+    float applied_threshold = 0.0f;
     while (true) {
         ++loop_cnt;
         if (!(iter->Next())) [[unlikely]] {
@@ -155,20 +167,31 @@ u32 ExecuteFTSearch(DocIterator *iter, FullTextScoreResultHeap &result_heap) {
         }
         if (result_heap.AddResult(iter->Score(), iter->DocID())) {
             // update threshold
-            iter->UpdateScoreThreshold(result_heap.GetScoreThreshold());
+            if (shared_threshold == nullptr) {
+                iter->UpdateScoreThreshold(result_heap.GetScoreThreshold());
+            } else {
+                RaiseScoreThreshold(*shared_threshold, result_heap.GetScoreThreshold());
+            }
+        }
+        if (shared_threshold != nullptr) {
+            if (const float threshold = shared_threshold->load(std::memory_order_relaxed); threshold > applied_threshold) {
+                applied_threshold = threshold;
+                iter->UpdateScoreThreshold(threshold);
+            }
         }
     }
     return loop_cnt;
 }
 
-auto ExecuteFTSearch(const QueryIterators &query_iterators, const u32 topn) {
-    struct FTSearchResultType {
-        u32 result_count{};
-        UniquePtr<float[]> score_result{};
-        UniquePtr<RowID[]> row_id_result{};
-    };
+struct FTSearchResult {
+    u32 result_count{};
+    UniquePtr<float[]> score_result{};
+    UniquePtr<RowID[]> row_id_result{};
+};
+
+FTSearchResult ExecuteFTSearch(const QueryIterators &query_iterators, const u32 topn) {
     auto GetFTSearchResult = [topn](const UniquePtr<DocIterator> &iter) {
-        FTSearchResultType result;
+        FTSearchResult result;
         result.score_result = MakeUniqueForOverwrite<float[]>(topn);
         result.row_id_result = MakeUniqueForOverwrite<RowID[]>(topn);
         FullTextScoreResultHeap result_heap(topn, result.score_result.get(), result.row_id_result.get());
@@ -182,7 +205,7 @@ auto ExecuteFTSearch(const QueryIterators &query_iterators, const u32 topn) {
     }
     // compare
     auto bmw_result = GetFTSearchResult(query_iterators.bmw_iter);
-    FTSearchResultType naive_result;
+    FTSearchResult naive_result;
     {
         naive_result.score_result = MakeUniqueForOverwrite<float[]>(topn);
         naive_result.row_id_result = MakeUniqueForOverwrite<RowID[]>(topn);
@@ -231,6 +254,72 @@ auto ExecuteFTSearch(const QueryIterators &query_iterators, const u32 topn) {
     return bmw_result;
 }
 
+// Search every segment partition on the shared fulltext search pool with a shared score threshold, then merge the partial top-n.
+FTSearchResult ExecuteFTSearchParallel(const Vector<UniquePtr<DocIterator>> &iters, const u32 topn) {
+    Vector<FTSearchResult> partial_results(iters.size());
+    Atomic<float> shared_threshold{0.0f};
+    auto search = [&](const SizeT i) {
+        FTSearchResult &result = partial_results[i];
+        result.score_result = MakeUniqueForOverwrite<float[]>(topn);
+        result.row_id_result = MakeUniqueForOverwrite<RowID[]>(topn);
+        FullTextScoreResultHeap result_heap(topn, result.score_result.get(), result.row_id_result.get());
+        [[maybe_unused]] const auto loop_cnt = ExecuteFTSearch(iters[i].get(), result_heap, &shared_threshold);
+        result.result_count = result_heap.GetResultSize();
+    };
+    {
+        ThreadPool &search_pool = InfinityContext::instance().GetFulltextSearchThreadPool();
+        Vector<std::future<void>> futs;
+        futs.reserve(iters.size());
+        for (SizeT i = 0; i < iters.size(); ++i) {
+            futs.emplace_back(search_pool.push([&search, i](int) { search(i); }));
+        }
+        std::exception_ptr error{};
+        for (auto &fut : futs) {
+            try {
+                fut.get();
+            } catch (...) {
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    FTSearchResult result;
+    result.score_result = MakeUniqueForOverwrite<float[]>(topn);
+    result.row_id_result = MakeUniqueForOverwrite<RowID[]>(topn);
+    FullTextScoreResultHeap result_heap(topn, result.score_result.get(), result.row_id_result.get());
+    for (const auto &partial_result : partial_results) {
+        for (u32 i = 0; i < partial_result.result_count; ++i) {
+            result_heap.AddResult(partial_result.score_result[i], partial_result.row_id_result[i]);
+        }
+    }
+    result_heap.Sort();
+    result.result_count = result_heap.GetResultSize();
+    return result;
+}
+
+// Split the segments that have fulltext index data on the searched columns round-robin into at most worker_count sorted groups.
+Vector<Vector<SegmentID>> PartitionSegments(const IndexReader &index_reader, const Vector<String> &index_hints) {
+    Set<SegmentID> indexed_segment_ids;
+    for (const auto &[column_id, _] : *index_reader.column_index_readers_) {
+        if (ColumnIndexReader *column_index_reader = index_reader.GetColumnIndexReader(column_id, index_hints); column_index_reader != nullptr) {
+            for (const SegmentID segment_id : column_index_reader->GetIndexedSegmentIDs()) {
+                indexed_segment_ids.insert(segment_id);
+            }
+        }
+    }
+    const SizeT partition_count = std::min<SizeT>(indexed_segment_ids.size(), InfinityContext::instance().task_scheduler()->worker_count());
+    Vector<Vector<SegmentID>> partitions(partition_count);
+    SizeT i = 0;
+    for (const SegmentID segment_id : indexed_segment_ids) {
+        partitions[i++ % partition_count].push_back(segment_id);
+    }
+    return partitions;
+}
+
 bool PhysicalMatch::ExecuteInner(QueryContext *query_context, OperatorState *operator_state) {
     if (!common_query_filter_) {
         UnrecoverableError(fmt::format("{}: common_query_filter_ is nullptr", __func__));
@@ -247,13 +336,31 @@ bool PhysicalMatch::ExecuteInner(QueryContext *query_context, OperatorState *ope
     // 2 build query iterator
     FullTextQueryContext full_text_query_context(ft_similarity_, minimum_should_match_option_, top_n_, match_expr_->index_names_);
     full_text_query_context.query_tree_ = MakeUnique<FilterQueryNode>(common_query_filter_.get(), std::move(query_tree_));
-    const auto query_iterators = CreateQueryIterators(query_builder, full_text_query_context, early_term_algo_, begin_threshold_, score_threshold_);
+    // with more than one indexed segment, build one iterator per segment partition and search them concurrently
+    QueryIterators query_iterators;
+    Vector<UniquePtr<DocIterator>> partition_iters;
+    Vector<Vector<SegmentID>> segment_partitions;
+    if (early_term_algo_ != EarlyTermAlgo::kCompare) {
+        segment_partitions = PartitionSegments(index_reader_, match_expr_->index_names_);
+    }
+    if (segment_partitions.size() > 1) {
+        partition_iters.reserve(segment_partitions.size());
+        for (const auto &segment_ids : segment_partitions) {
+            full_text_query_context.segment_ids_ = &segment_ids;
+            auto iters = CreateQueryIterators(query_builder, full_text_query_context, early_term_algo_, begin_threshold_, score_threshold_);
+            partition_iters.emplace_back(std::move(iters.query_iter));
+        }
+        full_text_query_context.segment_ids_ = nullptr;
+    } else {
+        query_iterators = CreateQueryIterators(query_builder, full_text_query_context, early_term_algo_, begin_threshold_, score_threshold_);
+    }
     const auto finish_query_builder_time = std::chrono::high_resolution_clock::now();
     LOG_DEBUG(fmt::format("PhysicalMatch Part 2: Build Query iterator time: {} ms",
                           static_cast<TimeDurationType>(finish_query_builder_time - finish_init_query_builder_time).count()));
 
     // 3 full text search
-    const auto [result_count, score_result, row_id_result] = ExecuteFTSearch(query_iterators, top_n_);
+    const auto [result_count, score_result, row_id_result] =
+        partition_iters.empty() ? ExecuteFTSearch(query_iterators, top_n_) : ExecuteFTSearchParallel(partition_iters, top_n_);
     auto finish_query_time = std::chrono::high_resolution_clock::now();
     LOG_DEBUG(fmt::format("PhysicalMatch Part 3: Full text search time: {} ms",
                           static_cast<TimeDurationType>(finish_query_time - finish_query_builder_time).count()));
@@ -408,7 +515,7 @@ void PhysicalMatch::AddCache(QueryContext *query_context, ResultCacheManager *ca
         data_blocks[i] = output_data_blocks[i]->Clone();
     }
     auto cached_node = MakeUnique<CachedMatch>(query_ts, this);
-    bool success = cache_mgr->AddCache(std::move(cached_node), std::move(data_blocks));
+    bool success = cache_mgr->AddCache(std::move(cached_node), std::move(data_blocks), query_context->execution_elapsed_us());
     if (!success) {
         LOG_WARN(fmt::format("Add cache failed for query: {}", txn->BeginTS()));
     } else {
@@ -29,6 +29,7 @@ import logical_type;
 import physical_aggregate;
 import aggregate_expression;
 import infinity_exception;
+import merge_grouped_aggregate;
 
 namespace infinity {
 
@@ -41,7 +42,12 @@ bool PhysicalMergeAggregate::Execute(QueryContext *query_context, OperatorState
 
     auto merge_aggregate_op_state = static_cast<MergeAggregateOperatorState *>(operator_state);
 
-    SimpleMergeAggregateExecute(merge_aggregate_op_state);
+    auto agg_op = static_cast<PhysicalAggregate *>(this->left());
+    if (agg_op->groups_.empty()) {
+        SimpleMergeAggregateExecute(merge_aggregate_op_state);
+    } else {
+        GroupByMergeAggregateExecute(merge_aggregate_op_state);
+    }
 
     if (merge_aggregate_op_state->input_complete_) {
 
@@ -106,6 +112,17 @@ void PhysicalMergeAggregate::SimpleMergeAggregateExecute(MergeAggregateOperatorS
     }
 }
 
+void PhysicalMergeAggregate::GroupByMergeAggregateExecute(MergeAggregateOperatorState *op_state) {
+    auto agg_op = static_cast<PhysicalAggregate *>(this->left());
+    MergeGroupedPartialResults(agg_op->aggregates_,
+                               agg_op->groups_.size(),
+                               *agg_op->GetOutputTypes(),
+                               op_state->input_data_block_.get(),
+                               op_state->hash_table_,
+                               op_state->group_ids_,
+                               op_state->data_block_array_);
+}
+
 template <typename T>
 void PhysicalMergeAggregate::HandleAggregateFunction(const String &function_name, MergeAggregateOperatorState *op_state, SizeT col_idx) {
     LOG_TRACE(function_name);
@@ -72,6 +72,8 @@ public:
 
     void SimpleMergeAggregateExecute(MergeAggregateOperatorState *merge_aggregate_op_state);
 
+    void GroupByMergeAggregateExecute(MergeAggregateOperatorState *merge_aggregate_op_state);
+
     template <typename T>
     void UpdateData(MergeAggregateOperatorState *op_state, MathOperation<T> operation, SizeT col_idx);
 
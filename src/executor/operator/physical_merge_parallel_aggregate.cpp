@@ -14,15 +14,47 @@
 
 module;
 
+module physical_merge_parallel_aggregate;
+
+import stl;
+import third_party;
 import query_context;
 import operator_state;
-
-module physical_merge_parallel_aggregate;
+import logger;
+import data_block;
+import physical_parallel_aggregate;
+import merge_grouped_aggregate;
 
 namespace infinity {
 
 void PhysicalMergeParallelAggregate::Init() {}
 
-bool PhysicalMergeParallelAggregate::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalMergeParallelAggregate::Execute(QueryContext *, OperatorState *operator_state) {
+    auto *merge_parallel_aggregate_op_state = static_cast<MergeParallelAggregateOperatorState *>(operator_state);
+    MergePartition(merge_parallel_aggregate_op_state);
+
+    if (merge_parallel_aggregate_op_state->input_complete_) {
+        LOG_TRACE("PhysicalMergeParallelAggregate::Input is complete");
+        for (auto &output_block : merge_parallel_aggregate_op_state->data_block_array_) {
+            output_block->Finalize();
+        }
+        merge_parallel_aggregate_op_state->hash_table_.reset();
+        merge_parallel_aggregate_op_state->SetComplete();
+        return true;
+    }
+    return false;
+}
+
+void PhysicalMergeParallelAggregate::MergePartition(MergeParallelAggregateOperatorState *op_state) const {
+    auto *parallel_agg_op = static_cast<PhysicalParallelAggregate *>(this->left());
+    UniquePtr<DataBlock> input_data_block = std::move(op_state->input_data_block_);
+    MergeGroupedPartialResults(parallel_agg_op->aggregates_,
+                               parallel_agg_op->groups_.size(),
+                               *output_types_,
+                               input_data_block.get(),
+                               op_state->hash_table_,
+                               op_state->group_ids_,
+                               op_state->data_block_array_);
+}
 
 } // namespace infinity
@@ -30,14 +30,18 @@ import logger;
 
 namespace infinity {
 
+// Merge stage of the parallel hash aggregation. The fragment runs one task per partition of PhysicalParallelAggregate, each task only
+// receives the partial results of its own partition from all the partial tasks, so the partitions are merged in parallel.
 export class PhysicalMergeParallelAggregate final : public PhysicalOperator {
 public:
-    explicit PhysicalMergeParallelAggregate(SharedPtr<Vector<String>> output_names,
+    explicit PhysicalMergeParallelAggregate(u64 id,
+                                            UniquePtr<PhysicalOperator> left,
+                                            SharedPtr<Vector<String>> output_names,
                                             SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                                            u64 id,
+                                            SizeT task_count,
                                             SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kMergeParallelAggregate, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+        : PhysicalOperator(PhysicalOperatorType::kMergeParallelAggregate, std::move(left), nullptr, id, load_metas),
+          output_names_(std::move(output_names)), output_types_(std::move(output_types)), task_count_(task_count) {}
 
     ~PhysicalMergeParallelAggregate() override = default;
 
@@ -49,15 +53,15 @@ public:
 
     inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
 
-    SizeT TaskletCount() override {
-        String error_message = "Not implement: TaskletCount not Implement";
-        UnrecoverableError(error_message);
-        return 0;
-    }
+    // One output stream per merged partition
+    SizeT TaskletCount() override { return task_count_; }
 
 private:
+    void MergePartition(MergeParallelAggregateOperatorState *op_state) const;
+
     SharedPtr<Vector<String>> output_names_{};
     SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    SizeT task_count_{1};
 };
 
 } // namespace infinity
@@ -14,15 +14,119 @@
 
 module;
 
+module physical_parallel_aggregate;
+
+import stl;
 import query_context;
 import operator_state;
-
-module physical_parallel_aggregate;
+import data_block;
+import physical_aggregate;
+import hash_table;
+import default_values;
+import base_expression;
+import internal_types;
+import data_type;
 
 namespace infinity {
 
 void PhysicalParallelAggregate::Init() {}
 
-bool PhysicalParallelAggregate::Execute(QueryContext *, OperatorState *) { return true; }
+bool PhysicalParallelAggregate::Execute(QueryContext *, OperatorState *operator_state) {
+    OperatorState *prev_op_state = operator_state->prev_op_state_;
+    auto *parallel_aggregate_operator_state = static_cast<ParallelAggregateOperatorState *>(operator_state);
+
+    if (parallel_aggregate_operator_state->hash_table_.get() == nullptr) {
+        parallel_aggregate_operator_state->hash_table_ = MakeUnique<HashTable>();
+        parallel_aggregate_operator_state->hash_table_->Init(PhysicalAggregate::GroupTypes(groups_));
+        parallel_aggregate_operator_state->group_states_.resize(aggregates_.size());
+    }
+    PhysicalAggregate::GroupByAccumulate(groups_,
+                                         aggregates_,
+                                         prev_op_state->data_block_array_,
+                                         parallel_aggregate_operator_state->hash_table_.get(),
+                                         parallel_aggregate_operator_state->group_states_);
+    prev_op_state->data_block_array_.clear();
+
+    if (prev_op_state->Complete()) {
+        PartitionOutput(parallel_aggregate_operator_state);
+        parallel_aggregate_operator_state->SetComplete();
+    }
+    return true;
+}
+
+void PhysicalParallelAggregate::PartitionOutput(ParallelAggregateOperatorState *parallel_aggregate_operator_state) const {
+    SizeT partition_count = parallel_aggregate_operator_state->partition_count_;
+    const HashTable &hash_table = *parallel_aggregate_operator_state->hash_table_;
+    SizeT total_group_count = hash_table.GroupCount();
+
+    // Counting sort of the group ids by partition, partition i is [partition_starts[i], partition_starts[i + 1]) of partitioned_group_ids
+    Vector<SizeT> partition_starts(partition_count + 1, 0);
+    for (u32 group_id = 0; group_id < total_group_count; ++group_id) {
+        ++partition_starts[HashTable::PartitionOf(hash_table.GroupHash(group_id), partition_count) + 1];
+    }
+    for (SizeT partition_idx = 0; partition_idx < partition_count; ++partition_idx) {
+        partition_starts[partition_idx + 1] += partition_starts[partition_idx];
+    }
+    Vector<u32> partitioned_group_ids(total_group_count);
+    Vector<SizeT> partition_cursors(partition_starts.begin(), partition_starts.end() - 1);
+    for (u32 group_id = 0; group_id < total_group_count; ++group_id) {
+        partitioned_group_ids[partition_cursors[HashTable::PartitionOf(hash_table.GroupHash(group_id), partition_count)]++] = group_id;
+    }
+
+    // Every partition has at least one block, so every merge task can see this task is completed even if it has no group.
+    SharedPtr<Vector<SharedPtr<DataType>>> output_types = GetOutputTypes();
+    Vector<UniquePtr<DataBlock>> &output_blocks = parallel_aggregate_operator_state->data_block_array_;
+    Vector<SizeT> &partition_offsets = parallel_aggregate_operator_state->partition_offsets_;
+    partition_offsets.clear();
+    partition_offsets.reserve(partition_count + 1);
+    for (SizeT partition_idx = 0; partition_idx < partition_count; ++partition_idx) {
+        partition_offsets.emplace_back(output_blocks.size());
+        SizeT group_start = partition_starts[partition_idx];
+        SizeT group_end = partition_starts[partition_idx + 1];
+        do {
+            SizeT output_group_count = std::min(group_end - group_start, (SizeT)DEFAULT_VECTOR_SIZE);
+            auto output_block = DataBlock::MakeUniquePtr();
+            output_block->Init(*output_types);
+            PhysicalAggregate::AppendGroupResults(groups_.size(),
+                                                  aggregates_,
+                                                  hash_table,
+                                                  parallel_aggregate_operator_state->group_states_,
+                                                  partitioned_group_ids.data() + group_start,
+                                                  output_group_count,
+                                                  output_block.get());
+            output_blocks.emplace_back(std::move(output_block));
+            group_start += output_group_count;
+        } while (group_start < group_end);
+    }
+    partition_offsets.emplace_back(output_blocks.size());
+
+    // The partial results are materialized, release the thread-local hash table.
+    parallel_aggregate_operator_state->hash_table_.reset();
+    parallel_aggregate_operator_state->group_states_.clear();
+}
+
+SharedPtr<Vector<String>> PhysicalParallelAggregate::GetOutputNames() const {
+    SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
+    result->reserve(groups_.size() + aggregates_.size());
+    for (const auto &expr : groups_) {
+        result->emplace_back(expr->Name());
+    }
+    for (const auto &expr : aggregates_) {
+        result->emplace_back(expr->Name());
+    }
+    return result;
+}
+
+SharedPtr<Vector<SharedPtr<DataType>>> PhysicalParallelAggregate::GetOutputTypes() const {
+    SharedPtr<Vector<SharedPtr<DataType>>> result = MakeShared<Vector<SharedPtr<DataType>>>();
+    result->reserve(groups_.size() + aggregates_.size());
+    for (const auto &expr : groups_) {
+        result->emplace_back(MakeShared<DataType>(expr->Type()));
+    }
+    for (const auto &expr : aggregates_) {
+        result->emplace_back(MakeShared<DataType>(expr->Type()));
+    }
+    return result;
+}
 
 } // namespace infinity
@@ -25,20 +25,27 @@ import physical_operator_type;
 import base_expression;
 import load_meta;
 import infinity_exception;
+import data_block;
 import internal_types;
 import data_type;
 import logger;
 
 namespace infinity {
 
+// Partial stage of the parallel hash aggregation. Every task of the fragment aggregates its own segments into a thread-local hash
+// table. When the task is completed, the groups are radix-partitioned by their hash into one partition per
+// PhysicalMergeParallelAggregate task, so each group key is merged by exactly one merge task.
 export class PhysicalParallelAggregate final : public PhysicalOperator {
 public:
-    explicit PhysicalParallelAggregate(SharedPtr<Vector<String>> output_names,
-                                       SharedPtr<Vector<SharedPtr<DataType>>> output_types,
-                                       u64 id,
+    explicit PhysicalParallelAggregate(u64 id,
+                                       UniquePtr<PhysicalOperator> left,
+                                       Vector<SharedPtr<BaseExpression>> groups,
+                                       u64 groupby_index,
+                                       Vector<SharedPtr<BaseExpression>> aggregates,
+                                       u64 aggregate_index,
                                        SharedPtr<Vector<LoadMeta>> load_metas)
-        : PhysicalOperator(PhysicalOperatorType::kParallelAggregate, nullptr, nullptr, id, load_metas), output_names_(std::move(output_names)),
-          output_types_(std::move(output_types)) {}
+        : PhysicalOperator(PhysicalOperatorType::kParallelAggregate, std::move(left), nullptr, id, load_metas), groups_(std::move(groups)),
+          aggregates_(std::move(aggregates)), groupby_index_(groupby_index), aggregate_index_(aggregate_index) {}
 
     ~PhysicalParallelAggregate() override = default;
 
@@ -46,19 +53,26 @@ public:
 
     bool Execute(QueryContext *query_context, OperatorState *operator_state) final;
 
-    inline SharedPtr<Vector<String>> GetOutputNames() const final { return output_names_; }
+    SharedPtr<Vector<String>> GetOutputNames() const final;
 
-    inline SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final { return output_types_; }
+    SharedPtr<Vector<SharedPtr<DataType>>> GetOutputTypes() const final;
 
-    SizeT TaskletCount() override {
-        String error_message = "Not implement: TaskletCount not Implement";
-        UnrecoverableError(error_message);
-        return 0;
-    }
+    SizeT TaskletCount() override { return left_->TaskletCount(); }
+
+    bool IsSink() const override { return true; }
+
+    inline u64 GroupTableIndex() const { return groupby_index_; }
+
+    inline u64 AggregateTableIndex() const { return aggregate_index_; }
+
+    Vector<SharedPtr<BaseExpression>> groups_{};
+    Vector<SharedPtr<BaseExpression>> aggregates_{};
 
 private:
-    SharedPtr<Vector<String>> output_names_{};
-    SharedPtr<Vector<SharedPtr<DataType>>> output_types_{};
+    void PartitionOutput(ParallelAggregateOperatorState *parallel_aggregate_operator_state) const;
+
+    u64 groupby_index_{};
+    u64 aggregate_index_{};
 };
 
 } // namespace infinity
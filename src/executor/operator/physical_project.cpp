@@ -29,6 +29,8 @@ import column_vector;
 import infinity_exception;
 import analyzer_pool;
 import value;
+import expression_type;
+import base_expression;
 
 module physical_project;
 
@@ -82,6 +84,9 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
         SizeT input_block_count = prev_op_state->data_block_array_.size();
         for (SizeT block_idx = 0; block_idx < input_block_count; ++block_idx) {
             DataBlock *input_data_block = prev_op_state->data_block_array_[block_idx].get();
+            if (input_data_block->HasSelection() && !ForwardSelection()) {
+                input_data_block->MaterializeSelection();
+            }
 
             project_operator_state->data_block_array_.emplace_back(DataBlock::MakeUniquePtr());
             DataBlock *output_data_block = project_operator_state->data_block_array_.back().get();
@@ -137,6 +142,9 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
                 }
             }
             output_data_block->Finalize();
+            if (input_data_block->HasSelection()) {
+                output_data_block->SetSelection(input_data_block->selection());
+            }
         }
 
         //    if (prev_op_state->Complete() && !prev_op_state->data_block_->Finalized()) {
@@ -158,6 +166,18 @@ bool PhysicalProject::Execute(QueryContext *, OperatorState *operator_state) {
     return true;
 }
 
+bool PhysicalProject::ForwardSelection() const {
+    if (!highlight_columns_.empty()) {
+        return false;
+    }
+    for (const auto &expr : expressions_) {
+        if (expr->type() != ExpressionType::kReference) {
+            return false;
+        }
+    }
+    return true;
+}
+
 SharedPtr<Vector<String>> PhysicalProject::GetOutputNames() const {
     SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
     SizeT expression_count = expressions_.size();
@@ -54,11 +54,17 @@ public:
 
     SizeT TaskletCount() override { return left_->TaskletCount(); }
 
+    bool AcceptsSelection() const override { return true; }
+
     Vector<SharedPtr<BaseExpression>> expressions_{};
 
     inline u64 TableIndex() const { return projection_table_index_; }
 
 private:
+    // Pure column references just share the input columns, so the selection of the input can be kept on the output.
+    // Other expressions are evaluated on the gathered rows only.
+    bool ForwardSelection() const;
+
     //    ExpressionExecutor executor;
     u64 projection_table_index_{};
     Map<SizeT, SharedPtr<HighlightInfo>> highlight_columns_{};
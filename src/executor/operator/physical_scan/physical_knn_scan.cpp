@@ -64,6 +64,7 @@ import hnsw_alg;
 import ivf_index_data_in_mem;
 import ivf_index_data;
 import ivf_index_search;
+import diskann_index_in_chunk;
 
 namespace infinity {
 
@@ -392,9 +393,12 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
                 }
                 // check index type
                 if (auto index_type = table_index_entry->index_base()->index_type_;
-                    index_type != IndexType::kIVF and index_type != IndexType::kHnsw) {
+                    index_type != IndexType::kIVF and index_type != IndexType::kHnsw and index_type != IndexType::kDiskAnn) {
                     LOG_TRACE(fmt::format("KnnScan: PlanWithIndex(): Skipping non-knn index."));
                     continue;
+                } else if (index_type == IndexType::kDiskAnn and knn_expression_->distance_type_ != KnnDistanceType::kL2) {
+                    LOG_TRACE(fmt::format("KnnScan: PlanWithIndex(): Skipping DiskAnn index, it only supports l2 distance."));
+                    continue;
                 }
 
                 // Fill the segment with index
@@ -428,10 +432,14 @@ void PhysicalKnnScan::PlanWithIndex(QueryContext *query_context) { // TODO: retu
                 RecoverableError(std::move(error_status));
             }
             // check index type
-            if (auto index_type = table_index_entry->index_base()->index_type_; index_type != IndexType::kIVF and index_type != IndexType::kHnsw) {
+            if (auto index_type = table_index_entry->index_base()->index_type_;
+                index_type != IndexType::kIVF and index_type != IndexType::kHnsw and index_type != IndexType::kDiskAnn) {
                 LOG_ERROR("Invalid index type");
                 Status error_status = Status::InvalidIndexType("invalid index");
                 RecoverableError(std::move(error_status));
+            } else if (index_type == IndexType::kDiskAnn and knn_expression_->distance_type_ != KnnDistanceType::kL2) {
+                Status error_status = Status::NotSupport("DiskAnn index only supports l2 distance");
+                RecoverableError(std::move(error_status));
             }
 
             // Fill the segment with index
@@ -476,6 +484,20 @@ void MultiVectorSearchOneLine(MergeKnn<QueryDataType, C, DistanceDataType> *merg
                               SegmentOffset segment_offset,
                               BlockOffset block_offset);
 
+template <LogicalType t, typename ColumnDataType, typename QueryDataType, template <typename, typename> typename C, typename DistanceDataType>
+void RefineCandidates(MergeKnn<QueryDataType, C, DistanceDataType> *merge_heap,
+                      KnnDistance1<QueryDataType, DistanceDataType> *dist_func,
+                      u64 query_idx,
+                      const QueryDataType *query,
+                      u32 embedding_dim,
+                      UniquePtr<QueryDataType[]> &buffer_ptr_for_cast,
+                      BlockIndex *block_index,
+                      BufferManager *buffer_mgr,
+                      ColumnID knn_column_id,
+                      SegmentID segment_id,
+                      const SegmentOffset *candidates,
+                      SizeT candidate_n);
+
 template <LogicalType t, typename ColumnDataType, typename QueryDataType, template <typename, typename> typename C, typename DistanceDataType>
 void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryContext *query_context, KnnScanOperatorState *knn_scan_operator_state) {
     // knn expr output data type is always f32
@@ -604,6 +626,21 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                         ivf_result_handler->Search(memory_ivf_index.get());
                     }
                     auto [result_n, d_ptr, offset_ptr] = ivf_result_handler->EndWithoutSort();
+                    if (ivf_search_params.refine_factor_ > 0) {
+                        RefineCandidates<t, ColumnDataType, QueryDataType, C, DistanceDataType>(merge_heap,
+                                                                                                dist_func,
+                                                                                                0,
+                                                                                                knn_query_ptr,
+                                                                                                embedding_dim,
+                                                                                                buffer_ptr_for_cast,
+                                                                                                block_index,
+                                                                                                buffer_mgr,
+                                                                                                knn_column_id,
+                                                                                                segment_id,
+                                                                                                offset_ptr.get(),
+                                                                                                result_n);
+                        break;
+                    }
                     auto row_ids = MakeUniqueForOverwrite<RowID[]>(result_n);
                     for (SizeT i = 0; i < result_n; ++i) {
                         row_ids[i] = RowID{segment_id, offset_ptr[i]};
@@ -616,7 +653,7 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                         UnrecoverableError("Invalid data type");
                     } else {
                         auto hnsw_search = [&](auto *hnsw_index, bool with_lock) {
-                            bool rerank = false;
+                            u64 refine_factor = knn_scan_shared_data->refine_factor_;
                             KnnSearchOption search_option;
                             search_option.column_logical_type_ = t;
                             for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
@@ -624,47 +661,61 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                     u64 ef = std::stoull(opt_param.param_value_);
                                     search_option.ef_ = ef;
                                 } else if (opt_param.param_name_ == "rerank") {
-                                    rerank = true;
+                                    refine_factor = std::max<u64>(refine_factor, 1);
                                 }
                             }
+                            // search the index codes for refine_factor times of topk candidates, which are reranked with the raw vectors
+                            SizeT search_k = knn_scan_shared_data->topk_;
+                            if (refine_factor > 0) {
+                                search_k *= refine_factor;
+                                search_option.ef_ = std::max(search_option.ef_, search_k);
+                            }
 
-                            i64 result_n = -1;
-                            for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
-                                const auto *query = static_cast<const QueryDataType *>(knn_scan_shared_data->query_embedding_) +
-                                                    query_idx * knn_scan_shared_data->dimension_;
-
-                                SizeT result_n1 = 0;
-                                UniquePtr<DistanceDataType[]> d_ptr = nullptr;
-                                UniquePtr<SegmentOffset[]> l_ptr = nullptr;
-                                if (use_bitmask) {
-                                    BitmaskFilter<SegmentOffset> filter(bitmask);
-                                    if (with_lock) {
-                                        std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, true>(query,
-                                                                                                               knn_scan_shared_data->topk_,
-                                                                                                               filter,
-                                                                                                               search_option);
-                                    } else {
-                                        std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_index->template KnnSearch<BitmaskFilter<SegmentOffset>, false>(query,
-                                                                                                                knn_scan_shared_data->topk_,
-                                                                                                                filter,
-                                                                                                                search_option);
-                                    }
+                            const u64 query_count = knn_scan_shared_data->query_count_;
+                            Vector<const QueryDataType *> queries(query_count);
+                            for (u64 query_idx = 0; query_idx < query_count; ++query_idx) {
+                                queries[query_idx] = static_cast<const QueryDataType *>(knn_scan_shared_data->query_embedding_) +
+                                                     query_idx * knn_scan_shared_data->dimension_;
+                            }
+
+                            // All queries are searched in one batch, which shares the traversal of the upper layers of the graph
+                            Vector<Tuple<SizeT, UniquePtr<DistanceDataType[]>, UniquePtr<SegmentOffset[]>>> results;
+                            if (use_bitmask) {
+                                BitmaskFilter<SegmentOffset> filter(bitmask);
+                                if (with_lock) {
+                                    results = hnsw_index->template KnnSearchBatch<BitmaskFilter<SegmentOffset>, true>(queries.data(),
+                                                                                                                      query_count,
+                                                                                                                      search_k,
+                                                                                                                      filter,
+                                                                                                                      search_option);
                                 } else {
-                                    SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
-                                    if (!with_lock) {
-                                        std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_index->template KnnSearch<false>(query, knn_scan_shared_data->topk_, search_option);
-                                    } else {
-                                        AppendFilter filter(max_segment_offset);
-                                        std::tie(result_n1, d_ptr, l_ptr) =
-                                            hnsw_index->template KnnSearch<AppendFilter, true>(query,
-                                                                                               knn_scan_shared_data->topk_,
-                                                                                               filter,
-                                                                                               search_option);
-                                    }
+                                    results = hnsw_index->template KnnSearchBatch<BitmaskFilter<SegmentOffset>, false>(queries.data(),
+                                                                                                                       query_count,
+                                                                                                                       search_k,
+                                                                                                                       filter,
+                                                                                                                       search_option);
+                                }
+                            } else {
+                                SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
+                                if (!with_lock) {
+                                    results = hnsw_index->template KnnSearchBatch<false>(queries.data(),
+                                                                                         query_count,
+                                                                                         search_k,
+                                                                                         search_option);
+                                } else {
+                                    AppendFilter filter(max_segment_offset);
+                                    results = hnsw_index->template KnnSearchBatch<AppendFilter, true>(queries.data(),
+                                                                                                      query_count,
+                                                                                                      search_k,
+                                                                                                      filter,
+                                                                                                      search_option);
                                 }
+                            }
+
+                            i64 result_n = -1;
+                            for (u64 query_idx = 0; query_idx < query_count; ++query_idx) {
+                                const auto *query = queries[query_idx];
+                                auto &[result_n1, d_ptr, l_ptr] = results[query_idx];
 
                                 if (result_n < 0) {
                                     result_n = result_n1;
@@ -673,46 +724,19 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                     UnrecoverableError(error_message);
                                 }
 
-                                if (rerank) {
-                                    Vector<SizeT> idxes(result_n);
-                                    std::iota(idxes.begin(), idxes.end(), 0);
-                                    std::sort(idxes.begin(), idxes.end(), [&](SizeT i, SizeT j) {
-                                        return l_ptr[i] < l_ptr[j];
-                                    }); // sort by segment offset
-                                    BlockID prev_block_id = -1;
-                                    ColumnVector column_vector;
-                                    for (SizeT idx : idxes) {
-                                        SegmentOffset segment_offset = l_ptr[idx];
-                                        BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
-                                        BlockOffset block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
-                                        if (block_id != prev_block_id) {
-                                            prev_block_id = block_id;
-                                            BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
-                                            column_vector = block_entry->GetConstColumnVector(buffer_mgr, knn_column_id);
-                                        }
-                                        if constexpr (t == LogicalType::kEmbedding) {
-                                            const auto *data = reinterpret_cast<const ColumnDataType *>(column_vector.data());
-                                            data += block_offset * knn_scan_shared_data->dimension_;
-                                            merge_heap->Search(query,
-                                                               data,
-                                                               knn_scan_shared_data->dimension_,
-                                                               dist_func->dist_func_,
-                                                               segment_id,
-                                                               segment_offset);
-                                        } else if constexpr (t == LogicalType::kMultiVector) {
-                                            MultiVectorSearchOneLine<ColumnDataType, QueryDataType, C, DistanceDataType>(merge_heap,
-                                                                                                                         dist_func,
-                                                                                                                         query,
-                                                                                                                         embedding_dim,
-                                                                                                                         buffer_ptr_for_cast,
-                                                                                                                         column_vector,
-                                                                                                                         segment_id,
-                                                                                                                         segment_offset,
-                                                                                                                         block_offset);
-                                        } else {
-                                            static_assert(false, "Unexpected logical type");
-                                        }
-                                    }
+                                if (refine_factor > 0) {
+                                    RefineCandidates<t, ColumnDataType, QueryDataType, C, DistanceDataType>(merge_heap,
+                                                                                                            dist_func,
+                                                                                                            query_idx,
+                                                                                                            query,
+                                                                                                            embedding_dim,
+                                                                                                            buffer_ptr_for_cast,
+                                                                                                            block_index,
+                                                                                                            buffer_mgr,
+                                                                                                            knn_column_id,
+                                                                                                            segment_id,
+                                                                                                            l_ptr.get(),
+                                                                                                            result_n);
                                 } else {
                                     switch (knn_scan_shared_data->knn_distance_type_) {
                                         case KnnDistanceType::kInvalid: {
@@ -738,7 +762,7 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                                         row_ids[i] = RowID{segment_id, l_ptr[i]};
                                     }
 
-                                    merge_heap->Search(0, d_ptr.get(), row_ids.get(), result_n);
+                                    merge_heap->Search(query_idx, d_ptr.get(), row_ids.get(), result_n);
                                 }
                             }
                         };
@@ -772,6 +796,73 @@ void PhysicalKnnScan::ExecuteInternalByColumnDataTypeAndQueryDataType(QueryConte
                     }
                     break;
                 }
+                case IndexType::kDiskAnn: {
+                    if constexpr (!(t == LogicalType::kEmbedding && std::is_same_v<ColumnDataType, f32> && std::is_same_v<QueryDataType, f32> &&
+                                   std::is_same_v<DistanceDataType, f32>)) {
+                        UnrecoverableError("Invalid data type");
+                    } else {
+                        u32 search_l = DISKANN_SEARCH_L;
+                        u32 beam_width = DISKANN_BEAM_WIDTH;
+                        for (const auto &opt_param : knn_scan_shared_data->opt_params_) {
+                            if (opt_param.param_name_ == "search_l") {
+                                search_l = std::stoul(opt_param.param_value_);
+                            } else if (opt_param.param_name_ == "beam_width") {
+                                beam_width = std::stoul(opt_param.param_value_);
+                            }
+                        }
+                        const SegmentOffset max_segment_offset = block_index->GetSegmentOffset(segment_id);
+                        const u32 topk = knn_scan_shared_data->topk_;
+                        // Filtered rows are dropped after the search, so take the whole candidates list when filtering.
+                        const u32 result_limit = use_bitmask ? std::max(topk, search_l) : topk;
+                        auto d_ptr = MakeUniqueForOverwrite<DistanceDataType[]>(result_limit);
+                        auto offset_ptr = MakeUniqueForOverwrite<SegmentOffset[]>(result_limit);
+                        auto row_ids = MakeUniqueForOverwrite<RowID[]>(result_limit);
+                        // chunks are built on the rows from the segment start, the rows after them are searched by brute force
+                        SegmentOffset indexed_row_end = 0;
+                        for (const auto &chunk_index_entry : segment_index_entry->GetDiskAnnIndexSnapshot()) {
+                            if (!chunk_index_entry->CheckVisible(txn)) {
+                                continue;
+                            }
+                            const SegmentOffset chunk_start = chunk_index_entry->base_rowid_.segment_offset_;
+                            indexed_row_end = std::max<SegmentOffset>(indexed_row_end, chunk_start + chunk_index_entry->row_count_);
+                            BufferHandle index_handle = chunk_index_entry->GetIndex();
+                            const auto *diskann_chunk = static_cast<const DiskAnnIndexInChunk *>(index_handle.GetData());
+                            for (u64 query_idx = 0; query_idx < knn_scan_shared_data->query_count_; ++query_idx) {
+                                const auto *query = knn_query_ptr + query_idx * embedding_dim;
+                                const SizeT result_n1 =
+                                    diskann_chunk->Search(query, result_limit, search_l, beam_width, d_ptr.get(), offset_ptr.get());
+                                SizeT result_n = 0;
+                                for (SizeT i = 0; i < result_n1 && result_n < topk; ++i) {
+                                    const SegmentOffset segment_offset = chunk_start + offset_ptr[i];
+                                    if (segment_offset >= max_segment_offset || (use_bitmask && !bitmask.IsTrue(segment_offset))) {
+                                        continue;
+                                    }
+                                    d_ptr[result_n] = d_ptr[i];
+                                    row_ids[result_n] = RowID(segment_id, segment_offset);
+                                    ++result_n;
+                                }
+                                merge_heap->Search(query_idx, d_ptr.get(), row_ids.get(), result_n);
+                            }
+                        }
+                        BlockID prev_block_id = -1;
+                        ColumnVector column_vector;
+                        for (SegmentOffset segment_offset = indexed_row_end; segment_offset < max_segment_offset; ++segment_offset) {
+                            if (use_bitmask && !bitmask.IsTrue(segment_offset)) {
+                                continue;
+                            }
+                            const BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
+                            const BlockOffset block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
+                            if (block_id != prev_block_id) {
+                                prev_block_id = block_id;
+                                BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
+                                column_vector = block_entry->GetConstColumnVector(buffer_mgr, knn_column_id);
+                            }
+                            const auto *data = reinterpret_cast<const ColumnDataType *>(column_vector.data()) + block_offset * embedding_dim;
+                            merge_heap->Search(knn_query_ptr, data, embedding_dim, dist_func->dist_func_, segment_id, segment_offset);
+                        }
+                    }
+                    break;
+                }
                 default: {
                     RecoverableError(Status::NotSupport("Not implemented index type"));
                 }
@@ -900,4 +991,68 @@ void MultiVectorSearchOneLine(MergeKnn<QueryDataType, C, DistanceDataType> *merg
     merge_heap->Search(0, &result_dist, &db_row_id, 1);
 }
 
+template <LogicalType t, typename ColumnDataType, typename QueryDataType, template <typename, typename> typename C, typename DistanceDataType>
+void RefineCandidates(MergeKnn<QueryDataType, C, DistanceDataType> *merge_heap,
+                      KnnDistance1<QueryDataType, DistanceDataType> *dist_func,
+                      const u64 query_idx,
+                      const QueryDataType *query,
+                      const u32 embedding_dim,
+                      UniquePtr<QueryDataType[]> &buffer_ptr_for_cast,
+                      BlockIndex *block_index,
+                      BufferManager *buffer_mgr,
+                      const ColumnID knn_column_id,
+                      const SegmentID segment_id,
+                      const SegmentOffset *candidates,
+                      const SizeT candidate_n) {
+    // visit the candidates in segment offset order, so that the column of each block is read only once
+    Vector<SegmentOffset> segment_offsets(candidates, candidates + candidate_n);
+    std::sort(segment_offsets.begin(), segment_offsets.end());
+    BlockID prev_block_id = -1;
+    ColumnVector column_vector;
+    u32 dist_dim = embedding_dim;
+    for (const SegmentOffset segment_offset : segment_offsets) {
+        const BlockID block_id = segment_offset / DEFAULT_BLOCK_CAPACITY;
+        const BlockOffset block_offset = segment_offset % DEFAULT_BLOCK_CAPACITY;
+        if (block_id != prev_block_id) {
+            prev_block_id = block_id;
+            BlockEntry *block_entry = block_index->GetBlockEntry(segment_id, block_id);
+            column_vector = block_entry->GetConstColumnVector(buffer_mgr, knn_column_id);
+            if constexpr (t == LogicalType::kEmbedding) {
+                auto embedding_info = static_cast<EmbeddingInfo *>(column_vector.data_type()->type_info().get());
+                dist_dim = embedding_info->Type() == EmbeddingDataType::kElemBit ? embedding_dim / 8 : embedding_dim;
+            }
+        }
+        if constexpr (t == LogicalType::kEmbedding) {
+            const auto *data = reinterpret_cast<const ColumnDataType *>(column_vector.data()) + block_offset * dist_dim;
+            const QueryDataType *target_ptr = nullptr;
+            if constexpr (std::is_same_v<ColumnDataType, QueryDataType>) {
+                target_ptr = data;
+            } else {
+                if (!buffer_ptr_for_cast) {
+                    buffer_ptr_for_cast = MakeUniqueForOverwrite<QueryDataType[]>(embedding_dim);
+                }
+                for (u32 i = 0; i < dist_dim; ++i) {
+                    buffer_ptr_for_cast[i] = static_cast<QueryDataType>(data[i]);
+                }
+                target_ptr = buffer_ptr_for_cast.get();
+            }
+            const auto dist = dist_func->dist_func_(query, target_ptr, dist_dim);
+            const RowID db_row_id(segment_id, segment_offset);
+            merge_heap->Search(query_idx, &dist, &db_row_id, 1);
+        } else if constexpr (t == LogicalType::kMultiVector) {
+            MultiVectorSearchOneLine<ColumnDataType, QueryDataType, C, DistanceDataType>(merge_heap,
+                                                                                         dist_func,
+                                                                                         query,
+                                                                                         embedding_dim,
+                                                                                         buffer_ptr_for_cast,
+                                                                                         column_vector,
+                                                                                         segment_id,
+                                                                                         segment_offset,
+                                                                                         block_offset);
+        } else {
+            static_assert(false, "Unexpected logical type");
+        }
+    }
+}
+
 } // namespace infinity
@@ -200,7 +200,7 @@ void PhysicalMergeMatchTensor::AddCache(QueryContext *query_context,
         data_blocks[i] = output_data_blocks[i]->Clone();
     }
     auto cached_node = MakeUnique<CachedMatchTensorScan>(query_ts, this);
-    bool success = cache_mgr->AddCache(std::move(cached_node), std::move(data_blocks));
+    bool success = cache_mgr->AddCache(std::move(cached_node), std::move(data_blocks), query_context->execution_elapsed_us());
     if (!success) {
         LOG_WARN(fmt::format("Add cache failed for query: {}", txn->BeginTS()));
     } else {
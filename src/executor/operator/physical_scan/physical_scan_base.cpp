@@ -193,7 +193,7 @@ void PhysicalScanBase::AddCache(QueryContext *query_context,
             UnrecoverableError("Unsupported operator type for cache");
         }
     }
-    bool success = cache_mgr->AddCache(std::move(cached_node), std::move(data_blocks));
+    bool success = cache_mgr->AddCache(std::move(cached_node), std::move(data_blocks), query_context->execution_elapsed_us());
     if (!success) {
         LOG_WARN(fmt::format("Add cache failed for query: {}", txn->BeginTS()));
     } else {
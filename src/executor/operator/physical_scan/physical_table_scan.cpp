@@ -38,11 +38,34 @@ import third_party;
 import logger;
 import column_vector;
 import logical_type;
+import data_type;
 
 import block_entry;
 
 namespace infinity {
 
+namespace {
+
+// Columns with one fixed-width value per row (embeddings included) can be handed out straight from the block buffer.
+// Booleans are stored as compact bits and var-length types keep their data in outline buffers, those are copied.
+bool CanReferenceBlockColumn(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kBoolean:
+        case LogicalType::kVarchar:
+        case LogicalType::kSparse:
+        case LogicalType::kMultiVector:
+        case LogicalType::kTensor:
+        case LogicalType::kTensorArray: {
+            return false;
+        }
+        default: {
+            return true;
+        }
+    }
+}
+
+} // namespace
+
 void PhysicalTableScan::Init() {}
 
 bool PhysicalTableScan::Execute(QueryContext *query_context, OperatorState *operator_state) {
@@ -91,6 +114,25 @@ Vector<SizeT> &PhysicalTableScan::ColumnIDs() const {
     return column_ids_;
 }
 
+void PhysicalTableScan::PrefetchBlocks(QueryContext *query_context, TableScanFunctionData *table_scan_function_data_ptr) const {
+    // Read ahead the columns of the next blocks while the current block is being scanned
+    const Vector<GlobalBlockID> &block_ids = *table_scan_function_data_ptr->global_block_ids_;
+    u64 &prefetch_idx = table_scan_function_data_ptr->prefetch_block_ids_idx_;
+    u64 prefetch_end = std::min(table_scan_function_data_ptr->current_block_ids_idx_ + 1 + DEFAULT_SCAN_READ_AHEAD_BLOCK_NUM, u64(block_ids.size()));
+    prefetch_idx = std::max(prefetch_idx, table_scan_function_data_ptr->current_block_ids_idx_ + 1);
+
+    TxnTimeStamp begin_ts = query_context->GetTxn()->BeginTS();
+    auto *buffer_mgr = query_context->storage()->buffer_manager();
+    for (; prefetch_idx < prefetch_end; ++prefetch_idx) {
+        const BlockEntry *block_entry = table_scan_function_data_ptr->block_index_->GetBlockEntry(block_ids[prefetch_idx].segment_id_,
+                                                                                                  block_ids[prefetch_idx].block_id_);
+        if (fast_rough_filter_evaluator_ and !fast_rough_filter_evaluator_->Evaluate(begin_ts, *block_entry->GetFastRoughFilter())) {
+            continue;
+        }
+        block_entry->PrefetchColumns(buffer_mgr, table_scan_function_data_ptr->column_ids_);
+    }
+}
+
 void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOperatorState *table_scan_operator_state) {
     if (!table_scan_operator_state->data_block_array_.empty()) {
         String error_message = "Table scan output data block array should be empty";
@@ -149,6 +191,7 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
                                       block_ids_idx,
                                       block_ids_count));
             }
+            PrefetchBlocks(query_context, table_scan_function_data_ptr);
         }
         auto [row_begin, row_end] = current_block_entry->GetVisibleRange(begin_ts, read_offset);
         if (row_begin == row_end) {
@@ -162,6 +205,9 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
             break;
         }
         auto write_size = std::min(write_capacity, SizeT(row_end - row_begin));
+        // A full block without deleted rows going into an empty output is passed on without copying: the output column
+        // references the pinned block buffer and the buffer handle lives as long as the column vector.
+        const bool reference_block = row_begin == 0 && write_size == SizeT(DEFAULT_BLOCK_CAPACITY) && write_capacity == output_ptr->capacity();
 
         read_offset = row_begin;
         SizeT output_column_id{0};
@@ -185,6 +231,10 @@ void PhysicalTableScan::ExecuteInternal(QueryContext *query_context, TableScanOp
                 }
                 default: {
                     ColumnVector column_vector = current_block_entry->GetConstColumnVector(buffer_mgr, column_id);
+                    if (reference_block && column_vector.Size() == write_size && CanReferenceBlockColumn(*column_vector.data_type())) {
+                        output_ptr->column_vectors[output_column_id] = MakeShared<ColumnVector>(std::move(column_vector));
+                        break;
+                    }
                     output_ptr->column_vectors[output_column_id]->AppendWith(column_vector, read_offset, write_size);
                 }
             }
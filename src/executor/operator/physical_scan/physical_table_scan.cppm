@@ -32,6 +32,7 @@ import internal_types;
 import data_type;
 import fast_rough_filter;
 import physical_scan_base;
+import table_scan_function_data;
 
 namespace infinity {
 
@@ -72,6 +73,8 @@ public:
 private:
     void ExecuteInternal(QueryContext *query_context, TableScanOperatorState *table_scan_operator_state);
 
+    void PrefetchBlocks(QueryContext *query_context, TableScanFunctionData *table_scan_function_data_ptr) const;
+
 private:
     UniquePtr<FastRoughFilterEvaluator> fast_rough_filter_evaluator_{};
 
@@ -1310,7 +1310,10 @@ void PhysicalShow::ExecuteShowIndexSegment(QueryContext *query_context, ShowOper
                     chunk_index_entries = std::get<0>(segment_index_entry->GetBMPIndexSnapshot());
                     break;
                 }
-                case IndexType::kDiskAnn:
+                case IndexType::kDiskAnn: {
+                    chunk_index_entries = segment_index_entry->GetDiskAnnIndexSnapshot();
+                    break;
+                }
                 case IndexType::kInvalid: {
                     Status status3 = Status::InvalidIndexName(index_type_name);
                     RecoverableError(status3);
@@ -1389,7 +1392,10 @@ void PhysicalShow::ExecuteShowIndexChunk(QueryContext *query_context, ShowOperat
             chunk_indexes = chunk_index_entries;
             break;
         }
-        case IndexType::kDiskAnn:
+        case IndexType::kDiskAnn: {
+            chunk_indexes = segment_index_entry->GetDiskAnnIndexSnapshot();
+            break;
+        }
         case IndexType::kInvalid: {
             Status status3 = Status::InvalidIndexName(index_type_name);
             RecoverableError(status3);
@@ -4048,6 +4054,58 @@ void PhysicalShow::ExecuteShowGlobalVariable(QueryContext *query_context, ShowOp
             value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
             break;
         }
+        case GlobalVariable::kCacheResultMemory: {
+            const String &result_cache_status = config->ResultCache();
+            if (result_cache_status == "off") {
+                operator_state->status_ = Status::NotSupport(fmt::format("Result cache is off"));
+                RecoverableError(operator_state->status_);
+            }
+            ResultCacheManager *cache_mgr = query_context->storage()->GetResultCacheManagerPtr();
+
+            Vector<SharedPtr<ColumnDef>> output_column_defs = {
+                MakeShared<ColumnDef>(0, integer_type, "value", std::set<ConstraintType>()),
+            };
+
+            SharedPtr<TableDef> table_def =
+                TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("variables"), nullptr, output_column_defs);
+            output_ = MakeShared<DataTable>(table_def, TableType::kResult);
+
+            Vector<SharedPtr<DataType>> output_column_types{
+                integer_type,
+            };
+
+            output_block_ptr->Init(output_column_types);
+            Value value = Value::MakeBigInt(cache_mgr->cache_memory_capacity());
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+            break;
+        }
+        case GlobalVariable::kCacheResultStats: {
+            const String &result_cache_status = config->ResultCache();
+            if (result_cache_status == "off") {
+                operator_state->status_ = Status::NotSupport(fmt::format("Result cache is off"));
+                RecoverableError(operator_state->status_);
+            }
+            ResultCacheManager *cache_mgr = query_context->storage()->GetResultCacheManagerPtr();
+
+            Vector<SharedPtr<ColumnDef>> output_column_defs = {
+                MakeShared<ColumnDef>(0, varchar_type, "value", std::set<ConstraintType>()),
+            };
+
+            SharedPtr<TableDef> table_def =
+                TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("variables"), nullptr, output_column_defs);
+            output_ = MakeShared<DataTable>(table_def, TableType::kResult);
+
+            Vector<SharedPtr<DataType>> output_column_types{
+                varchar_type,
+            };
+
+            output_block_ptr->Init(output_column_types);
+            Value value = Value::MakeVarchar(ResultCacheStatsToString(cache_mgr->GetStats()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+            break;
+        }
         case GlobalVariable::kMemoryCacheMiss: {
             Vector<SharedPtr<ColumnDef>> output_column_defs = {
                 MakeShared<ColumnDef>(0, varchar_type, "value", std::set<ConstraintType>()),
@@ -4090,6 +4148,46 @@ void PhysicalShow::ExecuteShowGlobalVariable(QueryContext *query_context, ShowOp
             value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
             break;
         }
+        case GlobalVariable::kWalFlushStats: {
+            Vector<SharedPtr<ColumnDef>> output_column_defs = {
+                MakeShared<ColumnDef>(0, varchar_type, "value", std::set<ConstraintType>()),
+            };
+
+            SharedPtr<TableDef> table_def =
+                TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("variables"), nullptr, output_column_defs);
+            output_ = MakeShared<DataTable>(table_def, TableType::kResult);
+
+            Vector<SharedPtr<DataType>> output_column_types{
+                varchar_type,
+            };
+
+            output_block_ptr->Init(output_column_types);
+            WalManager *wal_manager = query_context->storage()->wal_manager();
+            Value value = Value::MakeVarchar(WalFlushStatsToString(wal_manager->GetFlushStats()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+            break;
+        }
+        case GlobalVariable::kBufferLoadStats: {
+            Vector<SharedPtr<ColumnDef>> output_column_defs = {
+                MakeShared<ColumnDef>(0, varchar_type, "value", std::set<ConstraintType>()),
+            };
+
+            SharedPtr<TableDef> table_def =
+                TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>("variables"), nullptr, output_column_defs);
+            output_ = MakeShared<DataTable>(table_def, TableType::kResult);
+
+            Vector<SharedPtr<DataType>> output_column_types{
+                varchar_type,
+            };
+
+            output_block_ptr->Init(output_column_types);
+            BufferManager *buffer_manager = query_context->storage()->buffer_manager();
+            Value value = Value::MakeVarchar(BufferLoadStatsToString(buffer_manager->GetLoadStats()));
+            ValueExpression value_expr(value);
+            value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+            break;
+        }
         case GlobalVariable::kQueryCount: {
             Vector<SharedPtr<ColumnDef>> output_column_defs = {
                 MakeShared<ColumnDef>(0, integer_type, "value", std::set<ConstraintType>()),
@@ -4669,6 +4767,59 @@ void PhysicalShow::ExecuteShowGlobalVariables(QueryContext *query_context, ShowO
                 }
                 break;
             }
+            case GlobalVariable::kCacheResultMemory: {
+                const String &result_cache_status = config->ResultCache();
+                if (result_cache_status == "off") {
+                    break;
+                }
+                ResultCacheManager *cache_mgr = query_context->storage()->GetResultCacheManagerPtr();
+                SizeT cache_memory_capacity = cache_mgr->cache_memory_capacity();
+                {
+                    // option name
+                    Value value = Value::MakeVarchar(var_name);
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+                }
+                {
+                    // option value
+                    Value value = Value::MakeVarchar(std::to_string(cache_memory_capacity));
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+                }
+                {
+                    // option description
+                    Value value = Value::MakeVarchar("Result cache memory capacity");
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+                }
+                break;
+            }
+            case GlobalVariable::kCacheResultStats: {
+                const String &result_cache_status = config->ResultCache();
+                if (result_cache_status == "off") {
+                    break;
+                }
+                ResultCacheManager *cache_mgr = query_context->storage()->GetResultCacheManagerPtr();
+                {
+                    // option name
+                    Value value = Value::MakeVarchar(var_name);
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+                }
+                {
+                    // option value
+                    Value value = Value::MakeVarchar(ResultCacheStatsToString(cache_mgr->GetStats()));
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+                }
+                {
+                    // option description
+                    Value value = Value::MakeVarchar("Result cache hits, misses, evictions and memory used");
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+                }
+                break;
+            }
             case GlobalVariable::kMemoryCacheMiss: {
                 BufferManager *buffer_manager = query_context->storage()->buffer_manager();
                 u64 total_request_count = buffer_manager->TotalRequestCount();
@@ -4714,6 +4865,50 @@ void PhysicalShow::ExecuteShowGlobalVariables(QueryContext *query_context, ShowO
                 }
                 break;
             }
+            case GlobalVariable::kWalFlushStats: {
+                {
+                    // option name
+                    Value value = Value::MakeVarchar(var_name);
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+                }
+                {
+                    // option value
+                    WalManager *wal_manager = query_context->storage()->wal_manager();
+                    Value value = Value::MakeVarchar(WalFlushStatsToString(wal_manager->GetFlushStats()));
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+                }
+                {
+                    // option description
+                    Value value = Value::MakeVarchar("WAL flush batches, synced batches and sync latency");
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+                }
+                break;
+            }
+            case GlobalVariable::kBufferLoadStats: {
+                {
+                    // option name
+                    Value value = Value::MakeVarchar(var_name);
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[0]);
+                }
+                {
+                    // option value
+                    BufferManager *buffer_manager = query_context->storage()->buffer_manager();
+                    Value value = Value::MakeVarchar(BufferLoadStatsToString(buffer_manager->GetLoadStats()));
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[1]);
+                }
+                {
+                    // option description
+                    Value value = Value::MakeVarchar("Buffer cache miss load latency and prefetches");
+                    ValueExpression value_expr(value);
+                    value_expr.AppendToChunk(output_block_ptr->column_vectors[2]);
+                }
+                break;
+            }
             case GlobalVariable::kQueryCount: {
                 {
                     // option name
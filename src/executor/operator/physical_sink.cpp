@@ -486,6 +486,59 @@ void PhysicalSink::FillSinkStateFromLastOperatorState(FragmentContext *fragment_
         LOG_TRACE("Task not completed");
         return;
     }
+    if (task_operator_state->operator_type_ == PhysicalOperatorType::kParallelAggregate) {
+        // Partition i of the partial aggregate result is only sent to the i-th task of the merge fragment.
+        auto *parallel_aggregate_state = static_cast<ParallelAggregateOperatorState *>(task_operator_state);
+        const Vector<SizeT> &partition_offsets = parallel_aggregate_state->partition_offsets_;
+        SizeT partition_count = queue_sink_state->fragment_data_queues_.size();
+        if (partition_offsets.size() != partition_count + 1) {
+            String error_message = fmt::format("Parallel aggregate output isn't partitioned for {} merge tasks", partition_count);
+            UnrecoverableError(error_message);
+        }
+        for (SizeT partition_idx = 0; partition_idx < partition_count; ++partition_idx) {
+            SizeT block_offset = partition_offsets[partition_idx];
+            SizeT partition_block_count = partition_offsets[partition_idx + 1] - block_offset;
+            for (SizeT idx = 0; idx < partition_block_count; ++idx) {
+                auto fragment_data = MakeShared<FragmentData>(queue_sink_state->fragment_id_,
+                                                              std::move(task_operator_state->data_block_array_[block_offset + idx]),
+                                                              queue_sink_state->task_id_,
+                                                              idx,
+                                                              partition_block_count,
+                                                              true,
+                                                              false,
+                                                              0);
+                queue_sink_state->fragment_data_queues_[partition_idx]->Enqueue(fragment_data);
+            }
+        }
+        task_operator_state->data_block_array_.clear();
+        return;
+    }
+    if (task_operator_state->operator_type_ == PhysicalOperatorType::kHash) {
+        // Partition i of the hashed input is only sent to the i-th task of the hash join fragment.
+        auto *hash_state = static_cast<HashOperatorState *>(task_operator_state);
+        Vector<Vector<UniquePtr<DataBlock>>> &partition_blocks = hash_state->partition_blocks_;
+        SizeT partition_count = queue_sink_state->fragment_data_queues_.size();
+        if (partition_blocks.size() != partition_count) {
+            String error_message = fmt::format("Hash output isn't partitioned for {} join tasks", partition_count);
+            UnrecoverableError(error_message);
+        }
+        for (SizeT partition_idx = 0; partition_idx < partition_count; ++partition_idx) {
+            SizeT partition_block_count = partition_blocks[partition_idx].size();
+            for (SizeT idx = 0; idx < partition_block_count; ++idx) {
+                auto fragment_data = MakeShared<FragmentData>(queue_sink_state->fragment_id_,
+                                                              std::move(partition_blocks[partition_idx][idx]),
+                                                              queue_sink_state->task_id_,
+                                                              idx,
+                                                              partition_block_count,
+                                                              task_operator_state->Complete(),
+                                                              false,
+                                                              0);
+                queue_sink_state->fragment_data_queues_[partition_idx]->Enqueue(fragment_data);
+            }
+            partition_blocks[partition_idx].clear();
+        }
+        return;
+    }
     SizeT output_data_block_count = task_operator_state->data_block_array_.size();
     for (SizeT idx = 0; idx < output_data_block_count; ++idx) {
         auto fragment_data = MakeShared<FragmentData>(queue_sink_state->fragment_id_,
@@ -49,7 +49,7 @@ public:
     u32 WriteTopResultsToOutput(const Vector<Vector<SharedPtr<ColumnVector>>> &eval_columns,
                                 const Vector<UniquePtr<DataBlock>> &input_data_block_array,
                                 Vector<UniquePtr<DataBlock>> &output_data_block_array) {
-        ResetInput(eval_columns);
+        ResetInput(eval_columns, input_data_block_array);
         SolveTop();
         WriteToOutput(input_data_block_array, output_data_block_array);
         return size_;
@@ -62,13 +62,15 @@ private:
     UniquePtr<Pair<u32, u32>[]> candidate_local_row_ids_;
     Pair<u32, u32> *row_ids_ptr_ = nullptr; // with offset, start from 1, for heap sort
     const Vector<Vector<SharedPtr<ColumnVector>>> *input_data_ = nullptr;
+    const Vector<UniquePtr<DataBlock>> *input_blocks_ = nullptr;
     void Init() {
         candidate_local_row_ids_ = MakeUniqueForOverwrite<Pair<u32, u32>[]>(limit_);
         row_ids_ptr_ = candidate_local_row_ids_.get() - 1;
     }
-    void ResetInput(const Vector<Vector<SharedPtr<ColumnVector>>> &eval_columns) {
+    void ResetInput(const Vector<Vector<SharedPtr<ColumnVector>>> &eval_columns, const Vector<UniquePtr<DataBlock>> &input_data_block_array) {
         size_ = 0;
         input_data_ = &eval_columns;
+        input_blocks_ = &input_data_block_array;
     }
     void HeapifyDown(u32 index, auto compare) {
         if (index == 0 || (index << 1) > size_) {
@@ -125,6 +127,15 @@ private:
         };
         const u32 input_block_cnt = input_data_->size();
         for (u32 block_id = 0; block_id < input_block_cnt; ++block_id) {
+            const DataBlock *input_block = (*input_blocks_)[block_id].get();
+            if (input_block->HasSelection()) {
+                // Only the selected rows are candidates, the winners are gathered by WriteToOutput.
+                const u32 selected_cnt = input_block->selected_row_count();
+                for (u32 idx = 0; idx < selected_cnt; ++idx) {
+                    AddCandidate({block_id, static_cast<u32>(input_block->SelectedRowIndex(idx))}, compare_id_for_heap);
+                }
+                continue;
+            }
             const u32 row_cnt = (*input_data_)[block_id][0]->Size();
             for (u32 row_id = 0; row_id < row_cnt; ++row_id) {
                 AddCandidate({block_id, row_id}, compare_id_for_heap);
@@ -342,7 +353,7 @@ bool PhysicalTop::Execute(QueryContext *, OperatorState *operator_state) {
     auto &output_data_block_array = top_operator_state->data_block_array_;
 
     SizeT total_hits_row_count = std::accumulate(input_data_block_array.begin(), input_data_block_array.end(), 0, [](u32 x, const auto &y) -> u32 {
-        return x + y->row_count();
+        return x + y->selected_row_count();
     });
     // sometimes the input_data_block_array is empty, but the operator is not complete
     if (total_hits_row_count == 0) {
@@ -359,6 +370,15 @@ bool PhysicalTop::Execute(QueryContext *, OperatorState *operator_state) {
         String error_message = "output data_block_array_ is not empty";
         UnrecoverableError(error_message);
     }
+    for (const auto &expr : sort_expressions_) {
+        if (expr->type() != ExpressionType::kReference) {
+            // Computed sort keys are only evaluated on the selected rows
+            for (auto &input_data_block : input_data_block_array) {
+                input_data_block->MaterializeSelection();
+            }
+            break;
+        }
+    }
     auto eval_columns = GetEvalColumns(sort_expressions_, top_operator_state->expr_states_, input_data_block_array);
     TopSolver solve_top(limit_, prefer_left_function_);
     auto output_row_cnt = solve_top.WriteTopResultsToOutput(eval_columns, input_data_block_array, output_data_block_array);
@@ -89,6 +89,8 @@ public:
 
     SizeT TaskletCount() override { return left_->TaskletCount(); }
 
+    bool AcceptsSelection() const override { return true; }
+
     // for OperatorState and Explain
     inline auto const &GetSortExpressions() const { return sort_expressions_; }
 
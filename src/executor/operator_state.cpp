@@ -174,6 +174,24 @@ bool QueueSourceState::GetData() {
             merge_aggregate_op_state->input_complete_ = completed;
             break;
         }
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+            auto *merge_parallel_aggregate_op_state = (MergeParallelAggregateOperatorState *)next_op_state;
+            merge_parallel_aggregate_op_state->input_data_block_ = std::move(fragment_data->data_block_);
+            merge_parallel_aggregate_op_state->input_complete_ = completed;
+            break;
+        }
+        case PhysicalOperatorType::kJoinHash: {
+            auto *hash_join_op_state = (HashJoinOperatorState *)next_op_state;
+            if (fragment_data_base->type_ == FragmentDataType::kData) {
+                auto *fragment_data = static_cast<FragmentData *>(fragment_data_base.get());
+                hash_join_op_state->input_data_block_ = std::move(fragment_data->data_block_);
+                hash_join_op_state->input_is_build_ = fragment_data->fragment_id_ == hash_join_op_state->build_fragment_id_;
+            }
+            hash_join_op_state->build_complete_ = !num_tasks_.contains(hash_join_op_state->build_fragment_id_);
+            hash_join_op_state->input_complete_ = completed;
+            break;
+        }
         default: {
             String error_message = "Not support operator type";
             UnrecoverableError(error_message);
@@ -37,6 +37,8 @@ import internal_types;
 import column_def;
 import data_type;
 import segment_entry;
+import hash_table;
+import local_file_handle;
 
 namespace infinity {
 
@@ -74,6 +76,10 @@ export struct AggregateOperatorState : public OperatorState {
         : OperatorState(PhysicalOperatorType::kAggregate), states_(std::move(states)) {}
 
     Vector<UniquePtr<char[]>> states_;
+
+    // Group by: the hash table maps group keys to group ids, and each aggregate keeps its states in chunks indexed by group id.
+    UniquePtr<HashTable> hash_table_{};
+    Vector<Vector<UniquePtr<char[]>>> group_states_{};
 };
 
 // Merge Aggregate
@@ -84,16 +90,35 @@ export struct MergeAggregateOperatorState : public OperatorState {
     // Vector<UniquePtr<DataBlock>> input_data_blocks_{nullptr};
     UniquePtr<DataBlock> input_data_block_{nullptr};
     bool input_complete_{false};
+
+    // Group by: map the group keys of the partial results to the output row which holds the merged result.
+    UniquePtr<HashTable> hash_table_{};
+    Vector<u32> group_ids_{};
 };
 
 // Merge Parallel Aggregate
 export struct MergeParallelAggregateOperatorState : public OperatorState {
     inline explicit MergeParallelAggregateOperatorState() : OperatorState(PhysicalOperatorType::kMergeParallelAggregate) {}
+
+    // One partition of the partial results of every parallel aggregate task.
+    UniquePtr<DataBlock> input_data_block_{nullptr};
+    bool input_complete_{false};
+
+    UniquePtr<HashTable> hash_table_{};
+    Vector<u32> group_ids_{};
 };
 
 // Parallel Aggregate
 export struct ParallelAggregateOperatorState : public OperatorState {
     inline explicit ParallelAggregateOperatorState() : OperatorState(PhysicalOperatorType::kParallelAggregate) {}
+
+    // Thread-local partial aggregation, same layout as AggregateOperatorState.
+    UniquePtr<HashTable> hash_table_{};
+    Vector<Vector<UniquePtr<char[]>>> group_states_{};
+
+    // Number of merge tasks, the output blocks of partition i are data_block_array_[partition_offsets_[i], partition_offsets_[i + 1]).
+    SizeT partition_count_{1};
+    Vector<SizeT> partition_offsets_{};
 };
 
 // UnionAll
@@ -174,6 +199,13 @@ export struct IndexScanOperatorState : public OperatorState {
 // Hash
 export struct HashOperatorState : public OperatorState {
     inline explicit HashOperatorState() : OperatorState(PhysicalOperatorType::kHash) {}
+
+    // Only used to hash the join keys.
+    UniquePtr<HashTable> hash_table_{};
+
+    // Number of hash join tasks, the blocks of partition_blocks_[i] are only sent to the i-th join task.
+    SizeT partition_count_{1};
+    Vector<Vector<UniquePtr<DataBlock>>> partition_blocks_{};
 };
 
 // Merge Hash
@@ -184,6 +216,32 @@ export struct MergeHashOperatorState : public OperatorState {
 // Hash Join
 export struct HashJoinOperatorState : public OperatorState {
     inline explicit HashJoinOperatorState() : OperatorState(PhysicalOperatorType::kJoinHash) {}
+
+    // Since hash join is the first op, the input comes from the queue source: one block of either the build or the probe side.
+    u64 build_fragment_id_{};
+    UniquePtr<DataBlock> input_data_block_{nullptr};
+    bool input_is_build_{false};
+    bool build_complete_{false};
+    bool input_complete_{false};
+
+    // Build side partition of this task. Once the build side is complete, build_rows_ of the same key are chained from
+    // group_heads_[group id] through build_row_next_.
+    Vector<SharedPtr<DataBlock>> build_blocks_{};
+    SizeT build_bytes_{};
+    UniquePtr<HashTable> hash_table_{};
+    Vector<u32> group_heads_{};
+    Vector<u32> build_row_next_{};
+    Vector<Pair<u32, u32>> build_rows_{}; // (block index, row index)
+    // Full join only: build_matched_[block index][row index] is set once the build row joins a probe row.
+    Vector<Vector<bool>> build_matched_{};
+
+    // Probe blocks received before the build side is complete
+    Vector<SharedPtr<DataBlock>> probe_blocks_{};
+
+    // Build side beyond the join memory budget: both sides are partitioned again into spill files under the temp dir,
+    // spill_paths_[i] / spill_files_[i] is the build side of spill partition i, and [i + spill partition count] is its probe side.
+    Vector<String> spill_paths_{};
+    Vector<UniquePtr<LocalFileHandle>> spill_files_{};
 };
 
 // Nested Loop
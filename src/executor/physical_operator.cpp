@@ -78,7 +78,10 @@ void PhysicalOperator::InputLoad(QueryContext *query_context, OperatorState *ope
 
         auto row_column_id = input_block->column_count() - 1;
 
-        for (SizeT j = 0; j < row_count; ++j) {
+        // Rows dropped by the selection are never read back
+        SizeT selected_row_count = input_block->selected_row_count();
+        for (SizeT selected_idx = 0; selected_idx < selected_row_count; ++selected_idx) {
+            SizeT j = input_block->SelectedRowIndex(selected_idx);
             // If late materialization needs to be optional, then this needs to be modified
             RowID row_id = input_block->GetValue(row_column_id, j).value_.row;
             u32 segment_id = row_id.segment_id_;
@@ -102,6 +102,10 @@ public:
 
     virtual bool ParallelOperator() const { return false; }
 
+    // Whether the operator can consume input data blocks carrying a selection (see DataBlock::SetSelection).
+    // Data blocks are materialized before they reach an operator that returns false.
+    virtual bool AcceptsSelection() const { return false; }
+
 public:
     // Exchange
     virtual bool IsExchange() const { return false; }
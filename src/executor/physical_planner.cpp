@@ -133,6 +133,12 @@ import logical_read_cache;
 
 import value;
 import value_expression;
+import reference_expression;
+import cast_expression;
+import function_expression;
+import conjunction_expression;
+import expression_type;
+import join_reference;
 import match_tensor_expression;
 import match_sparse_expression;
 import explain_physical_plan;
@@ -145,6 +151,7 @@ import explain_statement;
 import alter_statement;
 import load_meta;
 import block_index;
+import base_table_ref;
 import logger;
 
 namespace infinity {
@@ -504,11 +511,13 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildDropView(const SharedPtr<Logic
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildInsert(const SharedPtr<LogicalNode> &logical_operator) const {
 
     SharedPtr<LogicalInsert> logical_insert_ptr = dynamic_pointer_cast<LogicalInsert>(logical_operator);
-    return MakeUnique<PhysicalInsert>(logical_operator->node_id(),
-                                      logical_insert_ptr->table_entry(),
-                                      logical_insert_ptr->table_index(),
-                                      logical_insert_ptr->value_list(),
-                                      logical_operator->load_metas());
+    auto physical_insert = MakeUnique<PhysicalInsert>(logical_operator->node_id(),
+                                                      logical_insert_ptr->table_entry(),
+                                                      logical_insert_ptr->table_index(),
+                                                      logical_insert_ptr->value_list(),
+                                                      logical_operator->load_metas());
+    physical_insert->set_data_blocks(logical_insert_ptr->data_blocks());
+    return physical_insert;
 }
 
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildDelete(const SharedPtr<LogicalNode> &logical_operator) const {
@@ -632,6 +641,23 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
 
     SizeT tasklet_count = input_physical_operator->TaskletCount();
 
+    if (tasklet_count > 1 && !logical_aggregate->groups_.empty()) {
+        // Group by on multiple tasks: thread-local partial aggregation, then the partitions are merged in parallel
+        auto parallel_agg_op = MakeUnique<PhysicalParallelAggregate>(logical_aggregate->node_id(),
+                                                                     std::move(input_physical_operator),
+                                                                     logical_aggregate->groups_,
+                                                                     logical_aggregate->groupby_index_,
+                                                                     logical_aggregate->aggregates_,
+                                                                     logical_aggregate->aggregate_index_,
+                                                                     logical_operator->load_metas());
+        return MakeUnique<PhysicalMergeParallelAggregate>(query_context_ptr_->GetNextNodeID(),
+                                                          std::move(parallel_agg_op),
+                                                          logical_aggregate->GetOutputNames(),
+                                                          logical_aggregate->GetOutputTypes(),
+                                                          query_context_ptr_->cpu_number_limit(),
+                                                          MakeShared<Vector<LoadMeta>>());
+    }
+
     auto physical_agg_op = MakeUnique<PhysicalAggregate>(logical_aggregate->node_id(),
                                                          std::move(input_physical_operator),
                                                          logical_aggregate->groups_,
@@ -652,6 +678,53 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildAggregate(const SharedPtr<Logi
     }
 }
 
+namespace {
+
+// The column reference of a join key, which may be wrapped by a cast.
+const ReferenceExpression *JoinKeyReference(const SharedPtr<BaseExpression> &expression) {
+    const BaseExpression *key_expression = expression.get();
+    if (key_expression->type() == ExpressionType::kCast) {
+        key_expression = key_expression->arguments()[0].get();
+    }
+    if (key_expression->type() != ExpressionType::kReference) {
+        return nullptr;
+    }
+    return static_cast<const ReferenceExpression *>(key_expression);
+}
+
+// Move the key of the right input to the column index of the right input itself.
+SharedPtr<BaseExpression> RebaseJoinKey(const SharedPtr<BaseExpression> &expression, SizeT left_column_count) {
+    const ReferenceExpression *reference = JoinKeyReference(expression);
+    auto rebased_reference = ReferenceExpression::Make(reference->Type(),
+                                                       reference->table_name(),
+                                                       reference->column_name(),
+                                                       reference->alias_,
+                                                       reference->column_index() - left_column_count);
+    if (expression->type() == ExpressionType::kCast) {
+        auto *cast_expression = static_cast<CastExpression *>(expression.get());
+        return MakeShared<CastExpression>(cast_expression->func_, rebased_reference, cast_expression->Type());
+    }
+    return rebased_reference;
+}
+
+// Row count of the scanned tables under the node, it's used to pick the build side of a hash join.
+SizeT EstimateRowCount(const SharedPtr<LogicalNode> &logical_node) {
+    if (logical_node.get() == nullptr) {
+        return 0;
+    }
+    if (logical_node->operator_type() == LogicalNodeType::kTableScan) {
+        auto *logical_table_scan = static_cast<LogicalTableScan *>(logical_node.get());
+        SizeT row_count = 0;
+        for (const auto &[segment_id, segment_snapshot] : logical_table_scan->base_table_ref_->block_index_->segment_block_index_) {
+            row_count += segment_snapshot.segment_offset_;
+        }
+        return row_count;
+    }
+    return EstimateRowCount(logical_node->left_node()) + EstimateRowCount(logical_node->right_node());
+}
+
+} // namespace
+
 UniquePtr<PhysicalOperator> PhysicalPlanner::BuildJoin(const SharedPtr<LogicalNode> &logical_operator) const {
 
     auto left_node = logical_operator->left_node();
@@ -674,6 +747,62 @@ UniquePtr<PhysicalOperator> PhysicalPlanner::BuildJoin(const SharedPtr<LogicalNo
     left_physical_operator = BuildPhysicalOperator(left_node);
     right_physical_operator = BuildPhysicalOperator(right_node);
 
+    JoinType join_type = logical_join->join_type_;
+    if (join_type == JoinType::kInner || join_type == JoinType::kLeft || join_type == JoinType::kRight || join_type == JoinType::kFull ||
+        join_type == JoinType::kSemi || join_type == JoinType::kAnti) {
+        // Split the conditions into the equal keys of the two inputs and the other conditions
+        SizeT left_column_count = left_physical_operator->GetOutputTypes()->size();
+        Vector<SharedPtr<BaseExpression>> left_keys;
+        Vector<SharedPtr<BaseExpression>> right_keys;
+        SharedPtr<BaseExpression> other_condition{};
+        for (const auto &condition : logical_join->conditions_) {
+            bool is_equal_key = false;
+            if (condition->type() == ExpressionType::kFunction &&
+                static_cast<FunctionExpression *>(condition.get())->ScalarFunctionName() == "=") {
+                const SharedPtr<BaseExpression> &first_arg = condition->arguments()[0];
+                const SharedPtr<BaseExpression> &second_arg = condition->arguments()[1];
+                const ReferenceExpression *first_reference = JoinKeyReference(first_arg);
+                const ReferenceExpression *second_reference = JoinKeyReference(second_arg);
+                if (first_reference != nullptr && second_reference != nullptr && first_arg->Type() == second_arg->Type()) {
+                    bool first_is_left = first_reference->column_index() < left_column_count;
+                    bool second_is_left = second_reference->column_index() < left_column_count;
+                    if (first_is_left != second_is_left) {
+                        left_keys.emplace_back(first_is_left ? first_arg : second_arg);
+                        right_keys.emplace_back(RebaseJoinKey(first_is_left ? second_arg : first_arg, left_column_count));
+                        is_equal_key = true;
+                    }
+                }
+            }
+            if (!is_equal_key) {
+                other_condition =
+                    other_condition.get() == nullptr ? condition : MakeShared<ConjunctionExpression>(ConjunctionType::kAnd, other_condition, condition);
+            }
+        }
+
+        if (!left_keys.empty()) {
+            // A right join builds on the left input to output the unmatched right rows as probe rows. An inner join builds on the
+            // smaller input, and the other join types build on the right input to output the unmatched left rows.
+            bool build_left = join_type == JoinType::kRight ||
+                              (join_type == JoinType::kInner && EstimateRowCount(left_node) < EstimateRowCount(right_node));
+            auto left_hash = MakeUnique<PhysicalHash>(query_context_ptr_->GetNextNodeID(),
+                                                      std::move(left_physical_operator),
+                                                      std::move(left_keys),
+                                                      MakeShared<Vector<LoadMeta>>());
+            auto right_hash = MakeUnique<PhysicalHash>(query_context_ptr_->GetNextNodeID(),
+                                                       std::move(right_physical_operator),
+                                                       std::move(right_keys),
+                                                       MakeShared<Vector<LoadMeta>>());
+            return MakeUnique<PhysicalHashJoin>(logical_operator->node_id(),
+                                                join_type,
+                                                std::move(left_hash),
+                                                std::move(right_hash),
+                                                std::move(other_condition),
+                                                build_left,
+                                                query_context_ptr_->cpu_number_limit(),
+                                                logical_operator->load_metas());
+        }
+    }
+
     return MakeUnique<PhysicalNestedLoopJoin>(logical_operator->node_id(),
                                               logical_join->join_type_,
                                               logical_join->conditions_,
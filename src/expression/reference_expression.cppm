@@ -37,6 +37,10 @@ public:
 
     inline SizeT column_index() const { return column_index_; }
 
+    inline const String &table_name() const { return table_name_; }
+
+    inline const String &column_name() const { return column_name_; }
+
     inline DataType Type() const override { return data_type_; };
 
     String ToString() const override;
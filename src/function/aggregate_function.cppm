@@ -34,6 +34,7 @@ namespace infinity {
 
 using AggregateInitializeFuncType = std::function<void(ptr_t)>;
 using AggregateUpdateFuncType = std::function<void(ptr_t, const SharedPtr<ColumnVector> &)>;
+using AggregateGroupedUpdateFuncType = std::function<void(ptr_t *, const SharedPtr<ColumnVector> &, SizeT)>;
 using AggregateFinalizeFuncType = std::function<ptr_t(ptr_t)>;
 
 class AggregateOperation {
@@ -98,6 +99,62 @@ public:
         }
     }
 
+    template <typename AggregateState, typename InputType>
+    static inline void StateGroupedUpdate(ptr_t *states, const SharedPtr<ColumnVector> &input_column_vector, SizeT row_count) {
+        // Row idx of the input column vector is accumulated into states[idx], the state of the group which the row belongs to.
+
+        switch (input_column_vector->vector_type()) {
+            case ColumnVectorType::kCompactBit: {
+                if constexpr (!std::is_same_v<InputType, BooleanT>) {
+                    String error_message = "kCompactBit column vector only support Boolean type";
+                    UnrecoverableError(error_message);
+                } else {
+                    BooleanT value;
+                    const VectorBuffer *buffer = input_column_vector->buffer_.get();
+                    for (SizeT idx = 0; idx < row_count; ++idx) {
+                        value = buffer->GetCompactBit(idx);
+                        ((AggregateState *)states[idx])->Update(&value, 0);
+                    }
+                }
+                break;
+            }
+            case ColumnVectorType::kFlat: {
+                auto *input_ptr = (InputType *)(input_column_vector->data());
+                for (SizeT idx = 0; idx < row_count; ++idx) {
+                    ((AggregateState *)states[idx])->Update(input_ptr, idx);
+                }
+                break;
+            }
+            case ColumnVectorType::kConstant: {
+                if (input_column_vector->data_type()->type() == LogicalType::kBoolean) {
+                    if constexpr (!std::is_same_v<InputType, BooleanT>) {
+                        String error_message = "types do not match";
+                        UnrecoverableError(error_message);
+                    } else {
+                        BooleanT value = input_column_vector->buffer_->GetCompactBit(0);
+                        for (SizeT idx = 0; idx < row_count; ++idx) {
+                            ((AggregateState *)states[idx])->Update(&value, 0);
+                        }
+                    }
+                    break;
+                }
+                auto *input_ptr = (InputType *)(input_column_vector->data());
+                for (SizeT idx = 0; idx < row_count; ++idx) {
+                    ((AggregateState *)states[idx])->Update(input_ptr, 0);
+                }
+                break;
+            }
+            case ColumnVectorType::kHeterogeneous: {
+                String error_message = "Not implement: Heterogeneous type";
+                UnrecoverableError(error_message);
+            }
+            default: {
+                String error_message = "Not implement: Other type";
+                UnrecoverableError(error_message);
+            }
+        }
+    }
+
     template <typename AggregateState, typename ResultType>
     static inline ptr_t StateFinalize(const ptr_t state) {
         // Loop execute state update according to the input column vector
@@ -114,9 +171,10 @@ public:
                                SizeT state_size,
                                AggregateInitializeFuncType init_func,
                                AggregateUpdateFuncType update_func,
+                               AggregateGroupedUpdateFuncType grouped_update_func,
                                AggregateFinalizeFuncType finalize_func)
         : Function(std::move(name), FunctionType::kAggregate), init_func_(std::move(init_func)), update_func_(std::move(update_func)),
-          finalize_func_(std::move(finalize_func)), argument_type_(std::move(argument_type)), return_type_(std::move(return_type)),
+          grouped_update_func_(std::move(grouped_update_func)), finalize_func_(std::move(finalize_func)), argument_type_(std::move(argument_type)), return_type_(std::move(return_type)),
           state_size_(state_size) {}
 
     void CastArgumentTypes(BaseExpression &input_argument);
@@ -127,11 +185,15 @@ public:
 
     UniquePtr<char[]> InitState() const { return MakeUnique<char[]>(state_size_); }
 
+    // States of the groups are laid out back to back, each one padded to keep 8-byte alignment.
+    [[nodiscard]] SizeT GroupStateStride() const { return (state_size_ + 7) & ~(SizeT)7; }
+
     [[nodiscard]] String GetFuncName() const { return name_; }
 
 public:
     AggregateInitializeFuncType init_func_;
     AggregateUpdateFuncType update_func_;
+    AggregateGroupedUpdateFuncType grouped_update_func_;
     AggregateFinalizeFuncType finalize_func_;
 
     DataType argument_type_;
@@ -148,6 +210,7 @@ inline AggregateFunction UnaryAggregate(const String &name, const DataType &inpu
                              AggregateState::Size(input_type),
                              AggregateOperation::StateInitialize<AggregateState>,
                              AggregateOperation::StateUpdate<AggregateState, InputType>,
+                             AggregateOperation::StateGroupedUpdate<AggregateState, InputType>,
                              AggregateOperation::StateFinalize<AggregateState, ResultType>);
 }
 
@@ -36,6 +36,22 @@ import simd_functions;
 
 namespace infinity {
 
+i64 ParseRefineFactor(const Vector<InitParameter> &opt_params, const i64 topk) {
+    i64 refine_factor = 0;
+    for (const auto &opt_param : opt_params) {
+        if (opt_param.param_name_ == "refine_factor") {
+            refine_factor = DataType::StringToValue<IntegerT>(opt_param.param_value_);
+            if (refine_factor <= 0) {
+                RecoverableError(Status::SyntaxError(fmt::format("Invalid refine_factor value: {}", opt_param.param_value_)));
+            }
+        }
+    }
+    if (refine_factor > 0 && topk > 0 && refine_factor > static_cast<i64>(std::numeric_limits<u32>::max()) / topk) {
+        RecoverableError(Status::SyntaxError(fmt::format("Invalid refine_factor value: {}, topk * refine_factor is out of range.", refine_factor)));
+    }
+    return refine_factor;
+}
+
 template <>
 void KnnDistance1<f32, f32>::InitKnnDistance1(KnnDistanceType dist_type) {
     switch (dist_type) {
@@ -36,6 +36,9 @@ import internal_types;
 
 namespace infinity {
 
+// Parse the refine_factor search option: 0 when it is not given, otherwise a positive factor with topk * refine_factor in u32.
+export i64 ParseRefineFactor(const Vector<InitParameter> &opt_params, i64 topk);
+
 export class KnnScanSharedData {
 public:
     KnnScanSharedData(SharedPtr<BaseTableRef> table_ref,
@@ -50,7 +53,8 @@ public:
                       KnnDistanceType knn_distance_type)
         : table_ref_(table_ref), block_column_entries_(std::move(block_column_entries)), index_entries_(std::move(index_entries)),
           opt_params_(std::move(opt_params)), topk_(topk), dimension_(dimension), query_count_(query_embedding_count),
-          query_embedding_(query_embedding), query_elem_type_(elem_type), knn_distance_type_(knn_distance_type) {}
+          query_embedding_(query_embedding), query_elem_type_(elem_type), knn_distance_type_(knn_distance_type),
+          refine_factor_(ParseRefineFactor(opt_params_, topk_)) {}
 
 public:
     const SharedPtr<BaseTableRef> table_ref_{};
@@ -65,6 +69,8 @@ public:
     void *const query_embedding_;
     const EmbeddingDataType query_elem_type_{EmbeddingDataType::kElemInvalid};
     const KnnDistanceType knn_distance_type_{KnnDistanceType::kInvalid};
+    // when not 0, topk_ * refine_factor_ candidates are searched from the index codes and reranked with the raw vectors
+    const i64 refine_factor_{};
 
     atomic_u64 current_block_idx_{0};
     atomic_u64 current_index_idx_{0};
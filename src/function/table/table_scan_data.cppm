@@ -35,6 +35,8 @@ public:
 
     u64 current_block_ids_idx_{0};
     SizeT current_read_offset_{0};
+    // Blocks before it have been prefetched
+    u64 prefetch_block_ids_idx_{0};
 };
 
 } // namespace infinity
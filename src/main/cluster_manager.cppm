@@ -84,7 +84,8 @@ public:
 
     // Used by leader to notify leader to synchronize logs to the follower and learner, during registration
     Status SyncLogsOnRegistration(const SharedPtr<NodeInfo> &non_leader_node, const SharedPtr<PeerClient> &peer_client);
-    void PrepareLogs(const SharedPtr<String> &log_string);
+    // Copy the wal entries written in one batch, `logs` holds the entries of `log_sizes` one after another.
+    void PrepareLogs(const char *logs, const Vector<SizeT> &log_sizes);
     Status SyncLogs();
     // Used by leader to control the number of follower
     Status SetFollowerNumber(SizeT new_follower_number);
@@ -94,7 +95,8 @@ private:
     void CheckHeartBeatThread();
     Status SendLogs(const String &node_name,
                     const SharedPtr<PeerClient> &peer_client,
-                    const Vector<SharedPtr<String>> &logs,
+                    const Vector<SharedPtr<String>> &log_buffers,
+                    const Vector<std::string_view> &logs,
                     bool synchronize,
                     bool on_register);
     Status GetReadersInfo(Vector<SharedPtr<NodeInfo>> &followers,
@@ -103,7 +105,8 @@ private:
                           Vector<SharedPtr<PeerClient>> &learner_clients);
     // Leader clients to followers and learners
     Map<String, SharedPtr<PeerClient>> reader_client_map_{}; // Used by leader;
-    Vector<SharedPtr<String>> logs_to_sync_{};
+    Vector<SharedPtr<String>> log_buffers_to_sync_{};
+    Vector<std::string_view> logs_to_sync_{}; // wal entries in log_buffers_to_sync_
     Atomic<u8> follower_limit_{4};
     Vector<SharedPtr<PeerClient>> clients_for_cleanup_;
 
@@ -419,10 +419,25 @@ Status ClusterManager::SyncLogsOnRegistration(const SharedPtr<NodeInfo> &non_lea
     // Leader will send the WALs
     String non_leader_node_name = non_leader_node->node_name();
     LOG_TRACE(fmt::format("Leader will send the diff logs count: {} to {} synchronously", wal_strings.size(), non_leader_node_name));
-    return SendLogs(non_leader_node_name, peer_client, wal_strings, true, true);
+    Vector<std::string_view> wal_entries;
+    wal_entries.reserve(wal_strings.size());
+    for (const auto &wal_string : wal_strings) {
+        wal_entries.emplace_back(*wal_string);
+    }
+    return SendLogs(non_leader_node_name, peer_client, wal_strings, wal_entries, true, true);
 }
 
-void ClusterManager::PrepareLogs(const SharedPtr<String> &log_string) { logs_to_sync_.emplace_back(log_string); }
+void ClusterManager::PrepareLogs(const char *logs, const Vector<SizeT> &log_sizes) {
+    // One buffer for the whole batch, the entries are sent as views of it
+    SizeT total_size = std::accumulate(log_sizes.begin(), log_sizes.end(), SizeT(0));
+    auto log_buffer = MakeShared<String>(logs, total_size);
+    const char *log_entry = log_buffer->data();
+    for (SizeT log_size : log_sizes) {
+        logs_to_sync_.emplace_back(log_entry, log_size);
+        log_entry += log_size;
+    }
+    log_buffers_to_sync_.emplace_back(std::move(log_buffer));
+}
 
 Status ClusterManager::SyncLogs() {
     LOG_TRACE("Sync logs to follower and async logs to learner");
@@ -450,7 +465,7 @@ Status ClusterManager::SyncLogs() {
         for (SizeT idx = 0; idx < follower_count; ++idx) {
             const String &follower_name = followers[idx]->node_name();
             if (!sent_nodes.contains(follower_name)) {
-                status = SendLogs(follower_name, follower_clients[idx], logs_to_sync_, true, false);
+                status = SendLogs(follower_name, follower_clients[idx], log_buffers_to_sync_, logs_to_sync_, true, false);
                 if (status.ok()) {
                     sent_nodes.insert(follower_name);
                 }
@@ -461,7 +476,7 @@ Status ClusterManager::SyncLogs() {
         for (SizeT idx = 0; idx < learner_count; ++idx) {
             const String &learner_name = learners[idx]->node_name();
             if (!sent_nodes.contains(learner_name)) {
-                status = SendLogs(learner_name, learner_clients[idx], logs_to_sync_, false, false);
+                status = SendLogs(learner_name, learner_clients[idx], log_buffers_to_sync_, logs_to_sync_, false, false);
                 if (status.ok()) {
                     sent_nodes.insert(learner_name);
                 }
@@ -470,6 +485,7 @@ Status ClusterManager::SyncLogs() {
 
         if (sent_nodes.size() == follower_count + learner_count) {
             logs_to_sync_.clear();
+            log_buffers_to_sync_.clear();
             break;
         }
     }
@@ -490,10 +506,11 @@ SizeT ClusterManager::GetFollowerLimit() const { return follower_limit_; }
 
 Status ClusterManager::SendLogs(const String &node_name,
                                 const SharedPtr<PeerClient> &peer_client,
-                                const Vector<SharedPtr<String>> &logs,
+                                const Vector<SharedPtr<String>> &log_buffers,
+                                const Vector<std::string_view> &logs,
                                 bool synchronize,
                                 bool on_register) {
-    SharedPtr<SyncLogTask> sync_log_task = MakeShared<SyncLogTask>(node_name, logs, on_register);
+    SharedPtr<SyncLogTask> sync_log_task = MakeShared<SyncLogTask>(node_name, log_buffers, logs, on_register);
     peer_client->Send(sync_log_task);
 
     Status status = Status::OK();
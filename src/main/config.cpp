@@ -483,6 +483,26 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        // Join memory budget
+        i64 join_memory_budget = DEFAULT_JOIN_MEMORY_BUDGET;
+        UniquePtr<IntegerOption> join_memory_budget_option =
+            MakeUnique<IntegerOption>(JOIN_MEMORY_BUDGET_OPTION_NAME, join_memory_budget, std::numeric_limits<i64>::max(), 0);
+        status = global_options_.AddOption(std::move(join_memory_budget_option));
+        if (!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
+        // Import partition size
+        i64 import_partition_size = MIN_IMPORT_PARTITION_SIZE;
+        UniquePtr<IntegerOption> import_partition_size_option =
+            MakeUnique<IntegerOption>(IMPORT_PARTITION_SIZE_OPTION_NAME, import_partition_size, std::numeric_limits<i64>::max(), 1);
+        status = global_options_.AddOption(std::move(import_partition_size_option));
+        if (!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Dense index building worker
         i64 dense_index_building_worker = Thread::hardware_concurrency() / 2;
         if (dense_index_building_worker < 2) {
@@ -540,6 +560,15 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        i64 cache_result_memory = DEFAULT_CACHE_RESULT_MEMORY;
+        auto cache_result_memory_option =
+            MakeUnique<IntegerOption>(CACHE_RESULT_MEMORY_OPTION_NAME, cache_result_memory, std::numeric_limits<i64>::max(), 0);
+        status = global_options_.AddOption(std::move(cache_result_memory_option));
+        if (!status.ok()) {
+            fmt::print("Fatal: {}", status.message());
+            UnrecoverableError(status.message());
+        }
+
         // Temp Dir
         String temp_dir = "/var/infinity/tmp";
         if (default_config != nullptr) {
@@ -619,6 +648,15 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
             UnrecoverableError(status.message());
         }
 
+        // WAL Replay Threads
+        i64 wal_replay_threads = DEFAULT_WAL_REPLAY_THREADS;
+        UniquePtr<IntegerOption> wal_replay_threads_option =
+            MakeUnique<IntegerOption>(WAL_REPLAY_THREADS_OPTION_NAME, wal_replay_threads, MAX_WAL_REPLAY_THREADS, MIN_WAL_REPLAY_THREADS);
+        status = global_options_.AddOption(std::move(wal_replay_threads_option));
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+
         // Resource Dir
         String resource_dir = "/var/infinity/resource";
         if (default_config != nullptr) {
@@ -1756,6 +1794,28 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                                         }
                                         break;
                                     }
+                                    case GlobalOptionIndex::kObjectStorageDiskCacheLimit: {
+                                        i64 disk_cache_limit = DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT;
+                                        if (elem.second.is_string()) {
+                                            String disk_cache_limit_str = elem.second.value_or(DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT_STR.data());
+                                            auto res = ParseByteSize(disk_cache_limit_str, disk_cache_limit);
+                                            if (!res.ok()) {
+                                                return res;
+                                            }
+                                        } else {
+                                            return Status::InvalidConfig("'disk_cache_limit' field in [storage.object_storage] isn't string, such as \"128GB\"");
+                                        }
+                                        UniquePtr<IntegerOption> disk_cache_limit_option =
+                                            MakeUnique<IntegerOption>(OBJECT_STORAGE_DISK_CACHE_LIMIT_OPTION_NAME,
+                                                                      disk_cache_limit,
+                                                                      std::numeric_limits<i64>::max(),
+                                                                      0);
+                                        if (!disk_cache_limit_option->Validate()) {
+                                            return Status::InvalidConfig(fmt::format("Invalid disk_cache_limit: {}", disk_cache_limit));
+                                        }
+                                        global_options_.AddOption(std::move(disk_cache_limit_option));
+                                        break;
+                                    }
                                     default: {
                                         return Status::InvalidConfig(
                                             fmt::format("Unrecognized config parameter: {} in 'storage.object_storage' field", var_name));
@@ -1783,6 +1843,15 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             if (global_options_.GetOptionByIndex(GlobalOptionIndex::kObjectStorageHttps) == nullptr) {
                                 return Status::InvalidConfig("No 'enable_https' field in [storage.object_storage]");
                             }
+                            if (global_options_.GetOptionByIndex(GlobalOptionIndex::kObjectStorageDiskCacheLimit) == nullptr) {
+                                i64 disk_cache_limit = DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT;
+                                UniquePtr<IntegerOption> disk_cache_limit_option =
+                                    MakeUnique<IntegerOption>(OBJECT_STORAGE_DISK_CACHE_LIMIT_OPTION_NAME,
+                                                              disk_cache_limit,
+                                                              std::numeric_limits<i64>::max(),
+                                                              0);
+                                global_options_.AddOption(std::move(disk_cache_limit_option));
+                            }
                             break;
                         }
 
@@ -1840,6 +1909,25 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             global_options_.AddOption(std::move(fulltext_index_building_worker_option));
                             break;
                         }
+                        case GlobalOptionIndex::kImportPartitionSize: {
+                            i64 import_partition_size = MIN_IMPORT_PARTITION_SIZE;
+                            if (elem.second.is_string()) {
+                                String import_partition_size_str = elem.second.value_or(MIN_IMPORT_PARTITION_SIZE_STR.data());
+                                auto res = ParseByteSize(import_partition_size_str, import_partition_size);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig("'import_partition_size' field isn't string.");
+                            }
+                            UniquePtr<IntegerOption> import_partition_size_option =
+                                MakeUnique<IntegerOption>(IMPORT_PARTITION_SIZE_OPTION_NAME, import_partition_size, std::numeric_limits<i64>::max(), 1);
+                            if (!import_partition_size_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid import partition size: {}", import_partition_size));
+                            }
+                            global_options_.AddOption(std::move(import_partition_size_option));
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'storage' field", var_name));
                         }
@@ -1972,6 +2060,16 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                         UnrecoverableError(status.message());
                     }
                 }
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kImportPartitionSize) == nullptr) {
+                    // Import partition size
+                    i64 import_partition_size = MIN_IMPORT_PARTITION_SIZE;
+                    UniquePtr<IntegerOption> import_partition_size_option =
+                        MakeUnique<IntegerOption>(IMPORT_PARTITION_SIZE_OPTION_NAME, import_partition_size, std::numeric_limits<i64>::max(), 1);
+                    Status status = global_options_.AddOption(std::move(import_partition_size_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
             } else {
                 return Status::InvalidConfig("No 'storage' section in configure file.");
             }
@@ -2054,6 +2152,25 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             global_options_.AddOption(std::move(mem_index_memory_quota_option));
                             break;
                         }
+                        case GlobalOptionIndex::kJoinMemoryBudget: {
+                            i64 join_memory_budget = DEFAULT_JOIN_MEMORY_BUDGET;
+                            if (elem.second.is_string()) {
+                                String join_memory_budget_str = elem.second.value_or(DEFAULT_JOIN_MEMORY_BUDGET_STR.data());
+                                auto res = ParseByteSize(join_memory_budget_str, join_memory_budget);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig("'join_memory_budget' field isn't string.");
+                            }
+                            UniquePtr<IntegerOption> join_memory_budget_option =
+                                MakeUnique<IntegerOption>(JOIN_MEMORY_BUDGET_OPTION_NAME, join_memory_budget, std::numeric_limits<i64>::max(), 0);
+                            if (!join_memory_budget_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid join memory budget: {}", join_memory_budget));
+                            }
+                            global_options_.AddOption(std::move(join_memory_budget_option));
+                            break;
+                        }
                         case GlobalOptionIndex::kResultCache: {
                             String result_cache_str(DEFAULT_RESULT_CACHE);
                             if (elem.second.is_string()) {
@@ -2077,6 +2194,25 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             global_options_.AddOption(std::move(cache_result_num_option));
                             break;
                         }
+                        case GlobalOptionIndex::kCacheResultMemory: {
+                            i64 cache_result_memory = DEFAULT_CACHE_RESULT_MEMORY;
+                            if (elem.second.is_string()) {
+                                String cache_result_memory_str = elem.second.value_or(DEFAULT_CACHE_RESULT_MEMORY_STR.data());
+                                auto res = ParseByteSize(cache_result_memory_str, cache_result_memory);
+                                if (!res.ok()) {
+                                    return res;
+                                }
+                            } else {
+                                return Status::InvalidConfig("'cache_result_memory' field isn't string, such as \"1GB\"");
+                            }
+                            UniquePtr<IntegerOption> cache_result_memory_option =
+                                MakeUnique<IntegerOption>(CACHE_RESULT_MEMORY_OPTION_NAME, cache_result_memory, std::numeric_limits<i64>::max(), 0);
+                            if (!cache_result_memory_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid cache result memory: {}", cache_result_memory));
+                            }
+                            global_options_.AddOption(std::move(cache_result_memory_option));
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'buffer' field", var_name));
                         }
@@ -2122,6 +2258,16 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                         UnrecoverableError(status.message());
                     }
                 }
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kJoinMemoryBudget) == nullptr) {
+                    // Join Memory Budget
+                    i64 join_memory_budget = DEFAULT_JOIN_MEMORY_BUDGET;
+                    UniquePtr<IntegerOption> join_memory_budget_option =
+                        MakeUnique<IntegerOption>(JOIN_MEMORY_BUDGET_OPTION_NAME, join_memory_budget, std::numeric_limits<i64>::max(), 0);
+                    Status status = global_options_.AddOption(std::move(join_memory_budget_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
                 if (global_options_.GetOptionByIndex(GlobalOptionIndex::kResultCache) == nullptr) {
                     // Result Cache Mode
                     String result_cache_str(DEFAULT_RESULT_CACHE);
@@ -2142,6 +2288,16 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                     }
                 }
 
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kCacheResultMemory) == nullptr) {
+                    i64 cache_result_memory = DEFAULT_CACHE_RESULT_MEMORY;
+                    UniquePtr<IntegerOption> cache_result_memory_option =
+                        MakeUnique<IntegerOption>(CACHE_RESULT_MEMORY_OPTION_NAME, cache_result_memory, std::numeric_limits<i64>::max(), 0);
+                    Status status = global_options_.AddOption(std::move(cache_result_memory_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
+
             } else {
                 return Status::InvalidConfig("No 'buffer' section in configure file.");
             }
@@ -2298,9 +2454,9 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                                 if (IsEqual(flush_option_str, "flush_at_once")) {
                                     flush_option_type = FlushOptionType::kFlushAtOnce;
                                 } else if (IsEqual(flush_option_str, "only_write")) {
-                                    flush_option_type = FlushOptionType::kFlushAtOnce;
+                                    flush_option_type = FlushOptionType::kOnlyWrite;
                                 } else if (IsEqual(flush_option_str, "flush_per_second")) {
-                                    flush_option_type = FlushOptionType::kFlushAtOnce;
+                                    flush_option_type = FlushOptionType::kFlushPerSecond;
                                 } else {
                                     return Status::InvalidConfig(fmt::format("Unsupported flush option: {}", flush_option_str));
                                 }
@@ -2315,6 +2471,27 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                             }
                             break;
                         }
+                        case GlobalOptionIndex::kWALReplayThreads: {
+                            // WAL Replay Threads
+                            i64 wal_replay_threads = DEFAULT_WAL_REPLAY_THREADS;
+                            if (elem.second.is_integer()) {
+                                wal_replay_threads = elem.second.value_or(wal_replay_threads);
+                            } else {
+                                return Status::InvalidConfig("'wal_replay_threads' field isn't integer.");
+                            }
+                            UniquePtr<IntegerOption> wal_replay_threads_option = MakeUnique<IntegerOption>(WAL_REPLAY_THREADS_OPTION_NAME,
+                                                                                                           wal_replay_threads,
+                                                                                                           MAX_WAL_REPLAY_THREADS,
+                                                                                                           MIN_WAL_REPLAY_THREADS);
+                            if (!wal_replay_threads_option->Validate()) {
+                                return Status::InvalidConfig(fmt::format("Invalid WAL replay threads: {}", wal_replay_threads));
+                            }
+                            Status status = global_options_.AddOption(std::move(wal_replay_threads_option));
+                            if (!status.ok()) {
+                                return status;
+                            }
+                            break;
+                        }
                         default: {
                             return Status::InvalidConfig(fmt::format("Unrecognized config parameter: {} in 'wal' field", var_name));
                         }
@@ -2392,6 +2569,19 @@ Status Config::Init(const SharedPtr<String> &config_path, DefaultConfig *default
                         UnrecoverableError(status.message());
                     }
                 }
+
+                if (global_options_.GetOptionByIndex(GlobalOptionIndex::kWALReplayThreads) == nullptr) {
+                    // WAL Replay Threads
+                    i64 wal_replay_threads = DEFAULT_WAL_REPLAY_THREADS;
+                    UniquePtr<IntegerOption> wal_replay_threads_option = MakeUnique<IntegerOption>(WAL_REPLAY_THREADS_OPTION_NAME,
+                                                                                                   wal_replay_threads,
+                                                                                                   MAX_WAL_REPLAY_THREADS,
+                                                                                                   MIN_WAL_REPLAY_THREADS);
+                    Status status = global_options_.AddOption(std::move(wal_replay_threads_option));
+                    if (!status.ok()) {
+                        UnrecoverableError(status.message());
+                    }
+                }
             } else {
                 return Status::InvalidConfig("No 'wal' section in configure file.");
             }
@@ -2731,6 +2921,11 @@ bool Config::ObjectStorageHttps() {
     return global_options_.GetBoolValue(GlobalOptionIndex::kObjectStorageHttps);
 }
 
+i64 Config::ObjectStorageDiskCacheLimit() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kObjectStorageDiskCacheLimit);
+}
+
 // Persistence
 String Config::PersistenceDir() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -2763,6 +2958,40 @@ i64 Config::MemIndexMemoryQuota() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kMemIndexMemoryQuota);
 }
 
+i64 Config::JoinMemoryBudget() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kJoinMemoryBudget);
+}
+
+void Config::SetJoinMemoryBudget(i64 join_memory_budget) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    BaseOption *base_option = global_options_.GetOptionByIndex(GlobalOptionIndex::kJoinMemoryBudget);
+    if (base_option->data_type_ != BaseOptionDataType::kInteger) {
+        String error_message = "Attempt to set non-integer value to join memory budget";
+        UnrecoverableError(error_message);
+    }
+    IntegerOption *join_memory_budget_option = static_cast<IntegerOption *>(base_option);
+    join_memory_budget_option->value_ = join_memory_budget;
+    return;
+}
+
+i64 Config::ImportPartitionSize() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kImportPartitionSize);
+}
+
+void Config::SetImportPartitionSize(i64 import_partition_size) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    BaseOption *base_option = global_options_.GetOptionByIndex(GlobalOptionIndex::kImportPartitionSize);
+    if (base_option->data_type_ != BaseOptionDataType::kInteger) {
+        String error_message = "Attempt to set non-integer value to import partition size";
+        UnrecoverableError(error_message);
+    }
+    IntegerOption *import_partition_size_option = static_cast<IntegerOption *>(base_option);
+    import_partition_size_option->value_ = import_partition_size;
+    return;
+}
+
 String Config::ResultCache() {
     std::lock_guard<std::mutex> guard(mutex_);
     return global_options_.GetStringValue(GlobalOptionIndex::kResultCache);
@@ -2773,6 +3002,11 @@ i64 Config::CacheResultNum() {
     return global_options_.GetIntegerValue(GlobalOptionIndex::kCacheResultCapacity);
 }
 
+i64 Config::CacheResultMemory() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kCacheResultMemory);
+}
+
 void Config::SetCacheResult(const String &mode) {
     std::lock_guard<std::mutex> guard(mutex_);
     BaseOption *base_option = global_options_.GetOptionByIndex(GlobalOptionIndex::kResultCache);
@@ -2845,6 +3079,11 @@ FlushOptionType Config::FlushMethodAtCommit() {
     return flush_option->value_;
 }
 
+i64 Config::WALReplayThreads() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    return global_options_.GetIntegerValue(GlobalOptionIndex::kWALReplayThreads);
+}
+
 // Resource
 String Config::ResourcePath() {
     std::lock_guard<std::mutex> guard(mutex_);
@@ -2901,6 +3140,7 @@ void Config::PrintAll() {
     fmt::print(" - dense_index_building_worker: {}\n", DenseIndexBuildingWorker());
     fmt::print(" - sparse_index_building_worker: {}\n", SparseIndexBuildingWorker());
     fmt::print(" - fulltext_index_building_worker: {}\n", FulltextIndexBuildingWorker());
+    fmt::print(" - import_partition_size: {}\n", Utility::FormatByteSize(ImportPartitionSize()));
     fmt::print(" - storage_type: {}\n", ToString(StorageType()));
     switch (StorageType()) {
         case StorageType::kLocal: {
@@ -2912,6 +3152,7 @@ void Config::PrintAll() {
             fmt::print(" - object_storage_access_key: {}\n", ObjectStorageAccessKey());
             fmt::print(" - object_storage_secret_key: {}\n", ObjectStorageSecretKey());
             fmt::print(" - object_storage_enable_https: {}\n", ObjectStorageHttps());
+            fmt::print(" - object_storage_disk_cache_limit: {}\n", Utility::FormatByteSize(ObjectStorageDiskCacheLimit()));
             break;
         }
         default: {
@@ -2923,6 +3164,8 @@ void Config::PrintAll() {
     fmt::print(" - buffer_manager_size: {}\n", Utility::FormatByteSize(BufferManagerSize()));
     fmt::print(" - temp_dir: {}\n", TempDir());
     fmt::print(" - memindex_memory_quota: {}\n", Utility::FormatByteSize(MemIndexMemoryQuota()));
+    fmt::print(" - join_memory_budget: {}\n", Utility::FormatByteSize(JoinMemoryBudget()));
+    fmt::print(" - cache_result_memory: {}\n", Utility::FormatByteSize(CacheResultMemory()));
 
     // WAL
     fmt::print(" - wal_dir: {}\n", WALDir());
@@ -2931,6 +3174,7 @@ void Config::PrintAll() {
     fmt::print(" - delta_checkpoint_interval: {}\n", Utility::FormatTimeInfo(DeltaCheckpointInterval()));
     fmt::print(" - delta_checkpoint_threshold: {}\n", Utility::FormatByteSize(DeltaCheckpointThreshold()));
     fmt::print(" - flush_method_at_commit: {}\n", FlushOptionTypeToString(FlushMethodAtCommit()));
+    fmt::print(" - wal_replay_threads: {}\n", WALReplayThreads());
 
     // Resource dir
     fmt::print(" - resource_dir: {}\n", ResourcePath());
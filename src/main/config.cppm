@@ -112,6 +112,7 @@ public:
     String ObjectStorageAccessKey();
     String ObjectStorageSecretKey();
     bool ObjectStorageHttps();
+    i64 ObjectStorageDiskCacheLimit();
 
     // Persistence
     String PersistenceDir();
@@ -124,8 +125,17 @@ public:
 
     i64 MemIndexMemoryQuota();
 
+    // Build side memory of a hash join task, the partitions are spilled to the temp dir beyond it. 0 disables spilling.
+    i64 JoinMemoryBudget();
+    void SetJoinMemoryBudget(i64);
+
+    // Import
+    i64 ImportPartitionSize();
+    void SetImportPartitionSize(i64);
+
     String ResultCache();
     i64 CacheResultNum();
+    i64 CacheResultMemory();
     void SetCacheResult(const String &mode);
 
     // WAL
@@ -143,6 +153,9 @@ public:
 
     FlushOptionType FlushMethodAtCommit();
 
+    // Threads to decode and replay the WAL on startup, 1 replays the entries one by one
+    i64 WALReplayThreads();
+
     // Resource
     String ResourcePath();
 
@@ -923,6 +923,25 @@ QueryResult Infinity::Insert(const String &db_name, const String &table_name, Ve
     return result;
 }
 
+QueryResult
+Infinity::InsertColumns(const String &db_name, const String &table_name, Vector<String> column_names, Vector<String> column_buffers, SizeT row_count) {
+    UniquePtr<QueryContext> query_context_ptr;
+    GET_QUERY_CONTEXT(GetQueryContext(), query_context_ptr);
+    UniquePtr<InsertStatement> insert_statement = MakeUnique<InsertStatement>();
+    insert_statement->schema_name_ = db_name;
+    ToLower(insert_statement->schema_name_);
+    insert_statement->table_name_ = table_name;
+    ToLower(insert_statement->table_name_);
+    for (auto &column_name : column_names) {
+        ToLower(column_name);
+    }
+    insert_statement->column_names_ = std::move(column_names);
+    insert_statement->column_buffers_ = std::move(column_buffers);
+    insert_statement->column_row_count_ = row_count;
+    QueryResult result = query_context_ptr->QueryStatement(insert_statement.get());
+    return result;
+}
+
 QueryResult Infinity::Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options) {
 
     UniquePtr<QueryContext> query_context_ptr;
@@ -163,6 +163,10 @@ public:
 
     QueryResult Insert(const String &db_name, const String &table_name, Vector<InsertRowExpr *> *insert_rows);
 
+    // Insert `row_count` rows given as one raw little-endian buffer per column, laid out like the columns of a select result.
+    QueryResult
+    InsertColumns(const String &db_name, const String &table_name, Vector<String> column_names, Vector<String> column_buffers, SizeT row_count);
+
     QueryResult Import(const String &db_name, const String &table_name, const String &path, ImportOptions import_options);
 
     QueryResult
@@ -504,6 +504,7 @@ void InfinityContext::UnInit() {
 
     //    inverting_thread_pool_.stop(true);
     //    commiting_thread_pool_.stop(true);
+    //    search_thread_pool_.stop(true);
     //    hnsw_build_thread_pool_.stop(true);
 
     session_mgr_.reset();
@@ -517,6 +518,7 @@ void InfinityContext::SetIndexThreadPool() {
     inverting_thread_pool_.resize(config_->DenseIndexBuildingWorker());
     commiting_thread_pool_.resize(config_->SparseIndexBuildingWorker());
     hnsw_build_thread_pool_.resize(config_->FulltextIndexBuildingWorker());
+    search_thread_pool_.resize(task_scheduler_->worker_count());
 }
 
 void InfinityContext::RestoreIndexThreadPoolToDefault() {
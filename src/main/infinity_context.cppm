@@ -50,6 +50,7 @@ public:
 
     [[nodiscard]] inline ThreadPool &GetFulltextInvertingThreadPool() { return inverting_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetFulltextCommitingThreadPool() { return commiting_thread_pool_; }
+    [[nodiscard]] inline ThreadPool &GetFulltextSearchThreadPool() { return search_thread_pool_; }
     [[nodiscard]] inline ThreadPool &GetHnswBuildThreadPool() { return hnsw_build_thread_pool_; }
 
     NodeRole GetServerRole() const;
@@ -92,6 +93,7 @@ private:
     // For fulltext index
     ThreadPool inverting_thread_pool_{2};
     ThreadPool commiting_thread_pool_{2};
+    ThreadPool search_thread_pool_{2};
 
     // For hnsw index
     ThreadPool hnsw_build_thread_pool_{2};
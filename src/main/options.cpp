@@ -72,11 +72,14 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(OBJECT_STORAGE_ACCESS_KEY_OPTION_NAME)] = GlobalOptionIndex::kObjectStorageAccessKey;
     name2index_[String(OBJECT_STORAGE_SECRET_KEY_OPTION_NAME)] = GlobalOptionIndex::kObjectStorageSecretKey;
     name2index_[String(OBJECT_STORAGE_ENABLE_HTTPS_OPTION_NAME)] = GlobalOptionIndex::kObjectStorageHttps;
+    name2index_[String(OBJECT_STORAGE_DISK_CACHE_LIMIT_OPTION_NAME)] = GlobalOptionIndex::kObjectStorageDiskCacheLimit;
 
     name2index_[String(BUFFER_MANAGER_SIZE_OPTION_NAME)] = GlobalOptionIndex::kBufferManagerSize;
     name2index_[String(LRU_NUM_OPTION_NAME)] = GlobalOptionIndex::kLRUNum;
     name2index_[String(TEMP_DIR_OPTION_NAME)] = GlobalOptionIndex::kTempDir;
     name2index_[String(MEMINDEX_MEMORY_QUOTA_OPTION_NAME)] = GlobalOptionIndex::kMemIndexMemoryQuota;
+    name2index_[String(JOIN_MEMORY_BUDGET_OPTION_NAME)] = GlobalOptionIndex::kJoinMemoryBudget;
+    name2index_[String(IMPORT_PARTITION_SIZE_OPTION_NAME)] = GlobalOptionIndex::kImportPartitionSize;
 
     name2index_[String(DENSE_INDEX_BUILDING_WORKER_OPTION_NAME)] = GlobalOptionIndex::kDenseIndexBuildingWorker;
     name2index_[String(SPARSE_INDEX_BUILDING_WORKER_OPTION_NAME)] = GlobalOptionIndex::kSparseIndexBuildingWorker;
@@ -84,6 +87,7 @@ GlobalOptions::GlobalOptions() {
 
     name2index_[String(RESULT_CACHE_OPTION_NAME)] = GlobalOptionIndex::kResultCache;
     name2index_[String(CACHE_RESULT_CAPACITY_OPTION_NAME)] = GlobalOptionIndex::kCacheResultCapacity;
+    name2index_[String(CACHE_RESULT_MEMORY_OPTION_NAME)] = GlobalOptionIndex::kCacheResultMemory;
 
     name2index_[String(WAL_DIR_OPTION_NAME)] = GlobalOptionIndex::kWALDir;
     name2index_[String(WAL_COMPACT_THRESHOLD_OPTION_NAME)] = GlobalOptionIndex::kWALCompactThreshold;
@@ -92,6 +96,7 @@ GlobalOptions::GlobalOptions() {
     name2index_[String(DELTA_CHECKPOINT_INTERVAL_OPTION_NAME)] = GlobalOptionIndex::kDeltaCheckpointInterval;
     name2index_[String(DELTA_CHECKPOINT_THRESHOLD_OPTION_NAME)] = GlobalOptionIndex::kDeltaCheckpointThreshold;
     name2index_[String(WAL_FLUSH_OPTION_NAME)] = GlobalOptionIndex::kFlushMethodAtCommit;
+    name2index_[String(WAL_REPLAY_THREADS_OPTION_NAME)] = GlobalOptionIndex::kWALReplayThreads;
     name2index_[String(RESOURCE_DIR_OPTION_NAME)] = GlobalOptionIndex::kResourcePath;
 
     name2index_[String(RECORD_RUNNING_QUERY_OPTION_NAME)] = GlobalOptionIndex::kRecordRunningQuery;
@@ -165,10 +165,15 @@ export enum class GlobalOptionIndex : i8 {
     kPeerConnectTimeout = 49,
     kPeerRecvTimeout = 50,
     kPeerSendTimeout = 51,
+    kJoinMemoryBudget = 52,
     kDenseIndexBuildingWorker = 53,
     kSparseIndexBuildingWorker = 54,
     kFulltextIndexBuildingWorker = 55,
-    kInvalid = 57,
+    kWALReplayThreads = 56,
+    kCacheResultMemory = 57,
+    kObjectStorageDiskCacheLimit = 58,
+    kImportPartitionSize = 59,
+    kInvalid = 60,
 };
 
 export struct GlobalOptions {
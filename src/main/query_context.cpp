@@ -261,6 +261,7 @@ QueryResult QueryContext::QueryStatement(const BaseStatement *base_statement) {
         StopProfile(QueryPhase::kTaskBuild);
         //        LOG_WARN(fmt::format("Before execution cost: {}", profiler.ElapsedToString()));
         StartProfile(QueryPhase::kExecution);
+        execution_begin_ = Clock::now();
         scheduler_->Schedule(plan_fragment.get(), base_statement);
         query_result.result_table_ = plan_fragment->GetResult();
         query_result.root_operator_type_ = logical_plans.back()->operator_type();
@@ -344,6 +345,7 @@ bool QueryContext::ExecuteBGStatement(BaseStatement *base_statement, BGQueryStat
         state.notifier = MakeUnique<Notifier>();
         FragmentContext::BuildTask(this, nullptr, state.plan_fragment.get(), state.notifier.get());
 
+        execution_begin_ = Clock::now();
         scheduler_->Schedule(state.plan_fragment.get(), base_statement);
     } catch (RecoverableException &e) {
         this->RollbackTxn();
@@ -86,6 +86,11 @@ public:
 
     [[nodiscard]] inline u64 query_id() const { return query_id_; }
 
+    // Time spent on executing the current statement so far, the result cache takes it as the cost of recomputing a result
+    [[nodiscard]] inline u64 execution_elapsed_us() const {
+        return ChronoCast<MicroSeconds>(ElapsedFromStart(Clock::now(), execution_begin_)).count();
+    }
+
     [[nodiscard]] inline u64 max_node_id() const { return current_max_node_id_; }
 
     inline void set_max_node_id(u64 node_id) { current_max_node_id_ = node_id; }
@@ -197,6 +202,8 @@ private:
     u64 user_id_{0};
     u64 current_max_node_id_{0};
 
+    TimePoint<Clock> execution_begin_{};
+
     u64 cpu_number_limit_{};
     u64 memory_size_limit_{};
 
@@ -49,8 +49,12 @@ export enum class GlobalVariable {
     kResultCache,               // global
     kCacheResultCapacity,       // global
     kCacheResultNum,            // global
+    kCacheResultMemory,         // global
+    kCacheResultStats,          // global
     kMemoryCacheMiss,           // global
     kDiskCacheMiss,             // global
+    kWalFlushStats,             // global
+    kBufferLoadStats,           // global
     kInvalid,
 };
 
@@ -1265,6 +1265,66 @@ public:
     }
 };
 
+// Body: {"row_count": n, "columns": [{"name": "c1", "data": "<base64>"}, ...]}
+// Each data field is the base64 encoding of n values laid out like the column buffers of ColumnarInsertRequest.
+class ColumnarInsertHandler final : public HttpRequestHandler {
+public:
+    SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
+        auto infinity = Infinity::RemoteConnect();
+        DeferFn defer_fn([&]() { infinity->RemoteDisconnect(); });
+
+        nlohmann::json json_response;
+        HTTPStatus http_status = HTTPStatus::CODE_500;
+
+        String data_body = request->readBodyToString();
+        try {
+            nlohmann::json http_body_json = nlohmann::json::parse(data_body);
+            if (!http_body_json.contains("row_count") || !http_body_json["row_count"].is_number_unsigned() || !http_body_json.contains("columns") ||
+                !http_body_json["columns"].is_array() || http_body_json["columns"].empty()) {
+                json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+                json_response["error_message"] = fmt::format("Invalid json format: {}", data_body);
+                return ResponseFactory::createResponse(http_status, json_response.dump());
+            }
+            SizeT row_count = http_body_json["row_count"].template get<u64>();
+
+            Vector<String> column_names;
+            Vector<String> column_buffers;
+            for (const auto &column_json : http_body_json["columns"]) {
+                if (!column_json.contains("name") || !column_json["name"].is_string() || !column_json.contains("data") ||
+                    !column_json["data"].is_string()) {
+                    json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+                    json_response["error_message"] = fmt::format("Invalid column: {}", column_json.dump());
+                    return ResponseFactory::createResponse(http_status, json_response.dump());
+                }
+                const auto &encoded_data = column_json["data"].template get_ref<const String &>();
+                if (!Base64::isBase64String(encoded_data.data(), encoded_data.size())) {
+                    json_response["error_code"] = ErrorCode::kInvalidParameterValue;
+                    json_response["error_message"] = fmt::format("Column {} data isn't base64 encoded", column_json["name"].template get<String>());
+                    return ResponseFactory::createResponse(http_status, json_response.dump());
+                }
+                column_names.emplace_back(column_json["name"].template get<String>());
+                column_buffers.emplace_back(*Base64::decode(encoded_data.data(), encoded_data.size()));
+            }
+
+            auto database_name = request->getPathVariable("database_name");
+            auto table_name = request->getPathVariable("table_name");
+            auto result = infinity->InsertColumns(database_name, table_name, std::move(column_names), std::move(column_buffers), row_count);
+            if (result.IsOk()) {
+                json_response["error_code"] = 0;
+                http_status = HTTPStatus::CODE_200;
+            } else {
+                json_response["error_code"] = result.ErrorCode();
+                json_response["error_message"] = result.ErrorMsg();
+                http_status = HTTPStatus::CODE_500;
+            }
+        } catch (nlohmann::json::exception &e) {
+            json_response["error_code"] = ErrorCode::kInvalidJsonFormat;
+            json_response["error_message"] = e.what();
+        }
+        return ResponseFactory::createResponse(http_status, json_response.dump());
+    }
+};
+
 class DeleteHandler final : public HttpRequestHandler {
 public:
     SharedPtr<OutgoingResponse> handle(const SharedPtr<IncomingRequest> &request) final {
@@ -3810,6 +3870,7 @@ Thread HTTPServer::Start(const String &ip_address, u16 port) {
     // DML
     router->route("PUT", "/databases/{database_name}/tables/{table_name}", MakeShared<ImportHandler>());
     router->route("POST", "/databases/{database_name}/tables/{table_name}/docs", MakeShared<InsertHandler>());
+    router->route("POST", "/databases/{database_name}/tables/{table_name}/columnar_docs", MakeShared<ColumnarInsertHandler>());
     router->route("DELETE", "/databases/{database_name}/tables/{table_name}/docs", MakeShared<DeleteHandler>());
     router->route("PUT", "/databases/{database_name}/tables/{table_name}/docs", MakeShared<UpdateHandler>());
 
@@ -29,6 +29,7 @@ class InfinityServiceIf {
   virtual void CreateTable(CommonResponse& _return, const CreateTableRequest& request) = 0;
   virtual void DropTable(CommonResponse& _return, const DropTableRequest& request) = 0;
   virtual void Insert(CommonResponse& _return, const InsertRequest& request) = 0;
+  virtual void ColumnarInsert(CommonResponse& _return, const ColumnarInsertRequest& request) = 0;
   virtual void Import(CommonResponse& _return, const ImportRequest& request) = 0;
   virtual void Export(CommonResponse& _return, const ExportRequest& request) = 0;
   virtual void Select(SelectResponse& _return, const SelectRequest& request) = 0;
@@ -110,6 +111,9 @@ class InfinityServiceNull : virtual public InfinityServiceIf {
   void Insert(CommonResponse& /* _return */, const InsertRequest& /* request */) override {
     return;
   }
+  void ColumnarInsert(CommonResponse& /* _return */, const ColumnarInsertRequest& /* request */) override {
+    return;
+  }
   void Import(CommonResponse& /* _return */, const ImportRequest& /* request */) override {
     return;
   }
@@ -933,6 +937,110 @@ class InfinityService_Insert_presult {
 
 };
 
+typedef struct _InfinityService_ColumnarInsert_args__isset {
+  _InfinityService_ColumnarInsert_args__isset() : request(false) {}
+  bool request :1;
+} _InfinityService_ColumnarInsert_args__isset;
+
+class InfinityService_ColumnarInsert_args {
+ public:
+
+  InfinityService_ColumnarInsert_args(const InfinityService_ColumnarInsert_args&);
+  InfinityService_ColumnarInsert_args& operator=(const InfinityService_ColumnarInsert_args&);
+  InfinityService_ColumnarInsert_args() noexcept {
+  }
+
+  virtual ~InfinityService_ColumnarInsert_args() noexcept;
+  ColumnarInsertRequest request;
+
+  _InfinityService_ColumnarInsert_args__isset __isset;
+
+  void __set_request(const ColumnarInsertRequest& val);
+
+  bool operator == (const InfinityService_ColumnarInsert_args & rhs) const
+  {
+    if (!(request == rhs.request))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_ColumnarInsert_args &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_ColumnarInsert_args & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+
+class InfinityService_ColumnarInsert_pargs {
+ public:
+
+
+  virtual ~InfinityService_ColumnarInsert_pargs() noexcept;
+  const ColumnarInsertRequest* request;
+
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_ColumnarInsert_result__isset {
+  _InfinityService_ColumnarInsert_result__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_ColumnarInsert_result__isset;
+
+class InfinityService_ColumnarInsert_result {
+ public:
+
+  InfinityService_ColumnarInsert_result(const InfinityService_ColumnarInsert_result&);
+  InfinityService_ColumnarInsert_result& operator=(const InfinityService_ColumnarInsert_result&);
+  InfinityService_ColumnarInsert_result() noexcept {
+  }
+
+  virtual ~InfinityService_ColumnarInsert_result() noexcept;
+  CommonResponse success;
+
+  _InfinityService_ColumnarInsert_result__isset __isset;
+
+  void __set_success(const CommonResponse& val);
+
+  bool operator == (const InfinityService_ColumnarInsert_result & rhs) const
+  {
+    if (!(success == rhs.success))
+      return false;
+    return true;
+  }
+  bool operator != (const InfinityService_ColumnarInsert_result &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const InfinityService_ColumnarInsert_result & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const;
+
+};
+
+typedef struct _InfinityService_ColumnarInsert_presult__isset {
+  _InfinityService_ColumnarInsert_presult__isset() : success(false) {}
+  bool success :1;
+} _InfinityService_ColumnarInsert_presult__isset;
+
+class InfinityService_ColumnarInsert_presult {
+ public:
+
+
+  virtual ~InfinityService_ColumnarInsert_presult() noexcept;
+  CommonResponse* success;
+
+  _InfinityService_ColumnarInsert_presult__isset __isset;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot);
+
+};
+
 typedef struct _InfinityService_Import_args__isset {
   _InfinityService_Import_args__isset() : request(false) {}
   bool request :1;
@@ -4203,6 +4311,9 @@ class InfinityServiceClient : virtual public InfinityServiceIf {
   void Insert(CommonResponse& _return, const InsertRequest& request) override;
   void send_Insert(const InsertRequest& request);
   void recv_Insert(CommonResponse& _return);
+  void ColumnarInsert(CommonResponse& _return, const ColumnarInsertRequest& request) override;
+  void send_ColumnarInsert(const ColumnarInsertRequest& request);
+  void recv_ColumnarInsert(CommonResponse& _return);
   void Import(CommonResponse& _return, const ImportRequest& request) override;
   void send_Import(const ImportRequest& request);
   void recv_Import(CommonResponse& _return);
@@ -4318,6 +4429,7 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
   void process_CreateTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_DropTable(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Insert(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
+  void process_ColumnarInsert(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Import(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Export(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
   void process_Select(int32_t seqid, ::apache::thrift::protocol::TProtocol* iprot, ::apache::thrift::protocol::TProtocol* oprot, void* callContext);
@@ -4359,6 +4471,7 @@ class InfinityServiceProcessor : public ::apache::thrift::TDispatchProcessor {
     processMap_["CreateTable"] = &InfinityServiceProcessor::process_CreateTable;
     processMap_["DropTable"] = &InfinityServiceProcessor::process_DropTable;
     processMap_["Insert"] = &InfinityServiceProcessor::process_Insert;
+    processMap_["ColumnarInsert"] = &InfinityServiceProcessor::process_ColumnarInsert;
     processMap_["Import"] = &InfinityServiceProcessor::process_Import;
     processMap_["Export"] = &InfinityServiceProcessor::process_Export;
     processMap_["Select"] = &InfinityServiceProcessor::process_Select;
@@ -4488,6 +4601,16 @@ class InfinityServiceMultiface : virtual public InfinityServiceIf {
     return;
   }
 
+  void ColumnarInsert(CommonResponse& _return, const ColumnarInsertRequest& request) override {
+    size_t sz = ifaces_.size();
+    size_t i = 0;
+    for (; i < (sz - 1); ++i) {
+      ifaces_[i]->ColumnarInsert(_return, request);
+    }
+    ifaces_[i]->ColumnarInsert(_return, request);
+    return;
+  }
+
   void Import(CommonResponse& _return, const ImportRequest& request) override {
     size_t sz = ifaces_.size();
     size_t i = 0;
@@ -4851,6 +4974,9 @@ class InfinityServiceConcurrentClient : virtual public InfinityServiceIf {
   void Insert(CommonResponse& _return, const InsertRequest& request) override;
   int32_t send_Insert(const InsertRequest& request);
   void recv_Insert(CommonResponse& _return, const int32_t seqid);
+  void ColumnarInsert(CommonResponse& _return, const ColumnarInsertRequest& request) override;
+  int32_t send_ColumnarInsert(const ColumnarInsertRequest& request);
+  void recv_ColumnarInsert(CommonResponse& _return, const int32_t seqid);
   void Import(CommonResponse& _return, const ImportRequest& request) override;
   int32_t send_Import(const ImportRequest& request);
   void recv_Import(CommonResponse& _return, const int32_t seqid);
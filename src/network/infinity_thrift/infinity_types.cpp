@@ -10560,6 +10560,198 @@ void InsertRequest::printTo(std::ostream& out) const {
 }
 
 
+ColumnarInsertRequest::~ColumnarInsertRequest() noexcept {
+}
+
+
+void ColumnarInsertRequest::__set_db_name(const std::string& val) {
+  this->db_name = val;
+}
+
+void ColumnarInsertRequest::__set_table_name(const std::string& val) {
+  this->table_name = val;
+}
+
+void ColumnarInsertRequest::__set_column_fields(const std::vector<ColumnField> & val) {
+  this->column_fields = val;
+}
+
+void ColumnarInsertRequest::__set_row_count(const int64_t val) {
+  this->row_count = val;
+}
+
+void ColumnarInsertRequest::__set_session_id(const int64_t val) {
+  this->session_id = val;
+}
+std::ostream& operator<<(std::ostream& out, const ColumnarInsertRequest& obj)
+{
+  obj.printTo(out);
+  return out;
+}
+
+
+uint32_t ColumnarInsertRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
+
+  ::apache::thrift::protocol::TInputRecursionTracker tracker(*iprot);
+  uint32_t xfer = 0;
+  std::string fname;
+  ::apache::thrift::protocol::TType ftype;
+  int16_t fid;
+
+  xfer += iprot->readStructBegin(fname);
+
+  using ::apache::thrift::protocol::TProtocolException;
+
+
+  while (true)
+  {
+    xfer += iprot->readFieldBegin(fname, ftype, fid);
+    if (ftype == ::apache::thrift::protocol::T_STOP) {
+      break;
+    }
+    switch (fid)
+    {
+      case 1:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->db_name);
+          this->__isset.db_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 2:
+        if (ftype == ::apache::thrift::protocol::T_STRING) {
+          xfer += iprot->readString(this->table_name);
+          this->__isset.table_name = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 3:
+        if (ftype == ::apache::thrift::protocol::T_LIST) {
+          {
+            this->column_fields.clear();
+            uint32_t _size399;
+            ::apache::thrift::protocol::TType _etype402;
+            xfer += iprot->readListBegin(_etype402, _size399);
+            this->column_fields.resize(_size399);
+            uint32_t _i403;
+            for (_i403 = 0; _i403 < _size399; ++_i403)
+            {
+              xfer += this->column_fields[_i403].read(iprot);
+            }
+            xfer += iprot->readListEnd();
+          }
+          this->__isset.column_fields = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 4:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->row_count);
+          this->__isset.row_count = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      case 5:
+        if (ftype == ::apache::thrift::protocol::T_I64) {
+          xfer += iprot->readI64(this->session_id);
+          this->__isset.session_id = true;
+        } else {
+          xfer += iprot->skip(ftype);
+        }
+        break;
+      default:
+        xfer += iprot->skip(ftype);
+        break;
+    }
+    xfer += iprot->readFieldEnd();
+  }
+
+  xfer += iprot->readStructEnd();
+
+  return xfer;
+}
+
+uint32_t ColumnarInsertRequest::write(::apache::thrift::protocol::TProtocol* oprot) const {
+  uint32_t xfer = 0;
+  ::apache::thrift::protocol::TOutputRecursionTracker tracker(*oprot);
+  xfer += oprot->writeStructBegin("ColumnarInsertRequest");
+
+  xfer += oprot->writeFieldBegin("db_name", ::apache::thrift::protocol::T_STRING, 1);
+  xfer += oprot->writeString(this->db_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("table_name", ::apache::thrift::protocol::T_STRING, 2);
+  xfer += oprot->writeString(this->table_name);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("column_fields", ::apache::thrift::protocol::T_LIST, 3);
+  {
+    xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->column_fields.size()));
+    std::vector<ColumnField> ::const_iterator _iter404;
+    for (_iter404 = this->column_fields.begin(); _iter404 != this->column_fields.end(); ++_iter404)
+    {
+      xfer += (*_iter404).write(oprot);
+    }
+    xfer += oprot->writeListEnd();
+  }
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("row_count", ::apache::thrift::protocol::T_I64, 4);
+  xfer += oprot->writeI64(this->row_count);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldBegin("session_id", ::apache::thrift::protocol::T_I64, 5);
+  xfer += oprot->writeI64(this->session_id);
+  xfer += oprot->writeFieldEnd();
+
+  xfer += oprot->writeFieldStop();
+  xfer += oprot->writeStructEnd();
+  return xfer;
+}
+
+void swap(ColumnarInsertRequest &a, ColumnarInsertRequest &b) {
+  using ::std::swap;
+  swap(a.db_name, b.db_name);
+  swap(a.table_name, b.table_name);
+  swap(a.column_fields, b.column_fields);
+  swap(a.row_count, b.row_count);
+  swap(a.session_id, b.session_id);
+  swap(a.__isset, b.__isset);
+}
+
+ColumnarInsertRequest::ColumnarInsertRequest(const ColumnarInsertRequest& other405) {
+  db_name = other405.db_name;
+  table_name = other405.table_name;
+  column_fields = other405.column_fields;
+  row_count = other405.row_count;
+  session_id = other405.session_id;
+  __isset = other405.__isset;
+}
+ColumnarInsertRequest& ColumnarInsertRequest::operator=(const ColumnarInsertRequest& other406) {
+  db_name = other406.db_name;
+  table_name = other406.table_name;
+  column_fields = other406.column_fields;
+  row_count = other406.row_count;
+  session_id = other406.session_id;
+  __isset = other406.__isset;
+  return *this;
+}
+void ColumnarInsertRequest::printTo(std::ostream& out) const {
+  using ::apache::thrift::to_string;
+  out << "ColumnarInsertRequest(";
+  out << "db_name=" << to_string(db_name);
+  out << ", " << "table_name=" << to_string(table_name);
+  out << ", " << "column_fields=" << to_string(column_fields);
+  out << ", " << "row_count=" << to_string(row_count);
+  out << ", " << "session_id=" << to_string(session_id);
+  out << ")";
+}
+
+
 ImportRequest::~ImportRequest() noexcept {
 }
 
@@ -10703,21 +10895,21 @@ void swap(ImportRequest &a, ImportRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ImportRequest::ImportRequest(const ImportRequest& other399) {
-  db_name = other399.db_name;
-  table_name = other399.table_name;
-  file_name = other399.file_name;
-  import_option = other399.import_option;
-  session_id = other399.session_id;
-  __isset = other399.__isset;
-}
-ImportRequest& ImportRequest::operator=(const ImportRequest& other400) {
-  db_name = other400.db_name;
-  table_name = other400.table_name;
-  file_name = other400.file_name;
-  import_option = other400.import_option;
-  session_id = other400.session_id;
-  __isset = other400.__isset;
+ImportRequest::ImportRequest(const ImportRequest& other407) {
+  db_name = other407.db_name;
+  table_name = other407.table_name;
+  file_name = other407.file_name;
+  import_option = other407.import_option;
+  session_id = other407.session_id;
+  __isset = other407.__isset;
+}
+ImportRequest& ImportRequest::operator=(const ImportRequest& other408) {
+  db_name = other408.db_name;
+  table_name = other408.table_name;
+  file_name = other408.file_name;
+  import_option = other408.import_option;
+  session_id = other408.session_id;
+  __isset = other408.__isset;
   return *this;
 }
 void ImportRequest::printTo(std::ostream& out) const {
@@ -10807,14 +10999,14 @@ uint32_t ExportRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->columns.clear();
-            uint32_t _size401;
-            ::apache::thrift::protocol::TType _etype404;
-            xfer += iprot->readListBegin(_etype404, _size401);
-            this->columns.resize(_size401);
-            uint32_t _i405;
-            for (_i405 = 0; _i405 < _size401; ++_i405)
+            uint32_t _size409;
+            ::apache::thrift::protocol::TType _etype412;
+            xfer += iprot->readListBegin(_etype412, _size409);
+            this->columns.resize(_size409);
+            uint32_t _i413;
+            for (_i413 = 0; _i413 < _size409; ++_i413)
             {
-              xfer += iprot->readString(this->columns[_i405]);
+              xfer += iprot->readString(this->columns[_i413]);
             }
             xfer += iprot->readListEnd();
           }
@@ -10875,10 +11067,10 @@ uint32_t ExportRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
   xfer += oprot->writeFieldBegin("columns", ::apache::thrift::protocol::T_LIST, 3);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->columns.size()));
-    std::vector<std::string> ::const_iterator _iter406;
-    for (_iter406 = this->columns.begin(); _iter406 != this->columns.end(); ++_iter406)
+    std::vector<std::string> ::const_iterator _iter414;
+    for (_iter414 = this->columns.begin(); _iter414 != this->columns.end(); ++_iter414)
     {
-      xfer += oprot->writeString((*_iter406));
+      xfer += oprot->writeString((*_iter414));
     }
     xfer += oprot->writeListEnd();
   }
@@ -10912,23 +11104,23 @@ void swap(ExportRequest &a, ExportRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ExportRequest::ExportRequest(const ExportRequest& other407) {
-  db_name = other407.db_name;
-  table_name = other407.table_name;
-  columns = other407.columns;
-  file_name = other407.file_name;
-  export_option = other407.export_option;
-  session_id = other407.session_id;
-  __isset = other407.__isset;
-}
-ExportRequest& ExportRequest::operator=(const ExportRequest& other408) {
-  db_name = other408.db_name;
-  table_name = other408.table_name;
-  columns = other408.columns;
-  file_name = other408.file_name;
-  export_option = other408.export_option;
-  session_id = other408.session_id;
-  __isset = other408.__isset;
+ExportRequest::ExportRequest(const ExportRequest& other415) {
+  db_name = other415.db_name;
+  table_name = other415.table_name;
+  columns = other415.columns;
+  file_name = other415.file_name;
+  export_option = other415.export_option;
+  session_id = other415.session_id;
+  __isset = other415.__isset;
+}
+ExportRequest& ExportRequest::operator=(const ExportRequest& other416) {
+  db_name = other416.db_name;
+  table_name = other416.table_name;
+  columns = other416.columns;
+  file_name = other416.file_name;
+  export_option = other416.export_option;
+  session_id = other416.session_id;
+  __isset = other416.__isset;
   return *this;
 }
 void ExportRequest::printTo(std::ostream& out) const {
@@ -11063,14 +11255,14 @@ uint32_t ExplainRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->select_list.clear();
-            uint32_t _size409;
-            ::apache::thrift::protocol::TType _etype412;
-            xfer += iprot->readListBegin(_etype412, _size409);
-            this->select_list.resize(_size409);
-            uint32_t _i413;
-            for (_i413 = 0; _i413 < _size409; ++_i413)
+            uint32_t _size417;
+            ::apache::thrift::protocol::TType _etype420;
+            xfer += iprot->readListBegin(_etype420, _size417);
+            this->select_list.resize(_size417);
+            uint32_t _i421;
+            for (_i421 = 0; _i421 < _size417; ++_i421)
             {
-              xfer += this->select_list[_i413].read(iprot);
+              xfer += this->select_list[_i421].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11083,14 +11275,14 @@ uint32_t ExplainRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->highlight_list.clear();
-            uint32_t _size414;
-            ::apache::thrift::protocol::TType _etype417;
-            xfer += iprot->readListBegin(_etype417, _size414);
-            this->highlight_list.resize(_size414);
-            uint32_t _i418;
-            for (_i418 = 0; _i418 < _size414; ++_i418)
+            uint32_t _size422;
+            ::apache::thrift::protocol::TType _etype425;
+            xfer += iprot->readListBegin(_etype425, _size422);
+            this->highlight_list.resize(_size422);
+            uint32_t _i426;
+            for (_i426 = 0; _i426 < _size422; ++_i426)
             {
-              xfer += this->highlight_list[_i418].read(iprot);
+              xfer += this->highlight_list[_i426].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11119,14 +11311,14 @@ uint32_t ExplainRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->group_by_list.clear();
-            uint32_t _size419;
-            ::apache::thrift::protocol::TType _etype422;
-            xfer += iprot->readListBegin(_etype422, _size419);
-            this->group_by_list.resize(_size419);
-            uint32_t _i423;
-            for (_i423 = 0; _i423 < _size419; ++_i423)
+            uint32_t _size427;
+            ::apache::thrift::protocol::TType _etype430;
+            xfer += iprot->readListBegin(_etype430, _size427);
+            this->group_by_list.resize(_size427);
+            uint32_t _i431;
+            for (_i431 = 0; _i431 < _size427; ++_i431)
             {
-              xfer += this->group_by_list[_i423].read(iprot);
+              xfer += this->group_by_list[_i431].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11163,14 +11355,14 @@ uint32_t ExplainRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->order_by_list.clear();
-            uint32_t _size424;
-            ::apache::thrift::protocol::TType _etype427;
-            xfer += iprot->readListBegin(_etype427, _size424);
-            this->order_by_list.resize(_size424);
-            uint32_t _i428;
-            for (_i428 = 0; _i428 < _size424; ++_i428)
+            uint32_t _size432;
+            ::apache::thrift::protocol::TType _etype435;
+            xfer += iprot->readListBegin(_etype435, _size432);
+            this->order_by_list.resize(_size432);
+            uint32_t _i436;
+            for (_i436 = 0; _i436 < _size432; ++_i436)
             {
-              xfer += this->order_by_list[_i428].read(iprot);
+              xfer += this->order_by_list[_i436].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11181,9 +11373,9 @@ uint32_t ExplainRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         break;
       case 13:
         if (ftype == ::apache::thrift::protocol::T_I32) {
-          int32_t ecast429;
-          xfer += iprot->readI32(ecast429);
-          this->explain_type = static_cast<ExplainType::type>(ecast429);
+          int32_t ecast437;
+          xfer += iprot->readI32(ecast437);
+          this->explain_type = static_cast<ExplainType::type>(ecast437);
           this->__isset.explain_type = true;
         } else {
           xfer += iprot->skip(ftype);
@@ -11221,10 +11413,10 @@ uint32_t ExplainRequest::write(::apache::thrift::protocol::TProtocol* oprot) con
   xfer += oprot->writeFieldBegin("select_list", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->select_list.size()));
-    std::vector<ParsedExpr> ::const_iterator _iter430;
-    for (_iter430 = this->select_list.begin(); _iter430 != this->select_list.end(); ++_iter430)
+    std::vector<ParsedExpr> ::const_iterator _iter438;
+    for (_iter438 = this->select_list.begin(); _iter438 != this->select_list.end(); ++_iter438)
     {
-      xfer += (*_iter430).write(oprot);
+      xfer += (*_iter438).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -11234,10 +11426,10 @@ uint32_t ExplainRequest::write(::apache::thrift::protocol::TProtocol* oprot) con
     xfer += oprot->writeFieldBegin("highlight_list", ::apache::thrift::protocol::T_LIST, 5);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->highlight_list.size()));
-      std::vector<ParsedExpr> ::const_iterator _iter431;
-      for (_iter431 = this->highlight_list.begin(); _iter431 != this->highlight_list.end(); ++_iter431)
+      std::vector<ParsedExpr> ::const_iterator _iter439;
+      for (_iter439 = this->highlight_list.begin(); _iter439 != this->highlight_list.end(); ++_iter439)
       {
-        xfer += (*_iter431).write(oprot);
+        xfer += (*_iter439).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -11257,10 +11449,10 @@ uint32_t ExplainRequest::write(::apache::thrift::protocol::TProtocol* oprot) con
     xfer += oprot->writeFieldBegin("group_by_list", ::apache::thrift::protocol::T_LIST, 8);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->group_by_list.size()));
-      std::vector<ParsedExpr> ::const_iterator _iter432;
-      for (_iter432 = this->group_by_list.begin(); _iter432 != this->group_by_list.end(); ++_iter432)
+      std::vector<ParsedExpr> ::const_iterator _iter440;
+      for (_iter440 = this->group_by_list.begin(); _iter440 != this->group_by_list.end(); ++_iter440)
       {
-        xfer += (*_iter432).write(oprot);
+        xfer += (*_iter440).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -11285,10 +11477,10 @@ uint32_t ExplainRequest::write(::apache::thrift::protocol::TProtocol* oprot) con
     xfer += oprot->writeFieldBegin("order_by_list", ::apache::thrift::protocol::T_LIST, 12);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->order_by_list.size()));
-      std::vector<OrderByExpr> ::const_iterator _iter433;
-      for (_iter433 = this->order_by_list.begin(); _iter433 != this->order_by_list.end(); ++_iter433)
+      std::vector<OrderByExpr> ::const_iterator _iter441;
+      for (_iter441 = this->order_by_list.begin(); _iter441 != this->order_by_list.end(); ++_iter441)
       {
-        xfer += (*_iter433).write(oprot);
+        xfer += (*_iter441).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -11321,37 +11513,37 @@ void swap(ExplainRequest &a, ExplainRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ExplainRequest::ExplainRequest(const ExplainRequest& other434) {
-  session_id = other434.session_id;
-  db_name = other434.db_name;
-  table_name = other434.table_name;
-  select_list = other434.select_list;
-  highlight_list = other434.highlight_list;
-  search_expr = other434.search_expr;
-  where_expr = other434.where_expr;
-  group_by_list = other434.group_by_list;
-  having_expr = other434.having_expr;
-  limit_expr = other434.limit_expr;
-  offset_expr = other434.offset_expr;
-  order_by_list = other434.order_by_list;
-  explain_type = other434.explain_type;
-  __isset = other434.__isset;
-}
-ExplainRequest& ExplainRequest::operator=(const ExplainRequest& other435) {
-  session_id = other435.session_id;
-  db_name = other435.db_name;
-  table_name = other435.table_name;
-  select_list = other435.select_list;
-  highlight_list = other435.highlight_list;
-  search_expr = other435.search_expr;
-  where_expr = other435.where_expr;
-  group_by_list = other435.group_by_list;
-  having_expr = other435.having_expr;
-  limit_expr = other435.limit_expr;
-  offset_expr = other435.offset_expr;
-  order_by_list = other435.order_by_list;
-  explain_type = other435.explain_type;
-  __isset = other435.__isset;
+ExplainRequest::ExplainRequest(const ExplainRequest& other442) {
+  session_id = other442.session_id;
+  db_name = other442.db_name;
+  table_name = other442.table_name;
+  select_list = other442.select_list;
+  highlight_list = other442.highlight_list;
+  search_expr = other442.search_expr;
+  where_expr = other442.where_expr;
+  group_by_list = other442.group_by_list;
+  having_expr = other442.having_expr;
+  limit_expr = other442.limit_expr;
+  offset_expr = other442.offset_expr;
+  order_by_list = other442.order_by_list;
+  explain_type = other442.explain_type;
+  __isset = other442.__isset;
+}
+ExplainRequest& ExplainRequest::operator=(const ExplainRequest& other443) {
+  session_id = other443.session_id;
+  db_name = other443.db_name;
+  table_name = other443.table_name;
+  select_list = other443.select_list;
+  highlight_list = other443.highlight_list;
+  search_expr = other443.search_expr;
+  where_expr = other443.where_expr;
+  group_by_list = other443.group_by_list;
+  having_expr = other443.having_expr;
+  limit_expr = other443.limit_expr;
+  offset_expr = other443.offset_expr;
+  order_by_list = other443.order_by_list;
+  explain_type = other443.explain_type;
+  __isset = other443.__isset;
   return *this;
 }
 void ExplainRequest::printTo(std::ostream& out) const {
@@ -11441,14 +11633,14 @@ uint32_t ExplainResponse::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->column_defs.clear();
-            uint32_t _size436;
-            ::apache::thrift::protocol::TType _etype439;
-            xfer += iprot->readListBegin(_etype439, _size436);
-            this->column_defs.resize(_size436);
-            uint32_t _i440;
-            for (_i440 = 0; _i440 < _size436; ++_i440)
+            uint32_t _size444;
+            ::apache::thrift::protocol::TType _etype447;
+            xfer += iprot->readListBegin(_etype447, _size444);
+            this->column_defs.resize(_size444);
+            uint32_t _i448;
+            for (_i448 = 0; _i448 < _size444; ++_i448)
             {
-              xfer += this->column_defs[_i440].read(iprot);
+              xfer += this->column_defs[_i448].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11461,14 +11653,14 @@ uint32_t ExplainResponse::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->column_fields.clear();
-            uint32_t _size441;
-            ::apache::thrift::protocol::TType _etype444;
-            xfer += iprot->readListBegin(_etype444, _size441);
-            this->column_fields.resize(_size441);
-            uint32_t _i445;
-            for (_i445 = 0; _i445 < _size441; ++_i445)
+            uint32_t _size449;
+            ::apache::thrift::protocol::TType _etype452;
+            xfer += iprot->readListBegin(_etype452, _size449);
+            this->column_fields.resize(_size449);
+            uint32_t _i453;
+            for (_i453 = 0; _i453 < _size449; ++_i453)
             {
-              xfer += this->column_fields[_i445].read(iprot);
+              xfer += this->column_fields[_i453].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11505,10 +11697,10 @@ uint32_t ExplainResponse::write(::apache::thrift::protocol::TProtocol* oprot) co
   xfer += oprot->writeFieldBegin("column_defs", ::apache::thrift::protocol::T_LIST, 3);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->column_defs.size()));
-    std::vector<ColumnDef> ::const_iterator _iter446;
-    for (_iter446 = this->column_defs.begin(); _iter446 != this->column_defs.end(); ++_iter446)
+    std::vector<ColumnDef> ::const_iterator _iter454;
+    for (_iter454 = this->column_defs.begin(); _iter454 != this->column_defs.end(); ++_iter454)
     {
-      xfer += (*_iter446).write(oprot);
+      xfer += (*_iter454).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -11517,10 +11709,10 @@ uint32_t ExplainResponse::write(::apache::thrift::protocol::TProtocol* oprot) co
   xfer += oprot->writeFieldBegin("column_fields", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->column_fields.size()));
-    std::vector<ColumnField> ::const_iterator _iter447;
-    for (_iter447 = this->column_fields.begin(); _iter447 != this->column_fields.end(); ++_iter447)
+    std::vector<ColumnField> ::const_iterator _iter455;
+    for (_iter455 = this->column_fields.begin(); _iter455 != this->column_fields.end(); ++_iter455)
     {
-      xfer += (*_iter447).write(oprot);
+      xfer += (*_iter455).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -11540,19 +11732,19 @@ void swap(ExplainResponse &a, ExplainResponse &b) {
   swap(a.__isset, b.__isset);
 }
 
-ExplainResponse::ExplainResponse(const ExplainResponse& other448) {
-  error_code = other448.error_code;
-  error_msg = other448.error_msg;
-  column_defs = other448.column_defs;
-  column_fields = other448.column_fields;
-  __isset = other448.__isset;
+ExplainResponse::ExplainResponse(const ExplainResponse& other456) {
+  error_code = other456.error_code;
+  error_msg = other456.error_msg;
+  column_defs = other456.column_defs;
+  column_fields = other456.column_fields;
+  __isset = other456.__isset;
 }
-ExplainResponse& ExplainResponse::operator=(const ExplainResponse& other449) {
-  error_code = other449.error_code;
-  error_msg = other449.error_msg;
-  column_defs = other449.column_defs;
-  column_fields = other449.column_fields;
-  __isset = other449.__isset;
+ExplainResponse& ExplainResponse::operator=(const ExplainResponse& other457) {
+  error_code = other457.error_code;
+  error_msg = other457.error_msg;
+  column_defs = other457.column_defs;
+  column_fields = other457.column_fields;
+  __isset = other457.__isset;
   return *this;
 }
 void ExplainResponse::printTo(std::ostream& out) const {
@@ -11686,14 +11878,14 @@ uint32_t SelectRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->select_list.clear();
-            uint32_t _size450;
-            ::apache::thrift::protocol::TType _etype453;
-            xfer += iprot->readListBegin(_etype453, _size450);
-            this->select_list.resize(_size450);
-            uint32_t _i454;
-            for (_i454 = 0; _i454 < _size450; ++_i454)
+            uint32_t _size458;
+            ::apache::thrift::protocol::TType _etype461;
+            xfer += iprot->readListBegin(_etype461, _size458);
+            this->select_list.resize(_size458);
+            uint32_t _i462;
+            for (_i462 = 0; _i462 < _size458; ++_i462)
             {
-              xfer += this->select_list[_i454].read(iprot);
+              xfer += this->select_list[_i462].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11706,14 +11898,14 @@ uint32_t SelectRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->highlight_list.clear();
-            uint32_t _size455;
-            ::apache::thrift::protocol::TType _etype458;
-            xfer += iprot->readListBegin(_etype458, _size455);
-            this->highlight_list.resize(_size455);
-            uint32_t _i459;
-            for (_i459 = 0; _i459 < _size455; ++_i459)
+            uint32_t _size463;
+            ::apache::thrift::protocol::TType _etype466;
+            xfer += iprot->readListBegin(_etype466, _size463);
+            this->highlight_list.resize(_size463);
+            uint32_t _i467;
+            for (_i467 = 0; _i467 < _size463; ++_i467)
             {
-              xfer += this->highlight_list[_i459].read(iprot);
+              xfer += this->highlight_list[_i467].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11742,14 +11934,14 @@ uint32_t SelectRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->group_by_list.clear();
-            uint32_t _size460;
-            ::apache::thrift::protocol::TType _etype463;
-            xfer += iprot->readListBegin(_etype463, _size460);
-            this->group_by_list.resize(_size460);
-            uint32_t _i464;
-            for (_i464 = 0; _i464 < _size460; ++_i464)
+            uint32_t _size468;
+            ::apache::thrift::protocol::TType _etype471;
+            xfer += iprot->readListBegin(_etype471, _size468);
+            this->group_by_list.resize(_size468);
+            uint32_t _i472;
+            for (_i472 = 0; _i472 < _size468; ++_i472)
             {
-              xfer += this->group_by_list[_i464].read(iprot);
+              xfer += this->group_by_list[_i472].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11786,14 +11978,14 @@ uint32_t SelectRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->order_by_list.clear();
-            uint32_t _size465;
-            ::apache::thrift::protocol::TType _etype468;
-            xfer += iprot->readListBegin(_etype468, _size465);
-            this->order_by_list.resize(_size465);
-            uint32_t _i469;
-            for (_i469 = 0; _i469 < _size465; ++_i469)
+            uint32_t _size473;
+            ::apache::thrift::protocol::TType _etype476;
+            xfer += iprot->readListBegin(_etype476, _size473);
+            this->order_by_list.resize(_size473);
+            uint32_t _i477;
+            for (_i477 = 0; _i477 < _size473; ++_i477)
             {
-              xfer += this->order_by_list[_i469].read(iprot);
+              xfer += this->order_by_list[_i477].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -11842,10 +12034,10 @@ uint32_t SelectRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
   xfer += oprot->writeFieldBegin("select_list", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->select_list.size()));
-    std::vector<ParsedExpr> ::const_iterator _iter470;
-    for (_iter470 = this->select_list.begin(); _iter470 != this->select_list.end(); ++_iter470)
+    std::vector<ParsedExpr> ::const_iterator _iter478;
+    for (_iter478 = this->select_list.begin(); _iter478 != this->select_list.end(); ++_iter478)
     {
-      xfer += (*_iter470).write(oprot);
+      xfer += (*_iter478).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -11855,10 +12047,10 @@ uint32_t SelectRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
     xfer += oprot->writeFieldBegin("highlight_list", ::apache::thrift::protocol::T_LIST, 5);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->highlight_list.size()));
-      std::vector<ParsedExpr> ::const_iterator _iter471;
-      for (_iter471 = this->highlight_list.begin(); _iter471 != this->highlight_list.end(); ++_iter471)
+      std::vector<ParsedExpr> ::const_iterator _iter479;
+      for (_iter479 = this->highlight_list.begin(); _iter479 != this->highlight_list.end(); ++_iter479)
       {
-        xfer += (*_iter471).write(oprot);
+        xfer += (*_iter479).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -11878,10 +12070,10 @@ uint32_t SelectRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
     xfer += oprot->writeFieldBegin("group_by_list", ::apache::thrift::protocol::T_LIST, 8);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->group_by_list.size()));
-      std::vector<ParsedExpr> ::const_iterator _iter472;
-      for (_iter472 = this->group_by_list.begin(); _iter472 != this->group_by_list.end(); ++_iter472)
+      std::vector<ParsedExpr> ::const_iterator _iter480;
+      for (_iter480 = this->group_by_list.begin(); _iter480 != this->group_by_list.end(); ++_iter480)
       {
-        xfer += (*_iter472).write(oprot);
+        xfer += (*_iter480).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -11906,10 +12098,10 @@ uint32_t SelectRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
     xfer += oprot->writeFieldBegin("order_by_list", ::apache::thrift::protocol::T_LIST, 12);
     {
       xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->order_by_list.size()));
-      std::vector<OrderByExpr> ::const_iterator _iter473;
-      for (_iter473 = this->order_by_list.begin(); _iter473 != this->order_by_list.end(); ++_iter473)
+      std::vector<OrderByExpr> ::const_iterator _iter481;
+      for (_iter481 = this->order_by_list.begin(); _iter481 != this->order_by_list.end(); ++_iter481)
       {
-        xfer += (*_iter473).write(oprot);
+        xfer += (*_iter481).write(oprot);
       }
       xfer += oprot->writeListEnd();
     }
@@ -11943,37 +12135,37 @@ void swap(SelectRequest &a, SelectRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-SelectRequest::SelectRequest(const SelectRequest& other474) {
-  session_id = other474.session_id;
-  db_name = other474.db_name;
-  table_name = other474.table_name;
-  select_list = other474.select_list;
-  highlight_list = other474.highlight_list;
-  search_expr = other474.search_expr;
-  where_expr = other474.where_expr;
-  group_by_list = other474.group_by_list;
-  having_expr = other474.having_expr;
-  limit_expr = other474.limit_expr;
-  offset_expr = other474.offset_expr;
-  order_by_list = other474.order_by_list;
-  total_hits_count = other474.total_hits_count;
-  __isset = other474.__isset;
-}
-SelectRequest& SelectRequest::operator=(const SelectRequest& other475) {
-  session_id = other475.session_id;
-  db_name = other475.db_name;
-  table_name = other475.table_name;
-  select_list = other475.select_list;
-  highlight_list = other475.highlight_list;
-  search_expr = other475.search_expr;
-  where_expr = other475.where_expr;
-  group_by_list = other475.group_by_list;
-  having_expr = other475.having_expr;
-  limit_expr = other475.limit_expr;
-  offset_expr = other475.offset_expr;
-  order_by_list = other475.order_by_list;
-  total_hits_count = other475.total_hits_count;
-  __isset = other475.__isset;
+SelectRequest::SelectRequest(const SelectRequest& other482) {
+  session_id = other482.session_id;
+  db_name = other482.db_name;
+  table_name = other482.table_name;
+  select_list = other482.select_list;
+  highlight_list = other482.highlight_list;
+  search_expr = other482.search_expr;
+  where_expr = other482.where_expr;
+  group_by_list = other482.group_by_list;
+  having_expr = other482.having_expr;
+  limit_expr = other482.limit_expr;
+  offset_expr = other482.offset_expr;
+  order_by_list = other482.order_by_list;
+  total_hits_count = other482.total_hits_count;
+  __isset = other482.__isset;
+}
+SelectRequest& SelectRequest::operator=(const SelectRequest& other483) {
+  session_id = other483.session_id;
+  db_name = other483.db_name;
+  table_name = other483.table_name;
+  select_list = other483.select_list;
+  highlight_list = other483.highlight_list;
+  search_expr = other483.search_expr;
+  where_expr = other483.where_expr;
+  group_by_list = other483.group_by_list;
+  having_expr = other483.having_expr;
+  limit_expr = other483.limit_expr;
+  offset_expr = other483.offset_expr;
+  order_by_list = other483.order_by_list;
+  total_hits_count = other483.total_hits_count;
+  __isset = other483.__isset;
   return *this;
 }
 void SelectRequest::printTo(std::ostream& out) const {
@@ -12067,14 +12259,14 @@ uint32_t SelectResponse::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->column_defs.clear();
-            uint32_t _size476;
-            ::apache::thrift::protocol::TType _etype479;
-            xfer += iprot->readListBegin(_etype479, _size476);
-            this->column_defs.resize(_size476);
-            uint32_t _i480;
-            for (_i480 = 0; _i480 < _size476; ++_i480)
+            uint32_t _size484;
+            ::apache::thrift::protocol::TType _etype487;
+            xfer += iprot->readListBegin(_etype487, _size484);
+            this->column_defs.resize(_size484);
+            uint32_t _i488;
+            for (_i488 = 0; _i488 < _size484; ++_i488)
             {
-              xfer += this->column_defs[_i480].read(iprot);
+              xfer += this->column_defs[_i488].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -12087,14 +12279,14 @@ uint32_t SelectResponse::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->column_fields.clear();
-            uint32_t _size481;
-            ::apache::thrift::protocol::TType _etype484;
-            xfer += iprot->readListBegin(_etype484, _size481);
-            this->column_fields.resize(_size481);
-            uint32_t _i485;
-            for (_i485 = 0; _i485 < _size481; ++_i485)
+            uint32_t _size489;
+            ::apache::thrift::protocol::TType _etype492;
+            xfer += iprot->readListBegin(_etype492, _size489);
+            this->column_fields.resize(_size489);
+            uint32_t _i493;
+            for (_i493 = 0; _i493 < _size489; ++_i493)
             {
-              xfer += this->column_fields[_i485].read(iprot);
+              xfer += this->column_fields[_i493].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -12139,10 +12331,10 @@ uint32_t SelectResponse::write(::apache::thrift::protocol::TProtocol* oprot) con
   xfer += oprot->writeFieldBegin("column_defs", ::apache::thrift::protocol::T_LIST, 3);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->column_defs.size()));
-    std::vector<ColumnDef> ::const_iterator _iter486;
-    for (_iter486 = this->column_defs.begin(); _iter486 != this->column_defs.end(); ++_iter486)
+    std::vector<ColumnDef> ::const_iterator _iter494;
+    for (_iter494 = this->column_defs.begin(); _iter494 != this->column_defs.end(); ++_iter494)
     {
-      xfer += (*_iter486).write(oprot);
+      xfer += (*_iter494).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -12151,10 +12343,10 @@ uint32_t SelectResponse::write(::apache::thrift::protocol::TProtocol* oprot) con
   xfer += oprot->writeFieldBegin("column_fields", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->column_fields.size()));
-    std::vector<ColumnField> ::const_iterator _iter487;
-    for (_iter487 = this->column_fields.begin(); _iter487 != this->column_fields.end(); ++_iter487)
+    std::vector<ColumnField> ::const_iterator _iter495;
+    for (_iter495 = this->column_fields.begin(); _iter495 != this->column_fields.end(); ++_iter495)
     {
-      xfer += (*_iter487).write(oprot);
+      xfer += (*_iter495).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -12179,21 +12371,21 @@ void swap(SelectResponse &a, SelectResponse &b) {
   swap(a.__isset, b.__isset);
 }
 
-SelectResponse::SelectResponse(const SelectResponse& other488) {
-  error_code = other488.error_code;
-  error_msg = other488.error_msg;
-  column_defs = other488.column_defs;
-  column_fields = other488.column_fields;
-  extra_result = other488.extra_result;
-  __isset = other488.__isset;
-}
-SelectResponse& SelectResponse::operator=(const SelectResponse& other489) {
-  error_code = other489.error_code;
-  error_msg = other489.error_msg;
-  column_defs = other489.column_defs;
-  column_fields = other489.column_fields;
-  extra_result = other489.extra_result;
-  __isset = other489.__isset;
+SelectResponse::SelectResponse(const SelectResponse& other496) {
+  error_code = other496.error_code;
+  error_msg = other496.error_msg;
+  column_defs = other496.column_defs;
+  column_fields = other496.column_fields;
+  extra_result = other496.extra_result;
+  __isset = other496.__isset;
+}
+SelectResponse& SelectResponse::operator=(const SelectResponse& other497) {
+  error_code = other497.error_code;
+  error_msg = other497.error_msg;
+  column_defs = other497.column_defs;
+  column_fields = other497.column_fields;
+  extra_result = other497.extra_result;
+  __isset = other497.__isset;
   return *this;
 }
 void SelectResponse::printTo(std::ostream& out) const {
@@ -12334,19 +12526,19 @@ void swap(DeleteRequest &a, DeleteRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-DeleteRequest::DeleteRequest(const DeleteRequest& other490) {
-  db_name = other490.db_name;
-  table_name = other490.table_name;
-  where_expr = other490.where_expr;
-  session_id = other490.session_id;
-  __isset = other490.__isset;
+DeleteRequest::DeleteRequest(const DeleteRequest& other498) {
+  db_name = other498.db_name;
+  table_name = other498.table_name;
+  where_expr = other498.where_expr;
+  session_id = other498.session_id;
+  __isset = other498.__isset;
 }
-DeleteRequest& DeleteRequest::operator=(const DeleteRequest& other491) {
-  db_name = other491.db_name;
-  table_name = other491.table_name;
-  where_expr = other491.where_expr;
-  session_id = other491.session_id;
-  __isset = other491.__isset;
+DeleteRequest& DeleteRequest::operator=(const DeleteRequest& other499) {
+  db_name = other499.db_name;
+  table_name = other499.table_name;
+  where_expr = other499.where_expr;
+  session_id = other499.session_id;
+  __isset = other499.__isset;
   return *this;
 }
 void DeleteRequest::printTo(std::ostream& out) const {
@@ -12469,17 +12661,17 @@ void swap(DeleteResponse &a, DeleteResponse &b) {
   swap(a.__isset, b.__isset);
 }
 
-DeleteResponse::DeleteResponse(const DeleteResponse& other492) {
-  error_code = other492.error_code;
-  error_msg = other492.error_msg;
-  deleted_rows = other492.deleted_rows;
-  __isset = other492.__isset;
+DeleteResponse::DeleteResponse(const DeleteResponse& other500) {
+  error_code = other500.error_code;
+  error_msg = other500.error_msg;
+  deleted_rows = other500.deleted_rows;
+  __isset = other500.__isset;
 }
-DeleteResponse& DeleteResponse::operator=(const DeleteResponse& other493) {
-  error_code = other493.error_code;
-  error_msg = other493.error_msg;
-  deleted_rows = other493.deleted_rows;
-  __isset = other493.__isset;
+DeleteResponse& DeleteResponse::operator=(const DeleteResponse& other501) {
+  error_code = other501.error_code;
+  error_msg = other501.error_msg;
+  deleted_rows = other501.deleted_rows;
+  __isset = other501.__isset;
   return *this;
 }
 void DeleteResponse::printTo(std::ostream& out) const {
@@ -12571,14 +12763,14 @@ uint32_t UpdateRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->update_expr_array.clear();
-            uint32_t _size494;
-            ::apache::thrift::protocol::TType _etype497;
-            xfer += iprot->readListBegin(_etype497, _size494);
-            this->update_expr_array.resize(_size494);
-            uint32_t _i498;
-            for (_i498 = 0; _i498 < _size494; ++_i498)
+            uint32_t _size502;
+            ::apache::thrift::protocol::TType _etype505;
+            xfer += iprot->readListBegin(_etype505, _size502);
+            this->update_expr_array.resize(_size502);
+            uint32_t _i506;
+            for (_i506 = 0; _i506 < _size502; ++_i506)
             {
-              xfer += this->update_expr_array[_i498].read(iprot);
+              xfer += this->update_expr_array[_i506].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -12627,10 +12819,10 @@ uint32_t UpdateRequest::write(::apache::thrift::protocol::TProtocol* oprot) cons
   xfer += oprot->writeFieldBegin("update_expr_array", ::apache::thrift::protocol::T_LIST, 4);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->update_expr_array.size()));
-    std::vector<UpdateExpr> ::const_iterator _iter499;
-    for (_iter499 = this->update_expr_array.begin(); _iter499 != this->update_expr_array.end(); ++_iter499)
+    std::vector<UpdateExpr> ::const_iterator _iter507;
+    for (_iter507 = this->update_expr_array.begin(); _iter507 != this->update_expr_array.end(); ++_iter507)
     {
-      xfer += (*_iter499).write(oprot);
+      xfer += (*_iter507).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -12655,21 +12847,21 @@ void swap(UpdateRequest &a, UpdateRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-UpdateRequest::UpdateRequest(const UpdateRequest& other500) {
-  db_name = other500.db_name;
-  table_name = other500.table_name;
-  where_expr = other500.where_expr;
-  update_expr_array = other500.update_expr_array;
-  session_id = other500.session_id;
-  __isset = other500.__isset;
+UpdateRequest::UpdateRequest(const UpdateRequest& other508) {
+  db_name = other508.db_name;
+  table_name = other508.table_name;
+  where_expr = other508.where_expr;
+  update_expr_array = other508.update_expr_array;
+  session_id = other508.session_id;
+  __isset = other508.__isset;
 }
-UpdateRequest& UpdateRequest::operator=(const UpdateRequest& other501) {
-  db_name = other501.db_name;
-  table_name = other501.table_name;
-  where_expr = other501.where_expr;
-  update_expr_array = other501.update_expr_array;
-  session_id = other501.session_id;
-  __isset = other501.__isset;
+UpdateRequest& UpdateRequest::operator=(const UpdateRequest& other509) {
+  db_name = other509.db_name;
+  table_name = other509.table_name;
+  where_expr = other509.where_expr;
+  update_expr_array = other509.update_expr_array;
+  session_id = other509.session_id;
+  __isset = other509.__isset;
   return *this;
 }
 void UpdateRequest::printTo(std::ostream& out) const {
@@ -12751,14 +12943,14 @@ uint32_t AddColumnsRequest::read(::apache::thrift::protocol::TProtocol* iprot) {
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->column_defs.clear();
-            uint32_t _size502;
-            ::apache::thrift::protocol::TType _etype505;
-            xfer += iprot->readListBegin(_etype505, _size502);
-            this->column_defs.resize(_size502);
-            uint32_t _i506;
-            for (_i506 = 0; _i506 < _size502; ++_i506)
+            uint32_t _size510;
+            ::apache::thrift::protocol::TType _etype513;
+            xfer += iprot->readListBegin(_etype513, _size510);
+            this->column_defs.resize(_size510);
+            uint32_t _i514;
+            for (_i514 = 0; _i514 < _size510; ++_i514)
             {
-              xfer += this->column_defs[_i506].read(iprot);
+              xfer += this->column_defs[_i514].read(iprot);
             }
             xfer += iprot->readListEnd();
           }
@@ -12803,10 +12995,10 @@ uint32_t AddColumnsRequest::write(::apache::thrift::protocol::TProtocol* oprot)
   xfer += oprot->writeFieldBegin("column_defs", ::apache::thrift::protocol::T_LIST, 3);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRUCT, static_cast<uint32_t>(this->column_defs.size()));
-    std::vector<ColumnDef> ::const_iterator _iter507;
-    for (_iter507 = this->column_defs.begin(); _iter507 != this->column_defs.end(); ++_iter507)
+    std::vector<ColumnDef> ::const_iterator _iter515;
+    for (_iter515 = this->column_defs.begin(); _iter515 != this->column_defs.end(); ++_iter515)
     {
-      xfer += (*_iter507).write(oprot);
+      xfer += (*_iter515).write(oprot);
     }
     xfer += oprot->writeListEnd();
   }
@@ -12830,19 +13022,19 @@ void swap(AddColumnsRequest &a, AddColumnsRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-AddColumnsRequest::AddColumnsRequest(const AddColumnsRequest& other508) {
-  db_name = other508.db_name;
-  table_name = other508.table_name;
-  column_defs = other508.column_defs;
-  session_id = other508.session_id;
-  __isset = other508.__isset;
+AddColumnsRequest::AddColumnsRequest(const AddColumnsRequest& other516) {
+  db_name = other516.db_name;
+  table_name = other516.table_name;
+  column_defs = other516.column_defs;
+  session_id = other516.session_id;
+  __isset = other516.__isset;
 }
-AddColumnsRequest& AddColumnsRequest::operator=(const AddColumnsRequest& other509) {
-  db_name = other509.db_name;
-  table_name = other509.table_name;
-  column_defs = other509.column_defs;
-  session_id = other509.session_id;
-  __isset = other509.__isset;
+AddColumnsRequest& AddColumnsRequest::operator=(const AddColumnsRequest& other517) {
+  db_name = other517.db_name;
+  table_name = other517.table_name;
+  column_defs = other517.column_defs;
+  session_id = other517.session_id;
+  __isset = other517.__isset;
   return *this;
 }
 void AddColumnsRequest::printTo(std::ostream& out) const {
@@ -12923,14 +13115,14 @@ uint32_t DropColumnsRequest::read(::apache::thrift::protocol::TProtocol* iprot)
         if (ftype == ::apache::thrift::protocol::T_LIST) {
           {
             this->column_names.clear();
-            uint32_t _size510;
-            ::apache::thrift::protocol::TType _etype513;
-            xfer += iprot->readListBegin(_etype513, _size510);
-            this->column_names.resize(_size510);
-            uint32_t _i514;
-            for (_i514 = 0; _i514 < _size510; ++_i514)
+            uint32_t _size518;
+            ::apache::thrift::protocol::TType _etype521;
+            xfer += iprot->readListBegin(_etype521, _size518);
+            this->column_names.resize(_size518);
+            uint32_t _i522;
+            for (_i522 = 0; _i522 < _size518; ++_i522)
             {
-              xfer += iprot->readString(this->column_names[_i514]);
+              xfer += iprot->readString(this->column_names[_i522]);
             }
             xfer += iprot->readListEnd();
           }
@@ -12975,10 +13167,10 @@ uint32_t DropColumnsRequest::write(::apache::thrift::protocol::TProtocol* oprot)
   xfer += oprot->writeFieldBegin("column_names", ::apache::thrift::protocol::T_LIST, 3);
   {
     xfer += oprot->writeListBegin(::apache::thrift::protocol::T_STRING, static_cast<uint32_t>(this->column_names.size()));
-    std::vector<std::string> ::const_iterator _iter515;
-    for (_iter515 = this->column_names.begin(); _iter515 != this->column_names.end(); ++_iter515)
+    std::vector<std::string> ::const_iterator _iter523;
+    for (_iter523 = this->column_names.begin(); _iter523 != this->column_names.end(); ++_iter523)
     {
-      xfer += oprot->writeString((*_iter515));
+      xfer += oprot->writeString((*_iter523));
     }
     xfer += oprot->writeListEnd();
   }
@@ -13002,19 +13194,19 @@ void swap(DropColumnsRequest &a, DropColumnsRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-DropColumnsRequest::DropColumnsRequest(const DropColumnsRequest& other516) {
-  db_name = other516.db_name;
-  table_name = other516.table_name;
-  column_names = other516.column_names;
-  session_id = other516.session_id;
-  __isset = other516.__isset;
+DropColumnsRequest::DropColumnsRequest(const DropColumnsRequest& other524) {
+  db_name = other524.db_name;
+  table_name = other524.table_name;
+  column_names = other524.column_names;
+  session_id = other524.session_id;
+  __isset = other524.__isset;
 }
-DropColumnsRequest& DropColumnsRequest::operator=(const DropColumnsRequest& other517) {
-  db_name = other517.db_name;
-  table_name = other517.table_name;
-  column_names = other517.column_names;
-  session_id = other517.session_id;
-  __isset = other517.__isset;
+DropColumnsRequest& DropColumnsRequest::operator=(const DropColumnsRequest& other525) {
+  db_name = other525.db_name;
+  table_name = other525.table_name;
+  column_names = other525.column_names;
+  session_id = other525.session_id;
+  __isset = other525.__isset;
   return *this;
 }
 void DropColumnsRequest::printTo(std::ostream& out) const {
@@ -13120,15 +13312,15 @@ void swap(ShowTablesRequest &a, ShowTablesRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowTablesRequest::ShowTablesRequest(const ShowTablesRequest& other518) {
-  session_id = other518.session_id;
-  db_name = other518.db_name;
-  __isset = other518.__isset;
+ShowTablesRequest::ShowTablesRequest(const ShowTablesRequest& other526) {
+  session_id = other526.session_id;
+  db_name = other526.db_name;
+  __isset = other526.__isset;
 }
-ShowTablesRequest& ShowTablesRequest::operator=(const ShowTablesRequest& other519) {
-  session_id = other519.session_id;
-  db_name = other519.db_name;
-  __isset = other519.__isset;
+ShowTablesRequest& ShowTablesRequest::operator=(const ShowTablesRequest& other527) {
+  session_id = other527.session_id;
+  db_name = other527.db_name;
+  __isset = other527.__isset;
   return *this;
 }
 void ShowTablesRequest::printTo(std::ostream& out) const {
@@ -13249,17 +13441,17 @@ void swap(ShowSegmentsRequest &a, ShowSegmentsRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowSegmentsRequest::ShowSegmentsRequest(const ShowSegmentsRequest& other520) {
-  session_id = other520.session_id;
-  db_name = other520.db_name;
-  table_name = other520.table_name;
-  __isset = other520.__isset;
+ShowSegmentsRequest::ShowSegmentsRequest(const ShowSegmentsRequest& other528) {
+  session_id = other528.session_id;
+  db_name = other528.db_name;
+  table_name = other528.table_name;
+  __isset = other528.__isset;
 }
-ShowSegmentsRequest& ShowSegmentsRequest::operator=(const ShowSegmentsRequest& other521) {
-  session_id = other521.session_id;
-  db_name = other521.db_name;
-  table_name = other521.table_name;
-  __isset = other521.__isset;
+ShowSegmentsRequest& ShowSegmentsRequest::operator=(const ShowSegmentsRequest& other529) {
+  session_id = other529.session_id;
+  db_name = other529.db_name;
+  table_name = other529.table_name;
+  __isset = other529.__isset;
   return *this;
 }
 void ShowSegmentsRequest::printTo(std::ostream& out) const {
@@ -13398,19 +13590,19 @@ void swap(ShowSegmentRequest &a, ShowSegmentRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowSegmentRequest::ShowSegmentRequest(const ShowSegmentRequest& other522) {
-  session_id = other522.session_id;
-  db_name = other522.db_name;
-  table_name = other522.table_name;
-  segment_id = other522.segment_id;
-  __isset = other522.__isset;
+ShowSegmentRequest::ShowSegmentRequest(const ShowSegmentRequest& other530) {
+  session_id = other530.session_id;
+  db_name = other530.db_name;
+  table_name = other530.table_name;
+  segment_id = other530.segment_id;
+  __isset = other530.__isset;
 }
-ShowSegmentRequest& ShowSegmentRequest::operator=(const ShowSegmentRequest& other523) {
-  session_id = other523.session_id;
-  db_name = other523.db_name;
-  table_name = other523.table_name;
-  segment_id = other523.segment_id;
-  __isset = other523.__isset;
+ShowSegmentRequest& ShowSegmentRequest::operator=(const ShowSegmentRequest& other531) {
+  session_id = other531.session_id;
+  db_name = other531.db_name;
+  table_name = other531.table_name;
+  segment_id = other531.segment_id;
+  __isset = other531.__isset;
   return *this;
 }
 void ShowSegmentRequest::printTo(std::ostream& out) const {
@@ -13669,33 +13861,33 @@ void swap(ShowSegmentResponse &a, ShowSegmentResponse &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowSegmentResponse::ShowSegmentResponse(const ShowSegmentResponse& other524) {
-  error_code = other524.error_code;
-  error_msg = other524.error_msg;
-  segment_id = other524.segment_id;
-  status = other524.status;
-  path = other524.path;
-  size = other524.size;
-  block_count = other524.block_count;
-  row_capacity = other524.row_capacity;
-  row_count = other524.row_count;
-  room = other524.room;
-  column_count = other524.column_count;
-  __isset = other524.__isset;
+ShowSegmentResponse::ShowSegmentResponse(const ShowSegmentResponse& other532) {
+  error_code = other532.error_code;
+  error_msg = other532.error_msg;
+  segment_id = other532.segment_id;
+  status = other532.status;
+  path = other532.path;
+  size = other532.size;
+  block_count = other532.block_count;
+  row_capacity = other532.row_capacity;
+  row_count = other532.row_count;
+  room = other532.room;
+  column_count = other532.column_count;
+  __isset = other532.__isset;
 }
-ShowSegmentResponse& ShowSegmentResponse::operator=(const ShowSegmentResponse& other525) {
-  error_code = other525.error_code;
-  error_msg = other525.error_msg;
-  segment_id = other525.segment_id;
-  status = other525.status;
-  path = other525.path;
-  size = other525.size;
-  block_count = other525.block_count;
-  row_capacity = other525.row_capacity;
-  row_count = other525.row_count;
-  room = other525.room;
-  column_count = other525.column_count;
-  __isset = other525.__isset;
+ShowSegmentResponse& ShowSegmentResponse::operator=(const ShowSegmentResponse& other533) {
+  error_code = other533.error_code;
+  error_msg = other533.error_msg;
+  segment_id = other533.segment_id;
+  status = other533.status;
+  path = other533.path;
+  size = other533.size;
+  block_count = other533.block_count;
+  row_capacity = other533.row_capacity;
+  row_count = other533.row_count;
+  room = other533.room;
+  column_count = other533.column_count;
+  __isset = other533.__isset;
   return *this;
 }
 void ShowSegmentResponse::printTo(std::ostream& out) const {
@@ -13842,19 +14034,19 @@ void swap(ShowBlocksRequest &a, ShowBlocksRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowBlocksRequest::ShowBlocksRequest(const ShowBlocksRequest& other526) {
-  session_id = other526.session_id;
-  db_name = other526.db_name;
-  table_name = other526.table_name;
-  segment_id = other526.segment_id;
-  __isset = other526.__isset;
+ShowBlocksRequest::ShowBlocksRequest(const ShowBlocksRequest& other534) {
+  session_id = other534.session_id;
+  db_name = other534.db_name;
+  table_name = other534.table_name;
+  segment_id = other534.segment_id;
+  __isset = other534.__isset;
 }
-ShowBlocksRequest& ShowBlocksRequest::operator=(const ShowBlocksRequest& other527) {
-  session_id = other527.session_id;
-  db_name = other527.db_name;
-  table_name = other527.table_name;
-  segment_id = other527.segment_id;
-  __isset = other527.__isset;
+ShowBlocksRequest& ShowBlocksRequest::operator=(const ShowBlocksRequest& other535) {
+  session_id = other535.session_id;
+  db_name = other535.db_name;
+  table_name = other535.table_name;
+  segment_id = other535.segment_id;
+  __isset = other535.__isset;
   return *this;
 }
 void ShowBlocksRequest::printTo(std::ostream& out) const {
@@ -14011,21 +14203,21 @@ void swap(ShowBlockRequest &a, ShowBlockRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowBlockRequest::ShowBlockRequest(const ShowBlockRequest& other528) {
-  session_id = other528.session_id;
-  db_name = other528.db_name;
-  table_name = other528.table_name;
-  segment_id = other528.segment_id;
-  block_id = other528.block_id;
-  __isset = other528.__isset;
+ShowBlockRequest::ShowBlockRequest(const ShowBlockRequest& other536) {
+  session_id = other536.session_id;
+  db_name = other536.db_name;
+  table_name = other536.table_name;
+  segment_id = other536.segment_id;
+  block_id = other536.block_id;
+  __isset = other536.__isset;
 }
-ShowBlockRequest& ShowBlockRequest::operator=(const ShowBlockRequest& other529) {
-  session_id = other529.session_id;
-  db_name = other529.db_name;
-  table_name = other529.table_name;
-  segment_id = other529.segment_id;
-  block_id = other529.block_id;
-  __isset = other529.__isset;
+ShowBlockRequest& ShowBlockRequest::operator=(const ShowBlockRequest& other537) {
+  session_id = other537.session_id;
+  db_name = other537.db_name;
+  table_name = other537.table_name;
+  segment_id = other537.segment_id;
+  block_id = other537.block_id;
+  __isset = other537.__isset;
   return *this;
 }
 void ShowBlockRequest::printTo(std::ostream& out) const {
@@ -14234,27 +14426,27 @@ void swap(ShowBlockResponse &a, ShowBlockResponse &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowBlockResponse::ShowBlockResponse(const ShowBlockResponse& other530) {
-  error_code = other530.error_code;
-  error_msg = other530.error_msg;
-  block_id = other530.block_id;
-  path = other530.path;
-  size = other530.size;
-  row_capacity = other530.row_capacity;
-  row_count = other530.row_count;
-  column_count = other530.column_count;
-  __isset = other530.__isset;
+ShowBlockResponse::ShowBlockResponse(const ShowBlockResponse& other538) {
+  error_code = other538.error_code;
+  error_msg = other538.error_msg;
+  block_id = other538.block_id;
+  path = other538.path;
+  size = other538.size;
+  row_capacity = other538.row_capacity;
+  row_count = other538.row_count;
+  column_count = other538.column_count;
+  __isset = other538.__isset;
 }
-ShowBlockResponse& ShowBlockResponse::operator=(const ShowBlockResponse& other531) {
-  error_code = other531.error_code;
-  error_msg = other531.error_msg;
-  block_id = other531.block_id;
-  path = other531.path;
-  size = other531.size;
-  row_capacity = other531.row_capacity;
-  row_count = other531.row_count;
-  column_count = other531.column_count;
-  __isset = other531.__isset;
+ShowBlockResponse& ShowBlockResponse::operator=(const ShowBlockResponse& other539) {
+  error_code = other539.error_code;
+  error_msg = other539.error_msg;
+  block_id = other539.block_id;
+  path = other539.path;
+  size = other539.size;
+  row_capacity = other539.row_capacity;
+  row_count = other539.row_count;
+  column_count = other539.column_count;
+  __isset = other539.__isset;
   return *this;
 }
 void ShowBlockResponse::printTo(std::ostream& out) const {
@@ -14432,23 +14624,23 @@ void swap(ShowBlockColumnRequest &a, ShowBlockColumnRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowBlockColumnRequest::ShowBlockColumnRequest(const ShowBlockColumnRequest& other532) {
-  session_id = other532.session_id;
-  db_name = other532.db_name;
-  table_name = other532.table_name;
-  segment_id = other532.segment_id;
-  block_id = other532.block_id;
-  column_id = other532.column_id;
-  __isset = other532.__isset;
+ShowBlockColumnRequest::ShowBlockColumnRequest(const ShowBlockColumnRequest& other540) {
+  session_id = other540.session_id;
+  db_name = other540.db_name;
+  table_name = other540.table_name;
+  segment_id = other540.segment_id;
+  block_id = other540.block_id;
+  column_id = other540.column_id;
+  __isset = other540.__isset;
 }
-ShowBlockColumnRequest& ShowBlockColumnRequest::operator=(const ShowBlockColumnRequest& other533) {
-  session_id = other533.session_id;
-  db_name = other533.db_name;
-  table_name = other533.table_name;
-  segment_id = other533.segment_id;
-  block_id = other533.block_id;
-  column_id = other533.column_id;
-  __isset = other533.__isset;
+ShowBlockColumnRequest& ShowBlockColumnRequest::operator=(const ShowBlockColumnRequest& other541) {
+  session_id = other541.session_id;
+  db_name = other541.db_name;
+  table_name = other541.table_name;
+  segment_id = other541.segment_id;
+  block_id = other541.block_id;
+  column_id = other541.column_id;
+  __isset = other541.__isset;
   return *this;
 }
 void ShowBlockColumnRequest::printTo(std::ostream& out) const {
@@ -14658,27 +14850,27 @@ void swap(ShowBlockColumnResponse &a, ShowBlockColumnResponse &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowBlockColumnResponse::ShowBlockColumnResponse(const ShowBlockColumnResponse& other534) {
-  error_code = other534.error_code;
-  error_msg = other534.error_msg;
-  column_name = other534.column_name;
-  column_id = other534.column_id;
-  data_type = other534.data_type;
-  path = other534.path;
-  extra_file_count = other534.extra_file_count;
-  extra_file_names = other534.extra_file_names;
-  __isset = other534.__isset;
+ShowBlockColumnResponse::ShowBlockColumnResponse(const ShowBlockColumnResponse& other542) {
+  error_code = other542.error_code;
+  error_msg = other542.error_msg;
+  column_name = other542.column_name;
+  column_id = other542.column_id;
+  data_type = other542.data_type;
+  path = other542.path;
+  extra_file_count = other542.extra_file_count;
+  extra_file_names = other542.extra_file_names;
+  __isset = other542.__isset;
 }
-ShowBlockColumnResponse& ShowBlockColumnResponse::operator=(const ShowBlockColumnResponse& other535) {
-  error_code = other535.error_code;
-  error_msg = other535.error_msg;
-  column_name = other535.column_name;
-  column_id = other535.column_id;
-  data_type = other535.data_type;
-  path = other535.path;
-  extra_file_count = other535.extra_file_count;
-  extra_file_names = other535.extra_file_names;
-  __isset = other535.__isset;
+ShowBlockColumnResponse& ShowBlockColumnResponse::operator=(const ShowBlockColumnResponse& other543) {
+  error_code = other543.error_code;
+  error_msg = other543.error_msg;
+  column_name = other543.column_name;
+  column_id = other543.column_id;
+  data_type = other543.data_type;
+  path = other543.path;
+  extra_file_count = other543.extra_file_count;
+  extra_file_names = other543.extra_file_names;
+  __isset = other543.__isset;
   return *this;
 }
 void ShowBlockColumnResponse::printTo(std::ostream& out) const {
@@ -14771,13 +14963,13 @@ void swap(ShowCurrentNodeRequest &a, ShowCurrentNodeRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowCurrentNodeRequest::ShowCurrentNodeRequest(const ShowCurrentNodeRequest& other536) noexcept {
-  session_id = other536.session_id;
-  __isset = other536.__isset;
+ShowCurrentNodeRequest::ShowCurrentNodeRequest(const ShowCurrentNodeRequest& other544) noexcept {
+  session_id = other544.session_id;
+  __isset = other544.__isset;
 }
-ShowCurrentNodeRequest& ShowCurrentNodeRequest::operator=(const ShowCurrentNodeRequest& other537) noexcept {
-  session_id = other537.session_id;
-  __isset = other537.__isset;
+ShowCurrentNodeRequest& ShowCurrentNodeRequest::operator=(const ShowCurrentNodeRequest& other545) noexcept {
+  session_id = other545.session_id;
+  __isset = other545.__isset;
   return *this;
 }
 void ShowCurrentNodeRequest::printTo(std::ostream& out) const {
@@ -14914,19 +15106,19 @@ void swap(ShowCurrentNodeResponse &a, ShowCurrentNodeResponse &b) {
   swap(a.__isset, b.__isset);
 }
 
-ShowCurrentNodeResponse::ShowCurrentNodeResponse(const ShowCurrentNodeResponse& other538) {
-  error_code = other538.error_code;
-  error_msg = other538.error_msg;
-  node_role = other538.node_role;
-  server_status = other538.server_status;
-  __isset = other538.__isset;
+ShowCurrentNodeResponse::ShowCurrentNodeResponse(const ShowCurrentNodeResponse& other546) {
+  error_code = other546.error_code;
+  error_msg = other546.error_msg;
+  node_role = other546.node_role;
+  server_status = other546.server_status;
+  __isset = other546.__isset;
 }
-ShowCurrentNodeResponse& ShowCurrentNodeResponse::operator=(const ShowCurrentNodeResponse& other539) {
-  error_code = other539.error_code;
-  error_msg = other539.error_msg;
-  node_role = other539.node_role;
-  server_status = other539.server_status;
-  __isset = other539.__isset;
+ShowCurrentNodeResponse& ShowCurrentNodeResponse::operator=(const ShowCurrentNodeResponse& other547) {
+  error_code = other547.error_code;
+  error_msg = other547.error_msg;
+  node_role = other547.node_role;
+  server_status = other547.server_status;
+  __isset = other547.__isset;
   return *this;
 }
 void ShowCurrentNodeResponse::printTo(std::ostream& out) const {
@@ -15049,17 +15241,17 @@ void swap(CommandRequest &a, CommandRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-CommandRequest::CommandRequest(const CommandRequest& other540) {
-  session_id = other540.session_id;
-  command_type = other540.command_type;
-  test_command_content = other540.test_command_content;
-  __isset = other540.__isset;
+CommandRequest::CommandRequest(const CommandRequest& other548) {
+  session_id = other548.session_id;
+  command_type = other548.command_type;
+  test_command_content = other548.test_command_content;
+  __isset = other548.__isset;
 }
-CommandRequest& CommandRequest::operator=(const CommandRequest& other541) {
-  session_id = other541.session_id;
-  command_type = other541.command_type;
-  test_command_content = other541.test_command_content;
-  __isset = other541.__isset;
+CommandRequest& CommandRequest::operator=(const CommandRequest& other549) {
+  session_id = other549.session_id;
+  command_type = other549.command_type;
+  test_command_content = other549.test_command_content;
+  __isset = other549.__isset;
   return *this;
 }
 void CommandRequest::printTo(std::ostream& out) const {
@@ -15164,15 +15356,15 @@ void swap(FlushRequest &a, FlushRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-FlushRequest::FlushRequest(const FlushRequest& other542) {
-  session_id = other542.session_id;
-  flush_type = other542.flush_type;
-  __isset = other542.__isset;
+FlushRequest::FlushRequest(const FlushRequest& other550) {
+  session_id = other550.session_id;
+  flush_type = other550.flush_type;
+  __isset = other550.__isset;
 }
-FlushRequest& FlushRequest::operator=(const FlushRequest& other543) {
-  session_id = other543.session_id;
-  flush_type = other543.flush_type;
-  __isset = other543.__isset;
+FlushRequest& FlushRequest::operator=(const FlushRequest& other551) {
+  session_id = other551.session_id;
+  flush_type = other551.flush_type;
+  __isset = other551.__isset;
   return *this;
 }
 void FlushRequest::printTo(std::ostream& out) const {
@@ -15293,17 +15485,17 @@ void swap(CompactRequest &a, CompactRequest &b) {
   swap(a.__isset, b.__isset);
 }
 
-CompactRequest::CompactRequest(const CompactRequest& other544) {
-  session_id = other544.session_id;
-  db_name = other544.db_name;
-  table_name = other544.table_name;
-  __isset = other544.__isset;
+CompactRequest::CompactRequest(const CompactRequest& other552) {
+  session_id = other552.session_id;
+  db_name = other552.db_name;
+  table_name = other552.table_name;
+  __isset = other552.__isset;
 }
-CompactRequest& CompactRequest::operator=(const CompactRequest& other545) {
-  session_id = other545.session_id;
-  db_name = other545.db_name;
-  table_name = other545.table_name;
-  __isset = other545.__isset;
+CompactRequest& CompactRequest::operator=(const CompactRequest& other553) {
+  session_id = other553.session_id;
+  db_name = other553.db_name;
+  table_name = other553.table_name;
+  __isset = other553.__isset;
   return *this;
 }
 void CompactRequest::printTo(std::ostream& out) const {
@@ -368,6 +368,8 @@ class DropTableRequest;
 
 class InsertRequest;
 
+class ColumnarInsertRequest;
+
 class ImportRequest;
 
 class ExportRequest;
@@ -4246,6 +4248,77 @@ void swap(InsertRequest &a, InsertRequest &b);
 
 std::ostream& operator<<(std::ostream& out, const InsertRequest& obj);
 
+typedef struct _ColumnarInsertRequest__isset {
+  _ColumnarInsertRequest__isset() : db_name(false), table_name(false), column_fields(true), row_count(false), session_id(false) {}
+  bool db_name :1;
+  bool table_name :1;
+  bool column_fields :1;
+  bool row_count :1;
+  bool session_id :1;
+} _ColumnarInsertRequest__isset;
+
+class ColumnarInsertRequest : public virtual ::apache::thrift::TBase {
+ public:
+
+  ColumnarInsertRequest(const ColumnarInsertRequest&);
+  ColumnarInsertRequest& operator=(const ColumnarInsertRequest&);
+  ColumnarInsertRequest() noexcept
+                : db_name(),
+                  table_name(),
+                  row_count(0),
+                  session_id(0) {
+
+  }
+
+  virtual ~ColumnarInsertRequest() noexcept;
+  std::string db_name;
+  std::string table_name;
+  std::vector<ColumnField>  column_fields;
+  int64_t row_count;
+  int64_t session_id;
+
+  _ColumnarInsertRequest__isset __isset;
+
+  void __set_db_name(const std::string& val);
+
+  void __set_table_name(const std::string& val);
+
+  void __set_column_fields(const std::vector<ColumnField> & val);
+
+  void __set_row_count(const int64_t val);
+
+  void __set_session_id(const int64_t val);
+
+  bool operator == (const ColumnarInsertRequest & rhs) const
+  {
+    if (!(db_name == rhs.db_name))
+      return false;
+    if (!(table_name == rhs.table_name))
+      return false;
+    if (!(column_fields == rhs.column_fields))
+      return false;
+    if (!(row_count == rhs.row_count))
+      return false;
+    if (!(session_id == rhs.session_id))
+      return false;
+    return true;
+  }
+  bool operator != (const ColumnarInsertRequest &rhs) const {
+    return !(*this == rhs);
+  }
+
+  bool operator < (const ColumnarInsertRequest & ) const;
+
+  uint32_t read(::apache::thrift::protocol::TProtocol* iprot) override;
+  uint32_t write(::apache::thrift::protocol::TProtocol* oprot) const override;
+
+  virtual void printTo(std::ostream& out) const;
+};
+
+void swap(ColumnarInsertRequest &a, ColumnarInsertRequest &b);
+
+std::ostream& operator<<(std::ostream& out, const ColumnarInsertRequest& obj);
+
 typedef struct _ImportRequest__isset {
   _ImportRequest__isset() : db_name(false), table_name(false), file_name(false), import_option(false), session_id(false) {}
   bool db_name :1;
@@ -337,6 +337,41 @@ void InfinityThriftService::Insert(infinity_thrift_rpc::CommonResponse &response
     ProcessQueryResult(response, result);
 }
 
+void InfinityThriftService::ColumnarInsert(infinity_thrift_rpc::CommonResponse &response,
+                                           const infinity_thrift_rpc::ColumnarInsertRequest &request) {
+    auto [infinity, infinity_status] = GetInfinityBySessionID(request.session_id);
+    if (!infinity_status.ok()) {
+        ProcessStatus(response, infinity_status);
+        return;
+    }
+
+    if (request.column_fields.empty() || request.row_count <= 0) {
+        ProcessStatus(response, Status::InsertWithoutValues());
+        return;
+    }
+
+    Vector<String> column_names;
+    Vector<String> column_buffers;
+    column_names.reserve(request.column_fields.size());
+    column_buffers.reserve(request.column_fields.size());
+    for (const auto &column_field : request.column_fields) {
+        // The request is const, the names and buffers are copied.
+        column_names.emplace_back(column_field.column_name);
+        // A column may be sent in several chunks, they are concatenated in order.
+        SizeT column_size = 0;
+        for (const auto &column_vector : column_field.column_vectors) {
+            column_size += column_vector.size();
+        }
+        String &column_buffer = column_buffers.emplace_back();
+        column_buffer.reserve(column_size);
+        for (const auto &column_vector : column_field.column_vectors) {
+            column_buffer.append(column_vector);
+        }
+    }
+    auto result = infinity->InsertColumns(request.db_name, request.table_name, std::move(column_names), std::move(column_buffers), request.row_count);
+    ProcessQueryResult(response, result);
+}
+
 Tuple<CopyFileType, Status> InfinityThriftService::GetCopyFileType(infinity_thrift_rpc::CopyFileType::type copy_file_type) {
     switch (copy_file_type) {
         case infinity_thrift_rpc::CopyFileType::CSV:
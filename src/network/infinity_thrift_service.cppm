@@ -96,6 +96,8 @@ public:
 
     void Insert(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::InsertRequest &request) final;
 
+    void ColumnarInsert(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::ColumnarInsertRequest &request) final;
+
     Tuple<CopyFileType, Status> GetCopyFileType(infinity_thrift_rpc::CopyFileType::type copy_file_type);
 
     void Import(infinity_thrift_rpc::CommonResponse &response, const infinity_thrift_rpc::ImportRequest &request) final;
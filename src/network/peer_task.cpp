@@ -67,7 +67,7 @@ String HeartBeatPeerTask::ToString() const {
 }
 
 String SyncLogTask::ToString() const {
-    return fmt::format("{}@{}, {}", infinity::ToString(type_), node_name_, log_strings_.size());
+    return fmt::format("{}@{}, {}", infinity::ToString(type_), node_name_, log_entries_.size());
 }
 
 String ChangeRoleTask::ToString() const {
@@ -145,13 +145,17 @@ public:
 
 export class SyncLogTask final : public PeerTask {
 public:
-    SyncLogTask(const String &node_name, const Vector<SharedPtr<String>> &log_strings, bool on_register)
-        : PeerTask(PeerTaskType::kLogSync), node_name_(node_name), log_strings_(log_strings), on_register_(on_register) {}
+    SyncLogTask(const String &node_name,
+                const Vector<SharedPtr<String>> &log_buffers,
+                const Vector<std::string_view> &log_entries,
+                bool on_register)
+        : PeerTask(PeerTaskType::kLogSync), node_name_(node_name), log_buffers_(log_buffers), log_entries_(log_entries), on_register_(on_register) {}
 
     String ToString() const final;
 
     String node_name_{};
-    Vector<SharedPtr<String>> log_strings_;
+    Vector<SharedPtr<String>> log_buffers_; // keep log_entries_ alive until the task is sent
+    Vector<std::string_view> log_entries_;
     bool on_register_{false};
 
     // response
@@ -438,11 +438,11 @@ void PeerClient::SyncLogs(SyncLogTask *peer_task) {
     SyncLogRequest request;
     SyncLogResponse response;
     request.node_name = peer_task->node_name_;
-    SizeT log_count = peer_task->log_strings_.size();
+    SizeT log_count = peer_task->log_entries_.size();
     request.log_entries.reserve(log_count);
     request.on_startup = peer_task->on_register_;
     for (SizeT i = 0; i < log_count; ++i) {
-        request.log_entries.emplace_back(*peer_task->log_strings_[i]);
+        request.log_entries.emplace_back(peer_task->log_entries_[i]);
     }
 
     try {
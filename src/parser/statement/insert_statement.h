@@ -33,6 +33,12 @@ public:
 
     std::vector<std::unique_ptr<InsertRowExpr>> insert_rows_{};
 
+    // Columnar insert: column_buffers_[i] holds column_row_count_ values of column column_names_[i],
+    // as raw little-endian data laid out like the column buffers of a select result.
+    std::vector<std::string> column_names_{};
+    std::vector<std::string> column_buffers_{};
+    size_t column_row_count_{};
+
     std::vector<std::string> columns_for_select_{};
     std::unique_ptr<SelectStatement> select_{};
 };
@@ -60,6 +60,9 @@ import logical_match;
 import logical_fusion;
 
 import subquery_unnest;
+import subquery_expr;
+import value_expression;
+import value;
 
 import infinity_exception;
 import expression_transformer;
@@ -548,6 +551,17 @@ SharedPtr<LogicalNode> BoundSelectStatement::BuildFilter(SharedPtr<LogicalNode>
                                                          QueryContext *query_context,
                                                          const SharedPtr<BindContext> &bind_context) {
     for (auto &cond : conditions) {
+        if (cond->type() == ExpressionType::kSubQuery) {
+            // A top level uncorrelated IN subquery keeps the rows with a match, which is a semi join with the subquery.
+            auto *subquery_expr_ptr = static_cast<SubqueryExpression *>(cond.get());
+            const auto &subquery_statement = subquery_expr_ptr->bound_select_statement_ptr_;
+            if (subquery_expr_ptr->subquery_type_ == SubqueryType::kIn && !subquery_statement->bind_context_->HasCorrelatedColumn()) {
+                SharedPtr<LogicalNode> subquery_plan = subquery_statement->BuildPlan(query_context);
+                SubqueryUnnest::UnnestUncorrelatedInAsSemiJoin(subquery_expr_ptr, root, subquery_plan, query_context, subquery_statement->bind_context_);
+                cond = MakeShared<ValueExpression>(Value::MakeBool(true));
+                continue;
+            }
+        }
         // 1. Go through all the expression to find subquery
         //        VisitExpression(cond,
         //                        [&](SharedPtr<BaseExpression> &expr) {
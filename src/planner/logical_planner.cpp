@@ -15,6 +15,7 @@
 module;
 
 #include <cassert>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <tuple>
@@ -106,6 +107,9 @@ import utility;
 import wal_manager;
 import infinity_context;
 import table_entry;
+import data_block;
+import column_vector;
+import data_type;
 
 namespace infinity {
 
@@ -250,6 +254,9 @@ Status LogicalPlanner::BuildSelect(const SelectStatement *statement, SharedPtr<B
 
 Status LogicalPlanner::BuildInsert(InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
     BindSchemaName(statement->schema_name_);
+    if (!statement->column_buffers_.empty()) {
+        return BuildInsertColumns(statement, bind_context_ptr);
+    }
     if (statement->select_ == nullptr) {
         return BuildInsertValue(statement, bind_context_ptr);
     } else {
@@ -413,6 +420,172 @@ Status LogicalPlanner::BuildInsertValue(const InsertStatement *statement, Shared
     return Status::OK();
 }
 
+namespace {
+
+// Check that the column buffer holds exactly `row_count` values of `column_type`.
+Status CheckColumnBuffer(const String &column_name, const DataType &column_type, const String &buffer, SizeT row_count) {
+    auto size_mismatch = [&]() {
+        return Status::InvalidParameterValue(column_name,
+                                             fmt::format("{} bytes", buffer.size()),
+                                             fmt::format("{} rows of {}", row_count, column_type.ToString()));
+    };
+    SizeT expected_size = 0;
+    switch (column_type.type()) {
+        case LogicalType::kBoolean: {
+            expected_size = row_count;
+            break;
+        }
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kHugeInt:
+        case LogicalType::kFloat16:
+        case LogicalType::kBFloat16:
+        case LogicalType::kFloat:
+        case LogicalType::kDouble:
+        case LogicalType::kDate:
+        case LogicalType::kTime:
+        case LogicalType::kDateTime:
+        case LogicalType::kTimestamp:
+        case LogicalType::kInterval:
+        case LogicalType::kEmbedding: {
+            expected_size = column_type.Size() * row_count;
+            break;
+        }
+        case LogicalType::kVarchar: {
+            // Each value is an i32 length followed by the bytes
+            for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+                if (expected_size + sizeof(i32) > buffer.size()) {
+                    return size_mismatch();
+                }
+                i32 length = 0;
+                std::memcpy(&length, buffer.data() + expected_size, sizeof(i32));
+                if (length < 0) {
+                    return size_mismatch();
+                }
+                expected_size += sizeof(i32) + length;
+            }
+            break;
+        }
+        default: {
+            return Status::NotSupport(fmt::format("Columnar insert into {} column {}", column_type.ToString(), column_name));
+        }
+    }
+    if (expected_size != buffer.size()) {
+        return size_mismatch();
+    }
+    return Status::OK();
+}
+
+// Append `count` values of the column buffer starting at `offset`, offset is advanced past them.
+void AppendColumnBuffer(ColumnVector &column_vector, const String &buffer, SizeT &offset, SizeT count) {
+    const DataType &column_type = *column_vector.data_type();
+    switch (column_type.type()) {
+        case LogicalType::kBoolean: {
+            column_vector.AppendFixedWidth(buffer.data() + offset, count);
+            offset += count;
+            break;
+        }
+        case LogicalType::kVarchar: {
+            for (SizeT i = 0; i < count; ++i) {
+                i32 length = 0;
+                std::memcpy(&length, buffer.data() + offset, sizeof(i32));
+                column_vector.AppendVarchar(Span<const char>(buffer.data() + offset + sizeof(i32), length));
+                offset += sizeof(i32) + length;
+            }
+            break;
+        }
+        default: {
+            column_vector.AppendFixedWidth(buffer.data() + offset, count);
+            offset += column_type.Size() * count;
+            break;
+        }
+    }
+}
+
+} // namespace
+
+Status LogicalPlanner::BuildInsertColumns(const InsertStatement *statement, SharedPtr<BindContext> &bind_context_ptr) {
+    const String &schema_name = statement->schema_name_;
+    const String &table_name = statement->table_name_;
+    if (table_name.empty()) {
+        String error_message = "Insert statement missing table table_name.";
+        UnrecoverableError(error_message);
+    }
+    Txn *txn = query_context_ptr_->GetTxn();
+    auto [table_entry, status] = txn->GetTableByName(schema_name, table_name);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    status = table_entry->AddWriteTxnNum(txn);
+    if (!status.ok()) {
+        RecoverableError(status);
+    }
+    if (table_entry->EntryType() == TableEntryType::kCollectionEntry) {
+        RecoverableError(Status::NotSupport("Currently, collection isn't supported."));
+    }
+
+    const SizeT row_count = statement->column_row_count_;
+    if (row_count == 0) {
+        RecoverableError(Status::NotSupport("No insert batch row found!"));
+    }
+    const SizeT table_column_count = table_entry->ColumnCount();
+    const SizeT column_count = statement->column_buffers_.size();
+    if (statement->column_names_.size() != column_count || column_count != table_column_count) {
+        RecoverableError(Status::ColumnCountMismatch(
+            fmt::format("Columnar insert has {} columns, table {} has {} columns.", column_count, table_name, table_column_count)));
+    }
+
+    // Rearrange the column buffers to the order of the table columns
+    Vector<const String *> column_buffers(table_column_count, nullptr);
+    for (SizeT idx = 0; idx < column_count; ++idx) {
+        const String &column_name = statement->column_names_[idx];
+        const SharedPtr<ColumnDef> column_def = table_entry->GetColumnDefByName(column_name);
+        if (column_def.get() == nullptr) {
+            RecoverableError(Status::ColumnNotExist(column_name));
+        }
+        SizeT table_column_idx = table_entry->GetColumnIdxByID(column_def->id());
+        if (column_buffers[table_column_idx] != nullptr) {
+            RecoverableError(Status::InvalidColumnName(column_name));
+        }
+        status = CheckColumnBuffer(column_name, *column_def->column_type_, statement->column_buffers_[idx], row_count);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        column_buffers[table_column_idx] = &statement->column_buffers_[idx];
+    }
+
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.reserve(table_column_count);
+    for (SizeT column_idx = 0; column_idx < table_column_count; ++column_idx) {
+        column_types.emplace_back(table_entry->GetColumnDefByIdx(column_idx)->column_type_);
+    }
+
+    // Decode the buffers straight into column vectors, one data block per DEFAULT_BLOCK_CAPACITY rows
+    Vector<SharedPtr<DataBlock>> data_blocks;
+    Vector<SizeT> buffer_offsets(table_column_count, 0);
+    for (SizeT row_offset = 0; row_offset < row_count; row_offset += DEFAULT_BLOCK_CAPACITY) {
+        const SizeT block_row_count = std::min(static_cast<SizeT>(DEFAULT_BLOCK_CAPACITY), row_count - row_offset);
+        auto data_block = DataBlock::Make();
+        data_block->Init(column_types, block_row_count);
+        for (SizeT column_idx = 0; column_idx < table_column_count; ++column_idx) {
+            AppendColumnBuffer(*data_block->column_vectors[column_idx], *column_buffers[column_idx], buffer_offsets[column_idx], block_row_count);
+        }
+        data_block->Finalize();
+        data_blocks.emplace_back(std::move(data_block));
+    }
+
+    auto logical_insert = MakeShared<LogicalInsert>(bind_context_ptr->GetNewLogicalNodeId(),
+                                                    table_entry,
+                                                    bind_context_ptr->GenerateTableIndex(),
+                                                    Vector<Vector<SharedPtr<BaseExpression>>>());
+    logical_insert->set_data_blocks(std::move(data_blocks));
+
+    this->logical_plan_ = std::move(logical_insert);
+    return Status::OK();
+}
+
 Status LogicalPlanner::BuildInsertSelect(const InsertStatement *, SharedPtr<BindContext> &) {
     Status status = Status::NotSupport("Not supported");
     RecoverableError(status);
@@ -25,6 +25,7 @@ import base_expression;
 import table_entry;
 import internal_types;
 import data_type;
+import data_block;
 
 namespace infinity {
 
@@ -57,6 +58,11 @@ public:
 
     [[nodiscard]] inline u64 table_index() const { return table_index_; }
 
+    // Rows of a columnar insert, already decoded into data blocks. value_list_ is empty in this case.
+    inline void set_data_blocks(Vector<SharedPtr<DataBlock>> data_blocks) { data_blocks_ = std::move(data_blocks); }
+
+    [[nodiscard]] inline const Vector<SharedPtr<DataBlock>> &data_blocks() const { return data_blocks_; }
+
 public:
     static bool NeedCastInInsert(const DataType &from, const DataType &to) {
         if (from.type() == to.type()) {
@@ -74,6 +80,7 @@ public:
 private:
     TableEntry *table_entry_{};
     Vector<Vector<SharedPtr<BaseExpression>>> value_list_{};
+    Vector<SharedPtr<DataBlock>> data_blocks_{};
     u64 table_index_{};
 };
 
@@ -45,8 +45,12 @@ Vector<ColumnBinding> LogicalJoin::GetColumnBindings() const {
         result_binding.emplace_back(mark_index_, 0);
     }
     Vector<ColumnBinding> left_binding = this->left_node_->GetColumnBindings();
-    Vector<ColumnBinding> right_binding = this->right_node_->GetColumnBindings();
     result_binding.insert(result_binding.end(), left_binding.begin(), left_binding.end());
+    if (join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti) {
+        // Semi and anti join only output the left columns
+        return result_binding;
+    }
+    Vector<ColumnBinding> right_binding = this->right_node_->GetColumnBindings();
     result_binding.insert(result_binding.end(), right_binding.begin(), right_binding.end());
     return result_binding;
 }
@@ -54,6 +58,10 @@ Vector<ColumnBinding> LogicalJoin::GetColumnBindings() const {
 SharedPtr<Vector<String>> LogicalJoin::GetOutputNames() const {
     SharedPtr<Vector<String>> result = MakeShared<Vector<String>>();
     SharedPtr<Vector<String>> left_output_names = left_node_->GetOutputNames();
+    if (join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti) {
+        *result = *left_output_names;
+        return result;
+    }
     SharedPtr<Vector<String>> right_output_names = right_node_->GetOutputNames();
     result->reserve(left_output_names->size() + right_output_names->size());
     for (auto &name_str : *left_output_names) {
@@ -70,6 +78,10 @@ SharedPtr<Vector<String>> LogicalJoin::GetOutputNames() const {
 SharedPtr<Vector<SharedPtr<DataType>>> LogicalJoin::GetOutputTypes() const {
     SharedPtr<Vector<SharedPtr<DataType>>> result = MakeShared<Vector<SharedPtr<DataType>>>();
     SharedPtr<Vector<SharedPtr<DataType>>> left_output_names = left_node_->GetOutputTypes();
+    if (join_type_ == JoinType::kSemi || join_type_ == JoinType::kAnti) {
+        *result = *left_output_names;
+        return result;
+    }
     SharedPtr<Vector<SharedPtr<DataType>>> right_output_names = right_node_->GetOutputTypes();
     result->reserve(left_output_names->size() + right_output_names->size());
     for (auto &name_str : *left_output_names) {
@@ -16,6 +16,9 @@ module;
 
 import logical_node;
 import logical_node_type;
+import logical_join;
+import column_binding;
+import join_reference;
 import stl;
 import base_expression;
 import column_expression;
@@ -61,7 +64,26 @@ void BindingRemapper::VisitNode(LogicalNode &op) {
             // skip
             return;
         }
-        case LogicalNodeType::kJoin:
+        case LogicalNodeType::kJoin: {
+            VisitNodeChildren(op);
+            auto &join = op.Cast<LogicalJoin>();
+            if (join.join_type_ == JoinType::kSemi || join.join_type_ == JoinType::kAnti) {
+                // The conditions refer to the columns of both inputs, though only the left ones are output
+                bindings_ = join.left_node()->GetColumnBindings();
+                Vector<ColumnBinding> right_bindings = join.right_node()->GetColumnBindings();
+                bindings_.insert(bindings_.end(), right_bindings.begin(), right_bindings.end());
+                VisitNodeExpression(op);
+                bindings_ = op.GetColumnBindings();
+                output_types_ = op.GetOutputTypes();
+                load_func();
+                break;
+            }
+            bindings_ = op.GetColumnBindings();
+            output_types_ = op.GetOutputTypes();
+            load_func();
+            VisitNodeExpression(op);
+            break;
+        }
         case LogicalNodeType::kMatch:
         case LogicalNodeType::kMatchSparseScan:
         case LogicalNodeType::kMatchTensorScan:
@@ -163,46 +163,20 @@ SharedPtr<BaseExpression> SubqueryUnnest::UnnestUncorrelated(SubqueryExpression
         }
         case SubqueryType::kNotIn:
         case SubqueryType::kIn: {
-            // 1. Generate right column expression
-            ColumnBinding right_column_binding = subquery_plan->GetColumnBindings()[0];
-            SharedPtr<ColumnExpression> right_column = ColumnExpression::Make(expr_ptr->left_->Type(),
-                                                                              subquery_plan->name(),
-                                                                              right_column_binding.table_idx,
-                                                                              "0",
-                                                                              right_column_binding.column_idx,
-                                                                              0);
-
-            // 2. Generate condition expression;
-            Vector<SharedPtr<BaseExpression>> function_arguments;
-            function_arguments.reserve(2);
-            function_arguments.emplace_back(expr_ptr->left_);
-            SharedPtr<BaseExpression> right_expr = CastExpression::AddCastToType(right_column, expr_ptr->left_->Type());
-            function_arguments.emplace_back(right_expr);
-
-            Catalog *catalog = query_context->storage()->catalog();
-            SharedPtr<FunctionSet> function_set_ptr = Catalog::GetFunctionSetByName(catalog, "first");
-
-            if (expr_ptr->subquery_type_ == SubqueryType::kIn) {
-                function_set_ptr = Catalog::GetFunctionSetByName(catalog, "=");
-            } else {
-                function_set_ptr = Catalog::GetFunctionSetByName(catalog, "<>");
-            }
-            auto scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(function_set_ptr);
-            ScalarFunction equi_function = scalar_function_set_ptr->GetMostMatchFunction(function_arguments);
-
-            SharedPtr<FunctionExpression> function_expr_ptr = MakeShared<FunctionExpression>(equi_function, function_arguments);
+            // 1. Generate condition expression on the left expression and the first column of the subquery
+            SharedPtr<BaseExpression> function_expr_ptr = MakeInCondition(expr_ptr, subquery_plan, query_context);
 
             Vector<SharedPtr<BaseExpression>> conditions;
             conditions.emplace_back(function_expr_ptr);
 
-            // 3. Generate mark join
+            // 2. Generate mark join
             u64 logical_node_id = bind_context->GetNewLogicalNodeId();
             String alias = fmt::format("logical_join{}", logical_node_id);
             SharedPtr<LogicalJoin> join_node = MakeShared<LogicalJoin>(logical_node_id, JoinType::kMark, alias, conditions, root, subquery_plan);
             join_node->mark_index_ = bind_context->GenerateTableIndex();
             root = join_node;
 
-            // 4. Generate output expression
+            // 3. Generate output expression
             SharedPtr<ColumnExpression> result =
                 ColumnExpression::Make(expr_ptr->Type(), function_expr_ptr->Name(), join_node->mark_index_, "0", 0, 0);
 
@@ -223,6 +197,54 @@ SharedPtr<BaseExpression> SubqueryUnnest::UnnestUncorrelated(SubqueryExpression
     return nullptr;
 }
 
+void SubqueryUnnest::UnnestUncorrelatedInAsSemiJoin(SubqueryExpression *expr_ptr,
+                                                    SharedPtr<LogicalNode> &root,
+                                                    SharedPtr<LogicalNode> &subquery_plan,
+                                                    QueryContext *query_context,
+                                                    const SharedPtr<BindContext> &bind_context) {
+    if (expr_ptr->subquery_type_ != SubqueryType::kIn) {
+        String error_message = "Only IN subquery can be planned as semi join.";
+        UnrecoverableError(error_message);
+    }
+    Vector<SharedPtr<BaseExpression>> conditions;
+    conditions.emplace_back(MakeInCondition(expr_ptr, subquery_plan, query_context));
+
+    u64 logical_node_id = bind_context->GetNewLogicalNodeId();
+    String alias = fmt::format("logical_join{}", logical_node_id);
+    root = MakeShared<LogicalJoin>(logical_node_id, JoinType::kSemi, alias, conditions, root, subquery_plan);
+}
+
+SharedPtr<BaseExpression>
+SubqueryUnnest::MakeInCondition(SubqueryExpression *expr_ptr, SharedPtr<LogicalNode> &subquery_plan, QueryContext *query_context) {
+    // 1. Generate right column expression
+    ColumnBinding right_column_binding = subquery_plan->GetColumnBindings()[0];
+    SharedPtr<ColumnExpression> right_column = ColumnExpression::Make(expr_ptr->left_->Type(),
+                                                                      subquery_plan->name(),
+                                                                      right_column_binding.table_idx,
+                                                                      "0",
+                                                                      right_column_binding.column_idx,
+                                                                      0);
+
+    // 2. Generate condition expression;
+    Vector<SharedPtr<BaseExpression>> function_arguments;
+    function_arguments.reserve(2);
+    function_arguments.emplace_back(expr_ptr->left_);
+    SharedPtr<BaseExpression> right_expr = CastExpression::AddCastToType(right_column, expr_ptr->left_->Type());
+    function_arguments.emplace_back(right_expr);
+
+    Catalog *catalog = query_context->storage()->catalog();
+    SharedPtr<FunctionSet> function_set_ptr;
+    if (expr_ptr->subquery_type_ == SubqueryType::kIn) {
+        function_set_ptr = Catalog::GetFunctionSetByName(catalog, "=");
+    } else {
+        function_set_ptr = Catalog::GetFunctionSetByName(catalog, "<>");
+    }
+    auto scalar_function_set_ptr = static_pointer_cast<ScalarFunctionSet>(function_set_ptr);
+    ScalarFunction equi_function = scalar_function_set_ptr->GetMostMatchFunction(function_arguments);
+
+    return MakeShared<FunctionExpression>(equi_function, function_arguments);
+}
+
 SharedPtr<BaseExpression> SubqueryUnnest::UnnestCorrelated(SubqueryExpression *expr_ptr,
                                                            SharedPtr<LogicalNode> &root,
                                                            SharedPtr<LogicalNode> &subquery_plan,
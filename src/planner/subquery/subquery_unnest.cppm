@@ -46,6 +46,13 @@ public:
                                                         QueryContext *query_context,
                                                         const SharedPtr<BindContext> &bind_context);
 
+    // Plan a top level `IN (subquery)` filter as a semi join of root with the subquery, which keeps the rows of root with a match.
+    static void UnnestUncorrelatedInAsSemiJoin(SubqueryExpression *expr_ptr,
+                                               SharedPtr<LogicalNode> &root,
+                                               SharedPtr<LogicalNode> &subquery_plan,
+                                               QueryContext *query_context,
+                                               const SharedPtr<BindContext> &bind_context);
+
     static SharedPtr<BaseExpression> UnnestCorrelated(SubqueryExpression *expr_ptr,
                                                       SharedPtr<LogicalNode> &root,
                                                       SharedPtr<LogicalNode> &subquery_plan,
@@ -53,6 +60,9 @@ public:
                                                       const SharedPtr<BindContext> &bind_context);
 
 private:
+    // `left = first column of the subquery` for IN, `left <> first column of the subquery` for NOT IN.
+    static SharedPtr<BaseExpression> MakeInCondition(SubqueryExpression *expr_ptr, SharedPtr<LogicalNode> &subquery_plan, QueryContext *query_context);
+
     static void GenerateJoinConditions(QueryContext *query_context,
                                        Vector<SharedPtr<BaseExpression>> &conditions,
                                        const Vector<SharedPtr<ColumnExpression>> &correlated_columns,
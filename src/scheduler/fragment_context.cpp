@@ -47,6 +47,7 @@ import physical_compact;
 import physical_compact_index_prepare;
 import physical_compact_index_do;
 import physical_compact_finish;
+import physical_hash_join;
 
 import global_block_id;
 import knn_expression;
@@ -355,6 +356,9 @@ MakeTaskState(SizeT operator_id, const Vector<PhysicalOperator *> &physical_ops,
         case PhysicalOperatorType::kMergeHash: {
             return MakeTaskStateTemplate<MergeHashOperatorState>(physical_ops[operator_id]);
         }
+        case PhysicalOperatorType::kJoinHash: {
+            return MakeTaskStateTemplate<HashJoinOperatorState>(physical_ops[operator_id]);
+        }
         case PhysicalOperatorType::kLimit: {
             return MakeTaskStateTemplate<LimitOperatorState>(physical_ops[operator_id]);
         }
@@ -596,6 +600,25 @@ void FragmentContext::BuildTask(QueryContext *query_context, FragmentContext *pa
                                 next_fragment_source_state->SetTaskNum(fragment_context->plan_fragment_ptr_->FragmentID(), real_parallel_size);
                                 queue_sink_state->fragment_data_queues_.emplace_back(&next_fragment_source_state->source_queue_);
                             }
+                            if (operator_state->operator_type_ == PhysicalOperatorType::kParallelAggregate) {
+                                // One partition of the partial aggregate result per merge task
+                                auto *parallel_aggregate_state = static_cast<ParallelAggregateOperatorState *>(operator_state.get());
+                                parallel_aggregate_state->partition_count_ = queue_sink_state->fragment_data_queues_.size();
+                            }
+                            if (operator_state->operator_type_ == PhysicalOperatorType::kHash) {
+                                // One partition of the hashed input per join task
+                                auto *hash_state = static_cast<HashOperatorState *>(operator_state.get());
+                                hash_state->partition_count_ = queue_sink_state->fragment_data_queues_.size();
+
+                                PhysicalOperator *parent_operator = parent_context->GetOperators().back();
+                                if (parent_operator->operator_type() == PhysicalOperatorType::kJoinHash &&
+                                    static_cast<PhysicalHashJoin *>(parent_operator)->build_side() == fragment_operators[0]) {
+                                    for (const auto &next_fragment_task : parent_context->Tasks()) {
+                                        auto *hash_join_state = static_cast<HashJoinOperatorState *>(next_fragment_task->operator_states_.back().get());
+                                        hash_join_state->build_fragment_id_ = fragment_context->plan_fragment_ptr_->FragmentID();
+                                    }
+                                }
+                            }
                             break;
                         }
                         case SinkStateType::kInvalid: {
@@ -886,6 +909,23 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
             tasks_[0]->source_state_ = MakeUnique<QueueSourceState>();
             break;
         }
+        case PhysicalOperatorType::kMergeParallelAggregate:
+        case PhysicalOperatorType::kJoinHash: {
+            if (fragment_type_ != FragmentType::kParallelMaterialize && fragment_type_ != FragmentType::kSerialMaterialize) {
+                UnrecoverableError(
+                    fmt::format("{} should in parallel/serial materialized fragment", PhysicalOperatorToString(first_operator->operator_type())));
+            }
+
+            if ((i64)tasks_.size() != parallel_count) {
+                String error_message = fmt::format("{} task count isn't correct.", PhysicalOperatorToString(first_operator->operator_type()));
+                UnrecoverableError(error_message);
+            }
+
+            for (i64 task_id = 0; task_id < parallel_count; ++task_id) {
+                tasks_[task_id]->source_state_ = MakeUnique<QueueSourceState>();
+            }
+            break;
+        }
         case PhysicalOperatorType::kCompact: {
             if (fragment_type_ != FragmentType::kParallelMaterialize) {
                 UnrecoverableError(
@@ -913,7 +953,6 @@ void FragmentContext::MakeSourceState(i64 parallel_count) {
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
         case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
@@ -1070,10 +1109,10 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
-        case PhysicalOperatorType::kParallelAggregate:
-        case PhysicalOperatorType::kHash: {
-            if (fragment_type_ != FragmentType::kParallelStream) {
-                String error_message = fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type()));
+        case PhysicalOperatorType::kParallelAggregate: {
+            if (fragment_type_ != FragmentType::kParallelMaterialize) {
+                String error_message =
+                    fmt::format("{} should in parallel materialized fragment", PhysicalOperatorToString(last_operator->operator_type()));
                 UnrecoverableError(error_message);
             }
 
@@ -1083,17 +1122,33 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
 
             for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
-                auto sink_state = MakeUnique<MaterializeSinkState>(plan_fragment_ptr_->FragmentID(), task_id);
-                sink_state->column_types_ = last_operator->GetOutputTypes();
-                sink_state->column_names_ = last_operator->GetOutputNames();
+                tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(plan_fragment_ptr_->FragmentID(), task_id);
+            }
+            break;
+        }
+        case PhysicalOperatorType::kHash: {
+            if (fragment_type_ == FragmentType::kSerialMaterialize) {
+                String error_message =
+                    fmt::format("{} should in parallel materialized/stream fragment", PhysicalOperatorToString(last_operator->operator_type()));
+                UnrecoverableError(error_message);
+            }
 
-                tasks_[task_id]->sink_state_ = std::move(sink_state);
+            if ((i64)tasks_.size() != parallel_count) {
+                String error_message = fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type()));
+                UnrecoverableError(error_message);
+            }
+
+            // The partitions of the hashed input are sent to the tasks of the hash join fragment.
+            for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(plan_fragment_ptr_->FragmentID(), task_id);
             }
             break;
         }
         case PhysicalOperatorType::kLimit: {
-            if (fragment_type_ != FragmentType::kParallelStream) {
-                String error_message = fmt::format("{} should in parallel stream fragment", PhysicalOperatorToString(last_operator->operator_type()));
+            // A limit over the merge stage of the parallel aggregate runs in its parallel materialized fragment
+            if (fragment_type_ == FragmentType::kSerialMaterialize) {
+                String error_message =
+                    fmt::format("{} should in parallel materialized/stream fragment", PhysicalOperatorToString(last_operator->operator_type()));
                 UnrecoverableError(error_message);
             }
 
@@ -1109,7 +1164,22 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
             }
             break;
         }
-        case PhysicalOperatorType::kMergeParallelAggregate:
+        case PhysicalOperatorType::kMergeParallelAggregate: {
+            if (fragment_type_ != FragmentType::kParallelMaterialize && fragment_type_ != FragmentType::kSerialMaterialize) {
+                UnrecoverableError(
+                    fmt::format("{} should in parallel/serial materialized fragment", PhysicalOperatorToString(last_operator->operator_type())));
+            }
+
+            if ((i64)tasks_.size() != parallel_count) {
+                String error_message = fmt::format("{} task count isn't correct.", PhysicalOperatorToString(last_operator->operator_type()));
+                UnrecoverableError(error_message);
+            }
+
+            for (u64 task_id = 0; (i64)task_id < parallel_count; ++task_id) {
+                tasks_[task_id]->sink_state_ = MakeUnique<QueueSinkState>(plan_fragment_ptr_->FragmentID(), task_id);
+            }
+            break;
+        }
         case PhysicalOperatorType::kMergeAggregate:
         case PhysicalOperatorType::kMergeHash:
         case PhysicalOperatorType::kMergeLimit:
@@ -1178,7 +1248,8 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
         }
         case PhysicalOperatorType::kTableScan:
         case PhysicalOperatorType::kFilter:
-        case PhysicalOperatorType::kIndexScan: {
+        case PhysicalOperatorType::kIndexScan:
+        case PhysicalOperatorType::kJoinHash: {
             if (fragment_type_ == FragmentType::kSerialMaterialize) {
                 UnrecoverableError(
                     fmt::format("{} should in parallel materialized/stream fragment", PhysicalOperatorToString(last_operator->operator_type())));
@@ -1227,7 +1298,6 @@ void FragmentContext::MakeSinkState(i64 parallel_count) {
         case PhysicalOperatorType::kIntersect:
         case PhysicalOperatorType::kExcept:
         case PhysicalOperatorType::kDummyScan:
-        case PhysicalOperatorType::kJoinHash:
         case PhysicalOperatorType::kJoinNestedLoop:
         case PhysicalOperatorType::kJoinMerge:
         case PhysicalOperatorType::kJoinIndex:
@@ -1322,7 +1392,9 @@ void FragmentContext::CreateTasks(i64 cpu_count, i64 operator_count, FragmentCon
         case PhysicalOperatorType::kTableScan:
         case PhysicalOperatorType::kMatchTensorScan:
         case PhysicalOperatorType::kMatchSparseScan:
-        case PhysicalOperatorType::kIndexScan: {
+        case PhysicalOperatorType::kIndexScan:
+        case PhysicalOperatorType::kJoinHash:
+        case PhysicalOperatorType::kMergeParallelAggregate: {
             parallel_count = std::min(parallel_count, (i64)(first_operator->TaskletCount()));
             if (parallel_count == 0) {
                 parallel_count = 1;
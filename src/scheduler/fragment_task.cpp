@@ -28,6 +28,7 @@ import physical_sink;
 import physical_operator;
 import infinity_exception;
 import operator_state;
+import data_block;
 import physical_operator_type;
 import query_context;
 import base_table_ref;
@@ -88,6 +89,12 @@ void FragmentTask::OnExecute() {
                     operator_status = operator_states_[op_idx]->status_;
                     break;
                 }
+                // Gather the selected rows once, right before the first operator (or the sink) that can't work on a selection.
+                if (op_idx == 0 || !operator_refs[op_idx - 1]->AcceptsSelection()) {
+                    for (auto &data_block : operator_states_[op_idx]->data_block_array_) {
+                        data_block->MaterializeSelection();
+                    }
+                }
                 if (!execute_success) {
                     break;
                 }
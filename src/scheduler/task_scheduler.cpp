@@ -14,7 +14,6 @@
 
 module;
 
-#include <list>
 #include <sched.h>
 
 module task_scheduler;
@@ -42,7 +41,7 @@ import global_resource_usage;
 
 namespace infinity {
 
-Worker::Worker(u64 cpu_id, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<Thread> thread)
+Worker::Worker(u64 cpu_id, UniquePtr<FragmentTaskQueue> queue, UniquePtr<Thread> thread)
     : cpu_id_(cpu_id), queue_(std::move(queue)), thread_(std::move(thread)) {}
 
 // Non-static memory methods
@@ -77,16 +76,19 @@ void TaskScheduler::Init(Config *config_ptr) {
         cpu_id_vec.push_back(cpu_id);
     }
 
+    // All queues must exist before any worker starts stealing from them.
     for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
         const u64 cpu_id = cpu_id_vec[worker_id];
-        UniquePtr<FragmentTaskBlockQueue> worker_queue = MakeUnique<FragmentTaskBlockQueue>("TaskScheduler");
-        UniquePtr<Thread> worker_thread = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_queue.get(), worker_id);
-        // Pin the thread to specific cpu
-        ThreadUtil::pin(*worker_thread, cpu_id);
-
-        worker_array_.emplace_back(cpu_id, std::move(worker_queue), std::move(worker_thread));
+        worker_array_.emplace_back(cpu_id, MakeUnique<FragmentTaskQueue>(), nullptr);
         worker_workloads_[worker_id] = 0;
     }
+    terminate_ = false;
+    for (u64 worker_id = 0; worker_id < worker_count_; ++worker_id) {
+        Worker &worker = worker_array_[worker_id];
+        worker.thread_ = MakeUnique<Thread>(&TaskScheduler::WorkerLoop, this, worker_id);
+        // Pin the thread to specific cpu
+        ThreadUtil::pin(*worker.thread_, worker.cpu_id_);
+    }
 
     if (worker_array_.empty()) {
         String error_message = "No cpu is used in scheduler";
@@ -98,10 +100,13 @@ void TaskScheduler::Init(Config *config_ptr) {
 
 void TaskScheduler::UnInit() {
     initialized_ = false;
-    UniquePtr<FragmentTask> terminate_task = MakeUnique<FragmentTask>(true);
+    {
+        std::lock_guard<std::mutex> lock(idle_mutex_);
+        terminate_ = true;
+    }
+    idle_cv_.notify_all();
 
     for (const auto &worker : worker_array_) {
-        worker.queue_->Enqueue(terminate_task.get());
         worker.thread_->join();
     }
 }
@@ -220,32 +225,46 @@ void TaskScheduler::ScheduleFragment(PlanFragment *plan_fragment) {
 }
 
 void TaskScheduler::ScheduleTask(FragmentTask *task, u64 worker_id) {
+    // `worker_id` is only the preferred worker, any idle worker may steal the task.
     ++worker_workloads_[worker_id];
-    worker_array_[worker_id].queue_->Enqueue(task);
+    worker_array_[worker_id].queue_->enqueue(task);
+    ++queued_task_count_;
+    {
+        // Pair with the predicate check of the idle workers so that the notification isn't lost.
+        std::lock_guard<std::mutex> lock(idle_mutex_);
+    }
+    idle_cv_.notify_one();
 }
 
-void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id) {
-    List<FragmentTask *> task_lists;
-    auto iter = task_lists.end();
-    auto last_iter = task_lists.end();
-    while (true) {
-        if (iter == last_iter) {
-            Vector<FragmentTask *> dequeue_output;
-            if (task_lists.empty()) {
-                task_queue->DequeueBulk(dequeue_output);
-            } else {
-                task_queue->TryDequeueBulk(dequeue_output);
-            }
-            if (!dequeue_output.empty()) {
-                task_lists.insert(task_lists.end(), dequeue_output.begin(), dequeue_output.end());
+FragmentTask *TaskScheduler::NextTask(u64 worker_id) {
+    FragmentTask *task = nullptr;
+    for (u64 i = 0; i < worker_count_; ++i) {
+        u64 victim_id = (worker_id + i) % worker_count_;
+        if (worker_array_[victim_id].queue_->try_dequeue(task)) {
+            --queued_task_count_;
+            if (victim_id != worker_id) {
+                --worker_workloads_[victim_id];
+                ++worker_workloads_[worker_id];
             }
-            last_iter = task_lists.end();
+            return task;
         }
-        if (iter == task_lists.end()) {
-            iter = task_lists.begin();
+    }
+    return nullptr;
+}
+
+void TaskScheduler::WorkerLoop(i64 worker_id) {
+    FragmentTaskQueue *task_queue = worker_array_[worker_id].queue_.get();
+    while (true) {
+        FragmentTask *fragment_task = NextTask(worker_id);
+        if (fragment_task == nullptr) {
+            std::unique_lock<std::mutex> lock(idle_mutex_);
+            idle_cv_.wait(lock, [this] { return queued_task_count_ > 0 || terminate_; });
+            if (terminate_) {
+                break;
+            }
+            continue;
         }
-        auto *fragment_task = *iter;
-        if (fragment_task->IsTerminator()) {
+        if (terminate_) {
             break;
         }
         auto *fragment_ctx = fragment_task->fragment_context();
@@ -265,19 +284,18 @@ void TaskScheduler::WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id
             if (fragment_task->IsComplete()) {
                 --worker_workloads_[worker_id];
                 fragment_task->CompleteTask();
-                iter = task_lists.erase(iter);
                 finish = true;
             } else if (fragment_task->QuitFromWorkerLoop()) {
                 --worker_workloads_[worker_id];
-                iter = task_lists.erase(iter);
             } else {
-                ++iter;
+                // Put the task back to the tail of the own queue, so that tasks of the worker are executed in turn.
+                task_queue->enqueue(fragment_task);
+                ++queued_task_count_;
             }
         } else {
             --worker_workloads_[worker_id];
             fragment_ctx->notifier()->SetError(fragment_ctx);
             fragment_task->CompleteTask();
-            iter = task_lists.erase(iter);
         }
         if (finish || error) {
             fragment_ctx->notifier()->FinishTask();
@@ -19,20 +19,21 @@ export module task_scheduler;
 import config;
 import stl;
 import fragment_task;
-import blocking_queue;
 import base_statement;
+import third_party;
 
 namespace infinity {
 
 class QueryContext;
 class PlanFragment;
 
-using FragmentTaskBlockQueue = BlockingQueue<FragmentTask *>;
+// Lock-free MPMC queue, the owner worker dequeues from it first and idle workers steal from it.
+using FragmentTaskQueue = ConcurrentQueue<FragmentTask *>;
 
 struct Worker {
-    Worker(u64 cpu_id, UniquePtr<FragmentTaskBlockQueue> queue, UniquePtr<Thread> thread);
+    Worker(u64 cpu_id, UniquePtr<FragmentTaskQueue> queue, UniquePtr<Thread> thread);
     u64 cpu_id_{0};
-    UniquePtr<FragmentTaskBlockQueue> queue_{};
+    UniquePtr<FragmentTaskQueue> queue_{};
     UniquePtr<Thread> thread_{};
 };
 
@@ -54,6 +55,8 @@ public:
 
     void DumpPlanFragment(PlanFragment *plan_fragment);
 
+    inline u64 worker_count() const { return worker_count_; }
+
 private:
     u64 FindLeastWorkloadWorker();
 
@@ -61,14 +64,24 @@ private:
 
     void RunTask(FragmentTask *task);
 
-    void WorkerLoop(FragmentTaskBlockQueue *task_queue, i64 worker_id);
+    // Dequeue from the own queue of `worker_id` first, then steal from the other workers.
+    FragmentTask *NextTask(u64 worker_id);
+
+    void WorkerLoop(i64 worker_id);
 
 private:
     bool initialized_{false};
 
     Vector<Worker> worker_array_{};
+    // Tasks queued on or running by each worker
     Deque<Atomic<u64>> worker_workloads_{};
 
+    // Tasks queued on all workers, idle workers sleep until it's positive
+    Atomic<u64> queued_task_count_{0};
+    Atomic<bool> terminate_{false};
+    std::mutex idle_mutex_{};
+    std::condition_variable idle_cv_{};
+
     u64 worker_count_{0};
 };
 
@@ -30,70 +30,95 @@ import var_file_worker;
 import persistence_manager;
 import virtual_store;
 import global_resource_usage;
+import default_values;
 
 namespace infinity {
 
-void LRUCache::RemoveClean(const Vector<BufferObj *> &buffer_obj) {
+String BufferLoadStatsToString(const BufferLoadStats &stats) {
+    u64 avg_load_time_us = stats.load_count_ == 0 ? 0 : stats.total_load_time_us_ / stats.load_count_;
+    return fmt::format("loads: {}, avg load latency: {}us, max load latency: {}us, prefetches: {}, prefetch hits: {}",
+                       stats.load_count_,
+                       avg_load_time_us,
+                       stats.max_load_time_us_,
+                       stats.prefetch_count_,
+                       stats.prefetch_hit_count_);
+}
+
+void ClockCache::Add(BufferObj *buffer_obj) {
     std::unique_lock lock(locker_);
-    for (auto *buffer_obj : buffer_obj) {
-        if (auto iter = gc_map_.find(buffer_obj); iter != gc_map_.end()) {
-            gc_list_.erase(iter->second);
-            gc_map_.erase(iter);
-        }
+    auto [iter, insert_ok] = ring_idx_.emplace(buffer_obj, ring_.size());
+    if (!insert_ok) {
+        String error_message = fmt::format("ClockCache::Add: buffer {} is already in the clock.", buffer_obj->GetFilename());
+        UnrecoverableError(error_message);
+    }
+    ring_.push_back(buffer_obj);
+}
+
+bool ClockCache::Remove(BufferObj *buffer_obj) {
+    std::unique_lock lock(locker_);
+    auto iter = ring_idx_.find(buffer_obj);
+    if (iter == ring_idx_.end()) {
+        return false;
     }
+    RemoveAt(iter->second);
+    return true;
 }
 
-SizeT LRUCache::WaitingGCObjectCount() {
+void ClockCache::RemoveClean(const Vector<BufferObj *> &buffer_obj) {
     std::unique_lock lock(locker_);
-    return gc_map_.size();
+    for (auto *buffer_obj : buffer_obj) {
+        if (auto iter = ring_idx_.find(buffer_obj); iter != ring_idx_.end()) {
+            RemoveAt(iter->second);
+        }
+    }
 }
 
-SizeT LRUCache::RequestSpace(SizeT need_space) {
+SizeT ClockCache::RequestSpace(SizeT need_space) {
     SizeT free_space = 0;
     std::unique_lock lock(locker_);
-    auto iter = gc_list_.begin();
-    while (free_space < need_space && iter != gc_list_.end()) {
-        auto *buffer_obj = *iter;
-        // Free return false when the buffer is freed by cleanup
+    // Two rounds at most: the first clears the reference bits, the second frees the objects still unreferenced
+    SizeT step_n = 2 * ring_.size();
+    while (free_space < need_space && !ring_.empty() && step_n > 0) {
+        --step_n;
+        if (hand_ >= ring_.size()) {
+            hand_ = 0;
+        }
+        auto *buffer_obj = ring_[hand_];
+        if (buffer_obj->ClearReferenced()) {
+            ++hand_;
+            continue;
+        }
+        // Free return false when the buffer is loaded or freed by cleanup
         // will not dead lock because caller is in kNew or kFree state, and `buffer_obj` is in kUnloaded or state
         if (buffer_obj->Free()) {
             free_space += buffer_obj->GetBufferSize();
-            iter = gc_list_.erase(iter);
-            gc_map_.erase(buffer_obj);
+            --unloaded_count_;
+            // the last object is moved to the hand, and is checked next
+            RemoveAt(hand_);
         } else {
-            ++iter;
+            ++hand_;
         }
     }
     return free_space;
 }
 
-void LRUCache::PushGCQueue(BufferObj *buffer_obj) {
-    std::unique_lock lock(locker_);
-    auto iter = gc_map_.find(buffer_obj);
-    if (iter != gc_map_.end()) {
-        gc_list_.erase(iter->second);
-    }
-    gc_list_.push_back(buffer_obj);
-    gc_map_[buffer_obj] = --gc_list_.end();
-}
-
-bool LRUCache::RemoveFromGCQueue(BufferObj *buffer_obj) {
-    std::unique_lock lock(locker_);
-    if (auto iter = gc_map_.find(buffer_obj); iter != gc_map_.end()) {
-        gc_list_.erase(iter->second);
-        gc_map_.erase(iter);
-        return true;
+void ClockCache::RemoveAt(SizeT idx) {
+    ring_idx_.erase(ring_[idx]);
+    if (idx + 1 != ring_.size()) {
+        ring_[idx] = ring_.back();
+        ring_idx_[ring_[idx]] = idx;
     }
-    return false;
+    ring_.pop_back();
 }
 
 BufferManager::BufferManager(u64 memory_limit,
                              SharedPtr<String> data_dir,
                              SharedPtr<String> temp_dir,
                              PersistenceManager *persistence_manager,
-                             SizeT lru_count)
+                             SizeT lru_count,
+                             SizeT map_shard_count)
     : data_dir_(std::move(data_dir)), temp_dir_(std::move(temp_dir)), memory_limit_(memory_limit), persistence_manager_(persistence_manager),
-      current_memory_size_(0), lru_caches_(lru_count) {
+      current_memory_size_(0), map_shards_(map_shard_count), id_shards_(map_shard_count), clock_caches_(lru_count), prefetch_pool_(MakeUnique<ThreadPool>(DEFAULT_BUFFER_PREFETCH_THREAD_NUM)) {
 #ifdef INFINITY_DEBUG
     GlobalResourceUsage::IncrObjectCount("BufferManager");
 #endif
@@ -113,31 +138,38 @@ void BufferManager::Start() {
     VirtualStore::CleanupDirectory(*temp_dir_);
 }
 
-void BufferManager::Stop() { RemoveClean(); }
+void BufferManager::Stop() {
+    prefetch_pool_->stop(true);
+    RemoveClean();
+}
 
 BufferObj *BufferManager::AllocateBufferObject(UniquePtr<FileWorker> file_worker) {
     String file_path = file_worker->GetFilePath();
     auto buffer_obj = MakeBufferObj(std::move(file_worker), true);
 
-    BufferObj *res = buffer_obj.get();
-    {
-        std::unique_lock lock(w_locker_);
-        if (auto iter = buffer_map_.find(file_path); iter != buffer_map_.end()) {
-            String error_message = fmt::format("BufferManager::Allocate: file {} already exists.", file_path.c_str());
-            UnrecoverableError(error_message);
-        }
-        buffer_map_.emplace(file_path, std::move(buffer_obj));
+    BufferMapShard &shard = PathShard(file_path);
+    std::unique_lock lock(shard.locker_);
+    if (auto iter = shard.buffer_map_.find(file_path); iter != shard.buffer_map_.end()) {
+        String error_message = fmt::format("BufferManager::Allocate: file {} already exists.", file_path.c_str());
+        UnrecoverableError(error_message);
     }
-
-    return res;
+    return InsertBufferObj(shard, std::move(file_path), std::move(buffer_obj));
 }
 
 BufferObj *BufferManager::GetBufferObject(UniquePtr<FileWorker> file_worker, bool restart) {
     String file_path = file_worker->GetFilePath();
     // LOG_TRACE(fmt::format("Get buffer object: {}", file_path));
 
-    std::unique_lock lock(w_locker_);
-    if (auto iter1 = buffer_map_.find(file_path); iter1 != buffer_map_.end()) {
+    BufferMapShard &shard = PathShard(file_path);
+    if (!restart) {
+        std::shared_lock lock(shard.locker_);
+        if (auto iter = shard.buffer_map_.find(file_path); iter != shard.buffer_map_.end()) {
+            return iter->second.get();
+        }
+    }
+
+    std::unique_lock lock(shard.locker_);
+    if (auto iter1 = shard.buffer_map_.find(file_path); iter1 != shard.buffer_map_.end()) {
         BufferObj *buffer_obj = iter1->second.get();
         if (restart) {
             buffer_obj->UpdateFileWorkerInfo(std::move(file_worker));
@@ -146,24 +178,33 @@ BufferObj *BufferManager::GetBufferObject(UniquePtr<FileWorker> file_worker, boo
     }
 
     auto buffer_obj = MakeBufferObj(std::move(file_worker), false);
+    return InsertBufferObj(shard, std::move(file_path), std::move(buffer_obj));
+}
 
-    BufferObj *res = buffer_obj.get();
-    buffer_map_.emplace(std::move(file_path), std::move(buffer_obj));
-
-    return res;
+BufferObj *BufferManager::GetBufferObjectById(u32 buffer_id) {
+    BufferIdShard &shard = IdShard(buffer_id);
+    std::shared_lock lock(shard.locker_);
+    if (auto iter = shard.id_map_.find(buffer_id); iter != shard.id_map_.end()) {
+        return iter->second;
+    }
+    return nullptr;
 }
 
 Vector<SizeT> BufferManager::WaitingGCObjectCount() {
-    Vector<SizeT> size_list(lru_caches_.size());
-    for (SizeT i = 0; i < lru_caches_.size(); ++i) {
-        size_list[i] = lru_caches_[i].WaitingGCObjectCount();
+    Vector<SizeT> size_list(clock_caches_.size());
+    for (SizeT i = 0; i < clock_caches_.size(); ++i) {
+        size_list[i] = clock_caches_[i].WaitingGCObjectCount();
     }
     return size_list;
 }
 
 SizeT BufferManager::BufferedObjectCount() {
-    std::unique_lock lock(w_locker_);
-    return buffer_map_.size();
+    SizeT count = 0;
+    for (auto &shard : map_shards_) {
+        std::shared_lock lock(shard.locker_);
+        count += shard.buffer_map_.size();
+    }
+    return count;
 }
 
 void BufferManager::RemoveClean() {
@@ -185,29 +226,67 @@ void BufferManager::RemoveClean() {
         buffer_obj->CleanupTempFile();
     }
 
-    for (auto &lru_cache : lru_caches_) {
-        lru_cache.RemoveClean(clean_list);
+    for (auto &clock_cache : clock_caches_) {
+        clock_cache.RemoveClean(clean_list);
     }
     {
-        std::unique_lock lock(w_locker_);
+        std::unique_lock prefetch_lock(prefetch_locker_);
         for (auto *buffer_obj : clean_list) {
             auto file_path = buffer_obj->GetFilename();
-            size_t remove_n = buffer_map_.erase(file_path);
+            BufferMapShard &shard = PathShard(file_path);
+            std::unique_lock lock(shard.locker_);
+            {
+                BufferIdShard &id_shard = IdShard(buffer_obj->id());
+                std::unique_lock id_lock(id_shard.locker_);
+                id_shard.id_map_.erase(buffer_obj->id());
+            }
+            size_t remove_n = shard.buffer_map_.erase(file_path);
             if (remove_n != 1) {
                 String error_message = fmt::format("BufferManager::RemoveClean: file {} not found.", file_path.c_str());
                 UnrecoverableError(error_message);
             }
         }
-        buffer_map_.rehash(buffer_map_.size());
+        if (!clean_list.empty()) {
+            for (auto &shard : map_shards_) {
+                std::unique_lock lock(shard.locker_);
+                shard.buffer_map_.rehash(shard.buffer_map_.size());
+            }
+        }
+    }
+}
+
+void BufferManager::Prefetch(BufferObj *buffer_obj) {
+    // The object may be cleaned up before the task runs, so the task looks it up again by id
+    prefetch_pool_->push([this, buffer_id = buffer_obj->id()](int id) {
+        std::shared_lock prefetch_lock(prefetch_locker_);
+        BufferObj *buffer_obj = GetBufferObjectById(buffer_id);
+        if (buffer_obj != nullptr && buffer_obj->Prefetch()) {
+            AddPrefetchCount();
+        }
+    });
+}
+
+BufferLoadStats BufferManager::GetLoadStats() const {
+    return BufferLoadStats{.load_count_ = load_count_,
+                           .total_load_time_us_ = total_load_time_us_,
+                           .max_load_time_us_ = max_load_time_us_,
+                           .prefetch_count_ = prefetch_count_,
+                           .prefetch_hit_count_ = prefetch_hit_count_};
+}
+
+void BufferManager::AddLoadTime(u64 load_time_us) {
+    ++load_count_;
+    total_load_time_us_ += load_time_us;
+    u64 max_load_time_us = max_load_time_us_;
+    while (load_time_us > max_load_time_us && !max_load_time_us_.compare_exchange_weak(max_load_time_us, load_time_us)) {
     }
 }
 
 Vector<BufferObjectInfo> BufferManager::GetBufferObjectsInfo() {
     Vector<BufferObjectInfo> result;
-    {
-        std::unique_lock lock(w_locker_);
-        result.reserve(buffer_map_.size());
-        for (const auto &buffer_pair : buffer_map_) {
+    for (auto &shard : map_shards_) {
+        std::shared_lock lock(shard.locker_);
+        for (const auto &buffer_pair : shard.buffer_map_) {
             BufferObjectInfo buffer_object_info;
             buffer_object_info.object_path_ = buffer_pair.first;
             BufferObj *buffer_object_ptr = buffer_pair.second.get();
@@ -222,39 +301,56 @@ Vector<BufferObjectInfo> BufferManager::GetBufferObjectsInfo() {
 }
 
 bool BufferManager::RequestSpace(SizeT need_size) {
+    // Reserve without the gc lock while the memory limit isn't reached
+    u64 cur_mem_size = current_memory_size_;
+    while (cur_mem_size + need_size <= memory_limit_) {
+        if (current_memory_size_.compare_exchange_weak(cur_mem_size, cur_mem_size + need_size)) {
+            return true;
+        }
+    }
+
     std::unique_lock lock(gc_locker_);
-    SizeT freed_space = 0;
     const SizeT free_space = memory_limit_ - current_memory_size_;
     if (free_space >= need_size) {
         [[maybe_unused]] auto cur_mem_size = current_memory_size_.fetch_add(need_size);
         return true;
     }
-    SizeT round_robin = round_robin_;
-    do {
-        freed_space += lru_caches_[round_robin_].RequestSpace(need_size);
-        round_robin_ = (round_robin_ + 1) % lru_caches_.size();
-    } while (freed_space + free_space < need_size && round_robin_ != round_robin);
+    SizeT freed_space = FreeSpace(need_size - free_space);
     bool free_success = freed_space + free_space >= need_size;
-    [[maybe_unused]] auto cur_mem_size = current_memory_size_.fetch_add(need_size - freed_space); // It's ok to add minus value
+    [[maybe_unused]] auto new_mem_size = current_memory_size_.fetch_add(need_size - freed_space); // It's ok to add minus value
     return free_success;
 }
 
-void BufferManager::PushGCQueue(BufferObj *buffer_obj) {
-    SizeT idx = LRUIdx(buffer_obj);
-    lru_caches_[idx].PushGCQueue(buffer_obj);
-
+void BufferManager::FreeOverLimit() {
+    if (memory_usage() <= memory_limit_) {
+        return;
+    }
+    std::unique_lock lock(gc_locker_);
+    // caller buffer obj has released its lock, and FreeSpace only try lock the objects, so no dead lock
     if (auto mem_usage = memory_usage(); mem_usage > memory_limit_) {
-        SizeT need_size = mem_usage - memory_limit_;
-        // caller buffer obj is in kLoad state, and RequestSpace will lock those in kNew or kFree state, so no dead lock
-        RequestSpace(need_size);
+        SizeT freed_space = FreeSpace(mem_usage - memory_limit_);
+        current_memory_size_.fetch_sub(freed_space);
     }
 }
 
-bool BufferManager::RemoveFromGCQueue(BufferObj *buffer_obj) {
-    SizeT idx = LRUIdx(buffer_obj);
-    return lru_caches_[idx].RemoveFromGCQueue(buffer_obj);
+SizeT BufferManager::FreeSpace(SizeT need_size) {
+    SizeT freed_space = 0;
+    SizeT round_robin = round_robin_;
+    do {
+        freed_space += clock_caches_[round_robin_].RequestSpace(need_size - freed_space);
+        round_robin_ = (round_robin_ + 1) % clock_caches_.size();
+    } while (freed_space < need_size && round_robin_ != round_robin);
+    return freed_space;
 }
 
+void BufferManager::AddToClock(BufferObj *buffer_obj) { clock_caches_[ClockIdx(buffer_obj)].Add(buffer_obj); }
+
+bool BufferManager::RemoveFromClock(BufferObj *buffer_obj) { return clock_caches_[ClockIdx(buffer_obj)].Remove(buffer_obj); }
+
+void BufferManager::AddWaitingGC(BufferObj *buffer_obj) { clock_caches_[ClockIdx(buffer_obj)].AddUnloaded(); }
+
+void BufferManager::SubWaitingGC(BufferObj *buffer_obj) { clock_caches_[ClockIdx(buffer_obj)].SubUnloaded(); }
+
 void BufferManager::AddToCleanList(BufferObj *buffer_obj, bool do_free) {
     {
         std::unique_lock lock(clean_locker_);
@@ -266,10 +362,11 @@ void BufferManager::AddToCleanList(BufferObj *buffer_obj, bool do_free) {
         if (memory_size < buffer_size) {
             UnrecoverableError(fmt::format("BufferManager::AddToCleanList: memory_size < buffer_size: {} < {}", memory_size, buffer_size));
         }
-        if (!RemoveFromGCQueue(buffer_obj)) {
-            String error_message = fmt::format("attempt to buffer: {} status is UNLOADED, but not in GC queue", buffer_obj->GetFilename());
+        if (!RemoveFromClock(buffer_obj)) {
+            String error_message = fmt::format("attempt to buffer: {} status is UNLOADED, but not in clock", buffer_obj->GetFilename());
             UnrecoverableError(error_message);
         }
+        SubWaitingGC(buffer_obj);
     }
 }
 
@@ -306,9 +403,20 @@ void BufferManager::MoveTemp(BufferObj *buffer_obj) {
     }
 }
 
-SizeT BufferManager::LRUIdx(BufferObj *buffer_obj) const {
+SizeT BufferManager::ClockIdx(BufferObj *buffer_obj) const {
     auto id = buffer_obj->id();
-    return id % lru_caches_.size();
+    return id % clock_caches_.size();
+}
+
+BufferObj *BufferManager::InsertBufferObj(BufferMapShard &path_shard, String file_path, UniquePtr<BufferObj> buffer_obj) {
+    BufferObj *res = buffer_obj.get();
+    {
+        BufferIdShard &id_shard = IdShard(res->id());
+        std::unique_lock id_lock(id_shard.locker_);
+        id_shard.id_map_.emplace(res->id(), res);
+    }
+    path_shard.buffer_map_.emplace(std::move(file_path), std::move(buffer_obj));
+    return res;
 }
 
 UniquePtr<BufferObj> BufferManager::MakeBufferObj(UniquePtr<FileWorker> file_worker, bool is_ephemeral) {
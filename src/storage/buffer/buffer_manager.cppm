@@ -27,23 +27,60 @@ namespace infinity {
 class BufferObj;
 class BufferObjectInfo;
 
-class LRUCache {
+// Loads of buffer objects from files
+export struct BufferLoadStats {
+    // loads on the request path, which stall the caller
+    u64 load_count_{};
+    u64 total_load_time_us_{};
+    u64 max_load_time_us_{};
+    // loads in background ahead of the request, and those requested before evicted
+    u64 prefetch_count_{};
+    u64 prefetch_hit_count_{};
+};
+
+export String BufferLoadStatsToString(const BufferLoadStats &stats);
+
+// CLOCK replacement over the memory resident buffer objects of one shard.
+// An object joins the ring when its memory is allocated and leaves it when the memory is freed, so Load and Unload of a
+// resident object only touch its reference bit and never take the shard lock.
+class ClockCache {
 public:
+    void Add(BufferObj *buffer_obj);
+
+    bool Remove(BufferObj *buffer_obj);
+
     void RemoveClean(const Vector<BufferObj *> &buffer_obj);
 
-    SizeT WaitingGCObjectCount();
+    SizeT WaitingGCObjectCount() const { return unloaded_count_; }
 
+    // Sweep the ring from the hand and free unloaded objects whose reference bit is clear, an object with the bit set
+    // gets a second chance. Return the freed size.
     SizeT RequestSpace(SizeT need_space);
 
-    void PushGCQueue(BufferObj *buffer_obj);
+    void AddUnloaded() { ++unloaded_count_; }
 
-    bool RemoveFromGCQueue(BufferObj *buffer_obj);
+    void SubUnloaded() { --unloaded_count_; }
 
 private:
+    void RemoveAt(SizeT idx);
+
     std::mutex locker_{};
-    using GCListIter = List<BufferObj *>::iterator;
-    HashMap<BufferObj *, GCListIter> gc_map_{};
-    List<BufferObj *> gc_list_{};
+    Vector<BufferObj *> ring_{};
+    HashMap<BufferObj *, SizeT> ring_idx_{};
+    SizeT hand_{};
+    Atomic<SizeT> unloaded_count_{};
+};
+
+// Buffer objects whose file path hashes to one shard. Lookups only take the lock shared.
+struct BufferMapShard {
+    std::shared_mutex locker_{};
+    HashMap<String, UniquePtr<BufferObj>> buffer_map_{};
+};
+
+// Index of the buffer objects by id, sharded by the id. The lock is taken after the lock of the path shard.
+struct BufferIdShard {
+    std::shared_mutex locker_{};
+    HashMap<u32, BufferObj *> id_map_{};
 };
 
 export class BufferManager {
@@ -52,7 +89,8 @@ public:
                            SharedPtr<String> data_dir,
                            SharedPtr<String> temp_dir,
                            PersistenceManager *persistence_manager,
-                           SizeT lru_count = DEFAULT_BUFFER_MANAGER_LRU_COUNT);
+                           SizeT lru_count = DEFAULT_BUFFER_MANAGER_LRU_COUNT,
+                           SizeT map_shard_count = DEFAULT_BUFFER_MANAGER_MAP_SHARD_COUNT);
 
     ~BufferManager();
 
@@ -66,6 +104,9 @@ public:
     // Get an existing BufferHandle from memory or disk.
     BufferObj *GetBufferObject(UniquePtr<FileWorker> file_worker, bool restart = false);
 
+    // Get an existing buffer object by its id, return nullptr if it's cleaned up.
+    BufferObj *GetBufferObjectById(u32 buffer_id);
+
     SharedPtr<String> GetFullDataDir() const { return data_dir_; }
 
     SharedPtr<String> GetTempDir() const { return temp_dir_; }
@@ -92,6 +133,12 @@ public:
     inline u64 TotalRequestCount() { return total_request_count_; }
     inline u64 CacheMissCount() { return cache_miss_count_; }
 
+    // Load the buffer object from file in background if it isn't in memory, so that a later Load doesn't wait for the read.
+    // The object stays unloaded after prefetch and may be evicted as any other unloaded object.
+    void Prefetch(BufferObj *buffer_obj);
+
+    BufferLoadStats GetLoadStats() const;
+
 private:
     friend class BufferObj;
 
@@ -99,20 +146,43 @@ private:
     // Return whether need_size is freed successfully.
     bool RequestSpace(SizeT need_size);
 
-    // BufferHandle calls it, after unload.
-    void PushGCQueue(BufferObj *buffer_obj);
+    // BufferObj calls it, after unload. Free the unloaded objects if the memory usage exceeds the limit.
+    void FreeOverLimit();
+
+    // Sweep the clock of each shard in round robin until need_size is freed, gc_locker_ must be held.
+    SizeT FreeSpace(SizeT need_size);
+
+    // BufferObj calls them when its memory is allocated or freed.
+    void AddToClock(BufferObj *buffer_obj);
+
+    bool RemoveFromClock(BufferObj *buffer_obj);
 
-    bool RemoveFromGCQueue(BufferObj *buffer_obj);
+    // BufferObj calls them when it becomes unloaded or leaves the unloaded status.
+    void AddWaitingGC(BufferObj *buffer_obj);
+
+    void SubWaitingGC(BufferObj *buffer_obj);
 
     void AddToCleanList(BufferObj *buffer_obj, bool do_free);
 
+    void AddLoadTime(u64 load_time_us);
+
+    inline void AddPrefetchCount() { ++prefetch_count_; }
+    inline void AddPrefetchHitCount() { ++prefetch_hit_count_; }
+
     void AddTemp(BufferObj *buffer_obj);
 
     void RemoveTemp(BufferObj *buffer_obj);
 
     void MoveTemp(BufferObj *buffer_obj);
 
-    SizeT LRUIdx(BufferObj *buffer_obj) const;
+    SizeT ClockIdx(BufferObj *buffer_obj) const;
+
+    BufferMapShard &PathShard(const String &file_path) { return map_shards_[std::hash<String>{}(file_path) % map_shards_.size()]; }
+
+    BufferIdShard &IdShard(u32 buffer_id) { return id_shards_[buffer_id % id_shards_.size()]; }
+
+    // Insert a new buffer object into the path shard and the id shard, lock of the path shard must be held.
+    BufferObj *InsertBufferObj(BufferMapShard &path_shard, String file_path, UniquePtr<BufferObj> buffer_obj);
 
     UniquePtr<BufferObj> MakeBufferObj(UniquePtr<FileWorker> file_worker, bool is_ephemeral);
 
@@ -123,12 +193,12 @@ private:
     PersistenceManager *persistence_manager_;
     Atomic<u64> current_memory_size_{};
 
-    std::mutex w_locker_{};
-    HashMap<String, UniquePtr<BufferObj>> buffer_map_{};
+    Vector<BufferMapShard> map_shards_{};
+    Vector<BufferIdShard> id_shards_{};
     Atomic<u32> buffer_id_{};
 
     std::mutex gc_locker_{};
-    Vector<LRUCache> lru_caches_{};
+    Vector<ClockCache> clock_caches_{};
     SizeT round_robin_{};
 
     std::mutex clean_locker_{};
@@ -140,6 +210,16 @@ private:
 
     Atomic<u64> total_request_count_{0};
     Atomic<u64> cache_miss_count_{0};
+
+    UniquePtr<ThreadPool> prefetch_pool_{};
+    // Prefetch tasks hold it shared while they look up and load an object, RemoveClean holds it to delete objects
+    std::shared_mutex prefetch_locker_{};
+
+    Atomic<u64> load_count_{0};
+    Atomic<u64> total_load_time_us_{0};
+    Atomic<u64> max_load_time_us_{0};
+    Atomic<u64> prefetch_count_{0};
+    Atomic<u64> prefetch_hit_count_{0};
 };
 
 } // namespace infinity
@@ -75,9 +75,11 @@ BufferHandle BufferObj::Load() {
             break;
         }
         case BufferStatus::kUnloaded: {
-            if (!buffer_mgr_->RemoveFromGCQueue(this)) {
-                String error_message = fmt::format("attempt to buffer: {} status is UNLOADED, but not in GC queue", GetFilename());
-                UnrecoverableError(error_message);
+            // the object stays in the clock, the hand skips it while loaded
+            buffer_mgr_->SubWaitingGC(this);
+            if (prefetched_) {
+                buffer_mgr_->AddPrefetchHitCount();
+                prefetched_ = false;
             }
             break;
         }
@@ -93,7 +95,11 @@ BufferHandle BufferObj::Load() {
                 UnrecoverableError(error_message);
             }
             bool from_spill = type_ != BufferType::kPersistent;
+            auto load_begin = std::chrono::steady_clock::now();
             file_worker_->ReadFromFile(from_spill);
+            auto load_time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - load_begin);
+            buffer_mgr_->AddLoadTime(load_time.count());
+            buffer_mgr_->AddToClock(this);
             break;
         }
         case BufferStatus::kNew: {
@@ -106,6 +112,7 @@ BufferHandle BufferObj::Load() {
             }
             file_worker_->AllocateInMemory();
             LOG_TRACE(fmt::format("Allocated memory {}", GetBufferSize()));
+            buffer_mgr_->AddToClock(this);
             break;
         }
         default: {
@@ -119,14 +126,45 @@ BufferHandle BufferObj::Load() {
     return BufferHandle(this, data);
 }
 
+bool BufferObj::Prefetch() {
+    std::unique_lock<std::mutex> locker(w_locker_);
+    // Spilled objects are read back on demand, objects picked for cleanup are not read again
+    if (status_ != BufferStatus::kFreed || type_ != BufferType::kPersistent || obj_rc_ == 0) {
+        return false;
+    }
+    SizeT buffer_size = GetBufferSize();
+    if (!buffer_mgr_->RequestSpace(buffer_size)) {
+        // Don't evict more than the memory limit for a read ahead, give back the requested space
+        buffer_mgr_->current_memory_size_.fetch_sub(buffer_size);
+        return false;
+    }
+    file_worker_->ReadFromFile(false);
+    status_ = BufferStatus::kUnloaded;
+    prefetched_ = true;
+    referenced_ = true;
+    buffer_mgr_->AddToClock(this);
+    buffer_mgr_->AddWaitingGC(this);
+    return true;
+}
+
 bool BufferObj::Free() {
     std::unique_lock<std::mutex> locker(w_locker_, std::defer_lock);
     if (!locker.try_lock()) {
         return false; // when other thread is loading or cleaning, return false
     }
-    if (status_ != BufferStatus::kUnloaded) {
-        String error_message = fmt::format("attempt to free {} buffer object", BufferStatusToString(status_));
-        UnrecoverableError(error_message);
+    switch (status_) {
+        case BufferStatus::kUnloaded: {
+            break;
+        }
+        // loaded objects stay in the clock, so do the objects dropped before they are removed in RemoveClean
+        case BufferStatus::kLoaded:
+        case BufferStatus::kClean: {
+            return false;
+        }
+        default: {
+            String error_message = fmt::format("attempt to free {} buffer object", BufferStatusToString(status_));
+            UnrecoverableError(error_message);
+        }
     }
     switch (type_) {
         case BufferType::kTemp:
@@ -147,6 +185,7 @@ bool BufferObj::Free() {
     }
     file_worker_->FreeInMemory();
     status_ = BufferStatus::kFreed;
+    prefetched_ = false;
     return true;
 }
 
@@ -259,21 +298,27 @@ void BufferObj::GetMutPointer() {
 }
 
 void BufferObj::UnloadInner() {
-    std::unique_lock<std::mutex> locker(w_locker_);
-    switch (status_) {
-        case BufferStatus::kLoaded: {
-            --rc_;
-            if (rc_ == 0) {
-                buffer_mgr_->PushGCQueue(this);
+    {
+        std::unique_lock<std::mutex> locker(w_locker_);
+        switch (status_) {
+            case BufferStatus::kLoaded: {
+                --rc_;
+                if (rc_ > 0) {
+                    return;
+                }
                 status_ = BufferStatus::kUnloaded;
+                referenced_.store(true, std::memory_order_relaxed);
+                buffer_mgr_->AddWaitingGC(this);
+                break;
+            }
+            default: {
+                String error_message = fmt::format("Calling with invalid buffer status: {}", BufferStatusToString(status_));
+                UnrecoverableError(error_message);
             }
-            break;
-        }
-        default: {
-            String error_message = fmt::format("Calling with invalid buffer status: {}", BufferStatusToString(status_));
-            UnrecoverableError(error_message);
         }
     }
+    // this object may be freed too, so the lock is released first
+    buffer_mgr_->FreeOverLimit();
 }
 
 bool BufferObj::AddBufferSize(SizeT add_size) {
@@ -301,6 +346,9 @@ void BufferObj::SubObjRc() {
     }
     --obj_rc_;
     if (obj_rc_ == 0) {
+        if (status_ == BufferStatus::kUnloaded) {
+            buffer_mgr_->SubWaitingGC(this);
+        }
         status_ = BufferStatus::kClean;
         buffer_mgr_->AddToCleanList(this, false /*do_free*/);
     }
@@ -92,9 +92,16 @@ public:
     // called by ObjectHandle when load first time for that ObjectHandle
     BufferHandle Load();
 
-    // called by BufferMgr in GC process.
+    // called by BufferMgr in GC process. Return false if the object is in use or locked by other thread.
     bool Free();
 
+    // called by BufferMgr in GC process. Clear the reference bit and return whether it was set.
+    bool ClearReferenced() { return referenced_.exchange(false, std::memory_order_relaxed); }
+
+    // called by BufferMgr prefetch task. Read a freed persistent object from file and leave it unloaded.
+    // Return false if the object isn't read.
+    bool Prefetch();
+
     // called when checkpoint. or in "IMPORT" operator.
     bool Save(const FileWorkerSaveCtx &ctx = {});
 
@@ -159,6 +166,12 @@ private:
     u32 id_;
 
     u32 obj_rc_ = 0;
+
+    // read by Prefetch and not loaded since then
+    bool prefetched_ = false;
+
+    // set when unloaded, cleared by the clock hand of BufferMgr before the object is freed
+    Atomic<bool> referenced_{false};
 };
 
 } // namespace infinity
\ No newline at end of file
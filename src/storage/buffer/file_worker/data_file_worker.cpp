@@ -24,16 +24,26 @@ import third_party;
 import status;
 import logger;
 import persistence_manager;
+import column_encoding;
 
 namespace infinity {
 
+namespace {
+
+constexpr u64 kRawMagicNumber = 0x00dd3344;
+constexpr u64 kEncodedMagicNumber = 0x00dd3345;
+
+} // namespace
+
 DataFileWorker::DataFileWorker(SharedPtr<String> data_dir,
                                SharedPtr<String> temp_dir,
                                SharedPtr<String> file_dir,
                                SharedPtr<String> file_name,
                                SizeT buffer_size,
-                               PersistenceManager* persistence_manager)
-    : FileWorker(std::move(data_dir), std::move(temp_dir), std::move(file_dir), std::move(file_name), persistence_manager), buffer_size_(buffer_size) {}
+                               PersistenceManager* persistence_manager,
+                               ColumnEncodingInfo encoding_info)
+    : FileWorker(std::move(data_dir), std::move(temp_dir), std::move(file_dir), std::move(file_name), persistence_manager), buffer_size_(buffer_size),
+      encoding_info_(encoding_info) {}
 
 DataFileWorker::~DataFileWorker() {
     if (data_ != nullptr) {
@@ -64,14 +74,25 @@ void DataFileWorker::FreeInMemory() {
 }
 
 // FIXME: to_spill
-bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const FileWorkerSaveCtx &ctx) {
+bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const FileWorkerSaveCtx &base_ctx) {
     // File structure:
     // - header: magic number
     // - header: buffer size
-    // - data buffer
+    // - header: encoding type and encoded size, if the magic number is kEncodedMagicNumber
+    // - data buffer, or the encoded data buffer
     // - footer: checksum
 
-    u64 magic_number = 0x00dd3344;
+    // Spilled buffers are read back soon and unsealed blocks are written again at the next checkpoint, they are not worth encoding
+    Vector<char> encoded;
+    ColumnEncodingType encoding_type = ColumnEncodingType::kRaw;
+    if (!to_spill && encoding_info_.value_width_ != 0) {
+        const auto &ctx = static_cast<const DataFileWorkerSaveCtx &>(base_ctx);
+        if (ctx.sealed_) {
+            encoding_type = ColumnEncoding::Encode(encoding_info_, static_cast<const char *>(data_), buffer_size_, encoded);
+        }
+    }
+
+    u64 magic_number = encoding_type == ColumnEncodingType::kRaw ? kRawMagicNumber : kEncodedMagicNumber;
     Status status = file_handle_->Append(&magic_number, sizeof(magic_number));
     if(!status.ok()) {
         RecoverableError(status);
@@ -82,9 +103,21 @@ bool DataFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const
         RecoverableError(status);
     }
 
-    status = file_handle_->Append(data_, buffer_size_);
-    if(!status.ok()) {
-        RecoverableError(status);
+    if (encoding_type == ColumnEncodingType::kRaw) {
+        status = file_handle_->Append(data_, buffer_size_);
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+    } else {
+        u64 encoding_header[2] = {static_cast<u64>(encoding_type), encoded.size()};
+        status = file_handle_->Append(encoding_header, sizeof(encoding_header));
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
+        status = file_handle_->Append(encoded.data(), encoded.size());
+        if (!status.ok()) {
+            RecoverableError(status);
+        }
     }
 
     u64 checksum{};
@@ -113,7 +146,7 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size) {
         Status status = Status::DataIOError(fmt::format("Read magic number which length isn't {}.", nbytes1));
         RecoverableError(status);
     }
-    if (magic_number != 0x00dd3344) {
+    if (magic_number != kRawMagicNumber && magic_number != kEncodedMagicNumber) {
         Status status = Status::DataIOError(fmt::format("Read magic number which length isn't {}.", nbytes1));
         RecoverableError(status);
     }
@@ -125,17 +158,21 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size) {
         RecoverableError(status2);
     }
 
-    if (file_size != buffer_size_ + 3 * sizeof(u64)) {
-        Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size_ + 3 * sizeof(u64)));
-        RecoverableError(status);
-    }
+    if (magic_number == kEncodedMagicNumber) {
+        ReadEncodedBody(file_size, buffer_size_);
+    } else {
+        if (file_size != buffer_size_ + 3 * sizeof(u64)) {
+            Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, buffer_size_ + 3 * sizeof(u64)));
+            RecoverableError(status);
+        }
 
-    // file body
-    data_ = static_cast<void *>(new char[buffer_size_]);
-    auto [nbytes3, status3] = file_handle_->Read(data_, buffer_size_);
-    if (nbytes3 != buffer_size_) {
-        Status status = Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", buffer_size_, nbytes3));
-        RecoverableError(status);
+        // file body
+        data_ = static_cast<void *>(new char[buffer_size_]);
+        auto [nbytes3, status3] = file_handle_->Read(data_, buffer_size_);
+        if (nbytes3 != buffer_size_) {
+            Status status = Status::DataIOError(fmt::format("Expect to read buffer with size: {}, but {} bytes is read", buffer_size_, nbytes3));
+            RecoverableError(status);
+        }
     }
 
     // file footer: checksum
@@ -147,4 +184,31 @@ void DataFileWorker::ReadFromFileImpl(SizeT file_size) {
     }
 }
 
+void DataFileWorker::ReadEncodedBody(SizeT file_size, SizeT buffer_size) {
+    // encoding header: encoding type, encoded size
+    u64 encoding_header[2]{};
+    auto [nbytes1, status1] = file_handle_->Read(encoding_header, sizeof(encoding_header));
+    if (nbytes1 != sizeof(encoding_header)) {
+        Status status = Status::DataIOError(fmt::format("Incorrect encoding header length: {}.", nbytes1));
+        RecoverableError(status);
+    }
+    auto encoding_type = static_cast<ColumnEncodingType>(encoding_header[0]);
+    SizeT encoded_size = encoding_header[1];
+    if (file_size != encoded_size + 5 * sizeof(u64)) {
+        Status status = Status::DataIOError(fmt::format("File size: {} isn't matched with {}.", file_size, encoded_size + 5 * sizeof(u64)));
+        RecoverableError(status);
+    }
+
+    auto encoded = MakeUnique<char[]>(encoded_size);
+    auto [nbytes2, status2] = file_handle_->Read(encoded.get(), encoded_size);
+    if (nbytes2 != encoded_size) {
+        Status status = Status::DataIOError(fmt::format("Expect to read encoded buffer with size: {}, but {} bytes is read", encoded_size, nbytes2));
+        RecoverableError(status);
+    }
+
+    auto *data = new char[buffer_size];
+    data_ = static_cast<void *>(data);
+    ColumnEncoding::Decode(encoding_type, encoded.get(), encoded_size, data, buffer_size);
+}
+
 } // namespace infinity
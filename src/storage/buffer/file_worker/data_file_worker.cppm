@@ -20,9 +20,18 @@ import stl;
 import file_worker;
 import file_worker_type;
 import persistence_manager;
+import column_encoding;
 
 namespace infinity {
 
+// Block column data files with an encoding are always saved with this context
+export struct DataFileWorkerSaveCtx : public FileWorkerSaveCtx {
+    explicit DataFileWorkerSaveCtx(bool sealed) : sealed_(sealed) {}
+
+    // No more rows are appended to the buffer, so it is encoded once instead of at every checkpoint
+    bool sealed_{};
+};
+
 export class DataFileWorker : public FileWorker {
 public:
     explicit DataFileWorker(SharedPtr<String> data_dir,
@@ -30,7 +39,8 @@ public:
                             SharedPtr<String> file_dir,
                             SharedPtr<String> file_name,
                             SizeT buffer_size,
-                            PersistenceManager* persistence_manager);
+                            PersistenceManager* persistence_manager,
+                            ColumnEncodingInfo encoding_info = {});
 
     virtual ~DataFileWorker() override;
 
@@ -49,6 +59,11 @@ protected:
     void ReadFromFileImpl(SizeT file_size) override;
 
 private:
+    // Read and decode the body of a data file with kEncodedMagicNumber into data_
+    void ReadEncodedBody(SizeT file_size, SizeT buffer_size);
+
     const SizeT buffer_size_;
+    // How the buffer is encoded when written to the data file, the buffer is written raw if value width is 0
+    const ColumnEncodingInfo encoding_info_;
 };
 } // namespace infinity
\ No newline at end of file
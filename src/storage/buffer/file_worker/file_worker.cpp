@@ -140,9 +140,12 @@ void FileWorker::ReadFromFile(bool from_spill) {
     if (use_object_cache) {
         file_handle->Seek(obj_addr_.part_offset_);
         file_size = obj_addr_.part_size_;
+        read_offset_ = obj_addr_.part_offset_;
     } else {
         file_size = file_handle->FileSize();
+        read_offset_ = 0;
     }
+    read_from_spill_ = from_spill;
     file_handle_ = std::move(file_handle);
     DeferFn defer_fn2([&]() {
         file_handle_ = nullptr;
@@ -86,5 +86,8 @@ public:
 protected:
     void *data_{nullptr};
     UniquePtr<LocalFileHandle> file_handle_{nullptr};
+    // Set by ReadFromFile for ReadFromFileImpl: the data starts at read_offset_ of file_handle_, which is a spill file if read_from_spill_
+    SizeT read_offset_{};
+    bool read_from_spill_{};
 };
 } // namespace infinity
\ No newline at end of file
@@ -36,6 +36,7 @@ import abstract_hnsw;
 import virtual_store;
 import persistence_manager;
 import local_file_handle;
+import status;
 
 namespace infinity {
 
@@ -99,6 +100,14 @@ void HnswFileWorker::FreeInMemory() {
         *p);
     delete p;
     data_ = nullptr;
+    if (mmap_data_ != nullptr) {
+        Status status = LocalFileHandle::Unmmap(mmap_data_, mmap_size_);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        mmap_data_ = nullptr;
+        mmap_size_ = 0;
+    }
 }
 
 bool HnswFileWorker::WriteToFileImpl(bool to_spill, bool &prepare_success, const FileWorkerSaveCtx &ctx) {
@@ -134,6 +143,23 @@ void HnswFileWorker::ReadFromFileImpl(SizeT file_size) {
                 UnrecoverableError("Invalid index type.");
             } else {
                 using IndexT = std::decay_t<decltype(*index)>;
+                // A spill file is rewritten in place when the buffer is spilled again, so it is never mapped
+                if (!read_from_spill_ && file_size > 0) {
+                    auto [mmap_data, status] = file_handle_->MmapRead(read_offset_, file_size);
+                    if (status.ok()) {
+                        auto mapped_index = IndexT::LoadFromPtr(mmap_data);
+                        if (mapped_index) {
+                            index = mapped_index.release();
+                            mmap_data_ = mmap_data;
+                            mmap_size_ = file_size;
+                            return;
+                        }
+                        // saved before the graph layout could be searched in place, or the sections are misaligned in the file
+                        LocalFileHandle::Unmmap(mmap_data, file_size);
+                    } else {
+                        LOG_WARN(fmt::format("Read hnsw index {} into memory, {}", GetFilePath(), status.message()));
+                    }
+                }
                 index = IndexT::Load(*file_handle_).release();
             }
         },
@@ -58,6 +58,10 @@ protected:
 
 private:
     SizeT index_size_{};
+
+    // The index file mapped by ReadFromFileImpl, the loaded index is searched in it until FreeInMemory
+    const char *mmap_data_{};
+    SizeT mmap_size_{};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -114,6 +114,10 @@ VectorBufferType ColumnVector::InitializeHelper(ColumnVectorType vector_type, Si
 void ColumnVector::Initialize(ColumnVectorType vector_type, SizeT capacity) {
     VectorBufferType vector_buffer_type = InitializeHelper(vector_type, capacity);
 
+    if (buffer_.get() != nullptr && buffer_->HoldsBufferHandle()) {
+        // the vector referenced a block column, reusing it must not write into the block
+        buffer_.reset();
+    }
     if (buffer_.get() == nullptr) {
         if (vector_type_ == ColumnVectorType::kConstant) {
             buffer_ = VectorBuffer::Make(data_type_size_, 1, vector_buffer_type);
@@ -1395,6 +1399,30 @@ void ColumnVector::AppendByPtr(const_ptr_t value_ptr) {
     SetByRawPtr(tail_index_++, value_ptr);
 }
 
+void ColumnVector::AppendFixedWidth(const_ptr_t values_ptr, SizeT count) {
+    if (!initialized) {
+        String error_message = "Column vector isn't initialized.";
+        UnrecoverableError(error_message);
+    }
+    if (vector_type_ != ColumnVectorType::kFlat && vector_type_ != ColumnVectorType::kCompactBit) {
+        String error_message = "Only flat column vector supports appending fixed width values.";
+        UnrecoverableError(error_message);
+    }
+    if (tail_index_ + count > capacity_) {
+        String error_message = fmt::format("Exceed the column vector capacity.({}/{})", tail_index_ + count, capacity_);
+        UnrecoverableError(error_message);
+    }
+    if (data_type_->type() == LogicalType::kBoolean) {
+        for (SizeT i = 0; i < count; ++i) {
+            buffer_->SetCompactBit(tail_index_ + i, values_ptr[i] != 0);
+        }
+    } else {
+        const SizeT value_width = data_type_->Size();
+        std::memcpy(data_ptr_ + tail_index_ * value_width, values_ptr, count * value_width);
+    }
+    tail_index_ += count;
+}
+
 namespace {
 Vector<std::string_view> SplitArrayElement(std::string_view data, char delimiter) {
     SizeT data_size = data.size();
@@ -2227,6 +2255,22 @@ i32 ColumnVector::GetSizeInBytes() const {
     return size;
 }
 
+SizeT ColumnVector::MemoryUsage() const {
+    if (!initialized) {
+        return 0;
+    }
+    SizeT size = 0;
+    if (vector_type_ == ColumnVectorType::kCompactBit) {
+        size += (capacity_ + 7) / 8;
+    } else {
+        size += capacity_ * data_type_size_;
+    }
+    size += buffer_->TotalSize(data_type_.get());
+    // null mask of one bit per row at most
+    size += (capacity_ + 7) / 8;
+    return size;
+}
+
 void ColumnVector::WriteAdv(char *&ptr) const {
     if (!initialized) {
         String error_message = "Column vector isn't initialized.";
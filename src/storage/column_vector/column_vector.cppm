@@ -232,6 +232,10 @@ public:
 
     void AppendByPtr(const_ptr_t value_ptr);
 
+    // Append `count` fixed width values stored back to back, as they are laid out in data().
+    // Booleans take one byte each.
+    void AppendFixedWidth(const_ptr_t values_ptr, SizeT count);
+
     void AppendByStringView(std::string_view sv);
 
     void AppendByConstantExpr(const ConstantExpr *const_expr);
@@ -254,6 +258,9 @@ public:
     // Estimated serialized size in bytes
     i32 GetSizeInBytes() const;
 
+    // Bytes held in memory: the allocated values, the heap of variable length values and the null mask
+    SizeT MemoryUsage() const;
+
     // Write to a char buffer
     void WriteAdv(char *&ptr) const;
 
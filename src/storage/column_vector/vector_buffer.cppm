@@ -88,6 +88,9 @@ public:
         }
     }
 
+    // true if the data lives in a buffer manager object (a block column) instead of memory owned by this vector buffer
+    [[nodiscard]] bool HoldsBufferHandle() const { return std::holds_alternative<BufferHandle>(ptr_); }
+
     [[nodiscard]] bool GetCompactBit(SizeT idx) const;
 
     void SetCompactBit(SizeT idx, bool val);
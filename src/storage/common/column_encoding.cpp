@@ -0,0 +1,377 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include "snappy/snappy.h"
+#include <bit>
+
+module column_encoding;
+
+import stl;
+import data_type;
+import logical_type;
+import status;
+import infinity_exception;
+import third_party;
+
+namespace infinity {
+
+namespace {
+
+// Header of a frame of reference body, followed by the bit packed deltas of the values to the reference.
+struct ForHeader {
+    u8 value_width_{};
+    u8 bit_width_{};
+    u16 reserved_{};
+    u32 value_count_{};
+    i64 reference_{};
+};
+
+// Header of a dictionary body, followed by the distinct values and the bit packed codes of the values.
+struct DictionaryHeader {
+    u8 value_width_{};
+    u8 bit_width_{};
+    u16 reserved_{};
+    u32 value_count_{};
+    u32 dict_size_{};
+    u32 reserved2_{};
+};
+
+constexpr SizeT kMaxDictionaryValueWidth = 16;
+constexpr SizeT kMaxDictionarySize = 1 << 16;
+
+inline u8 BitWidthOf(u64 max_value) { return static_cast<u8>(std::bit_width(max_value)); }
+
+inline u64 BitMask(u8 bit_width) { return bit_width == 64 ? ~u64(0) : (u64(1) << bit_width) - 1; }
+
+inline SizeT PackedSize(SizeT count, u8 bit_width) { return (count * bit_width + 63) / 64 * sizeof(u64); }
+
+// Append `count` values of `bit_width` bits to `out`, in u64 words.
+void PackBits(const u64 *values, SizeT count, u8 bit_width, Vector<char> &out) {
+    SizeT offset = out.size();
+    out.resize(offset + PackedSize(count, bit_width));
+    if (bit_width == 0) {
+        return;
+    }
+    Vector<u64> words(PackedSize(count, bit_width) / sizeof(u64));
+    SizeT bit_pos = 0;
+    for (SizeT i = 0; i < count; ++i, bit_pos += bit_width) {
+        SizeT word_idx = bit_pos / 64;
+        SizeT bit_offset = bit_pos % 64;
+        words[word_idx] |= values[i] << bit_offset;
+        if (bit_offset + bit_width > 64) {
+            words[word_idx + 1] |= values[i] >> (64 - bit_offset);
+        }
+    }
+    std::memcpy(out.data() + offset, words.data(), words.size() * sizeof(u64));
+}
+
+// Sequential reader of bit packed values.
+class BitUnpacker {
+public:
+    BitUnpacker(const char *packed, u8 bit_width) : packed_(packed), bit_width_(bit_width), mask_(BitMask(bit_width)) {}
+
+    inline u64 Next() {
+        if (bit_width_ == 0) {
+            return 0;
+        }
+        SizeT word_idx = bit_pos_ / 64;
+        SizeT bit_offset = bit_pos_ % 64;
+        u64 value = Word(word_idx) >> bit_offset;
+        if (bit_offset + bit_width_ > 64) {
+            value |= Word(word_idx + 1) << (64 - bit_offset);
+        }
+        bit_pos_ += bit_width_;
+        return value & mask_;
+    }
+
+private:
+    inline u64 Word(SizeT word_idx) const {
+        u64 word;
+        std::memcpy(&word, packed_ + word_idx * sizeof(u64), sizeof(u64));
+        return word;
+    }
+
+    const char *packed_;
+    const u8 bit_width_;
+    const u64 mask_;
+    SizeT bit_pos_{};
+};
+
+inline i64 ReadInteger(const char *ptr, SizeT value_width) {
+    switch (value_width) {
+        case 1: {
+            return *reinterpret_cast<const i8 *>(ptr);
+        }
+        case 2: {
+            i16 value;
+            std::memcpy(&value, ptr, sizeof(value));
+            return value;
+        }
+        case 4: {
+            i32 value;
+            std::memcpy(&value, ptr, sizeof(value));
+            return value;
+        }
+        default: {
+            i64 value;
+            std::memcpy(&value, ptr, sizeof(value));
+            return value;
+        }
+    }
+}
+
+inline void WriteInteger(char *ptr, SizeT value_width, i64 value) {
+    switch (value_width) {
+        case 1: {
+            *reinterpret_cast<i8 *>(ptr) = static_cast<i8>(value);
+            break;
+        }
+        case 2: {
+            i16 v = static_cast<i16>(value);
+            std::memcpy(ptr, &v, sizeof(v));
+            break;
+        }
+        case 4: {
+            i32 v = static_cast<i32>(value);
+            std::memcpy(ptr, &v, sizeof(v));
+            break;
+        }
+        default: {
+            std::memcpy(ptr, &value, sizeof(value));
+            break;
+        }
+    }
+}
+
+template <typename Header>
+Header ReadHeader(const char *encoded, SizeT encoded_size) {
+    if (encoded_size < sizeof(Header)) {
+        RecoverableError(Status::DataIOError(fmt::format("Encoded column body of {} bytes is shorter than its header.", encoded_size)));
+    }
+    Header header;
+    std::memcpy(&header, encoded, sizeof(Header));
+    return header;
+}
+
+void EncodeFrameOfReference(const ColumnEncodingInfo &info, const char *data, SizeT size, Vector<char> &encoded) {
+    SizeT value_count = size / info.value_width_;
+    i64 min_value = std::numeric_limits<i64>::max();
+    i64 max_value = std::numeric_limits<i64>::min();
+    for (SizeT i = 0; i < value_count; ++i) {
+        i64 value = ReadInteger(data + i * info.value_width_, info.value_width_);
+        min_value = std::min(min_value, value);
+        max_value = std::max(max_value, value);
+    }
+    ForHeader header{.value_width_ = static_cast<u8>(info.value_width_),
+                     .bit_width_ = BitWidthOf(static_cast<u64>(max_value) - static_cast<u64>(min_value)),
+                     .value_count_ = static_cast<u32>(value_count),
+                     .reference_ = min_value};
+    if (sizeof(ForHeader) + PackedSize(value_count, header.bit_width_) >= size) {
+        return;
+    }
+
+    Vector<u64> deltas(value_count);
+    for (SizeT i = 0; i < value_count; ++i) {
+        deltas[i] = static_cast<u64>(ReadInteger(data + i * info.value_width_, info.value_width_)) - static_cast<u64>(min_value);
+    }
+    encoded.resize(sizeof(ForHeader));
+    std::memcpy(encoded.data(), &header, sizeof(ForHeader));
+    PackBits(deltas.data(), value_count, header.bit_width_, encoded);
+}
+
+void DecodeFrameOfReference(const char *encoded, SizeT encoded_size, char *data, SizeT size) {
+    auto header = ReadHeader<ForHeader>(encoded, encoded_size);
+    if (header.value_width_ * header.value_count_ != size ||
+        sizeof(ForHeader) + PackedSize(header.value_count_, header.bit_width_) != encoded_size) {
+        RecoverableError(Status::DataIOError(fmt::format("Frame of reference body of {} values doesn't match buffer size {}.", header.value_count_, size)));
+    }
+    BitUnpacker unpacker(encoded + sizeof(ForHeader), header.bit_width_);
+    for (SizeT i = 0; i < header.value_count_; ++i) {
+        WriteInteger(data + i * header.value_width_, header.value_width_, static_cast<i64>(static_cast<u64>(header.reference_) + unpacker.Next()));
+    }
+}
+
+void EncodeDictionary(const ColumnEncodingInfo &info, const char *data, SizeT size, Vector<char> &encoded) {
+    SizeT value_count = size / info.value_width_;
+    SizeT max_dict_size = std::min(kMaxDictionarySize, value_count / 4);
+    HashMap<std::string_view, u32> dict;
+    Vector<u64> codes(value_count);
+    Vector<const char *> dict_values;
+    for (SizeT i = 0; i < value_count; ++i) {
+        const char *value = data + i * info.value_width_;
+        auto [iter, inserted] = dict.emplace(std::string_view(value, info.value_width_), dict_values.size());
+        if (inserted) {
+            if (dict_values.size() == max_dict_size) {
+                return;
+            }
+            dict_values.push_back(value);
+        }
+        codes[i] = iter->second;
+    }
+    DictionaryHeader header{.value_width_ = static_cast<u8>(info.value_width_),
+                            .bit_width_ = BitWidthOf(dict_values.size() - 1),
+                            .value_count_ = static_cast<u32>(value_count),
+                            .dict_size_ = static_cast<u32>(dict_values.size())};
+    SizeT dict_bytes = dict_values.size() * info.value_width_;
+    if (sizeof(DictionaryHeader) + dict_bytes + PackedSize(value_count, header.bit_width_) >= size) {
+        return;
+    }
+
+    encoded.resize(sizeof(DictionaryHeader) + dict_bytes);
+    std::memcpy(encoded.data(), &header, sizeof(DictionaryHeader));
+    char *dict_ptr = encoded.data() + sizeof(DictionaryHeader);
+    for (const char *value : dict_values) {
+        std::memcpy(dict_ptr, value, info.value_width_);
+        dict_ptr += info.value_width_;
+    }
+    PackBits(codes.data(), value_count, header.bit_width_, encoded);
+}
+
+void DecodeDictionary(const char *encoded, SizeT encoded_size, char *data, SizeT size) {
+    auto header = ReadHeader<DictionaryHeader>(encoded, encoded_size);
+    SizeT dict_bytes = header.dict_size_ * header.value_width_;
+    if (header.value_width_ * header.value_count_ != size ||
+        sizeof(DictionaryHeader) + dict_bytes + PackedSize(header.value_count_, header.bit_width_) != encoded_size) {
+        RecoverableError(Status::DataIOError(fmt::format("Dictionary body of {} values doesn't match buffer size {}.", header.value_count_, size)));
+    }
+    const char *dict_ptr = encoded + sizeof(DictionaryHeader);
+    BitUnpacker unpacker(dict_ptr + dict_bytes, header.bit_width_);
+    for (SizeT i = 0; i < header.value_count_; ++i) {
+        u64 code = unpacker.Next();
+        if (code >= header.dict_size_) {
+            RecoverableError(Status::DataIOError(fmt::format("Dictionary code {} is out of dictionary size {}.", code, header.dict_size_)));
+        }
+        std::memcpy(data + i * header.value_width_, dict_ptr + code * header.value_width_, header.value_width_);
+    }
+}
+
+void EncodeSnappy(const char *data, SizeT size, Vector<char> &encoded) {
+    encoded.resize(snappy::MaxCompressedLength(size));
+    SizeT compressed_size = 0;
+    snappy::RawCompress(data, size, encoded.data(), &compressed_size);
+    encoded.resize(compressed_size);
+}
+
+void DecodeSnappy(const char *encoded, SizeT encoded_size, char *data, SizeT size) {
+    SizeT uncompressed_size = 0;
+    if (!snappy::GetUncompressedLength(encoded, encoded_size, &uncompressed_size) || uncompressed_size != size ||
+        !snappy::RawUncompress(encoded, encoded_size, data)) {
+        RecoverableError(Status::DataIOError(fmt::format("Fail to uncompress snappy body of {} bytes into {} bytes.", encoded_size, size)));
+    }
+}
+
+} // namespace
+
+String ColumnEncodingTypeToString(ColumnEncodingType type) {
+    switch (type) {
+        case ColumnEncodingType::kRaw:
+            return "raw";
+        case ColumnEncodingType::kFrameOfReference:
+            return "frame_of_reference";
+        case ColumnEncodingType::kDictionary:
+            return "dictionary";
+        case ColumnEncodingType::kSnappy:
+            return "snappy";
+    }
+    return "invalid";
+}
+
+ColumnEncodingInfo ColumnEncodingInfo::Make(const DataType &data_type) {
+    switch (data_type.type()) {
+        case LogicalType::kTinyInt:
+        case LogicalType::kSmallInt:
+        case LogicalType::kInteger:
+        case LogicalType::kBigInt:
+        case LogicalType::kDate:
+        case LogicalType::kTime: {
+            return {.value_width_ = data_type.Size(), .is_integer_ = true};
+        }
+        case LogicalType::kBoolean: {
+            // bitmap of the values
+            return {.value_width_ = 1, .is_integer_ = false};
+        }
+        default: {
+            return {.value_width_ = data_type.Size(), .is_integer_ = false};
+        }
+    }
+}
+
+ColumnEncodingType ColumnEncoding::Encode(const ColumnEncodingInfo &info, const char *data, SizeT size, Vector<char> &encoded) {
+    encoded.clear();
+    if (info.value_width_ == 0 || size == 0) {
+        return ColumnEncodingType::kRaw;
+    }
+    ColumnEncodingType best_type = ColumnEncodingType::kRaw;
+    SizeT best_size = size - size / 8;
+    Vector<char> candidate;
+    auto try_encoding = [&](ColumnEncodingType type) {
+        if (!candidate.empty() && candidate.size() < best_size) {
+            best_type = type;
+            best_size = candidate.size();
+            encoded.swap(candidate);
+        }
+        candidate.clear();
+    };
+
+    if (size % info.value_width_ == 0) {
+        if (info.is_integer_) {
+            EncodeFrameOfReference(info, data, size, candidate);
+            try_encoding(ColumnEncodingType::kFrameOfReference);
+        }
+        if (info.value_width_ <= kMaxDictionaryValueWidth) {
+            EncodeDictionary(info, data, size, candidate);
+            try_encoding(ColumnEncodingType::kDictionary);
+        }
+    }
+    // The lightweight encodings are good enough, skip the cost of the general purpose codec
+    if (best_size > size / 4) {
+        EncodeSnappy(data, size, candidate);
+        try_encoding(ColumnEncodingType::kSnappy);
+    }
+    if (best_type == ColumnEncodingType::kRaw) {
+        encoded.clear();
+    }
+    return best_type;
+}
+
+void ColumnEncoding::Decode(ColumnEncodingType type, const char *encoded, SizeT encoded_size, char *data, SizeT size) {
+    switch (type) {
+        case ColumnEncodingType::kRaw: {
+            if (encoded_size != size) {
+                RecoverableError(Status::DataIOError(fmt::format("Raw body size {} doesn't match buffer size {}.", encoded_size, size)));
+            }
+            std::memcpy(data, encoded, size);
+            break;
+        }
+        case ColumnEncodingType::kFrameOfReference: {
+            DecodeFrameOfReference(encoded, encoded_size, data, size);
+            break;
+        }
+        case ColumnEncodingType::kDictionary: {
+            DecodeDictionary(encoded, encoded_size, data, size);
+            break;
+        }
+        case ColumnEncodingType::kSnappy: {
+            DecodeSnappy(encoded, encoded_size, data, size);
+            break;
+        }
+        default: {
+            RecoverableError(Status::DataIOError(fmt::format("Unknown column encoding {}.", static_cast<u8>(type))));
+        }
+    }
+}
+
+} // namespace infinity
@@ -0,0 +1,59 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module column_encoding;
+
+import stl;
+import data_type;
+
+namespace infinity {
+
+// Encodings of a block column file. The in-memory buffer of a column is always the raw values,
+// the file body is encoded when the buffer is written and decoded when it is loaded.
+export enum class ColumnEncodingType : u8 {
+    kRaw = 0,
+    // reference value + bit packed deltas to it, for integer columns
+    kFrameOfReference = 1,
+    // distinct values + bit packed codes, for fixed width values of low cardinality, including inline varchar
+    kDictionary = 2,
+    // general purpose codec on the raw buffer
+    kSnappy = 3,
+};
+
+export String ColumnEncodingTypeToString(ColumnEncodingType type);
+
+// What the writer knows about the values in a column buffer.
+export struct ColumnEncodingInfo {
+    // Width of each value in bytes, 0 if the buffer isn't an array of fixed width values and shouldn't be encoded
+    SizeT value_width_{};
+    // Values are little endian signed integers of value_width_ bytes, frame of reference can be used
+    bool is_integer_{};
+
+    static ColumnEncodingInfo Make(const DataType &data_type);
+};
+
+export class ColumnEncoding {
+public:
+    // Encode the raw buffer with the encoding of smallest output, the encoded body is written to `encoded`.
+    // kRaw is returned, and `encoded` is left empty, if no encoding saves at least 1/8 of the size.
+    static ColumnEncodingType Encode(const ColumnEncodingInfo &info, const char *data, SizeT size, Vector<char> &encoded);
+
+    // Decode the encoded body into the raw buffer `data` of `size` bytes.
+    static void Decode(ColumnEncodingType type, const char *encoded, SizeT encoded_size, char *data, SizeT size);
+
+};
+
+} // namespace infinity
@@ -170,6 +170,7 @@ void DataBlock::UnInit() {
     }
 
     column_vectors.clear();
+    selection_.reset();
 
     row_count_ = 0;
     initialized = false;
@@ -192,10 +193,28 @@ void DataBlock::Reset() {
         column_vectors[i]->Initialize(old_vector_type);
     }
 
+    selection_.reset();
     row_count_ = 0;
     finalized = false;
 }
 
+void DataBlock::MaterializeSelection() {
+    if (selection_.get() == nullptr) {
+        return;
+    }
+    for (SizeT idx = 0; idx < column_count_; ++idx) {
+        auto column_vector = MakeShared<ColumnVector>(column_vectors[idx]->data_type());
+        column_vector->Initialize(*column_vectors[idx], *selection_);
+        column_vectors[idx] = std::move(column_vector);
+    }
+    if (column_count_ > 0) {
+        capacity_ = column_vectors[0]->capacity();
+    }
+    selection_.reset();
+    finalized = false;
+    this->Finalize();
+}
+
 // TODO: May cause error when capacity is larger than the originally allocated size
 // TODO: Initialize() parameter may not be ColumnVectorType::kFlat ?
 void DataBlock::Reset(SizeT capacity) {
@@ -391,6 +410,14 @@ i32 DataBlock::GetSizeInBytes() const {
     return size;
 }
 
+SizeT DataBlock::MemoryUsage() const {
+    SizeT size = 0;
+    for (const auto &column_vector : column_vectors) {
+        size += column_vector->MemoryUsage();
+    }
+    return size;
+}
+
 void DataBlock::WriteAdv(char *&ptr) const {
     if (!finalized) {
         String error_message = "Data block is not finalized.";
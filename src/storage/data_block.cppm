@@ -92,6 +92,22 @@ public:
 
     void InsertVector(const SharedPtr<ColumnVector> &vector, SizeT index);
 
+    // Only the rows listed in `selection` are valid, the columns are gathered later by MaterializeSelection.
+    void SetSelection(SharedPtr<Selection> selection) { selection_ = std::move(selection); }
+
+    // Gather the selected rows of every column and drop the selection.
+    void MaterializeSelection();
+
+    [[nodiscard]] inline bool HasSelection() const { return selection_.get() != nullptr; }
+
+    [[nodiscard]] inline const SharedPtr<Selection> &selection() const { return selection_; }
+
+    // Row count seen by the operators which understand the selection.
+    [[nodiscard]] inline SizeT selected_row_count() const { return selection_.get() != nullptr ? selection_->Size() : row_count(); }
+
+    // Physical row index of the idx-th selected row.
+    [[nodiscard]] inline SizeT SelectedRowIndex(SizeT idx) const { return selection_.get() != nullptr ? selection_->Get(idx) : idx; }
+
 public:
     [[nodiscard]] inline SizeT column_count() const { return column_count_; }
 
@@ -124,6 +140,8 @@ public:
 
     // Estimated serialized size in bytes, ensured be no less than Write requires, allowed be larger.
     i32 GetSizeInBytes() const;
+    // Bytes held in memory by the column vectors
+    SizeT MemoryUsage() const;
     // Write to a char buffer
     void WriteAdv(char *&ptr) const;
     // Read from a serialized version
@@ -132,6 +150,7 @@ public:
     Vector<SharedPtr<ColumnVector>> column_vectors;
 
 private:
+    SharedPtr<Selection> selection_{};
     u16 row_count_{0};
     SizeT column_count_{0};
     SizeT capacity_{0};
@@ -123,7 +123,7 @@ SharedPtr<IndexBase> IndexBase::ReadAdv(const char *&ptr, int32_t maxbytes) {
     SharedPtr<IndexBase> res = nullptr;
     switch (index_type) {
         case IndexType::kIVF: {
-            const auto ivf_option = ReadBufAdv<IndexIVFOption>(ptr);
+            const auto ivf_option = IndexIVF::ReadIndexIVFOptionAdv(ptr);
             res = MakeShared<IndexIVF>(index_name, index_comment, file_name, column_names, ivf_option);
             break;
         }
@@ -238,6 +238,10 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
             SizeT M = index_def_json["M"];
             SizeT ef_construction = index_def_json["ef_construction"];
             SizeT block_size = index_def_json["block_size"];
+            SizeT build_threads = 0;
+            if (index_def_json.contains("build_threads")) {
+                build_threads = index_def_json["build_threads"];
+            }
             MetricType metric_type = StringToMetricType(index_def_json["metric_type"]);
             HnswEncodeType encode_type = StringToHnswEncodeType(index_def_json["encode_type"]);
             res = MakeShared<IndexHnsw>(index_name,
@@ -248,7 +252,8 @@ SharedPtr<IndexBase> IndexBase::Deserialize(const nlohmann::json &index_def_json
                                         encode_type,
                                         M,
                                         ef_construction,
-                                        block_size);
+                                        block_size,
+                                        build_threads);
             break;
         }
         case IndexType::kDiskAnn: {
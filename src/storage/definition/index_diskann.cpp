@@ -31,6 +31,8 @@ import index_base;
 import logical_type;
 import statement_common;
 import logger;
+import embedding_info;
+import internal_types;
 
 namespace infinity {
 
@@ -87,11 +89,23 @@ SharedPtr<IndexBase> IndexDiskAnn::Make(SharedPtr<String> index_name,
         Status status = Status::InvalidIndexParam("Metric type");
         RecoverableError(status);
     }
+    if (metric_type != MetricType::kMetricL2) {
+        Status status = Status::NotSupport(fmt::format("DiskAnn index with metric {}", MetricTypeToString(metric_type)));
+        RecoverableError(status);
+    }
 
     if (encode_type == DiskAnnEncodeType::kInvalid) {
         Status status = Status::InvalidIndexParam("Encode type");
         RecoverableError(status);
     }
+    if (num_parts == 0) {
+        Status status = Status::InvalidIndexParam("num_parts");
+        RecoverableError(status);
+    }
+    if (num_parts > 1) {
+        // Kept in the index definition, but every chunk of the index is built as a single Vamana graph.
+        LOG_WARN(fmt::format("DiskAnn index {}: num_parts = {} is ignored, the index is built in one part", *index_name, num_parts));
+    }
 
     return std::make_shared<
         IndexDiskAnn>(index_name, index_comment, file_name, std::move(column_names), metric_type, encode_type, R, L, num_pq_chunks, num_parts);
@@ -164,6 +178,12 @@ void IndexDiskAnn::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_ta
         Status status = Status::InvalidIndexDefinition(
             fmt::format("Attempt to create DsikAnn index on column: {}, data type: {}.", column_name, data_type->ToString()));
         RecoverableError(status);
+    } else if (static_cast<const EmbeddingInfo *>(data_type->type_info().get())->Type() != EmbeddingDataType::kElemFloat) {
+        Status status = Status::InvalidIndexDefinition(
+            fmt::format("Attempt to create DiskAnn index on column: {}, data type: {}, only float embedding is supported.",
+                        column_name,
+                        data_type->ToString()));
+        RecoverableError(status);
     }
 }
 
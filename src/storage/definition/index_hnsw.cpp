@@ -42,6 +42,8 @@ HnswEncodeType StringToHnswEncodeType(const String &str) {
         return HnswEncodeType::kPlain;
     } else if (str == "lvq") {
         return HnswEncodeType::kLVQ;
+    } else if (str == "rabitq") {
+        return HnswEncodeType::kRaBitQ;
     } else {
         return HnswEncodeType::kInvalid;
     }
@@ -53,6 +55,8 @@ String HnswEncodeTypeToString(HnswEncodeType encode_type) {
             return "plain";
         case HnswEncodeType::kLVQ:
             return "lvq";
+        case HnswEncodeType::kRaBitQ:
+            return "rabitq";
         default:
             return "invalid";
     }
@@ -66,6 +70,7 @@ SharedPtr<IndexBase> IndexHnsw::Make(SharedPtr<String> index_name,
     SizeT M = HNSW_M;
     SizeT ef_construction = HNSW_EF_CONSTRUCTION;
     SizeT block_size = HNSW_BLOCK_SIZE;
+    SizeT build_threads = 0;
     MetricType metric_type = MetricType::kInvalid;
     HnswEncodeType encode_type = HnswEncodeType::kPlain;
     for (const auto *param : index_param_list) {
@@ -79,6 +84,8 @@ SharedPtr<IndexBase> IndexHnsw::Make(SharedPtr<String> index_name,
             encode_type = StringToHnswEncodeType(param->param_value_);
         } else if (param->param_name_ == "block_size") {
             block_size = std::stoi(param->param_value_);
+        } else if (param->param_name_ == "build_threads") {
+            build_threads = std::stoi(param->param_value_);
         } else {
             Status status = Status::InvalidIndexParam(param->param_name_);
             RecoverableError(status);
@@ -103,7 +110,8 @@ SharedPtr<IndexBase> IndexHnsw::Make(SharedPtr<String> index_name,
                                  encode_type,
                                  M,
                                  ef_construction,
-                                 block_size);
+                                 block_size,
+                                 build_threads);
 }
 
 bool IndexHnsw::operator==(const IndexHnsw &other) const {
@@ -155,6 +163,7 @@ nlohmann::json IndexHnsw::Serialize() const {
     res["M"] = M_;
     res["ef_construction"] = ef_construction_;
     res["block_size"] = block_size_;
+    res["build_threads"] = build_threads_;
     return res;
 }
 
@@ -181,11 +190,16 @@ void IndexHnsw::ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table
     const auto embedding_info = dynamic_cast<const EmbeddingInfo *>(data_type_ptr->type_info().get());
     const EmbeddingDataType embedding_data_type = embedding_info->Type();
     for (const auto *param : index_param_list) {
-        if (param->param_name_ == "encode" && StringToHnswEncodeType(param->param_value_) == HnswEncodeType::kLVQ) {
-            // TODO: now only support float?
+        if (param->param_name_ != "encode") {
+            continue;
+        }
+        // TODO: now only support float?
+        if (HnswEncodeType encode_type = StringToHnswEncodeType(param->param_value_);
+            encode_type == HnswEncodeType::kLVQ || encode_type == HnswEncodeType::kRaBitQ) {
             if (embedding_data_type != EmbeddingDataType::kElemFloat) {
                 RecoverableError(Status::InvalidIndexDefinition(
-                    fmt::format("Attempt to create HNSW index with LVQ encoding on column: {}, data type: {}. now only support float element type.",
+                    fmt::format("Attempt to create HNSW index with {} encoding on column: {}, data type: {}. now only support float element type.",
+                                HnswEncodeTypeToString(encode_type),
                                 column_name,
                                 data_type_ptr->ToString())));
             }
@@ -30,6 +30,7 @@ namespace infinity {
 export enum class HnswEncodeType {
     kPlain,
     kLVQ,
+    kRaBitQ,
     kInvalid,
 };
 
@@ -53,9 +54,10 @@ public:
               HnswEncodeType encode_type,
               SizeT M,
               SizeT ef_construction,
-              SizeT block_size)
+              SizeT block_size,
+              SizeT build_threads = 0)
         : IndexBase(IndexType::kHnsw, index_name, index_comment, file_name, std::move(column_names)), metric_type_(metric_type),
-          encode_type_(encode_type), M_(M), ef_construction_(ef_construction), block_size_(block_size) {}
+          encode_type_(encode_type), M_(M), ef_construction_(ef_construction), block_size_(block_size), build_threads_(build_threads) {}
 
     ~IndexHnsw() final = default;
 
@@ -84,6 +86,9 @@ public:
     const SizeT M_{};
     const SizeT ef_construction_{};
     const SizeT block_size_{};
+    // tasks for concurrent insertion when building, 0 means all dense index building workers
+    // a build-time hint only: it is not written to the binary index definition and not compared
+    const SizeT build_threads_{};
 };
 
 } // namespace infinity
@@ -37,6 +37,17 @@ import create_index_info;
 
 namespace infinity {
 
+// binary layout of IndexIVFOption in WAL and catalog delta entries, build_threads_ is not part of it
+struct IndexIVFOptionBinary {
+    MetricType metric_ = MetricType::kInvalid;
+    IndexIVFCentroidOption centroid_option_;
+    IndexIVFStorageOption storage_option_;
+};
+
+bool IndexIVFOption::operator==(const IndexIVFOption &other) const {
+    return metric_ == other.metric_ && centroid_option_ == other.centroid_option_ && storage_option_ == other.storage_option_;
+}
+
 bool IndexIVF::operator==(const IndexIVF &other) const {
     return (*static_cast<const IndexBase *>(this) == static_cast<const IndexBase &>(other)) && (ivf_option_ == other.ivf_option_);
 }
@@ -45,13 +56,28 @@ bool IndexIVF::operator!=(const IndexIVF &other) const { return !(*this == other
 
 i32 IndexIVF::GetSizeInBytes() const {
     SizeT size = IndexBase::GetSizeInBytes();
-    size += sizeof(ivf_option_);
+    size += sizeof(IndexIVFOptionBinary);
     return size;
 }
 
 void IndexIVF::WriteAdv(char *&ptr) const {
     IndexBase::WriteAdv(ptr);
-    WriteBufAdv(ptr, ivf_option_);
+    IndexIVFOptionBinary option_binary;
+    // keep the padding bytes deterministic
+    std::memset(&option_binary, 0, sizeof(option_binary));
+    option_binary.metric_ = ivf_option_.metric_;
+    option_binary.centroid_option_ = ivf_option_.centroid_option_;
+    option_binary.storage_option_ = ivf_option_.storage_option_;
+    WriteBufAdv(ptr, option_binary);
+}
+
+IndexIVFOption IndexIVF::ReadIndexIVFOptionAdv(const char *&ptr) {
+    const auto option_binary = ReadBufAdv<IndexIVFOptionBinary>(ptr);
+    IndexIVFOption ivf_option;
+    ivf_option.metric_ = option_binary.metric_;
+    ivf_option.centroid_option_ = option_binary.centroid_option_;
+    ivf_option.storage_option_ = option_binary.storage_option_;
+    return ivf_option;
 }
 
 String IndexIVF::ToString() const {
@@ -117,6 +143,9 @@ SharedPtr<IndexIVF> IndexIVF::Make(SharedPtr<String> index_name,
             ivf_option.centroid_option_.max_points_per_centroid_ = GetIntegerFromNodeHandler<u32>(nh);
         }
     }
+    if (const auto nh = params_map.extract("build_threads"); nh) {
+        ivf_option.build_threads_ = GetIntegerFromNodeHandler<u32>(nh);
+    }
     {
         // IndexIVFStorageOption
         if (const auto nh = params_map.extract("storage_type"); nh) {
@@ -345,7 +374,7 @@ NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(IndexIVFStorageOption,
                                    scalar_quantization_bits_,
                                    product_quantization_subspace_num_,
                                    product_quantization_subspace_bits_);
-NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE(IndexIVFOption, metric_, centroid_option_, storage_option_);
+NLOHMANN_DEFINE_TYPE_NON_INTRUSIVE_WITH_DEFAULT(IndexIVFOption, metric_, centroid_option_, storage_option_, build_threads_);
 
 nlohmann::json IndexIVF::Serialize() const {
     nlohmann::json res = IndexBase::Serialize();
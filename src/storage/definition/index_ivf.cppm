@@ -56,7 +56,10 @@ export struct IndexIVFOption {
     MetricType metric_ = MetricType::kInvalid;
     IndexIVFCentroidOption centroid_option_;
     IndexIVFStorageOption storage_option_;
-    bool operator==(const IndexIVFOption &) const = default;
+    // tasks for k-means assignment and insertion when building, 0 means all dense index building workers
+    // a build-time hint only: it is not written to the binary index definition and not compared
+    u32 build_threads_ = 0;
+    bool operator==(const IndexIVFOption &other) const;
 };
 
 export class IndexIVF final : public IndexBase {
@@ -91,6 +94,8 @@ public:
 
     static IndexIVFOption DeserializeIndexIVFOption(const nlohmann::json &ivf_option_json);
 
+    static IndexIVFOption ReadIndexIVFOptionAdv(const char *&ptr);
+
     void ValidateColumnDataType(const SharedPtr<BaseTableRef> &base_table_ref, const String &column_name);
 
     IndexIVFOption ivf_option_;
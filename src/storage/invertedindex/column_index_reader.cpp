@@ -24,6 +24,7 @@ import stl;
 import segment_posting;
 import index_segment_reader;
 import posting_iterator;
+import term_meta;
 import index_defines;
 import disk_index_segment_reader;
 import inmem_index_segment_reader;
@@ -77,12 +78,17 @@ void ColumnIndexReader::Open(optionflag_t flag, String &&index_dir, Map<SegmentI
     }
 }
 
-UniquePtr<PostingIterator> ColumnIndexReader::Lookup(const String &term, bool fetch_position) {
+UniquePtr<PostingIterator> ColumnIndexReader::Lookup(const String &term, bool fetch_position, const Vector<SegmentID> *segment_ids) {
     SharedPtr<Vector<SegmentPosting>> seg_postings = MakeShared<Vector<SegmentPosting>>();
+    u32 total_doc_freq = 0;
     for (u32 i = 0; i < segment_readers_.size(); ++i) {
         SegmentPosting seg_posting;
         auto ret = segment_readers_[i]->GetSegmentPosting(term, seg_posting, fetch_position);
         if (ret) {
+            total_doc_freq += seg_posting.GetTermMeta().GetDocFreq();
+            if (segment_ids != nullptr && !std::binary_search(segment_ids->begin(), segment_ids->end(), segment_readers_[i]->segment_id())) {
+                continue;
+            }
             seg_postings->push_back(seg_posting);
         }
     }
@@ -92,9 +98,22 @@ UniquePtr<PostingIterator> ColumnIndexReader::Lookup(const String &term, bool fe
     auto iter = MakeUnique<PostingIterator>(flag_);
     u32 state_pool_size = 0; // TODO
     iter->Init(std::move(seg_postings), state_pool_size);
+    if (segment_ids != nullptr) {
+        iter->SetDocFreq(total_doc_freq);
+    }
     return iter;
 }
 
+Vector<SegmentID> ColumnIndexReader::GetIndexedSegmentIDs() const {
+    Vector<SegmentID> segment_ids;
+    for (const auto &segment_reader : segment_readers_) {
+        if (segment_ids.empty() || segment_ids.back() != segment_reader->segment_id()) {
+            segment_ids.push_back(segment_reader->segment_id());
+        }
+    }
+    return segment_ids;
+}
+
 Pair<u64, float> ColumnIndexReader::GetTotalDfAndAvgColumnLength() {
     std::lock_guard lock(mutex_);
     if (total_df_ == 0) {
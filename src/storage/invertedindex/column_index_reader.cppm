@@ -38,10 +38,15 @@ export class ColumnIndexReader {
 public:
     void Open(optionflag_t flag, String &&index_dir, Map<SegmentID, SharedPtr<SegmentIndexEntry>> &&index_by_segment, Txn *txn);
 
-    UniquePtr<PostingIterator> Lookup(const String &term, bool fetch_position = true);
+    // If segment_ids (sorted) is given, only postings of those segments are iterated, but the document frequency of the
+    // returned iterator still counts the whole column so that scores match an unrestricted lookup.
+    UniquePtr<PostingIterator> Lookup(const String &term, bool fetch_position = true, const Vector<SegmentID> *segment_ids = nullptr);
 
     Pair<u64, float> GetTotalDfAndAvgColumnLength();
 
+    // Segments with at least one chunk or in-memory index to read, in ascending order.
+    Vector<SegmentID> GetIndexedSegmentIDs() const;
+
     optionflag_t GetOptionFlag() const { return flag_; }
 
     void InvalidateSegment(SegmentID segment_id);
@@ -29,6 +29,9 @@ public:
 
     u32 GetDocFreq() const { return doc_freq_; }
 
+    // used when only a part of the segments is iterated but scoring needs the document frequency of all of them
+    void SetDocFreq(u32 doc_freq) { doc_freq_ = doc_freq; }
+
     bool SkipTo(RowID doc_id);
 
     RowID PrevBlockLastDocID() const { return last_doc_id_in_prev_block_; }
@@ -25,6 +25,7 @@ import base_expression;
 import roaring_bitmap;
 import table_entry;
 import column_index_reader;
+import default_values;
 
 namespace infinity {
 
@@ -44,7 +45,7 @@ public:
             }
             doc_id = query_iterator_->DocID();
             // check filter
-            if (common_query_filter_ == nullptr || common_query_filter_->PassFilter(doc_id)) {
+            if (common_query_filter_ == nullptr || PassFilter(doc_id)) {
                 doc_id_ = doc_id;
                 return true;
             }
@@ -62,8 +63,29 @@ public:
     void PrintTree(std::ostream &os, const String &prefix, bool is_final) const override;
 
 private:
+    // Same as CommonQueryFilter::PassFilter, but keeps the segment cursor in the iterator
+    // so that iterators over different segments can share one filter concurrently.
+    bool PassFilter(RowID doc_id) {
+        if (common_query_filter_->AlwaysTrue()) [[unlikely]] {
+            return true;
+        }
+        if (doc_id.segment_id_ != current_segment_id_) [[unlikely]] {
+            const auto &filter_result = common_query_filter_->filter_result_;
+            const auto it = filter_result.find(doc_id.segment_id_);
+            if (it == filter_result.end()) [[unlikely]] {
+                current_segment_id_ = INVALID_SEGMENT_ID;
+                return false;
+            }
+            current_segment_id_ = doc_id.segment_id_;
+            doc_id_bitmask_ = &(it->second);
+        }
+        return doc_id_bitmask_->IsTrue(doc_id.segment_offset_);
+    }
+
     CommonQueryFilter *common_query_filter_{};
     UniquePtr<DocIterator> query_iterator_{};
+    SegmentID current_segment_id_ = INVALID_SEGMENT_ID;
+    const Bitmask *doc_id_bitmask_ = nullptr;
 };
 
 // use QueryNodeType::FILTER
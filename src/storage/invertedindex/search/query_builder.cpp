@@ -57,7 +57,8 @@ UniquePtr<DocIterator> QueryBuilder::CreateSearch(FullTextQueryContext &context)
                                     context.ft_similarity_,
                                     context.minimum_should_match_,
                                     context.topn_,
-                                    context.index_names_};
+                                    context.index_names_,
+                                    context.segment_ids_};
     auto result = context.optimized_query_tree_->CreateSearch(params);
 #ifdef INFINITY_DEBUG
     {
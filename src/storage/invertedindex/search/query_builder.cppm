@@ -39,6 +39,8 @@ export struct FullTextQueryContext {
     u32 topn_ = 0;
     EarlyTermAlgo early_term_algo_ = EarlyTermAlgo::kNaive;
     const Vector<String> &index_names_;
+    // restrict the created iterator to these segments, nullptr means all segments
+    const Vector<SegmentID> *segment_ids_ = nullptr;
     FullTextQueryContext(const FulltextSimilarity ft_similarity,
                          const MinimumShouldMatchOption &minimum_should_match_option,
                          const u32 topn,
@@ -416,7 +416,7 @@ std::unique_ptr<DocIterator> TermQueryNode::CreateSearch(const CreateSearchParam
     if (option_flag & OptionFlag::of_position_list) {
         fetch_position = true;
     }
-    auto posting_iterator = column_index_reader->Lookup(term_, fetch_position);
+    auto posting_iterator = column_index_reader->Lookup(term_, fetch_position, params.segment_ids);
     if (!posting_iterator) {
         return nullptr;
     }
@@ -442,7 +442,7 @@ std::unique_ptr<DocIterator> PhraseQueryNode::CreateSearch(const CreateSearchPar
     }
     Vector<std::unique_ptr<PostingIterator>> posting_iterators;
     for (auto &term : terms_) {
-        auto posting_iterator = column_index_reader->Lookup(term, fetch_position);
+        auto posting_iterator = column_index_reader->Lookup(term, fetch_position, params.segment_ids);
         if (nullptr == posting_iterator) {
             return nullptr;
         }
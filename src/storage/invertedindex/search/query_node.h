@@ -62,7 +62,11 @@ struct CreateSearchParams {
     uint32_t minimum_should_match;
     uint32_t topn;
     const std::vector<std::string> &index_names_;
-    [[nodiscard]] CreateSearchParams RemoveMSM() const { return {table_entry, index_reader, early_term_algo, ft_similarity, 0, topn, index_names_}; }
+    // if not nullptr, only postings of these (sorted) segments are looked up, document frequencies stay table-wide
+    const std::vector<uint32_t> *segment_ids = nullptr;
+    [[nodiscard]] CreateSearchParams RemoveMSM() const {
+        return {table_entry, index_reader, early_term_algo, ft_similarity, 0, topn, index_names_, segment_ids};
+    }
 };
 
 // step 1. get the query tree from parser
@@ -18,6 +18,7 @@ module;
 #include <unistd.h>
 #include <cerrno>
 #include <cstring>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
 module local_file_handle;
@@ -117,6 +118,23 @@ Tuple<SizeT, Status> LocalFileHandle::Read(void *buffer, u64 nbytes) {
     return {read_n, Status::OK()};
 }
 
+Tuple<SizeT, Status> LocalFileHandle::ReadAt(void *buffer, u64 nbytes, u64 offset) {
+    i64 read_n = 0;
+    while (read_n < (i64)nbytes) {
+        SizeT a = nbytes - read_n;
+        i64 read_count = pread(fd_, (char *)buffer + read_n, a, offset + read_n);
+        if (read_count == 0) {
+            break;
+        }
+        if (read_count == -1) {
+            String error_message = fmt::format("Can't read file: {}: {}", path_, strerror(errno));
+            UnrecoverableError(error_message);
+        }
+        read_n += read_count;
+    }
+    return {read_n, Status::OK()};
+}
+
 Tuple<SizeT, Status> LocalFileHandle::Read(String &buffer, u64 nbytes) {
     i64 read_n = 0;
     while (read_n < (i64)nbytes) {
@@ -150,9 +168,24 @@ i64 LocalFileHandle::FileSize() {
     return s.st_size;
 }
 
-Tuple<char *, SizeT, Status> LocalFileHandle::MmapRead(const String &name) { return {nullptr, 0, Status::OK()}; }
+Tuple<const char *, Status> LocalFileHandle::MmapRead(u64 offset, u64 nbytes) {
+    static const u64 page_size = getpagesize();
+    u64 page_offset = offset % page_size;
+    void *addr = mmap(nullptr, nbytes + page_offset, PROT_READ, MAP_PRIVATE, fd_, offset - page_offset);
+    if (addr == MAP_FAILED) {
+        return {nullptr, Status::MmapFileError(fmt::format("{}: {}", path_, strerror(errno)))};
+    }
+    return {static_cast<const char *>(addr) + page_offset, Status::OK()};
+}
 
-Status LocalFileHandle::Unmmap(const String &name) { return Status::OK(); }
+Status LocalFileHandle::Unmmap(const char *data, u64 nbytes) {
+    static const u64 page_size = getpagesize();
+    u64 page_offset = reinterpret_cast<u64>(data) % page_size;
+    if (munmap(const_cast<char *>(data - page_offset), nbytes + page_offset) == -1) {
+        return Status::MunmapFileError(strerror(errno));
+    }
+    return Status::OK();
+}
 
 Status LocalFileHandle::Sync() {
     if(access_mode_ != FileAccessMode::kWrite) {
@@ -163,4 +196,16 @@ Status LocalFileHandle::Sync() {
     return Status::OK();
 }
 
+Status LocalFileHandle::SyncData() {
+    if (access_mode_ != FileAccessMode::kWrite) {
+        return Status::OK();
+    }
+
+    if (fdatasync(fd_) == -1) {
+        String error_message = fmt::format("Can't sync file: {}: {}", path_, strerror(errno));
+        return Status::IOError(error_message);
+    }
+    return Status::OK();
+}
+
 } // namespace infinity
@@ -38,11 +38,17 @@ public:
     Status Append(const String &buffer, u64 nbytes);
     Tuple<SizeT, Status> Read(void *buffer, u64 nbytes);
     Tuple<SizeT, Status> Read(String &buffer, u64 nbytes);
+    // Positional read, doesn't move the file offset so it can be shared by concurrent readers
+    Tuple<SizeT, Status> ReadAt(void *buffer, u64 nbytes, u64 offset);
     Status Seek(u64 nbytes);
     i64 FileSize();
-    Tuple<char *, SizeT, Status> MmapRead(const String &name);
-    Status Unmmap(const String &name);
+    // Map [offset, offset + nbytes) of the file read only, the returned pointer points to `offset`.
+    // The mapping stays valid after the file is closed or removed until it is released by Unmmap with the same pointer and size.
+    Tuple<const char *, Status> MmapRead(u64 offset, u64 nbytes);
+    static Status Unmmap(const char *data, u64 nbytes);
     Status Sync();
+    // fdatasync, skips the metadata which isn't needed to read the data back, such as mtime
+    Status SyncData();
 
 public:
     i32 FileDescriptor() const {
@@ -26,12 +26,14 @@ import blocking_queue;
 import infinity_exception;
 import third_party;
 import virtual_store;
+import default_values;
 
 namespace fs = std::filesystem;
 
 namespace infinity {
 
 void ObjectStorageProcess::Start() {
+    download_pool_ = MakeUnique<ThreadPool>(DEFAULT_OBJECT_STORAGE_DOWNLOAD_THREAD_NUM);
     processor_thread_ = Thread([this] { Process(); });
     LOG_INFO("Object storage processor is started.");
 }
@@ -42,6 +44,8 @@ void ObjectStorageProcess::Stop() {
     task_queue_.Enqueue(stop_task);
     stop_task->Wait();
     processor_thread_.join();
+    download_pool_->stop(true);
+    download_pool_.reset();
     LOG_INFO("Object storage processor is stopped.");
 }
 
@@ -55,6 +59,7 @@ void ObjectStorageProcess::Process() {
     Deque<SharedPtr<BaseObjectStorageTask>> tasks;
     while (running) {
         task_queue_.DequeueBulk(tasks);
+        SizeT dispatched_count = 0;
         for (const auto &object_storage_task : tasks) {
             switch (object_storage_task->type_) {
                 case ObjectStorageTaskType::kStopProcessor: {
@@ -70,9 +75,14 @@ void ObjectStorageProcess::Process() {
                     LOG_TRACE("Download task");
                     DownloadTask *download_task = static_cast<DownloadTask *>(object_storage_task.get());
                     assert(download_task != nullptr);
-                    VirtualStore::s3_client_->DownloadObject(VirtualStore::bucket_, download_task->object_name, download_task->file_dir);
-                    LOG_TRACE("Download task done");
-                    break;
+                    // The task is completed by the download pool
+                    download_pool_->push([this, object_storage_task](int) {
+                        Download(static_cast<DownloadTask *>(object_storage_task.get()));
+                        object_storage_task->Complete();
+                        --task_count_;
+                    });
+                    ++dispatched_count;
+                    continue;
                 }
                 case ObjectStorageTaskType::kUpload: {
                     LOG_TRACE("Upload task");
@@ -117,9 +127,25 @@ void ObjectStorageProcess::Process() {
             task_text_.clear();
             object_storage_task->Complete();
         }
-        task_count_ -= tasks.size();
+        task_count_ -= tasks.size() - dispatched_count;
         tasks.clear();
     }
 }
 
+void ObjectStorageProcess::Download(DownloadTask *download_task) {
+    if (download_task->length == 0) {
+        VirtualStore::s3_client_->DownloadObject(VirtualStore::bucket_, download_task->object_name, download_task->file_dir);
+    } else {
+        VirtualStore::s3_client_->DownloadObjectRange(VirtualStore::bucket_,
+                                                      download_task->object_name,
+                                                      download_task->file_dir,
+                                                      download_task->offset,
+                                                      download_task->length);
+    }
+    LOG_TRACE("Download task done");
+    if (download_task->done_callback) {
+        download_task->done_callback();
+    }
+}
+
 } // namespace infinity
@@ -47,11 +47,16 @@ public:
 private:
     void Process();
 
+    void Download(DownloadTask *download_task);
+
 private:
     BlockingQueue<SharedPtr<BaseObjectStorageTask>> task_queue_{"ObjectStorageProcess"};
 
     Thread processor_thread_{};
 
+    // Downloads run concurrently on the pool, the other tasks run on the processor thread in submit order
+    UniquePtr<ThreadPool> download_pool_{};
+
     Atomic<u64> task_count_{};
 
     mutable std::mutex task_mutex_;
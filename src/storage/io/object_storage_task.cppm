@@ -63,11 +63,18 @@ export struct BaseObjectStorageTask {
 export struct DownloadTask final : public BaseObjectStorageTask {
     DownloadTask(const String &_file_dir, const String& _object_name) : BaseObjectStorageTask(ObjectStorageTaskType::kDownload) , file_dir(_file_dir), object_name(_object_name){}
 
+    // Download the byte range [_offset, _offset + _length) of the object into the same range of the file
+    DownloadTask(const String &_file_dir, const String &_object_name, SizeT _offset, SizeT _length)
+        : BaseObjectStorageTask(ObjectStorageTaskType::kDownload), file_dir(_file_dir), object_name(_object_name), offset(_offset), length(_length) {}
+
     ~DownloadTask() = default;
 
     String ToString() const final { return "Download Task"; }
     String file_dir;
     String object_name;
+    SizeT offset{};
+    SizeT length{}; // 0 means the whole object
+    std::function<void()> done_callback{}; // called after the download when nobody waits for the task
 };
 
 export struct UploadTask final : public BaseObjectStorageTask {
@@ -20,6 +20,10 @@ public:
 
     virtual Status DownloadObject(const String &bucket_name, const String &object_name, const String &file_path) = 0;
 
+    // Download bytes [offset, offset + length) of the object and write them at the same offset of file_path.
+    // The file is created if it doesn't exist, the other bytes of the file are left as is.
+    virtual Status DownloadObjectRange(const String &bucket_name, const String &object_name, const String &file_path, SizeT offset, SizeT length) = 0;
+
     virtual Status UploadObject(const String &bucket_name, const String &object_name, const String &file_path) = 0;
 
     virtual Status RemoveObject(const String &bucket_name, const String &object_name) = 0;
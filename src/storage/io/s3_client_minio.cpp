@@ -1,5 +1,7 @@
 module;
 
+#include <filesystem>
+#include <fstream>
 #include <string>
 
 module s3_client_minio;
@@ -41,6 +43,45 @@ Status S3ClientMinio::DownloadObject(const String &bucket_name, const String &ob
     return Status::OK();
 }
 
+Status S3ClientMinio::DownloadObjectRange(const String &bucket_name,
+                                          const String &object_name,
+                                          const String &file_path,
+                                          SizeT offset,
+                                          SizeT length) {
+    if (!std::filesystem::exists(file_path)) {
+        std::ofstream create_file(file_path, std::ios::binary);
+    }
+    std::fstream out_file(file_path, std::ios::in | std::ios::out | std::ios::binary);
+    if (!out_file.is_open()) {
+        UnrecoverableError(fmt::format("Failed to open file {}", file_path));
+    }
+    out_file.seekp(offset);
+
+    // Create get object arguments with a byte range.
+    minio::s3::GetObjectArgs args;
+    args.bucket = bucket_name;
+    args.object = object_name;
+    args.offset = &offset;
+    args.length = &length;
+    args.datafunc = [&out_file](minio::http::DataFunctionArgs data_args) -> bool {
+        out_file.write(data_args.datachunk.data(), data_args.datachunk.size());
+        return out_file.good();
+    };
+
+    // Call get object.
+    LOG_TRACE(fmt::format("Downloading object {} range [{}, {}) from {} to {}", object_name, offset, offset + length, bucket_name, file_path));
+    minio::s3::GetObjectResponse resp = client_->GetObject(args);
+
+    // Handle response.
+    if (resp) {
+        LOG_TRACE(fmt::format("{}/{} range [{}, {}) downloaded to {} successfully", bucket_name, object_name, offset, offset + length, file_path));
+    } else {
+        UnrecoverableError(fmt::format("Unable to download object: {}/{}, reason: {}", bucket_name, object_name, resp.Error().String()));
+    }
+    out_file.close();
+    return Status::OK();
+}
+
 Status S3ClientMinio::UploadObject(const String &bucket_name, const String &object_name, const String &file_path) {
     // Create upload object arguments.
     minio::s3::UploadObjectArgs args;
@@ -31,6 +31,7 @@ public:
     Status UnInit() final;
 
     Status DownloadObject(const String &bucket_name, const String &object_name, const String &file_path) final;
+    Status DownloadObjectRange(const String &bucket_name, const String &object_name, const String &file_path, SizeT offset, SizeT length) final;
     Status UploadObject(const String &bucket_name, const String &object_name, const String &file_path) final;
     Status RemoveObject(const String &bucket_name, const String &object_name) final;
     Status
@@ -46,6 +46,10 @@ bool StreamReader::ReadLine(String& line) {
     }
 }
 
+void StreamReader::Seek(SizeT offset) {
+    file_.seekg(offset);
+}
+
 void StreamReader::Close() {
     file_.close();
 }
@@ -31,6 +31,7 @@ public:
 
     Status Init(const String& file_name);
     bool ReadLine(String& line);
+    void Seek(SizeT offset);
     void Close();
 
 private:
@@ -514,6 +514,52 @@ Status VirtualStore::DownloadObject(const String &file_path, const String &objec
     return Status::OK();
 }
 
+Status VirtualStore::DownloadObjectRange(const String &file_path, const String &object_name, SizeT offset, SizeT length) {
+    if (VirtualStore::storage_type_ == StorageType::kLocal) {
+        return Status::OK();
+    }
+    switch (VirtualStore::storage_type_) {
+        case StorageType::kMinio: {
+            auto download_task = MakeShared<DownloadTask>(file_path, object_name, offset, length);
+            auto object_storage_processor = infinity::InfinityContext::instance().storage()->object_storage_processor();
+            object_storage_processor->Submit(download_task);
+            download_task->Wait();
+            break;
+        }
+        default: {
+            return Status::NotSupport("Not support storage type");
+        }
+    }
+
+    return Status::OK();
+}
+
+Status VirtualStore::PrefetchObjectRange(const String &file_path,
+                                         const String &object_name,
+                                         SizeT offset,
+                                         SizeT length,
+                                         std::function<void()> done_callback) {
+    if (VirtualStore::storage_type_ == StorageType::kLocal) {
+        done_callback();
+        return Status::OK();
+    }
+    switch (VirtualStore::storage_type_) {
+        case StorageType::kMinio: {
+            auto download_task = MakeShared<DownloadTask>(file_path, object_name, offset, length);
+            download_task->done_callback = std::move(done_callback);
+            auto object_storage_processor = infinity::InfinityContext::instance().storage()->object_storage_processor();
+            object_storage_processor->Submit(download_task);
+            break;
+        }
+        default: {
+            done_callback();
+            return Status::NotSupport("Not support storage type");
+        }
+    }
+
+    return Status::OK();
+}
+
 Status VirtualStore::UploadObject(const String &file_path, const String &object_name) {
     if (VirtualStore::storage_type_ == StorageType::kLocal) {
         return Status::OK();
@@ -84,6 +84,10 @@ public:
     static bool IsInit();
     static Status CreateBucket();
     static Status DownloadObject(const String &file_dir, const String &object_name);
+    // Download the byte range [offset, offset + length) of the object to the same range of file_dir
+    static Status DownloadObjectRange(const String &file_dir, const String &object_name, SizeT offset, SizeT length);
+    // Same as DownloadObjectRange but doesn't wait, done_callback is called when the range is downloaded
+    static Status PrefetchObjectRange(const String &file_dir, const String &object_name, SizeT offset, SizeT length, std::function<void()> done_callback);
     static Status UploadObject(const String &file_dir, const String &object_name);
     static Status RemoveObject(const String &object_name);
     static Status CopyObject(const String &src_object_name, const String &dst_object_name);
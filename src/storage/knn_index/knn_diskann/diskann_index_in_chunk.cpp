@@ -0,0 +1,313 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cstring>
+
+module diskann_index_in_chunk;
+
+import stl;
+import index_base;
+import index_diskann;
+import column_def;
+import data_type;
+import embedding_info;
+import internal_types;
+import logical_type;
+import segment_entry;
+import block_entry;
+import buffer_manager;
+import column_vector;
+import infinity_exception;
+import status;
+import default_values;
+import logger;
+import third_party;
+import serialize;
+import uuid;
+import local_file_handle;
+import virtual_store;
+import diskann_index_data;
+import diskann_dist_func;
+import pq_flash_index;
+
+namespace infinity {
+
+namespace {
+
+constexpr SizeT kCopyBufferSize = 1024 * 1024;
+
+void CopyFileRange(LocalFileHandle &dst_handle, const String &src_path, u64 src_offset, u64 size) {
+    auto [src_handle, status] = VirtualStore::Open(src_path, FileAccessMode::kRead);
+    if (!status.ok()) {
+        UnrecoverableError(status.message());
+    }
+    auto buffer = MakeUniqueForOverwrite<char[]>(kCopyBufferSize);
+    u64 copied = 0;
+    while (copied < size) {
+        const u64 read_size = std::min<u64>(kCopyBufferSize, size - copied);
+        auto [read_n, read_status] = src_handle->ReadAt(buffer.get(), read_size, src_offset + copied);
+        if (read_n != read_size) {
+            UnrecoverableError(fmt::format("DiskAnn index: failed to read {} bytes at {} of {}", read_size, src_offset + copied, src_path));
+        }
+        dst_handle.Append(buffer.get(), read_size);
+        copied += read_size;
+    }
+}
+
+} // namespace
+
+DiskAnnIndexInChunk::DiskAnnIndexInChunk(u32 dimension, u32 R, u32 L, u32 num_pq_chunks)
+    : dimension_(dimension), R_(R), L_(L), num_pq_chunks_(num_pq_chunks) {}
+
+DiskAnnIndexInChunk::~DiskAnnIndexInChunk() {
+    flash_index_.reset();
+    if (!source_dir_.empty()) {
+        if (Status status = VirtualStore::RemoveDirectory(source_dir_); !status.ok()) {
+            LOG_WARN(fmt::format("Failed to remove DiskAnn build directory {}: {}", source_dir_, status.message()));
+        }
+    }
+}
+
+const char *DiskAnnIndexInChunk::PartFileName(SizeT part) {
+    // file names expected by PqFlashIndex::Load(index_prefix)
+    switch (part) {
+        case kPqPivot: {
+            return "pq_pivot.bin";
+        }
+        case kPqCompressedData: {
+            return "pqCompressed_data.bin";
+        }
+        case kDiskIndex: {
+            return "index.bin";
+        }
+        default: {
+            UnrecoverableError(fmt::format("Invalid DiskAnn index part: {}", part));
+        }
+    }
+    return nullptr;
+}
+
+void DiskAnnIndexInChunk::BuildDiskAnnIndex(const RowID base_rowid,
+                                            const u32 row_count,
+                                            const SegmentEntry *segment_entry,
+                                            const SharedPtr<ColumnDef> &column_def,
+                                            BufferManager *buffer_mgr) {
+    if (segment_entry->segment_id() != base_rowid.segment_id_) {
+        UnrecoverableError(fmt::format("{}: segment_id mismatch: segment_entry_id: {}, row_id_segment_id: {}.",
+                                       __func__,
+                                       segment_entry->segment_id(),
+                                       base_rowid.segment_id_));
+    }
+    if (flash_index_ != nullptr) {
+        UnrecoverableError("DiskAnn index is already built");
+    }
+    // PQ training needs more rows than the pq centers
+    if (row_count <= DISKANN_NUM_CENTERS) {
+        UnrecoverableError(fmt::format("{}: {} rows are too few to build DiskAnn index", __func__, row_count));
+    }
+
+    String build_dir = fmt::format("{}/diskann_{}", *buffer_mgr->GetTempDir(), UUID().to_string());
+    if (Status status = VirtualStore::MakeDirectory(build_dir); !status.ok()) {
+        RecoverableError(status);
+    }
+    source_dir_ = build_dir;
+
+    // 1. dump the vectors of the rows into the data file of the build
+    String data_file_path = fmt::format("{}/data.bin", build_dir);
+    {
+        auto [data_file_handle, status] = VirtualStore::Open(data_file_path, FileAccessMode::kWrite);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        Vector<SharedPtr<BlockEntry>> block_entries;
+        {
+            const BlocksGuard blocks_guard = segment_entry->GetBlocksGuard();
+            block_entries = blocks_guard.block_entries_;
+        }
+        const ColumnID column_id = column_def->id();
+        BlockID block_id = base_rowid.segment_offset_ / DEFAULT_BLOCK_CAPACITY;
+        BlockOffset block_offset = base_rowid.segment_offset_ % DEFAULT_BLOCK_CAPACITY;
+        u32 segment_row_to_read = row_count;
+        while (segment_row_to_read) {
+            const auto block_row_to_read = std::min<u32>(segment_row_to_read, DEFAULT_BLOCK_CAPACITY - block_offset);
+            ColumnVector column_vector(block_entries[block_id]->GetConstColumnVector(buffer_mgr, column_id));
+            const auto *block_data = reinterpret_cast<const f32 *>(column_vector.data()) + block_offset * dimension_;
+            data_file_handle->Append(block_data, sizeof(f32) * dimension_ * block_row_to_read);
+            segment_row_to_read -= block_row_to_read;
+            ++block_id;
+            block_offset = 0;
+        }
+    }
+
+    // 2. build the vamana graph and the pq data, node i of the graph is row i of the chunk
+    {
+        Vector<SizeT> labels(row_count);
+        std::iota(labels.begin(), labels.end(), 0);
+        // num_parts is ignored, merging vamana graphs of several parts is not supported by the builder
+        auto index_data = DiskAnnIndexData<f32, SizeT, MetricType::kMetricL2>::Make(dimension_, row_count, R_, L_, num_pq_chunks_, 1);
+        index_data->BuildIndex(dimension_,
+                               row_count,
+                               labels,
+                               Path(data_file_path),
+                               Path(fmt::format("{}/mem_index.bin", build_dir)),
+                               Path(fmt::format("{}/{}", build_dir, PartFileName(kDiskIndex))),
+                               Path(fmt::format("{}/{}", build_dir, PartFileName(kPqCompressedData))),
+                               Path(build_dir),
+                               Path(fmt::format("{}/{}", build_dir, PartFileName(kPqPivot))));
+    }
+    VirtualStore::DeleteFile(data_file_path);
+    VirtualStore::DeleteFile(fmt::format("{}/train_data.bin", build_dir));
+    VirtualStore::DeleteFile(fmt::format("{}/train_ids.bin", build_dir));
+
+    row_count_ = row_count;
+    for (SizeT part = 0; part < kPartCount; ++part) {
+        part_offsets_[part] = 0;
+        part_sizes_[part] = VirtualStore::GetFileSize(fmt::format("{}/{}", build_dir, PartFileName(part)));
+    }
+
+    // 3. load the built index so that it can be searched before it's saved
+    flash_index_ = PqFlashIndex<f32, SizeT>::Make(DiskAnnMetricType::L2, dimension_, row_count_, num_pq_chunks_);
+    flash_index_->Load(build_dir, DISKANN_SEARCH_SCRATCH_NUM);
+    CacheNodes();
+}
+
+// Index file: a header sector, then the pq pivot, the pq compressed data and the disk index, each aligned to a sector.
+// header: [dimension(u32), row_count(u32), num_pq_chunks(u32), reserved(u32), part offsets(u64 * 3), part sizes(u64 * 3)]
+void DiskAnnIndexInChunk::SaveIndexInner(LocalFileHandle &file_handle) const {
+    if (flash_index_ == nullptr) {
+        UnrecoverableError("DiskAnn index is not built");
+    }
+    if (source_dir_.empty() && source_file_ == file_handle.Path()) {
+        UnrecoverableError(fmt::format("DiskAnn index can't be saved to the file it's loaded from: {}", source_file_));
+    }
+    Array<u64, kPartCount> file_offsets{};
+    u64 file_offset = DISKANN_SECTOR_LEN;
+    for (SizeT part = 0; part < kPartCount; ++part) {
+        file_offsets[part] = file_offset;
+        file_offset = RoundUp(file_offset + part_sizes_[part], DISKANN_SECTOR_LEN);
+    }
+
+    auto sector = MakeUnique<char[]>(DISKANN_SECTOR_LEN);
+    std::memset(sector.get(), 0, DISKANN_SECTOR_LEN);
+    char *ptr = sector.get();
+    WriteBufAdv(ptr, dimension_);
+    WriteBufAdv(ptr, row_count_);
+    WriteBufAdv(ptr, num_pq_chunks_);
+    WriteBufAdv(ptr, u32(0));
+    for (SizeT part = 0; part < kPartCount; ++part) {
+        WriteBufAdv(ptr, file_offsets[part]);
+    }
+    for (SizeT part = 0; part < kPartCount; ++part) {
+        WriteBufAdv(ptr, part_sizes_[part]);
+    }
+    file_handle.Append(sector.get(), DISKANN_SECTOR_LEN);
+
+    std::memset(sector.get(), 0, DISKANN_SECTOR_LEN);
+    for (SizeT part = 0; part < kPartCount; ++part) {
+        if (source_dir_.empty()) {
+            CopyFileRange(file_handle, source_file_, source_offset_ + part_offsets_[part], part_sizes_[part]);
+        } else {
+            CopyFileRange(file_handle, fmt::format("{}/{}", source_dir_, PartFileName(part)), 0, part_sizes_[part]);
+        }
+        if (const u64 padding = RoundUp(part_sizes_[part], DISKANN_SECTOR_LEN) - part_sizes_[part]; padding > 0) {
+            file_handle.Append(sector.get(), padding);
+        }
+    }
+}
+
+void DiskAnnIndexInChunk::ReadIndexInner(LocalFileHandle &file_handle, u64 base_offset) {
+    if (flash_index_ != nullptr) {
+        UnrecoverableError("DiskAnn index is already loaded");
+    }
+    auto sector = MakeUniqueForOverwrite<char[]>(DISKANN_SECTOR_LEN);
+    if (auto [read_n, status] = file_handle.Read(sector.get(), DISKANN_SECTOR_LEN); read_n != DISKANN_SECTOR_LEN) {
+        UnrecoverableError(fmt::format("DiskAnn index: failed to read the header of {}", file_handle.Path()));
+    }
+    const char *ptr = sector.get();
+    const auto dimension = ReadBufAdv<u32>(ptr);
+    row_count_ = ReadBufAdv<u32>(ptr);
+    const auto num_pq_chunks = ReadBufAdv<u32>(ptr);
+    ReadBufAdv<u32>(ptr);
+    for (SizeT part = 0; part < kPartCount; ++part) {
+        part_offsets_[part] = ReadBufAdv<u64>(ptr);
+    }
+    for (SizeT part = 0; part < kPartCount; ++part) {
+        part_sizes_[part] = ReadBufAdv<u64>(ptr);
+    }
+    if (dimension != dimension_ || num_pq_chunks != num_pq_chunks_) {
+        UnrecoverableError(fmt::format("DiskAnn index file {} mismatch: dimension {} vs {}, num_pq_chunks {} vs {}",
+                                       file_handle.Path(),
+                                       dimension,
+                                       dimension_,
+                                       num_pq_chunks,
+                                       num_pq_chunks_));
+    }
+    source_file_ = file_handle.Path();
+    source_offset_ = base_offset;
+
+    flash_index_ = PqFlashIndex<f32, SizeT>::Make(DiskAnnMetricType::L2, dimension_, row_count_, num_pq_chunks_);
+    flash_index_->Load(file_handle,
+                       base_offset + part_offsets_[kPqPivot],
+                       base_offset + part_offsets_[kPqCompressedData],
+                       base_offset + part_offsets_[kDiskIndex],
+                       DISKANN_SEARCH_SCRATCH_NUM);
+    CacheNodes();
+}
+
+// Keep the nodes close to the entry point in memory, every search starts from them.
+void DiskAnnIndexInChunk::CacheNodes() {
+    const u64 node_size = dimension_ * sizeof(f32) + (R_ + 1) * sizeof(SizeT);
+    const u64 cache_budget = DISKANN_SPACE_FOR_CACHED_NODES_IN_GB * 1024 * 1024 * 1024 / node_size;
+    const u64 num_nodes_to_cache = std::min<u64>({DISKANN_NUM_NODES_TO_CACHE, cache_budget, row_count_ / 20});
+    if (num_nodes_to_cache == 0) {
+        return;
+    }
+    Vector<SizeT> node_list;
+    flash_index_->CacheBfsLevels(num_nodes_to_cache, node_list);
+    flash_index_->LoadCacheList(node_list);
+}
+
+SizeT DiskAnnIndexInChunk::Search(const f32 *query, u32 result_limit, u32 search_l, u32 beam_width, f32 *distances, SegmentOffset *offsets) const {
+    if (flash_index_ == nullptr) {
+        UnrecoverableError("DiskAnn index is not loaded");
+    }
+    result_limit = std::min(result_limit, row_count_);
+    search_l = std::max(search_l, result_limit);
+    auto node_ids = MakeUniqueForOverwrite<u64[]>(result_limit);
+    const u64 result_n = flash_index_->CachedBeamSearch(query, result_limit, search_l, node_ids.get(), distances, beam_width);
+    for (u64 i = 0; i < result_n; ++i) {
+        offsets[i] = node_ids[i];
+    }
+    return result_n;
+}
+
+DiskAnnIndexInChunk *DiskAnnIndexInChunk::GetNewDiskAnnIndexInChunk(const IndexBase *index_base, const ColumnDef *column_def) {
+    const auto *diskann_index = static_cast<const IndexDiskAnn *>(index_base);
+    const auto *data_type = column_def->type().get();
+    if (data_type->type() != LogicalType::kEmbedding) {
+        UnrecoverableError("Invalid DataType for DiskAnn index");
+    }
+    const auto *embedding_info = static_cast<const EmbeddingInfo *>(data_type->type_info().get());
+    if (embedding_info->Type() != EmbeddingDataType::kElemFloat) {
+        UnrecoverableError("Invalid embedding data type for DiskAnn index");
+    }
+    const u32 dimension = embedding_info->Dimension();
+    // same clamp as the builder, the pq chunk count is part of the index file
+    const u32 num_pq_chunks = std::clamp<u32>(diskann_index->num_pq_chunks_, 1, std::min<u32>(dimension, DISKANN_MAX_PQ_CHUNKS));
+    return new DiskAnnIndexInChunk(dimension, diskann_index->R_, diskann_index->L_, num_pq_chunks);
+}
+
+} // namespace infinity
@@ -0,0 +1,84 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module diskann_index_in_chunk;
+
+import stl;
+import column_def;
+import internal_types;
+import local_file_handle;
+import pq_flash_index;
+
+namespace infinity {
+
+class IndexBase;
+struct SegmentEntry;
+class BufferManager;
+
+// DiskAnn index on a range of rows of a segment.
+// PQ pivots and codes are kept in memory, the vamana graph and the full vectors stay in the index file and are read by the beam search.
+export class DiskAnnIndexInChunk {
+public:
+    DiskAnnIndexInChunk(u32 dimension, u32 R, u32 L, u32 num_pq_chunks);
+
+    ~DiskAnnIndexInChunk();
+
+    void BuildDiskAnnIndex(RowID base_rowid,
+                           u32 row_count,
+                           const SegmentEntry *segment_entry,
+                           const SharedPtr<ColumnDef> &column_def,
+                           BufferManager *buffer_mgr);
+
+    void SaveIndexInner(LocalFileHandle &file_handle) const;
+
+    // base_offset is the offset of the index in the file, file_handle must be positioned there
+    void ReadIndexInner(LocalFileHandle &file_handle, u64 base_offset);
+
+    // Search at most result_limit nearest rows, sorted by distance.
+    // Offsets are relative to the first row of the chunk, return the result count.
+    SizeT Search(const f32 *query, u32 result_limit, u32 search_l, u32 beam_width, f32 *distances, SegmentOffset *offsets) const;
+
+    u32 row_count() const { return row_count_; }
+
+    u32 dimension() const { return dimension_; }
+
+    static DiskAnnIndexInChunk *GetNewDiskAnnIndexInChunk(const IndexBase *index_base, const ColumnDef *column_def);
+
+private:
+    void CacheNodes();
+
+    // Parts of the index, in the order they are stored in the index file
+    enum DiskAnnIndexPart { kPqPivot = 0, kPqCompressedData = 1, kDiskIndex = 2, kPartCount = 3 };
+
+    static const char *PartFileName(SizeT part);
+
+    const u32 dimension_{};
+    const u32 R_{};
+    const u32 L_{};
+    const u32 num_pq_chunks_{};
+    u32 row_count_{};
+
+    // Where the parts are read from when saving: the build directory after a build, the index file after a load.
+    String source_dir_{};
+    String source_file_{};
+    u64 source_offset_{};
+    Array<u64, kPartCount> part_offsets_{};
+    Array<u64, kPartCount> part_sizes_{};
+
+    UniquePtr<PqFlashIndex<f32, SizeT>> flash_index_{};
+};
+
+} // namespace infinity
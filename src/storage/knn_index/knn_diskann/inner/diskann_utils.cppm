@@ -65,17 +65,18 @@ export struct AlignedRead {
 };
 
 // reader of disk index, async = false for now
+// reads are positional, so one reader can be shared by concurrent searches
 export class AlignedFileReader {
     using This = AlignedFileReader;
 
 private:
-    u64 file_sz_;
+    u64 base_offset_; // offset of the disk index in the file, nonzero when the index is packed in a larger file
     UniquePtr<LocalFileHandle> file_desc_;
 
 public:
-    AlignedFileReader() : file_sz_(0), file_desc_(nullptr) {}
+    AlignedFileReader() : base_offset_(0), file_desc_(nullptr) {}
 
-    AlignedFileReader(This &&other) : file_sz_(other.file_sz_), file_desc_(std::move(other.file_desc_)) {}
+    AlignedFileReader(This &&other) : base_offset_(other.base_offset_), file_desc_(std::move(other.file_desc_)) {}
 
     ~AlignedFileReader() = default;
 
@@ -88,17 +89,17 @@ public:
         }
 
         for (SizeT reqs = 0; reqs < read_reqs.size(); reqs++) {
-            file_desc_->Seek(read_reqs[reqs].offset);
-            file_desc_->Read(read_reqs[reqs].buf, read_reqs[reqs].len);
+            file_desc_->ReadAt(read_reqs[reqs].buf, read_reqs[reqs].len, base_offset_ + read_reqs[reqs].offset);
         }
     }
 
-    void Open(const std::string &file_path) {
+    void Open(const std::string &file_path, u64 base_offset = 0) {
         auto [data_file_handle, status] = VirtualStore::Open(file_path, FileAccessMode::kRead);
         if (!status.ok()) {
             UnrecoverableError(status.message());
         }
         file_desc_ = std::move(data_file_handle);
+        base_offset_ = base_offset;
     }
 
     void Close() { file_desc_.reset(); }
@@ -106,6 +106,25 @@ public:
         return 0;
     }
 
+    // Load the three parts of the index packed in one file at the given absolute offsets.
+    // PQ data is loaded in memory, the disk index part is kept on disk and read by the beam search.
+    int Load(LocalFileHandle &file_handle, u64 pq_pivot_offset, u64 pq_data_offset, u64 disk_index_offset, u32 num_threads = 1) {
+        this->disk_index_file_ = file_handle.Path();
+
+        LoadPqCompressedVec(file_handle, pq_data_offset);
+        pq_table_->LoadPqCentroidBin(file_handle, pq_pivot_offset, n_chunks_);
+        LoadDiskIndexMetaData(file_handle, disk_index_offset);
+
+        reader_->Open(this->disk_index_file_, disk_index_offset);
+        this->max_nthreads_ = num_threads;
+        this->SetupThreadData(num_threads);
+
+        this->UseMedoidsDataAsCentroids();
+
+        this->load_flag_ = true;
+        return 0;
+    }
+
     // Second step
     // nodes ids to cache in the bfs level order which starting from the medoids node
     void CacheBfsLevels(u64 num_nodes_to_cache, Vector<SizeT> &node_list, const bool shuffle = false) {
@@ -257,7 +276,8 @@ public:
     }
 
     // Fourth step
-    void CachedBeamSearch(const VectorDataType *query1,
+    // return the number of results, less than k_search if fewer nodes are visited
+    u64 CachedBeamSearch(const VectorDataType *query1,
                           const u64 k_search,
                           const u64 l_search,
                           u64 *indices,
@@ -509,7 +529,8 @@ public:
         LOG_DEBUG(fmt::format("Beam search hops {}: {} nodes expanded, {} cmps,  {} ios", hops, full_retset.size(), cmps, num_ios));
         // copy the top k results to the output buffer
         std::sort(full_retset.begin(), full_retset.end());
-        for (u64 i = 0; i < k_search; i++) {
+        const u64 result_n = std::min<u64>(k_search, full_retset.size());
+        for (u64 i = 0; i < result_n; i++) {
             indices[i] = full_retset[i].id;
             auto key = indices[i];
             // filter
@@ -527,19 +548,24 @@ public:
         }
 
         // delete[] data;
+        return result_n;
     }
 
 private:
     // read pq compressed vectors from disk to this->data_
     void LoadPqCompressedVec(std::string pq_compressed_vectors_path) {
-        this->data_ = MakeUnique<u8[]>(this->num_points_ * this->n_chunks_);
-        auto read_buf = MakeUnique<u32[]>(this->num_points_ * this->n_chunks_ * sizeof(u32));
         auto [pq_data_handle, status] = VirtualStore::Open(pq_compressed_vectors_path, FileAccessMode::kRead);
         if (!status.ok()) {
             UnrecoverableError(status.message());
         }
+        LoadPqCompressedVec(*pq_data_handle, 0);
+    }
 
-        pq_data_handle->Read(read_buf.get(), this->num_points_ * this->n_chunks_ * sizeof(u32));
+    void LoadPqCompressedVec(LocalFileHandle &pq_data_handle, u64 base_offset) {
+        this->data_ = MakeUnique<u8[]>(this->num_points_ * this->n_chunks_);
+        auto read_buf = MakeUnique<u32[]>(this->num_points_ * this->n_chunks_ * sizeof(u32));
+        pq_data_handle.Seek(base_offset);
+        pq_data_handle.Read(read_buf.get(), this->num_points_ * this->n_chunks_ * sizeof(u32));
         for (u64 i = 0; i < this->num_points_ * this->n_chunks_; i++) {
             this->data_[i] = static_cast<u8>(read_buf[i]);
         }
@@ -645,36 +671,40 @@ private:
         if (!status.ok()) {
             UnrecoverableError(status.message());
         }
+        LoadDiskIndexMetaData(*index_file_handle, 0);
+    }
 
+    void LoadDiskIndexMetaData(LocalFileHandle &index_file_handle, u64 base_offset) {
+        index_file_handle.Seek(base_offset);
         u64 disk_nnodes, disk_ndims;
-        index_file_handle->Read(&disk_nnodes, sizeof(u64));
-        index_file_handle->Read(&disk_ndims, sizeof(u64));
+        index_file_handle.Read(&disk_nnodes, sizeof(u64));
+        index_file_handle.Read(&disk_ndims, sizeof(u64));
         disk_bytes_per_point_ = disk_ndims * sizeof(VectorDataType);
         if (disk_nnodes != num_points_ || disk_ndims != data_dim_) {
             UnrecoverableError("Index file does not match the PQ flash index");
         }
 
         u64 medoid_id_on_file; // medoid node id
-        index_file_handle->Read(&medoid_id_on_file, sizeof(u64));
+        index_file_handle.Read(&medoid_id_on_file, sizeof(u64));
         this->num_medoids_ = 1;
         this->medoids_ = MakeUnique<SizeT[]>(1);
         this->medoids_[0] = medoid_id_on_file;
         LOG_DEBUG(fmt::format("LoadDiskIndexMetaData(): Loaded medoid node id: {}", medoid_id_on_file));
 
-        index_file_handle->Read(&max_node_len_, sizeof(u64));
-        index_file_handle->Read(&nnodes_per_sector_, sizeof(u64));
-        index_file_handle->Read(&sector_num_, sizeof(u64));
+        index_file_handle.Read(&max_node_len_, sizeof(u64));
+        index_file_handle.Read(&nnodes_per_sector_, sizeof(u64));
+        index_file_handle.Read(&sector_num_, sizeof(u64));
         max_degree_ = (max_node_len_ - disk_bytes_per_point_) / sizeof(u64) - 1; // -1 for the neighbor count
 
-        index_file_handle->Read(&num_frozen_points_, sizeof(u64));
+        index_file_handle.Read(&num_frozen_points_, sizeof(u64));
         u64 file_frozen_id;
-        index_file_handle->Read(&file_frozen_id, sizeof(u64));
+        index_file_handle.Read(&file_frozen_id, sizeof(u64));
         if (num_frozen_points_ == 1) {
             frozen_location_ = file_frozen_id;
         }
-        index_file_handle->Read(&reorder_data_exists_, sizeof(u64));
+        index_file_handle.Read(&reorder_data_exists_, sizeof(u64));
 
-        index_file_handle->Read(&disk_index_size_, sizeof(u64));
+        index_file_handle.Read(&disk_index_size_, sizeof(u64));
     }
 
     void SetupThreadData(u64 nthreads, u64 visited_reserve = 4096, bool async = false) {
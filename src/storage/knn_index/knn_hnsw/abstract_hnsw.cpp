@@ -72,6 +72,7 @@ HnswIndexInMem::HnswIndexInMem(RowID begin_row_id,
     SizeT dim = embedding_info->Dimension();
     SizeT M = index_hnsw->M_;
     SizeT ef_construction = index_hnsw->ef_construction_;
+    build_threads_ = index_hnsw->build_threads_;
     std::visit(
         [&](auto &&index) {
             using T = std::decay_t<decltype(index)>;
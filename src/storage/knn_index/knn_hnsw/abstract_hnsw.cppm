@@ -62,6 +62,9 @@ export using AbstractHnsw = std::variant<KnnHnsw<PlainCosVecStoreType<float>, Se
                                          KnnHnsw<LVQCosVecStoreType<float, i8>, SegmentOffset> *,
                                          KnnHnsw<LVQIPVecStoreType<float, i8>, SegmentOffset> *,
                                          KnnHnsw<LVQL2VecStoreType<float, i8>, SegmentOffset> *,
+                                         KnnHnsw<RabitqCosVecStoreType<float>, SegmentOffset> *,
+                                         KnnHnsw<RabitqIPVecStoreType<float>, SegmentOffset> *,
+                                         KnnHnsw<RabitqL2VecStoreType<float>, SegmentOffset> *,
                                          std::nullptr_t>;
 
 export struct HnswIndexInMem : public BaseMemIndex {
@@ -119,14 +122,62 @@ private:
                     }
                 }
             }
+            case HnswEncodeType::kRaBitQ: {
+                if constexpr (std::is_same_v<DataType, u8> || std::is_same_v<DataType, i8>) {
+                    return nullptr;
+                } else {
+                    switch (index_hnsw->metric_type_) {
+                        case MetricType::kMetricL2: {
+                            using HnswIndex = KnnHnsw<RabitqL2VecStoreType<DataType>, SegmentOffset>;
+                            return static_cast<HnswIndex *>(nullptr);
+                        }
+                        case MetricType::kMetricInnerProduct: {
+                            using HnswIndex = KnnHnsw<RabitqIPVecStoreType<DataType>, SegmentOffset>;
+                            return static_cast<HnswIndex *>(nullptr);
+                        }
+                        case MetricType::kMetricCosine: {
+                            using HnswIndex = KnnHnsw<RabitqCosVecStoreType<DataType>, SegmentOffset>;
+                            return static_cast<HnswIndex *>(nullptr);
+                        }
+                        default: {
+                            return nullptr;
+                        }
+                    }
+                }
+            }
             default: {
                 return nullptr;
             }
         }
     }
 
+public:
+    static AbstractHnsw InitAbstractIndex(const IndexBase *index_base, const ColumnDef *column_def);
+
+    HnswIndexInMem(const HnswIndexInMem &) = delete;
+    HnswIndexInMem &operator=(const HnswIndexInMem &) = delete;
+
+    virtual ~HnswIndexInMem();
+
+    SizeT GetRowCount() const;
+
+    void InsertVecs(SizeT block_offset,
+                    BlockColumnEntry *block_column_entry,
+                    BufferManager *buffer_manager,
+                    SizeT row_offset,
+                    SizeT row_count,
+                    const HnswInsertConfig &config = kDefaultHnswInsertConfig);
+
+    void InsertVecs(const SegmentEntry *segment_entry,
+                    BufferManager *buffer_mgr,
+                    SizeT column_id,
+                    TxnTimeStamp begin_ts,
+                    bool check_ts,
+                    const HnswInsertConfig &config = kDefaultHnswInsertConfig);
+
+    // store the vectors of iter into index, then build them concurrently on at most build_threads_ dense index building workers
     template <typename Iter, typename Index>
-    static void InsertVecs(Index &index, Iter &&iter, const HnswInsertConfig &config, SizeT &mem_usage) {
+    void InsertVecs(Index &index, Iter &&iter, const HnswInsertConfig &config, SizeT &mem_usage) {
         auto &thread_pool = InfinityContext::instance().GetHnswBuildThreadPool();
         if (thread_pool.size() == 0) {
             UnrecoverableError("Hnsw build thread pool is not initialized.");
@@ -135,7 +186,8 @@ private:
         if constexpr (!std::is_same_v<T, std::nullptr_t>) {
             SizeT mem1 = index->mem_usage();
             auto [start, end] = index->StoreData(std::forward<Iter>(iter), config);
-            SizeT bucket_size = std::max(kBuildBucketSize, SizeT(end - start - 1) / thread_pool.size() + 1);
+            const SizeT task_num = build_threads_ == 0 ? thread_pool.size() : std::min(build_threads_, SizeT(thread_pool.size()));
+            SizeT bucket_size = std::max(kBuildBucketSize, SizeT(end - start - 1) / task_num + 1);
             SizeT bucket_n = (end - start - 1) / bucket_size + 1;
 
             Vector<std::future<void>> futs;
@@ -157,30 +209,6 @@ private:
         }
     }
 
-public:
-    static AbstractHnsw InitAbstractIndex(const IndexBase *index_base, const ColumnDef *column_def);
-
-    HnswIndexInMem(const HnswIndexInMem &) = delete;
-    HnswIndexInMem &operator=(const HnswIndexInMem &) = delete;
-
-    virtual ~HnswIndexInMem();
-
-    SizeT GetRowCount() const;
-
-    void InsertVecs(SizeT block_offset,
-                    BlockColumnEntry *block_column_entry,
-                    BufferManager *buffer_manager,
-                    SizeT row_offset,
-                    SizeT row_count,
-                    const HnswInsertConfig &config = kDefaultHnswInsertConfig);
-
-    void InsertVecs(const SegmentEntry *segment_entry,
-                    BufferManager *buffer_mgr,
-                    SizeT column_id,
-                    TxnTimeStamp begin_ts,
-                    bool check_ts,
-                    const HnswInsertConfig &config = kDefaultHnswInsertConfig);
-
     SharedPtr<ChunkIndexEntry> Dump(SegmentIndexEntry *segment_index_entry, BufferManager *buffer_mgr, SizeT *dump_size = nullptr);
 
     const AbstractHnsw &get() const { return hnsw_; }
@@ -197,6 +225,7 @@ private:
 
     RowID begin_row_id_ = {};
     AbstractHnsw hnsw_ = nullptr;
+    SizeT build_threads_{};
 
     SegmentIndexEntry *segment_index_entry_{};
     bool trace_{};
@@ -15,6 +15,7 @@
 module;
 
 #include <cassert>
+#include <cstring>
 #include <ostream>
 #include <type_traits>
 
@@ -26,6 +27,7 @@ import local_file_handle;
 import vec_store_type;
 import graph_store;
 import infinity_exception;
+import serialize;
 
 namespace infinity {
 
@@ -38,6 +40,12 @@ class DataStoreChunkIter;
 template <typename VecStoreT, typename LabelType>
 class DataStoreIter;
 
+// The vectors and labels searched in place are cast from the buffer, so their sections must start at an address aligned for them.
+// 8 bytes covers the vector types of all the vec stores and the labels.
+constexpr SizeT kInPlaceAlignment = alignof(u64);
+
+inline bool IsInPlaceAligned(const char *ptr) { return reinterpret_cast<uintptr_t>(ptr) % kInPlaceAlignment == 0; }
+
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wunused-variable"
 
@@ -108,6 +116,7 @@ public:
         if constexpr (has_compress_type<VecStoreT>::value) {
             normalize = std::is_same_v<VecStoreMeta, typename LVQCosVecStoreType<DataType, typename VecStoreT::CompressType>::Meta>;
         }
+        normalize = normalize || std::is_same_v<VecStoreT, RabitqCosVecStoreType<DataType>>;
         VecStoreMeta vec_store_meta = VecStoreMeta::Make(dim, normalize);
         GraphStoreMeta graph_store_meta = GraphStoreMeta::Make(Mmax0, Mmax);
         This ret(chunk_size, max_chunk_n, std::move(vec_store_meta), std::move(graph_store_meta));
@@ -187,6 +196,34 @@ public:
         return ret;
     }
 
+    // Load the store saved by Save from `ptr`. If `in_place`, the vectors, graph and labels are read from `ptr` without copy, so the memory
+    // must outlive the store and the store is read only. Return None if the store can't be read in place.
+    static Optional<This> LoadFromPtr(const char *&ptr, bool in_place) {
+        SizeT chunk_size = ReadBufAdv<SizeT>(ptr);
+        SizeT max_chunk_n = ReadBufAdv<SizeT>(ptr);
+        SizeT cur_vec_num = ReadBufAdv<SizeT>(ptr);
+        VecStoreMeta vec_store_meta = VecStoreMeta::LoadFromPtr(ptr);
+        GraphStoreMeta graph_store_meta = GraphStoreMeta::LoadFromPtr(ptr);
+
+        This ret = This(chunk_size, max_chunk_n, std::move(vec_store_meta), std::move(graph_store_meta));
+        ret.cur_vec_num_ = cur_vec_num;
+
+        SizeT mem_usage = 0;
+        auto [chunk_num, last_chunk_size] = ret.ChunkInfo(cur_vec_num);
+        for (SizeT i = 0; i < chunk_num; ++i) {
+            SizeT cur_chunk_size = (i < chunk_num - 1) ? chunk_size : last_chunk_size;
+            auto inner = Inner::LoadFromPtr(ptr, cur_chunk_size, chunk_size, ret.vec_store_meta_, ret.graph_store_meta_, mem_usage, in_place);
+            if (!inner.has_value()) {
+                // the inners loaded before are views, nothing to free
+                ret.inners_ = nullptr;
+                return None;
+            }
+            ret.inners_[i] = std::move(*inner);
+        }
+        ret.mem_usage_.store(mem_usage);
+        return ret;
+    }
+
     template <DataIteratorConcept<QueryVecType, LabelType> Iterator>
     Pair<SizeT, SizeT> AddVec(Iterator &&query_iter) {
         SizeT mem_usage = 0;
@@ -388,7 +425,11 @@ public:
 private:
     DataStoreInner(SizeT chunk_size, VecStoreInner vec_store_inner, GraphStoreInner graph_store_inner)
         : vec_store_inner_(std::move(vec_store_inner)), graph_store_inner_(std::move(graph_store_inner)),
-          labels_(MakeUnique<LabelType[]>(chunk_size)), vertex_mutex_(MakeUnique<std::shared_mutex[]>(chunk_size)) {}
+          labels_(MakeStoreArray<LabelType>(chunk_size)), vertex_mutex_(MakeUnique<std::shared_mutex[]>(chunk_size)) {}
+
+    // The inner read in place is never modified, so it has no vertex lock
+    DataStoreInner(VecStoreInner vec_store_inner, GraphStoreInner graph_store_inner, StoreArray<LabelType> labels)
+        : vec_store_inner_(std::move(vec_store_inner)), graph_store_inner_(std::move(graph_store_inner)), labels_(std::move(labels)) {}
 
 public:
     DataStoreInner() = default;
@@ -428,6 +469,36 @@ public:
         return ret;
     }
 
+    static Optional<This> LoadFromPtr(const char *&ptr,
+                                      SizeT cur_vec_num,
+                                      SizeT chunk_size,
+                                      VecStoreMeta &vec_store_meta,
+                                      GraphStoreMeta &graph_store_meta,
+                                      SizeT &mem_usage,
+                                      bool in_place) {
+        static_assert(alignof(LabelType) <= kInPlaceAlignment);
+        if (in_place && !IsInPlaceAligned(ptr)) {
+            return None;
+        }
+        auto vec_store_inner = VecStoreInner::LoadFromPtr(ptr, cur_vec_num, chunk_size, vec_store_meta, mem_usage, in_place);
+        auto graph_store_inner = GraphStoreInner::LoadFromPtr(ptr, cur_vec_num, chunk_size, graph_store_meta, mem_usage, in_place);
+        if (!graph_store_inner.has_value()) {
+            return None;
+        }
+        if (in_place) {
+            if (!IsInPlaceAligned(ptr)) {
+                return None;
+            }
+            auto labels = ViewStoreArray<LabelType>(ptr);
+            ptr += sizeof(LabelType) * cur_vec_num;
+            return This(std::move(vec_store_inner), std::move(*graph_store_inner), std::move(labels));
+        }
+        This ret(chunk_size, std::move(vec_store_inner), std::move(*graph_store_inner));
+        std::memcpy(ret.labels_.get(), ptr, sizeof(LabelType) * cur_vec_num);
+        ptr += sizeof(LabelType) * cur_vec_num;
+        return ret;
+    }
+
     // vec store
     template <DataIteratorConcept<QueryVecType, LabelType> Iterator>
     Pair<SizeT, bool> AddVec(Iterator &&query_iter, VertexType start_idx, SizeT remain_num, const VecStoreMeta &meta, SizeT &mem_usage) {
@@ -465,7 +536,12 @@ public:
 
     LabelType GetLabel(VertexType vec_i) const { return labels_[vec_i]; }
 
-    std::shared_lock<std::shared_mutex> SharedLock(VertexType vec_i) const { return std::shared_lock<std::shared_mutex>(vertex_mutex_[vec_i]); }
+    std::shared_lock<std::shared_mutex> SharedLock(VertexType vec_i) const {
+        if (!vertex_mutex_) {
+            return {};
+        }
+        return std::shared_lock<std::shared_mutex>(vertex_mutex_[vec_i]);
+    }
 
     std::unique_lock<std::shared_mutex> UniqueLock(VertexType vec_i) { return std::unique_lock<std::shared_mutex>(vertex_mutex_[vec_i]); }
 
@@ -477,7 +553,7 @@ public:
 protected:
     VecStoreInner vec_store_inner_;
     GraphStoreInner graph_store_inner_;
-    UniquePtr<LabelType[]> labels_;
+    StoreArray<LabelType> labels_;
 
 private:
     mutable UniquePtr<std::shared_mutex[]> vertex_mutex_;
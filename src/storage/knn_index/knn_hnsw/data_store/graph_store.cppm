@@ -15,6 +15,7 @@
 module;
 
 #include <cassert>
+#include <cstring>
 #include <ostream>
 
 export module graph_store;
@@ -22,6 +23,7 @@ export module graph_store;
 import stl;
 import hnsw_common;
 import local_file_handle;
+import serialize;
 
 namespace infinity {
 
@@ -91,6 +93,16 @@ public:
         return meta;
     }
 
+    static GraphStoreMeta LoadFromPtr(const char *&ptr) {
+        SizeT Mmax0 = ReadBufAdv<SizeT>(ptr);
+        SizeT Mmax = ReadBufAdv<SizeT>(ptr);
+
+        GraphStoreMeta meta(Mmax0, Mmax);
+        meta.max_layer_ = ReadBufAdv<i32>(ptr);
+        meta.enterpoint_ = ReadBufAdv<VertexType>(ptr);
+        return meta;
+    }
+
     SizeT Mmax0() const { return Mmax0_; }
     SizeT Mmax() const { return Mmax_; }
     SizeT level0_size() const { return level0_size_; }
@@ -134,9 +146,13 @@ public:
 };
 
 export class GraphStoreInner {
+    // Set in the saved layer_sum when the level0 block is saved with the offset of the layers of each vertex in layers_p_.
+    // The graph saved without it can't be read in place.
+    static constexpr SizeT kLayerOffsetSaved = SizeT(1) << 63;
+
 private:
     GraphStoreInner(SizeT max_vertex, const GraphStoreMeta &meta, SizeT loaded_vertex_n)
-        : graph_(MakeUnique<char[]>(max_vertex * meta.level0_size())), loaded_vertex_n_(loaded_vertex_n) {}
+        : graph_(MakeStoreArray<char>(max_vertex * meta.level0_size())), loaded_vertex_n_(loaded_vertex_n) {}
 
 public:
     GraphStoreInner() = default;
@@ -160,7 +176,7 @@ public:
             const VertexL0 *v = GetLevel0(vertex_i, meta);
             size += sizeof(v->layer_n_) + sizeof(v->neighbor_n_) + sizeof(VertexType) * v->neighbor_n_;
             for (i32 layer_i = 1; layer_i <= v->layer_n_; ++layer_i) {
-                const VertexLX *vx = GetLevelX(v->layers_p_, layer_i, meta);
+                const VertexLX *vx = GetLevelX(GetLayers(v), layer_i, meta);
                 size += sizeof(vx->neighbor_n_) + sizeof(VertexType) * vx->neighbor_n_;
             }
         }
@@ -172,12 +188,23 @@ public:
         for (VertexType vertex_i = 0; vertex_i < (VertexType)cur_vertex_n; ++vertex_i) {
             layer_sum += GetLevel0(vertex_i, meta)->layer_n_;
         }
-        file_handle.Append(&layer_sum, sizeof(layer_sum));
-        file_handle.Append(graph_.get(), cur_vertex_n * meta.level0_size());
+        SizeT saved_layer_sum = layer_sum | kLayerOffsetSaved;
+        file_handle.Append(&saved_layer_sum, sizeof(saved_layer_sum));
+
+        // layers_p_ is saved as the offset of the layers of the vertex, so that LoadFromPtr can read the graph in place
+        auto level0 = MakeUniqueForOverwrite<char[]>(cur_vertex_n * meta.level0_size());
+        std::memcpy(level0.get(), graph_.get(), cur_vertex_n * meta.level0_size());
+        SizeT layer_offset = 0;
+        for (VertexType vertex_i = 0; vertex_i < (VertexType)cur_vertex_n; ++vertex_i) {
+            auto *v = reinterpret_cast<VertexL0 *>(level0.get() + vertex_i * meta.level0_size());
+            v->layers_p_ = reinterpret_cast<char *>(layer_offset);
+            layer_offset += meta.levelx_size() * v->layer_n_;
+        }
+        file_handle.Append(level0.get(), cur_vertex_n * meta.level0_size());
         for (VertexType vertex_i = 0; vertex_i < (VertexType)cur_vertex_n; ++vertex_i) {
             const VertexL0 *v = GetLevel0(vertex_i, meta);
             if (v->layer_n_) {
-                file_handle.Append(v->layers_p_, meta.levelx_size() * v->layer_n_);
+                file_handle.Append(GetLayers(v), meta.levelx_size() * v->layer_n_);
             }
         }
     }
@@ -187,11 +214,12 @@ public:
 
         SizeT layer_sum;
         file_handle.Read(&layer_sum, sizeof(layer_sum));
+        layer_sum &= ~kLayerOffsetSaved;
 
         GraphStoreInner graph_store(max_vertex, meta, cur_vertex_n);
         file_handle.Read(graph_store.graph_.get(), cur_vertex_n * meta.level0_size());
 
-        auto loaded_layers = MakeUnique<char[]>(meta.levelx_size() * layer_sum);
+        auto loaded_layers = MakeStoreArray<char>(meta.levelx_size() * layer_sum);
         char *loaded_layers_p = loaded_layers.get();
         for (VertexType vertex_i = 0; vertex_i < (VertexType)cur_vertex_n; ++vertex_i) {
             VertexL0 *v = graph_store.GetLevel0(vertex_i, meta);
@@ -209,6 +237,52 @@ public:
         return graph_store;
     }
 
+    // If `in_place`, the graph is read from `ptr` without copy, so the memory must outlive the store and the store is read only.
+    // Return None if the graph can't be read in place because it was saved without the layer offsets, or `ptr` isn't aligned for the vertices.
+    static Optional<GraphStoreInner>
+    LoadFromPtr(const char *&ptr, SizeT cur_vertex_n, SizeT max_vertex, const GraphStoreMeta &meta, SizeT &mem_usage, bool in_place) {
+        assert(cur_vertex_n <= max_vertex);
+
+        SizeT layer_sum = ReadBufAdv<SizeT>(ptr);
+        bool layer_offset_saved = layer_sum & kLayerOffsetSaved;
+        layer_sum &= ~kLayerOffsetSaved;
+
+        if (in_place) {
+            if (!layer_offset_saved || reinterpret_cast<uintptr_t>(ptr) % alignof(VertexL0) != 0) {
+                return None;
+            }
+            GraphStoreInner graph_store;
+            graph_store.graph_ = ViewStoreArray<char>(ptr);
+            graph_store.loaded_vertex_n_ = cur_vertex_n;
+            ptr += cur_vertex_n * meta.level0_size();
+            graph_store.layers_base_ = ptr;
+            ptr += layer_sum * meta.levelx_size();
+            return graph_store;
+        }
+
+        GraphStoreInner graph_store(max_vertex, meta, cur_vertex_n);
+        std::memcpy(graph_store.graph_.get(), ptr, cur_vertex_n * meta.level0_size());
+        ptr += cur_vertex_n * meta.level0_size();
+
+        auto loaded_layers = MakeStoreArray<char>(meta.levelx_size() * layer_sum);
+        std::memcpy(loaded_layers.get(), ptr, meta.levelx_size() * layer_sum);
+        ptr += meta.levelx_size() * layer_sum;
+        char *loaded_layers_p = loaded_layers.get();
+        for (VertexType vertex_i = 0; vertex_i < (VertexType)cur_vertex_n; ++vertex_i) {
+            VertexL0 *v = graph_store.GetLevel0(vertex_i, meta);
+            if (v->layer_n_) {
+                v->layers_p_ = loaded_layers_p;
+                loaded_layers_p += meta.levelx_size() * v->layer_n_;
+            } else {
+                v->layers_p_ = nullptr;
+            }
+        }
+        graph_store.loaded_layers_ = std::move(loaded_layers);
+
+        mem_usage += max_vertex * meta.level0_size() + layer_sum * meta.levelx_size();
+        return graph_store;
+    }
+
     void AddVertex(VertexType vertex_i, i32 layer_n, const GraphStoreMeta &meta, SizeT &mem_usage) {
         VertexL0 *v = GetLevel0(vertex_i, meta);
         v->neighbor_n_ = 0;
@@ -230,7 +304,7 @@ public:
         if (layer_i == 0) {
             return {v->neighbors_, v->neighbor_n_};
         }
-        const VertexLX *vx = GetLevelX(v->layers_p_, layer_i, meta);
+        const VertexLX *vx = GetLevelX(GetLayers(v), layer_i, meta);
         return {vx->neighbors_, vx->neighbor_n_};
     }
     Pair<VertexType *, VertexListSize *> GetNeighborsMut(VertexType vertex_i, i32 layer_i, const GraphStoreMeta &meta) {
@@ -238,11 +312,19 @@ public:
         if (layer_i == 0) {
             return {v->neighbors_, &v->neighbor_n_};
         }
-        VertexLX *vx = GetLevelX(v->layers_p_, layer_i, meta);
+        VertexLX *vx = GetLevelX(GetLayers(v), layer_i, meta);
         return {vx->neighbors_, &vx->neighbor_n_};
     }
 
 private:
+    // layers_p_ is the offset from layers_base_ when the graph is read in place
+    char *GetLayers(const VertexL0 *v) const {
+        if (layers_base_ == nullptr) {
+            return v->layers_p_;
+        }
+        return const_cast<char *>(layers_base_) + reinterpret_cast<SizeT>(v->layers_p_);
+    }
+
     const VertexL0 *GetLevel0(VertexType vertex_i, const GraphStoreMeta &meta) const {
         return reinterpret_cast<const VertexL0 *>(graph_.get() + vertex_i * meta.level0_size());
     }
@@ -260,9 +342,10 @@ private:
     }
 
 private:
-    UniquePtr<char[]> graph_;
+    StoreArray<char> graph_;
     SizeT loaded_vertex_n_;
-    UniquePtr<char[]> loaded_layers_;
+    StoreArray<char> loaded_layers_;
+    const char *layers_base_ = nullptr;
 
     //---------------------------------------------- Following is the tmp debug function. ----------------------------------------------
 
@@ -283,7 +366,7 @@ public:
                 assert(neighbor_idx != out_vertex_i);
             }
             for (int layer_i = 1; layer_i <= v->layer_n_; ++layer_i) {
-                const VertexLX *vx = GetLevelX(v->layers_p_, layer_i, meta);
+                const VertexLX *vx = GetLevelX(GetLayers(v), layer_i, meta);
                 for (int i = 0; i < vx->neighbor_n_; ++i) {
                     VertexType neighbor_idx = vx->neighbors_[i];
                     assert(neighbor_idx < (VertexType)cur_vec_num && neighbor_idx >= 0);
@@ -323,7 +406,7 @@ public:
                     neighbors = v->neighbors_;
                     neighbor_n = v->neighbor_n_;
                 } else {
-                    const VertexLX *vx = GetLevelX(v->layers_p_, layer, meta);
+                    const VertexLX *vx = GetLevelX(GetLayers(v), layer, meta);
                     neighbors = vx->neighbors_;
                     neighbor_n = vx->neighbor_n_;
                 }
@@ -15,6 +15,7 @@
 module;
 
 #include <cassert>
+#include <cstring>
 #include <ostream>
 
 #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
@@ -28,6 +29,7 @@ export module lvq_vec_store;
 import stl;
 import local_file_handle;
 import hnsw_common;
+import serialize;
 
 namespace infinity {
 
@@ -113,6 +115,16 @@ public:
         return meta;
     }
 
+    static This LoadFromPtr(const char *&ptr) {
+        SizeT dim = ReadBufAdv<SizeT>(ptr);
+        This meta(dim);
+        std::memcpy(meta.mean_.get(), ptr, sizeof(MeanType) * dim);
+        ptr += sizeof(MeanType) * dim;
+        std::memcpy(&meta.global_cache_, ptr, sizeof(GlobalCacheType));
+        ptr += sizeof(GlobalCacheType);
+        return meta;
+    }
+
     LVQQuery MakeQuery(const DataType *vec) const {
         LVQQuery query(compress_data_size_);
         CompressTo(vec, query.inner_.get());
@@ -252,7 +264,7 @@ public:
     using LVQData = LVQData<DataType, LocalCacheType, CompressType>;
 
 private:
-    LVQVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeUnique<char[]>(max_vec_num * meta.compress_data_size())) {}
+    LVQVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeStoreArray<char>(max_vec_num * meta.compress_data_size())) {}
 
 public:
     LVQVecStoreInner() = default;
@@ -277,6 +289,22 @@ public:
         return ret;
     }
 
+    // If `in_place`, the vectors are read from `ptr` without copy, so the memory must outlive the store and the store is read only.
+    static This LoadFromPtr(const char *&ptr, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta, SizeT &mem_usage, bool in_place) {
+        assert(cur_vec_num <= max_vec_num);
+        SizeT size = cur_vec_num * meta.compress_data_size();
+        This ret;
+        if (in_place) {
+            ret.ptr_ = ViewStoreArray<char>(ptr);
+        } else {
+            ret = This(max_vec_num, meta);
+            std::memcpy(ret.ptr_.get(), ptr, size);
+            mem_usage += max_vec_num * meta.compress_data_size();
+        }
+        ptr += size;
+        return ret;
+    }
+
     void SetVec(SizeT idx, const DataType *vec, const Meta &meta, SizeT &mem_usage) { meta.CompressTo(vec, GetVecMut(idx, meta)); }
 
     const LVQData *GetVec(SizeT idx, const Meta &meta) const {
@@ -289,7 +317,7 @@ private:
     LVQData *GetVecMut(SizeT idx, const Meta &meta) { return reinterpret_cast<LVQData *>(ptr_.get() + idx * meta.compress_data_size()); }
 
 private:
-    UniquePtr<char[]> ptr_;
+    StoreArray<char> ptr_;
 
 public:
     void Dump(std::ostream &os, SizeT offset, SizeT chunk_size, const Meta &meta) const {
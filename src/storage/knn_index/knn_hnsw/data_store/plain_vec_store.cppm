@@ -15,6 +15,7 @@
 module;
 
 #include <cassert>
+#include <cstring>
 #include <ostream>
 #if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
 #include <xmmintrin.h>
@@ -27,6 +28,7 @@ export module plain_vec_store;
 import stl;
 import local_file_handle;
 import hnsw_common;
+import serialize;
 
 namespace infinity {
 
@@ -64,6 +66,11 @@ public:
         return This(dim);
     }
 
+    static This LoadFromPtr(const char *&ptr) {
+        SizeT dim = ReadBufAdv<SizeT>(ptr);
+        return This(dim);
+    }
+
     QueryType MakeQuery(const DataType *vec) const { return vec; }
 
     SizeT dim() const { return dim_; }
@@ -82,7 +89,7 @@ public:
     using Meta = PlainVecStoreMeta<DataType>;
 
 private:
-    PlainVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeUnique<DataType[]>(max_vec_num * meta.dim())) {}
+    PlainVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeStoreArray<DataType>(max_vec_num * meta.dim())) {}
 
 public:
     PlainVecStoreInner() = default;
@@ -106,6 +113,22 @@ public:
         return ret;
     }
 
+    // If `in_place`, the vectors are read from `ptr` without copy, so the memory must outlive the store and the store is read only.
+    static This LoadFromPtr(const char *&ptr, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta, SizeT &mem_usage, bool in_place) {
+        assert(cur_vec_num <= max_vec_num);
+        SizeT size = sizeof(DataType) * cur_vec_num * meta.dim();
+        This ret;
+        if (in_place) {
+            ret.ptr_ = ViewStoreArray<DataType>(ptr);
+        } else {
+            ret = This(max_vec_num, meta);
+            std::memcpy(ret.ptr_.get(), ptr, size);
+            mem_usage += sizeof(DataType) * max_vec_num * meta.dim();
+        }
+        ptr += size;
+        return ret;
+    }
+
     void SetVec(SizeT idx, const DataType *vec, const Meta &meta, SizeT &mem_usage) { Copy(vec, vec + meta.dim(), GetVecMut(idx, meta)); }
 
     const DataType *GetVec(SizeT idx, const Meta &meta) const { return ptr_.get() + idx * meta.dim(); }
@@ -116,7 +139,7 @@ private:
     DataType *GetVecMut(SizeT idx, const Meta &meta) { return ptr_.get() + idx * meta.dim(); }
 
 private:
-    UniquePtr<DataType[]> ptr_;
+    StoreArray<DataType> ptr_;
 
 public:
     void Dump(std::ostream &os, SizeT offset, SizeT chunk_size, const Meta &meta) const {
@@ -0,0 +1,326 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <ostream>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <xmmintrin.h>
+#elif defined(__GNUC__) && defined(__aarch64__)
+#include <simde/x86/sse.h>
+#endif
+
+export module rabitq_vec_store;
+
+import stl;
+import local_file_handle;
+import hnsw_common;
+import serialize;
+
+namespace infinity {
+
+// A vector x is stored as the sign bits of its residual r = x - mean, one bit per dimension.
+// The unit residual r / |r| is estimated by the quantized vector sign(r) / sqrt(dim).
+export template <typename DataType>
+struct RabitqData {
+    // |r|
+    DataType norm_;
+    // <sign(r) / sqrt(dim), r / |r|>, which corrects the inner product estimated by the bits
+    DataType factor_;
+    // <r, mean>
+    DataType mean_ip_;
+    u8 code_[];
+};
+
+export template <typename DataType>
+class RabitqVecStoreInner;
+
+export template <typename DataType>
+class RabitqVecStoreMeta {
+public:
+    using This = RabitqVecStoreMeta<DataType>;
+    using Inner = RabitqVecStoreInner<DataType>;
+    using RabitqData = RabitqData<DataType>;
+    using StoreType = const RabitqData *;
+    struct RabitqQuery {
+        UniquePtr<RabitqData> inner_;
+        operator const RabitqData *() const { return inner_.get(); }
+
+        RabitqQuery(SizeT compress_data_size) : inner_(new(new char[compress_data_size]) RabitqData) {}
+        RabitqQuery(RabitqQuery &&other) = default;
+        ~RabitqQuery() { delete[] reinterpret_cast<char *>(inner_.release()); }
+    };
+    using QueryType = RabitqQuery;
+    using DistanceType = f32;
+
+private:
+    RabitqVecStoreMeta(SizeT dim)
+        : dim_(dim), code_size_((dim + 7) / 8), compress_data_size_(AlignTo(sizeof(RabitqData) + code_size_, alignof(RabitqData))) {
+        mean_ = MakeUnique<MeanType[]>(dim);
+        std::fill(mean_.get(), mean_.get() + dim, 0);
+    }
+
+public:
+    RabitqVecStoreMeta() : dim_(0), code_size_(0), compress_data_size_(0) {}
+    RabitqVecStoreMeta(This &&other)
+        : dim_(std::exchange(other.dim_, 0)), code_size_(std::exchange(other.code_size_, 0)),
+          compress_data_size_(std::exchange(other.compress_data_size_, 0)), mean_(std::move(other.mean_)),
+          mean_norm_sq_(std::exchange(other.mean_norm_sq_, 0)), normalize_(other.normalize_) {}
+    RabitqVecStoreMeta &operator=(This &&other) {
+        if (this != &other) {
+            dim_ = std::exchange(other.dim_, 0);
+            code_size_ = std::exchange(other.code_size_, 0);
+            compress_data_size_ = std::exchange(other.compress_data_size_, 0);
+            mean_ = std::move(other.mean_);
+            mean_norm_sq_ = std::exchange(other.mean_norm_sq_, 0);
+            normalize_ = other.normalize_;
+        }
+        return *this;
+    }
+
+    static This Make(SizeT dim) { return This(dim); }
+    static This Make(SizeT dim, bool normalize) {
+        This ret(dim);
+        ret.normalize_ = normalize;
+        return ret;
+    }
+
+    SizeT GetSizeInBytes() const { return sizeof(dim_) + sizeof(MeanType) * dim_ + sizeof(normalize_); }
+
+    void Save(LocalFileHandle &file_handle) const {
+        file_handle.Append(&dim_, sizeof(dim_));
+        file_handle.Append(mean_.get(), sizeof(MeanType) * dim_);
+        file_handle.Append(&normalize_, sizeof(normalize_));
+    }
+
+    static This Load(LocalFileHandle &file_handle) {
+        SizeT dim;
+        file_handle.Read(&dim, sizeof(dim));
+        This meta(dim);
+        file_handle.Read(meta.mean_.get(), sizeof(MeanType) * dim);
+        file_handle.Read(&meta.normalize_, sizeof(meta.normalize_));
+        meta.UpdateMeanNorm();
+        return meta;
+    }
+
+    static This LoadFromPtr(const char *&ptr) {
+        SizeT dim = ReadBufAdv<SizeT>(ptr);
+        This meta(dim);
+        std::memcpy(meta.mean_.get(), ptr, sizeof(MeanType) * dim);
+        ptr += sizeof(MeanType) * dim;
+        meta.normalize_ = ReadBufAdv<bool>(ptr);
+        meta.UpdateMeanNorm();
+        return meta;
+    }
+
+    RabitqQuery MakeQuery(const DataType *vec) const {
+        RabitqQuery query(compress_data_size_);
+        CompressTo(vec, query.inner_.get());
+        return query;
+    }
+
+    void CompressTo(const DataType *src, RabitqData *dest) const {
+        DataType scale = 1;
+        if (normalize_) {
+            DataType norm = 0;
+            for (SizeT j = 0; j < dim_; ++j) {
+                norm += src[j] * src[j];
+            }
+            if (norm > 0) {
+                scale = 1 / std::sqrt(norm);
+            }
+        }
+
+        u8 *code = dest->code_;
+        std::fill(code, code + code_size_, 0);
+        DataType norm_sq = 0;
+        DataType abs_sum = 0;
+        DataType mean_ip = 0;
+        for (SizeT j = 0; j < dim_; ++j) {
+            auto r = static_cast<DataType>(src[j] * scale - mean_[j]);
+            norm_sq += r * r;
+            abs_sum += std::abs(r);
+            mean_ip += r * mean_[j];
+            if (r > 0) {
+                code[j >> 3] |= u8(1) << (j & 7);
+            }
+        }
+        DataType norm = std::sqrt(norm_sq);
+        dest->norm_ = norm;
+        dest->factor_ = norm > 0 ? abs_sum / (norm * std::sqrt(static_cast<DataType>(dim_))) : 1;
+        dest->mean_ip_ = mean_ip;
+    }
+
+    // The bits of a stored vector can not be moved to another mean, so the mean is only fitted on the vectors of an empty store.
+    template <typename LabelType, DataIteratorConcept<const DataType *, LabelType> Iterator>
+    void Optimize(Iterator &&query_iter, const Vector<Pair<Inner *, SizeT>> &inners, SizeT &mem_usage) {
+        for (const auto &[inner, size] : inners) {
+            if (size > 0) {
+                return;
+            }
+        }
+        auto new_mean = MakeUnique<MeanType[]>(dim_);
+        std::fill(new_mean.get(), new_mean.get() + dim_, 0);
+        SizeT cur_vec_num = 0;
+        while (true) {
+            if (auto ret = query_iter.Next(); ret) {
+                auto &[vec, _] = *ret;
+                MeanType scale = 1;
+                if (normalize_) {
+                    MeanType norm = 0;
+                    for (SizeT i = 0; i < dim_; ++i) {
+                        norm += vec[i] * vec[i];
+                    }
+                    if (norm > 0) {
+                        scale = 1 / std::sqrt(norm);
+                    }
+                }
+                for (SizeT i = 0; i < dim_; ++i) {
+                    new_mean[i] += vec[i] * scale;
+                }
+                ++cur_vec_num;
+            } else {
+                break;
+            }
+        }
+        if (cur_vec_num == 0) {
+            return;
+        }
+        for (SizeT i = 0; i < dim_; ++i) {
+            new_mean[i] /= cur_vec_num;
+        }
+        swap(new_mean, mean_);
+        UpdateMeanNorm();
+    }
+
+    SizeT dim() const { return dim_; }
+    SizeT code_size() const { return code_size_; }
+    SizeT compress_data_size() const { return compress_data_size_; }
+    MeanType mean_norm_sq() const { return mean_norm_sq_; }
+
+    // for unit test
+    const MeanType *mean() const { return mean_.get(); }
+
+private:
+    void UpdateMeanNorm() {
+        mean_norm_sq_ = 0;
+        for (SizeT i = 0; i < dim_; ++i) {
+            mean_norm_sq_ += mean_[i] * mean_[i];
+        }
+    }
+
+private:
+    SizeT dim_;
+    SizeT code_size_;
+    SizeT compress_data_size_;
+
+    UniquePtr<MeanType[]> mean_;
+    MeanType mean_norm_sq_{0};
+
+    bool normalize_{false};
+
+public:
+    void Dump(std::ostream &os) const {
+        os << "[CONST] dim: " << dim_ << ", compress_data_size: " << compress_data_size_ << std::endl;
+        os << "mean: ";
+        for (SizeT i = 0; i < dim_; ++i) {
+            os << mean_[i] << " ";
+        }
+        os << std::endl;
+    }
+};
+
+export template <typename DataType>
+class RabitqVecStoreInner {
+public:
+    using This = RabitqVecStoreInner<DataType>;
+    using Meta = RabitqVecStoreMeta<DataType>;
+    using RabitqData = RabitqData<DataType>;
+
+private:
+    RabitqVecStoreInner(SizeT max_vec_num, const Meta &meta) : ptr_(MakeStoreArray<char>(max_vec_num * meta.compress_data_size())) {}
+
+public:
+    RabitqVecStoreInner() = default;
+
+    static This Make(SizeT max_vec_num, const Meta &meta, SizeT &mem_usage) {
+        auto ret = This(max_vec_num, meta);
+        mem_usage += max_vec_num * meta.compress_data_size();
+        return ret;
+    }
+
+    SizeT GetSizeInBytes(SizeT cur_vec_num, const Meta &meta) const { return cur_vec_num * meta.compress_data_size(); }
+
+    void Save(LocalFileHandle &file_handle, SizeT cur_vec_num, const Meta &meta) const {
+        file_handle.Append(ptr_.get(), cur_vec_num * meta.compress_data_size());
+    }
+
+    static This Load(LocalFileHandle &file_handle, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta, SizeT &mem_usage) {
+        assert(cur_vec_num <= max_vec_num);
+        This ret(max_vec_num, meta);
+        file_handle.Read(ret.ptr_.get(), cur_vec_num * meta.compress_data_size());
+        mem_usage += max_vec_num * meta.compress_data_size();
+        return ret;
+    }
+
+    // If `in_place`, the vectors are read from `ptr` without copy, so the memory must outlive the store and the store is read only.
+    static This LoadFromPtr(const char *&ptr, SizeT cur_vec_num, SizeT max_vec_num, const Meta &meta, SizeT &mem_usage, bool in_place) {
+        assert(cur_vec_num <= max_vec_num);
+        SizeT size = cur_vec_num * meta.compress_data_size();
+        This ret;
+        if (in_place) {
+            ret.ptr_ = ViewStoreArray<char>(ptr);
+        } else {
+            ret = This(max_vec_num, meta);
+            std::memcpy(ret.ptr_.get(), ptr, size);
+            mem_usage += max_vec_num * meta.compress_data_size();
+        }
+        ptr += size;
+        return ret;
+    }
+
+    void SetVec(SizeT idx, const DataType *vec, const Meta &meta, SizeT &mem_usage) { meta.CompressTo(vec, GetVecMut(idx, meta)); }
+
+    const RabitqData *GetVec(SizeT idx, const Meta &meta) const {
+        return reinterpret_cast<const RabitqData *>(ptr_.get() + idx * meta.compress_data_size());
+    }
+
+    void Prefetch(VertexType vec_i, const Meta &meta) const { _mm_prefetch(reinterpret_cast<const char *>(GetVec(vec_i, meta)), _MM_HINT_T0); }
+
+private:
+    RabitqData *GetVecMut(SizeT idx, const Meta &meta) { return reinterpret_cast<RabitqData *>(ptr_.get() + idx * meta.compress_data_size()); }
+
+private:
+    StoreArray<char> ptr_;
+
+public:
+    void Dump(std::ostream &os, SizeT offset, SizeT chunk_size, const Meta &meta) const {
+        for (int i = 0; i < (int)chunk_size; ++i) {
+            os << "vec " << i << "(" << offset + i << "): ";
+            const RabitqData *vec = GetVec(i, meta);
+            os << "norm: " << vec->norm_ << ", factor: " << vec->factor_ << ", mean_ip: " << vec->mean_ip_ << std::endl;
+            os << "code: ";
+            for (SizeT j = 0; j < meta.code_size(); ++j) {
+                os << static_cast<int>(vec->code_[j]) << " ";
+            }
+            os << std::endl;
+        }
+    }
+};
+
+} // namespace infinity
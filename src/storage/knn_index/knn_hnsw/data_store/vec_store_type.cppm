@@ -20,10 +20,12 @@ import stl;
 import plain_vec_store;
 import sparse_vec_store;
 import lvq_vec_store;
+import rabitq_vec_store;
 import dist_func_cos;
 import dist_func_l2;
 import dist_func_ip;
 import dist_func_sparse_ip;
+import dist_func_rabitq;
 import sparse_util;
 
 namespace infinity {
@@ -177,4 +179,65 @@ public:
     }
 };
 
+export template <typename DataT>
+class RabitqCosVecStoreType {
+public:
+    using DataType = DataT;
+    using CompressType = void;
+    using Meta = RabitqVecStoreMeta<DataType>;
+    using Inner = RabitqVecStoreInner<DataType>;
+    using QueryVecType = const DataType *;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    // the vectors are normalized before quantization
+    using Distance = RabitqIPDist<DataType>;
+
+    static constexpr bool HasOptimize = true;
+
+    template <typename CompressType>
+    static constexpr RabitqCosVecStoreType<DataType> ToLVQ() {
+        return {};
+    }
+};
+
+export template <typename DataT>
+class RabitqL2VecStoreType {
+public:
+    using DataType = DataT;
+    using CompressType = void;
+    using Meta = RabitqVecStoreMeta<DataType>;
+    using Inner = RabitqVecStoreInner<DataType>;
+    using QueryVecType = const DataType *;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = RabitqL2Dist<DataType>;
+
+    static constexpr bool HasOptimize = true;
+
+    template <typename CompressType>
+    static constexpr RabitqL2VecStoreType<DataType> ToLVQ() {
+        return {};
+    }
+};
+
+export template <typename DataT>
+class RabitqIPVecStoreType {
+public:
+    using DataType = DataT;
+    using CompressType = void;
+    using Meta = RabitqVecStoreMeta<DataType>;
+    using Inner = RabitqVecStoreInner<DataType>;
+    using QueryVecType = const DataType *;
+    using StoreType = typename Meta::StoreType;
+    using QueryType = typename Meta::QueryType;
+    using Distance = RabitqIPDist<DataType>;
+
+    static constexpr bool HasOptimize = true;
+
+    template <typename CompressType>
+    static constexpr RabitqIPVecStoreType<DataType> ToLVQ() {
+        return {};
+    }
+};
+
 } // namespace infinity
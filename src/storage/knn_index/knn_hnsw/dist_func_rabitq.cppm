@@ -0,0 +1,99 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+export module dist_func_rabitq;
+
+import stl;
+import hnsw_common;
+import rabitq_vec_store;
+import simd_functions;
+
+namespace infinity {
+
+// The inner product of the unit residuals of two vectors, estimated by the hamming distance of their bits:
+// <sign(r1), sign(r2)> / dim = 1 - 2 * hamming / dim, which is corrected by the factor of each vector.
+template <typename DataType>
+DataType RabitqUnitIP(const RabitqData<DataType> *v1, const RabitqData<DataType> *v2, f32 hamming, SizeT dim) {
+    DataType bits_ip = 1 - 2 * hamming / dim;
+    return std::clamp(bits_ip / (v1->factor_ * v2->factor_), DataType(-1), DataType(1));
+}
+
+export template <typename DataType>
+class RabitqL2Dist {
+public:
+    using VecStoreMeta = RabitqVecStoreMeta<DataType>;
+    using StoreType = typename VecStoreMeta::StoreType;
+    using DistanceType = typename VecStoreMeta::DistanceType;
+
+private:
+    using SIMDFuncType = f32 (*)(const u8 *, const u8 *, SizeT);
+
+    SIMDFuncType SIMDFunc = nullptr;
+
+public:
+    RabitqL2Dist() : SIMDFunc(nullptr) {}
+    RabitqL2Dist(RabitqL2Dist &&other) : SIMDFunc(std::exchange(other.SIMDFunc, nullptr)) {}
+    RabitqL2Dist &operator=(RabitqL2Dist &&other) {
+        if (this != &other) {
+            SIMDFunc = std::exchange(other.SIMDFunc, nullptr);
+        }
+        return *this;
+    }
+    ~RabitqL2Dist() = default;
+    RabitqL2Dist(SizeT dim) : SIMDFunc(GetSIMD_FUNCTIONS().HammingDistance_func_ptr_) {}
+
+    DistanceType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        f32 hamming = SIMDFunc(v1->code_, v2->code_, vec_store_meta.code_size());
+        DataType unit_ip = RabitqUnitIP(v1, v2, hamming, vec_store_meta.dim());
+        // |x1 - x2|^2 = |r1 - r2|^2
+        return v1->norm_ * v1->norm_ + v2->norm_ * v2->norm_ - 2 * v1->norm_ * v2->norm_ * unit_ip;
+    }
+};
+
+// Also the distance of the cosine store, whose vectors are normalized before quantization.
+export template <typename DataType>
+class RabitqIPDist {
+public:
+    using VecStoreMeta = RabitqVecStoreMeta<DataType>;
+    using StoreType = typename VecStoreMeta::StoreType;
+    using DistanceType = typename VecStoreMeta::DistanceType;
+
+private:
+    using SIMDFuncType = f32 (*)(const u8 *, const u8 *, SizeT);
+
+    SIMDFuncType SIMDFunc = nullptr;
+
+public:
+    RabitqIPDist() : SIMDFunc(nullptr) {}
+    RabitqIPDist(RabitqIPDist &&other) : SIMDFunc(std::exchange(other.SIMDFunc, nullptr)) {}
+    RabitqIPDist &operator=(RabitqIPDist &&other) {
+        if (this != &other) {
+            SIMDFunc = std::exchange(other.SIMDFunc, nullptr);
+        }
+        return *this;
+    }
+    ~RabitqIPDist() = default;
+    RabitqIPDist(SizeT dim) : SIMDFunc(GetSIMD_FUNCTIONS().HammingDistance_func_ptr_) {}
+
+    DistanceType operator()(const StoreType &v1, const StoreType &v2, const VecStoreMeta &vec_store_meta) const {
+        f32 hamming = SIMDFunc(v1->code_, v2->code_, vec_store_meta.code_size());
+        DataType unit_ip = RabitqUnitIP(v1, v2, hamming, vec_store_meta.dim());
+        // <x1, x2> = <r1, r2> + <r1, mean> + <r2, mean> + <mean, mean>
+        return -(v1->norm_ * v2->norm_ * unit_ip + v1->mean_ip_ + v2->mean_ip_ + vec_store_meta.mean_norm_sq());
+    }
+};
+
+} // namespace infinity
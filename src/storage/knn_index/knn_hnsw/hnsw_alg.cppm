@@ -15,6 +15,7 @@
 module;
 
 #include <ostream>
+#include <numeric>
 #include <random>
 
 export module hnsw_alg;
@@ -28,6 +29,7 @@ import logical_type;
 import hnsw_common;
 import data_store;
 import third_party;
+import serialize;
 
 // Fixme: some variable has implicit type conversion.
 // Fixme: some variable has confusing name.
@@ -60,6 +62,26 @@ public:
     using CMPReverse = CompareByFirstReverse<DistanceType, VertexType>;
     using DistHeap = Heap<PDV, CMP>;
 
+    // Buffers of SearchLayer, which are reused by the searches of one thread, such as the queries of a batch search
+    struct SearchScratch {
+        // vertex v is visited by the current search if visited_[v] == visit_tag_
+        Vector<u8> visited_;
+        u8 visit_tag_ = 0;
+        // heap of candidates ordered by CMP
+        Vector<PDV> candidate_;
+
+        void Reset(SizeT vertex_n) {
+            candidate_.clear();
+            if (visited_.size() < vertex_n) {
+                visited_.resize(vertex_n, 0);
+            }
+            if (++visit_tag_ == 0) {
+                std::fill(visited_.begin(), visited_.end(), 0);
+                visit_tag_ = 1;
+            }
+        }
+    };
+
     constexpr static int prefetch_offset_ = 0;
     constexpr static int prefetch_step_ = 2;
 
@@ -76,7 +98,8 @@ public:
     KnnHnsw() : M_(0), ef_construction_(0), mult_(0) {}
     KnnHnsw(This &&other)
         : M_(std::exchange(other.M_, 0)), ef_construction_(std::exchange(other.ef_construction_, 0)), mult_(std::exchange(other.mult_, 0.0)),
-          data_store_(std::move(other.data_store_)), distance_(std::move(other.distance_)) {}
+          data_store_(std::move(other.data_store_)), distance_(std::move(other.distance_)),
+          in_place_ptr_(std::exchange(other.in_place_ptr_, nullptr)) {}
     This &operator=(This &&other) {
         if (this != &other) {
             M_ = std::exchange(other.M_, 0);
@@ -84,6 +107,7 @@ public:
             mult_ = std::exchange(other.mult_, 0.0);
             data_store_ = std::move(other.data_store_);
             distance_ = std::move(other.distance_);
+            in_place_ptr_ = std::exchange(other.in_place_ptr_, nullptr);
         }
         return *this;
     }
@@ -116,7 +140,40 @@ public:
         return MakeUnique<This>(M, ef_construction, std::move(data_store), std::move(distance));
     }
 
+    // Load the index saved by Save from `ptr`, such as a mapped index file, and search it in place: the vectors, graph and labels are not
+    // copied, so the memory must outlive the index and the index is read only. Call Materialize before modifying it.
+    // Return nullptr if the index was saved in a layout that can't be searched in place, or a section of it isn't aligned in the buffer.
+    static UniquePtr<This> LoadFromPtr(const char *ptr) {
+        const char *index_ptr = ptr;
+        auto ret = LoadFromPtr(ptr, true);
+        if (ret) {
+            ret->in_place_ptr_ = index_ptr;
+        }
+        return ret;
+    }
+
+    bool IsInPlace() const { return in_place_ptr_ != nullptr; }
+
+    // Copy the index searched in place to memory
+    UniquePtr<This> Materialize() const {
+        const char *ptr = in_place_ptr_;
+        return LoadFromPtr(ptr, false);
+    }
+
 private:
+    static UniquePtr<This> LoadFromPtr(const char *&ptr, bool in_place) {
+        SizeT M = ReadBufAdv<SizeT>(ptr);
+        SizeT ef_construction = ReadBufAdv<SizeT>(ptr);
+
+        auto data_store = DataStore::LoadFromPtr(ptr, in_place);
+        if (!data_store.has_value()) {
+            return nullptr;
+        }
+        Distance distance(data_store->dim());
+
+        return MakeUnique<This>(M, ef_construction, std::move(*data_store), std::move(distance));
+    }
+
     // >= 0
     i32 GenerateRandomLayer() {
         static thread_local std::mt19937 generator;
@@ -135,7 +192,7 @@ private:
               LogicalType ColumnLogicalType = LogicalType::kEmbedding,
               typename MultiVectorInnerTopnIndexType = void>
     Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<SearchLayerReturnParam3T<ColumnLogicalType>[]>>
-    SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT result_n, const Filter &filter) const {
+    SearchLayer(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT result_n, const Filter &filter, SearchScratch &scratch) const {
         static_assert(ColumnLogicalType == LogicalType::kEmbedding || ColumnLogicalType == LogicalType::kMultiVector);
         auto d_ptr = MakeUniqueForOverwrite<DistanceType[]>(result_n);
         auto i_ptr = MakeUniqueForOverwrite<SearchLayerReturnParam3T<ColumnLogicalType>[]>(result_n);
@@ -166,23 +223,25 @@ private:
                 static_assert(false, "Unsupported column logical type");
             }
         };
-        DistHeap candidate;
+        SizeT cur_vec_num = data_store_.cur_vec_num();
+        scratch.Reset(cur_vec_num);
+        Vector<PDV> &candidate = scratch.candidate_;
+        Vector<u8> &visited = scratch.visited_;
+        const u8 visit_tag = scratch.visit_tag_;
 
         data_store_.PrefetchVec(enter_point);
         // enter_point will not be added to result_handler, the distance is not used
         {
             auto dist = distance_(query, data_store_.GetVec(enter_point), data_store_.vec_store_meta());
-            candidate.emplace(-dist, enter_point);
+            candidate.emplace_back(-dist, enter_point);
             add_result(dist, enter_point);
         }
-
-        SizeT cur_vec_num = data_store_.cur_vec_num();
-        Vector<bool> visited(cur_vec_num, false);
-        visited[enter_point] = true;
+        visited[enter_point] = visit_tag;
 
         while (!candidate.empty()) {
-            const auto [minus_c_dist, c_idx] = candidate.top();
-            candidate.pop();
+            std::pop_heap(candidate.begin(), candidate.end(), CMP());
+            const auto [minus_c_dist, c_idx] = candidate.back();
+            candidate.pop_back();
             if (result_handler.GetSize(0) == result_n && -minus_c_dist > result_handler.GetDistance0(0)) {
                 break;
             }
@@ -196,10 +255,10 @@ private:
             int prefetch_start = neighbor_size - 1 - prefetch_offset_;
             for (int i = neighbor_size - 1; i >= 0; --i) {
                 VertexType n_idx = neighbors_p[i];
-                if (n_idx >= (VertexType)cur_vec_num || visited[n_idx]) {
+                if (n_idx >= (VertexType)cur_vec_num || visited[n_idx] == visit_tag) {
                     continue;
                 }
-                visited[n_idx] = true;
+                visited[n_idx] = visit_tag;
                 if (prefetch_start >= 0) {
                     int lower = std::max(0, prefetch_start - prefetch_step_);
                     for (int j = prefetch_start; j >= lower; --j) {
@@ -210,7 +269,8 @@ private:
                 }
                 auto dist = distance_(query, data_store_.GetVec(n_idx), data_store_.vec_store_meta());
                 if (result_handler.GetSize(0) < result_n || dist <= result_handler.GetDistance0(0)) {
-                    candidate.emplace(-dist, n_idx);
+                    candidate.emplace_back(-dist, n_idx);
+                    std::push_heap(candidate.begin(), candidate.end(), CMP());
                     add_result(dist, n_idx);
                 }
             }
@@ -246,6 +306,60 @@ private:
         return cur_p;
     }
 
+    // SearchLayerNearest of all queries of a batch, eps[i] is the enter point of query i. The queries start from the same enter point and
+    // walk the same few vertices near the top of the graph, so the queries at one vertex share the read of its neighbors and their vectors.
+    template <bool WithLock>
+    void SearchLayerNearestBatch(const Vector<StoreType> &queries, Vector<VertexType> &eps, i32 layer_idx) const {
+        SizeT query_n = queries.size();
+        Vector<DistanceType> cur_dists(query_n);
+        for (SizeT i = 0; i < query_n; ++i) {
+            cur_dists[i] = distance_(queries[i], data_store_.GetVec(eps[i]), data_store_.vec_store_meta());
+        }
+        Vector<SizeT> active(query_n);
+        std::iota(active.begin(), active.end(), 0);
+        Vector<SizeT> next_active;
+        while (!active.empty()) {
+            std::sort(active.begin(), active.end(), [&](SizeT a, SizeT b) { return eps[a] < eps[b]; });
+            next_active.clear();
+            for (SizeT group_begin = 0; group_begin < active.size();) {
+                VertexType cur_p = eps[active[group_begin]];
+                SizeT group_end = group_begin + 1;
+                while (group_end < active.size() && eps[active[group_end]] == cur_p) {
+                    ++group_end;
+                }
+
+                std::shared_lock<std::shared_mutex> lock;
+                if constexpr (WithLock) {
+                    lock = data_store_.SharedLock(cur_p);
+                }
+
+                const auto [neighbors_p, neighbor_size] = data_store_.GetNeighbors(cur_p, layer_idx);
+                for (int i = neighbor_size - 1; i >= 0; --i) {
+                    if (i > 0) {
+                        data_store_.PrefetchVec(neighbors_p[i - 1]);
+                    }
+                    VertexType n_idx = neighbors_p[i];
+                    StoreType n_vec = data_store_.GetVec(n_idx);
+                    for (SizeT j = group_begin; j < group_end; ++j) {
+                        SizeT query_i = active[j];
+                        auto n_dist = distance_(queries[query_i], n_vec, data_store_.vec_store_meta());
+                        if (n_dist < cur_dists[query_i]) {
+                            eps[query_i] = n_idx;
+                            cur_dists[query_i] = n_dist;
+                        }
+                    }
+                }
+                for (SizeT j = group_begin; j < group_end; ++j) {
+                    if (eps[active[j]] != cur_p) {
+                        next_active.push_back(active[j]);
+                    }
+                }
+                group_begin = group_end;
+            }
+            std::swap(active, next_active);
+        }
+    }
+
     // the function does not need mutex because the lock of `result_p` is already acquired
     void SelectNeighborsHeuristic(Vector<PDV> candidates, SizeT M, VertexType *result_p, VertexListSize *result_size_p) const {
         VertexListSize result_size = 0;
@@ -310,18 +424,23 @@ private:
     LabelType GetLabel(VertexType vertex_i) const { return data_store_.GetLabel(vertex_i); }
 
     template <bool WithLock, FilterConcept<LabelType> Filter, LogicalType ColumnLogicalType>
-    auto SearchLayerHelper(VertexType enter_point, const StoreType &query, i32 layer_idx, SizeT result_n, const Filter &filter) const {
+    auto SearchLayerHelper(VertexType enter_point,
+                           const StoreType &query,
+                           i32 layer_idx,
+                           SizeT result_n,
+                           const Filter &filter,
+                           SearchScratch &scratch) const {
         if constexpr (ColumnLogicalType == LogicalType::kEmbedding) {
-            return SearchLayer<WithLock, Filter, ColumnLogicalType>(enter_point, query, layer_idx, result_n, filter);
+            return SearchLayer<WithLock, Filter, ColumnLogicalType>(enter_point, query, layer_idx, result_n, filter, scratch);
         } else if constexpr (ColumnLogicalType == LogicalType::kMultiVector) {
             if (result_n <= std::numeric_limits<u8>::max()) {
-                return SearchLayer<WithLock, Filter, ColumnLogicalType, u8>(enter_point, query, layer_idx, result_n, filter);
+                return SearchLayer<WithLock, Filter, ColumnLogicalType, u8>(enter_point, query, layer_idx, result_n, filter, scratch);
             }
             if (result_n <= std::numeric_limits<u16>::max()) {
-                return SearchLayer<WithLock, Filter, ColumnLogicalType, u16>(enter_point, query, layer_idx, result_n, filter);
+                return SearchLayer<WithLock, Filter, ColumnLogicalType, u16>(enter_point, query, layer_idx, result_n, filter, scratch);
             }
             if (result_n <= std::numeric_limits<u32>::max()) {
-                return SearchLayer<WithLock, Filter, ColumnLogicalType, u32>(enter_point, query, layer_idx, result_n, filter);
+                return SearchLayer<WithLock, Filter, ColumnLogicalType, u32>(enter_point, query, layer_idx, result_n, filter, scratch);
             }
             UnrecoverableError(fmt::format("Unsupported result_n : {}, which is larger than u32::max()", result_n));
             return Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<SearchLayerReturnParam3T<ColumnLogicalType>[]>>{};
@@ -345,7 +464,44 @@ private:
         for (i32 cur_layer = max_layer; cur_layer > 0; --cur_layer) {
             ep = SearchLayerNearest<WithLock>(ep, query, cur_layer);
         }
-        return SearchLayerHelper<WithLock, Filter, ColumnLogicalType>(ep, query, 0, ef, filter);
+        SearchScratch scratch;
+        return SearchLayerHelper<WithLock, Filter, ColumnLogicalType>(ep, query, 0, ef, filter, scratch);
+    }
+
+    template <bool WithLock, FilterConcept<LabelType> Filter = NoneType, LogicalType ColumnLogicalType = LogicalType::kEmbedding>
+    Vector<Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<SearchLayerReturnParam3T<ColumnLogicalType>[]>>>
+    KnnSearchBatchInner(const QueryVecType *qs, SizeT query_n, SizeT k, const Filter &filter, const KnnSearchOption &option) const {
+        Vector<Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<SearchLayerReturnParam3T<ColumnLogicalType>[]>>> results(query_n);
+        SizeT ef = option.ef_;
+        if (ef == 0) {
+            ef = k;
+        }
+        auto [max_layer, ep] = data_store_.GetEnterPoint();
+        if (ep == -1 || query_n == 0) {
+            return results;
+        }
+        Vector<QueryType> query_holders;
+        query_holders.reserve(query_n);
+        Vector<StoreType> queries;
+        queries.reserve(query_n);
+        for (SizeT i = 0; i < query_n; ++i) {
+            query_holders.push_back(data_store_.MakeQuery(qs[i]));
+            queries.push_back(query_holders.back());
+        }
+
+        Vector<VertexType> eps(query_n, ep);
+        for (i32 cur_layer = max_layer; cur_layer > 0; --cur_layer) {
+            SearchLayerNearestBatch<WithLock>(queries, eps, cur_layer);
+        }
+        SearchScratch scratch;
+        for (SizeT i = 0; i < query_n; ++i) {
+            if (i + 1 < query_n) {
+                // the enter point of the next query is read while this one is searched
+                data_store_.PrefetchVec(eps[i + 1]);
+            }
+            results[i] = SearchLayerHelper<WithLock, Filter, ColumnLogicalType>(eps[i], queries[i], 0, ef, filter, scratch);
+        }
+        return results;
     }
 
 public:
@@ -381,8 +537,9 @@ public:
         for (i32 cur_layer = max_layer; cur_layer > q_layer; --cur_layer) {
             ep = SearchLayerNearest<true>(ep, query, cur_layer);
         }
+        SearchScratch scratch;
         for (i32 cur_layer = std::min(q_layer, max_layer); cur_layer >= 0; --cur_layer) {
-            auto [result_n, d_ptr, v_ptr] = SearchLayer<true>(ep, query, cur_layer, ef_construction_, None);
+            auto [result_n, d_ptr, v_ptr] = SearchLayer<true>(ep, query, cur_layer, ef_construction_, None, scratch);
             auto search_result = Vector<PDV>(result_n);
             for (SizeT i = 0; i < result_n; ++i) {
                 search_result[i] = {d_ptr[i], v_ptr[i]};
@@ -437,6 +594,41 @@ public:
         return KnnSearch<NoneType, WithLock>(q, k, None, option);
     }
 
+    // KnnSearch of `query_n` queries, the i-th result is the result of qs[i]. The queries share the traversal of the layers above 0 and the
+    // search buffers, which is cheaper than searching them one by one.
+    template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
+    Vector<Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>>>
+    KnnSearchBatch(const QueryVecType *qs, SizeT query_n, SizeT k, const Filter &filter, const KnnSearchOption &option = {}) const {
+        switch (option.column_logical_type_) {
+            case LogicalType::kEmbedding: {
+                auto inner_results = KnnSearchBatchInner<WithLock, Filter>(qs, query_n, k, filter, option);
+                Vector<Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>>> results;
+                results.reserve(query_n);
+                for (auto &[result_n, d_ptr, v_ptr] : inner_results) {
+                    auto labels = MakeUniqueForOverwrite<LabelType[]>(result_n);
+                    for (SizeT i = 0; i < result_n; ++i) {
+                        labels[i] = GetLabel(v_ptr[i]);
+                    }
+                    results.emplace_back(result_n, std::move(d_ptr), std::move(labels));
+                }
+                return results;
+            }
+            case LogicalType::kMultiVector: {
+                return KnnSearchBatchInner<WithLock, Filter, LogicalType::kMultiVector>(qs, query_n, k, filter, option);
+            }
+            default: {
+                UnrecoverableError(fmt::format("Unsupported column logical type: {}", LogicalType2Str(option.column_logical_type_)));
+            }
+        }
+        return {};
+    }
+
+    template <bool WithLock = true>
+    Vector<Tuple<SizeT, UniquePtr<DistanceType[]>, UniquePtr<LabelType[]>>>
+    KnnSearchBatch(const QueryVecType *qs, SizeT query_n, SizeT k, const KnnSearchOption &option = {}) const {
+        return KnnSearchBatch<NoneType, WithLock>(qs, query_n, k, None, option);
+    }
+
     // function for test, add sort for convenience
     template <FilterConcept<LabelType> Filter = NoneType, bool WithLock = true>
     Vector<Pair<DistanceType, LabelType>>
@@ -469,6 +661,9 @@ private:
     DataStore data_store_;
     Distance distance_;
 
+    // The saved index which the index is searched in, nullptr if the index is in memory
+    const char *in_place_ptr_ = nullptr;
+
     // //---------------------------------------------- Following is the tmp debug function. ----------------------------------------------
 public:
     void Check() const { data_store_.Check(); }
@@ -15,6 +15,7 @@
 module;
 
 #include <limits>
+#include <memory>
 #include <utility>
 
 export module hnsw_common;
@@ -31,6 +32,32 @@ export struct HnswConfig {
 
 export constexpr SizeT AlignTo(SizeT a, SizeT b) { return (a + b - 1) / b * b; }
 
+// Deleter of the arrays of a data store. The arrays of an index loaded by LoadFromPtr in place point into memory the store doesn't own,
+// such as a mapped index file, so only the arrays allocated by the store are freed.
+export template <typename T>
+struct StoreArrayDeleter {
+    bool owned_ = true;
+
+    void operator()(T *p) const {
+        if (owned_) {
+            delete[] p;
+        }
+    }
+};
+
+export template <typename T>
+using StoreArray = std::unique_ptr<T[], StoreArrayDeleter<T>>;
+
+export template <typename T>
+StoreArray<T> MakeStoreArray(SizeT n) {
+    return StoreArray<T>(new T[n]());
+}
+
+export template <typename T>
+StoreArray<T> ViewStoreArray(const char *ptr) {
+    return StoreArray<T>(reinterpret_cast<T *>(const_cast<char *>(ptr)), StoreArrayDeleter<T>{false});
+}
+
 export using MeanType = double;
 export using VertexType = i32;
 export using VertexListSize = i32;
@@ -0,0 +1,275 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+module;
+
+#include <cmath>
+
+export module ivf_index_pq_code_storage;
+
+import stl;
+import infinity_exception;
+import third_party;
+import local_file_handle;
+import pq_fast_scan_simd_funcs;
+
+namespace infinity {
+
+// u8 lookup tables for PQFastScan
+// every subspace table is shifted by its own minimum, all tables share one scale
+export struct PQFastScanLUT {
+    Vector<u8> lut_{};
+    f32 bias_ = 0.0f;
+    f32 inv_scale_ = 1.0f;
+
+    template <typename GetTableValue>
+    PQFastScanLUT(const u32 subspace_num, const u32 centroid_num, GetTableValue &&get_value) {
+        const u32 subspace_pair_num = (subspace_num + 1) / 2;
+        // sum of all entries must fit in the u16 accumulators of PQFastScan
+        const f32 max_q = std::min<u32>(255, 65535 / (subspace_pair_num * 2));
+        const auto table_min = MakeUniqueForOverwrite<f32[]>(subspace_num);
+        f32 max_range = 0.0f;
+        for (u32 j = 0; j < subspace_num; ++j) {
+            f32 min_v = std::numeric_limits<f32>::max();
+            f32 max_v = std::numeric_limits<f32>::lowest();
+            for (u32 c = 0; c < centroid_num; ++c) {
+                const f32 v = get_value(j, c);
+                min_v = std::min(min_v, v);
+                max_v = std::max(max_v, v);
+            }
+            table_min[j] = min_v;
+            bias_ += min_v;
+            max_range = std::max(max_range, max_v - min_v);
+        }
+        const f32 scale = max_range > 0.0f ? max_q / max_range : 1.0f;
+        inv_scale_ = 1.0f / scale;
+        lut_.resize(PQFastScanBlockBytes(subspace_pair_num), 0);
+        for (u32 j = 0; j < subspace_num; ++j) {
+            u8 *table = lut_.data() + (j >> 1) * 32 + (j & 1) * 16;
+            for (u32 c = 0; c < centroid_num; ++c) {
+                table[c] = static_cast<u8>(std::min(max_q, std::round((get_value(j, c) - table_min[j]) * scale)));
+            }
+        }
+    }
+
+    [[nodiscard]] f32 Decode(const u16 accumulated) const { return bias_ + accumulated * inv_scale_; }
+};
+
+// PQ storage
+export struct PQ_Code_Storage {
+    const u64 subspace_num_ = 0;
+    explicit PQ_Code_Storage(const u32 subspace_num) : subspace_num_(subspace_num) {}
+    virtual ~PQ_Code_Storage() = default;
+    virtual void Save(LocalFileHandle &file_handle) const = 0;
+    virtual void Load(LocalFileHandle &file_handle) = 0;
+    virtual void ExtractCodes(u32 idx, u32 *output_codes) const = 0;
+    virtual void AppendCodes(const u32 *input_codes) = 0;
+    // codes packed for PQFastScan, only available for 4-bit codes
+    [[nodiscard]] virtual const u8 *FastScanBlocks() const { return nullptr; }
+};
+
+export template <std::unsigned_integral T>
+struct PQ_Code_StorageB : PQ_Code_Storage {
+    u64 last_code_id_ = 0;
+    Vector<T> storage_{};
+    using PQ_Code_Storage::PQ_Code_Storage;
+    void Save(LocalFileHandle &file_handle) const final {
+        file_handle.Append(&last_code_id_, sizeof(last_code_id_));
+        const u32 storage_size = storage_.size();
+        file_handle.Append(&storage_size, sizeof(storage_size));
+        file_handle.Append(storage_.data(), storage_.size() * sizeof(T));
+    }
+    void Load(LocalFileHandle &file_handle) final {
+        file_handle.Read(&last_code_id_, sizeof(last_code_id_));
+        u32 storage_size = 0;
+        file_handle.Read(&storage_size, sizeof(storage_size));
+        storage_.resize(storage_size);
+        file_handle.Read(storage_.data(), storage_size * sizeof(T));
+    }
+};
+
+export template <u32 storage_bits>
+struct PQ_Code_StorageT;
+
+// 4 bits per code
+// the codes are only kept in the fast scan block layout (see pq_fast_scan_simd_funcs), the last block is padded to 32 vectors
+// the file keeps the sequential layout of two codes per byte
+template <>
+struct PQ_Code_StorageT<4> final : PQ_Code_Storage {
+    const u32 subspace_pair_num_ = (subspace_num_ + 1) / 2;
+    u32 code_num_ = 0;
+    Vector<u8> fast_scan_blocks_{};
+
+    explicit PQ_Code_StorageT(const u32 subspace_num) : PQ_Code_Storage(subspace_num) {}
+
+    void Save(LocalFileHandle &file_handle) const override {
+        const u64 last_code_id = code_num_ * subspace_num_;
+        const u32 storage_size = (last_code_id + 1) / 2;
+        Vector<u8> storage(storage_size, 0);
+        const auto codes = MakeUniqueForOverwrite<u32[]>(subspace_num_);
+        u64 write_pos = 0;
+        for (u32 idx = 0; idx < code_num_; ++idx) {
+            ExtractCodes(idx, codes.get());
+            for (u32 i = 0; i < subspace_num_; ++i) {
+                storage[write_pos >> 1] |= (write_pos & 1) ? (codes[i] << 4) : codes[i];
+                ++write_pos;
+            }
+        }
+        file_handle.Append(&last_code_id, sizeof(last_code_id));
+        file_handle.Append(&storage_size, sizeof(storage_size));
+        file_handle.Append(storage.data(), storage_size);
+    }
+    void Load(LocalFileHandle &file_handle) override {
+        u64 last_code_id = 0;
+        file_handle.Read(&last_code_id, sizeof(last_code_id));
+        u32 storage_size = 0;
+        file_handle.Read(&storage_size, sizeof(storage_size));
+        Vector<u8> storage(storage_size);
+        file_handle.Read(storage.data(), storage_size);
+        code_num_ = 0;
+        fast_scan_blocks_.clear();
+        const u32 code_num = last_code_id / subspace_num_;
+        fast_scan_blocks_.reserve(((code_num + PQ_FAST_SCAN_BLOCK_SIZE - 1) / PQ_FAST_SCAN_BLOCK_SIZE) * PQFastScanBlockBytes(subspace_pair_num_));
+        const auto codes = MakeUniqueForOverwrite<u32[]>(subspace_num_);
+        u64 read_pos = 0;
+        for (u32 idx = 0; idx < code_num; ++idx) {
+            for (u32 i = 0; i < subspace_num_; ++i) {
+                const auto access_pos = read_pos >> 1;
+                codes[i] = ((read_pos & 1) ? (storage[access_pos] >> 4) : (storage[access_pos] & 0xf));
+                ++read_pos;
+            }
+            AppendCodes(codes.get());
+        }
+    }
+    [[nodiscard]] const u8 *FastScanBlocks() const override { return fast_scan_blocks_.data(); }
+    void ExtractCodes(const u32 idx, u32 *output_codes) const override {
+        const u8 *block = fast_scan_blocks_.data() + (idx / PQ_FAST_SCAN_BLOCK_SIZE) * PQFastScanBlockBytes(subspace_pair_num_);
+        const u32 in_block_id = idx % PQ_FAST_SCAN_BLOCK_SIZE;
+        const u32 byte_id = in_block_id & 15;
+        const u32 shift = (in_block_id >> 4) << 2;
+        for (u32 i = 0; i < subspace_num_; ++i) {
+            output_codes[i] = (block[(i >> 1) * 32 + (i & 1) * 16 + byte_id] >> shift) & 0xf;
+        }
+    }
+    void AppendCodes(const u32 *input_codes) override {
+        const u32 in_block_id = code_num_ % PQ_FAST_SCAN_BLOCK_SIZE;
+        if (in_block_id == 0) {
+            fast_scan_blocks_.resize(fast_scan_blocks_.size() + PQFastScanBlockBytes(subspace_pair_num_), 0);
+        }
+        u8 *block = fast_scan_blocks_.data() + (code_num_ / PQ_FAST_SCAN_BLOCK_SIZE) * PQFastScanBlockBytes(subspace_pair_num_);
+        const u32 byte_id = in_block_id & 15;
+        const u32 shift = (in_block_id >> 4) << 2;
+        for (u32 i = 0; i < subspace_num_; ++i) {
+            block[(i >> 1) * 32 + (i & 1) * 16 + byte_id] |= static_cast<u8>(input_codes[i] << shift);
+        }
+        ++code_num_;
+    }
+};
+
+// 8 bits per code
+template <>
+struct PQ_Code_StorageT<8> final : PQ_Code_StorageB<u8> {
+    using PQ_Code_StorageB<u8>::PQ_Code_StorageB;
+    void ExtractCodes(const u32 idx, u32 *output_codes) const override {
+        auto read_pos = idx * subspace_num_;
+        for (u32 i = 0; i < subspace_num_; ++i) {
+            output_codes[i] = storage_[read_pos];
+            ++read_pos;
+        }
+    }
+    void AppendCodes(const u32 *input_codes) override {
+        storage_.resize(last_code_id_ + subspace_num_);
+        auto write_pos = last_code_id_;
+        for (u32 i = 0; i < subspace_num_; ++i) {
+            storage_[write_pos] = input_codes[i];
+            ++write_pos;
+        }
+        last_code_id_ += subspace_num_;
+    }
+};
+
+// 12 bits per code
+// 3 * 4 bits
+template <>
+struct PQ_Code_StorageT<12> final : PQ_Code_StorageB<u8> {
+    using PQ_Code_StorageB<u8>::PQ_Code_StorageB;
+    void ExtractCodes(const u32 idx, u32 *output_codes) const override {
+        const auto half_read_pos = idx * subspace_num_ * 3;
+        auto byte_pos = half_read_pos >> 1;
+        bool is_odd = half_read_pos & 1;
+        for (u32 i = 0; i < subspace_num_; ++i) {
+            const auto pack_16 = (static_cast<u32>(storage_[byte_pos]) | (static_cast<u32>(storage_[byte_pos + 1]) << 8));
+            output_codes[i] = is_odd ? (pack_16 >> 4) : (pack_16 & 0xfff);
+            byte_pos += is_odd ? 2 : 1;
+            is_odd = !is_odd;
+        }
+    }
+    void AppendCodes(const u32 *input_codes) override {
+        storage_.resize(((last_code_id_ + subspace_num_) * 3 + 1) / 2);
+        const auto half_write_pos = last_code_id_ * 3;
+        auto byte_pos = half_write_pos >> 1;
+        bool is_odd = half_write_pos & 1;
+        for (u32 i = 0; i < subspace_num_; ++i) {
+            const auto write_16 = is_odd ? (input_codes[i] << 4) : input_codes[i];
+            storage_[byte_pos] |= (write_16 & 0xff);
+            storage_[byte_pos + 1] |= (write_16 >> 8);
+            byte_pos += is_odd ? 2 : 1;
+            is_odd = !is_odd;
+        }
+        last_code_id_ += subspace_num_;
+    }
+};
+
+// 16 bits per code
+template <>
+struct PQ_Code_StorageT<16> final : PQ_Code_StorageB<u16> {
+    using PQ_Code_StorageB<u16>::PQ_Code_StorageB;
+    void ExtractCodes(const u32 idx, u32 *output_codes) const override {
+        auto read_pos = idx * subspace_num_;
+        for (u32 i = 0; i < subspace_num_; ++i) {
+            output_codes[i] = storage_[read_pos];
+            ++read_pos;
+        }
+    }
+    void AppendCodes(const u32 *input_codes) override {
+        storage_.resize(last_code_id_ + subspace_num_);
+        auto write_pos = last_code_id_;
+        for (u32 i = 0; i < subspace_num_; ++i) {
+            storage_[write_pos] = input_codes[i];
+            ++write_pos;
+        }
+        last_code_id_ += subspace_num_;
+    }
+};
+
+template <typename = void>
+UniquePtr<PQ_Code_Storage> GetPQCodeStorageT(const u32 subspace_num, const u32 subspace_bits) {
+    UnrecoverableError(fmt::format("Invalid subspace_bits: {}, expect number no bigger than 16.", subspace_bits));
+    return {};
+}
+
+template <u32 I, u32... J>
+    requires(I == std::min({I, J...}))
+UniquePtr<PQ_Code_Storage> GetPQCodeStorageT(const u32 subspace_num, const u32 subspace_bits) {
+    if (I >= subspace_bits) {
+        return MakeUnique<PQ_Code_StorageT<I>>(subspace_num);
+    }
+    return GetPQCodeStorageT<J...>(subspace_num, subspace_bits);
+}
+
+export UniquePtr<PQ_Code_Storage> GetPQCodeStorage(const u32 subspace_num, const u32 subspace_bits) {
+    return GetPQCodeStorageT<4, 8, 12, 16>(subspace_num, subspace_bits);
+}
+
+} // namespace infinity
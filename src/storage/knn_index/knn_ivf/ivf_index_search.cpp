@@ -54,6 +54,10 @@ IVF_Search_Params IVF_Search_Params::Make(const KnnScanFunctionData *knn_scan_fu
             }
         }
     }
+    params.refine_factor_ = knn_scan_shared_data->refine_factor_;
+    if (params.refine_factor_ > 0) {
+        params.topk_ *= params.refine_factor_;
+    }
     if (params.topk_ <= 0 || params.topk_ > std::numeric_limits<u32>::max()) {
         RecoverableError(Status::SyntaxError(fmt::format("Invalid topk which is out of range: {}.", params.topk_)));
     }
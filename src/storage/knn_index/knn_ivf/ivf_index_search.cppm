@@ -47,6 +47,8 @@ export struct IVF_Search_Params {
     EmbeddingDataType query_elem_type_{EmbeddingDataType::kElemInvalid};
     KnnDistanceType knn_distance_type_{KnnDistanceType::kInvalid};
     i32 nprobe_{1};
+    // when not 0, topk_ is over-fetched by this factor from the quantized codes, and the candidates are reranked with the raw vectors
+    i64 refine_factor_{0};
 
     static IVF_Search_Params Make(const KnnScanFunctionData *knn_scan_function_data);
 };
@@ -39,6 +39,7 @@ import ivf_index_util_func;
 import knn_expr;
 import vector_distance;
 import mlas_matrix_multiply;
+import infinity_context;
 
 namespace infinity {
 
@@ -94,6 +95,24 @@ Pair<u32, const f32 *> IVF_Centroids_Storage::GetCentroidDataForMetric(const Knn
 
 // IVF_Index_Storage
 
+namespace {
+
+// batches smaller than this are assigned and appended on the calling thread
+constexpr u32 kIVFBuildRangeSize = 1024;
+
+// the pool and task number for k-means assignment and insertion, {nullptr, 1} means building on the calling thread
+Pair<ThreadPool *, u32> GetIVFBuildThreadPool(const u32 build_threads) {
+    auto &thread_pool = InfinityContext::instance().GetHnswBuildThreadPool();
+    const u32 pool_size = thread_pool.size();
+    const u32 task_num = build_threads == 0 ? pool_size : std::min(build_threads, pool_size);
+    if (task_num <= 1) {
+        return {nullptr, 1};
+    }
+    return {&thread_pool, task_num};
+}
+
+} // namespace
+
 SizeT IVF_Index_Storage::MemoryUsed() const { return ivf_centroids_storage_.MemoryUsed() + ivf_parts_storage_->MemoryUsed(); }
 
 void IVF_Index_Storage::Save(LocalFileHandle &file_handle) const {
@@ -132,6 +151,7 @@ IVF_Index_Storage::IVF_Index_Storage(const IndexIVFOption &ivf_option,
       embedding_dimension_(embedding_dimension) {}
 
 void IVF_Index_Storage::Train(const u32 training_embedding_num, const f32 *training_data, const u32 expect_centroid_num) {
+    const auto [thread_pool, task_num] = GetIVFBuildThreadPool(ivf_option_.build_threads_);
     Vector<f32> output_centroids;
     const auto partition_num = GetKMeansCentroids(ivf_option_.metric_,
                                                   embedding_dimension_,
@@ -142,7 +162,9 @@ void IVF_Index_Storage::Train(const u32 training_embedding_num, const f32 *train
                                                   0,
                                                   ivf_option_.centroid_option_.min_points_per_centroid_,
                                                   ivf_option_.centroid_option_.max_points_per_centroid_,
-                                                  ivf_option_.centroid_option_.centroids_num_ratio_);
+                                                  ivf_option_.centroid_option_.centroids_num_ratio_,
+                                                  thread_pool,
+                                                  task_num);
     assert(expect_centroid_num == 0 || expect_centroid_num == partition_num);
     assert(output_centroids.size() == partition_num * embedding_dimension_);
     ivf_centroids_storage_ = IVF_Centroids_Storage(embedding_dimension_, partition_num, std::move(output_centroids));
@@ -218,22 +240,7 @@ void IVF_Index_Storage::AddEmbeddingBatchT(const SegmentOffset start_segment_off
                                            const EmbeddingDataTypeToCppTypeT<embedding_data_type> *embedding_ptr,
                                            const u32 embedding_num) {
     assert(embedding_data_type == embedding_data_type_);
-    assert(ivf_centroids_storage_.embedding_dimension() == embedding_dimension_);
-    assert(ivf_centroids_storage_.centroids_num() == ivf_parts_storage_->centroids_num());
-    const auto [embedding_f32_ptr, _] = GetF32Ptr(embedding_ptr, embedding_num * embedding_dimension_);
-    auto part_ids = Vector<u32>(embedding_num, std::numeric_limits<u32>::max());
-    search_top_1_without_dis<f32>(embedding_dimension_,
-                                  embedding_num,
-                                  embedding_f32_ptr,
-                                  ivf_centroids_storage_.centroids_num(),
-                                  ivf_centroids_storage_.data(),
-                                  part_ids.data());
-    for (u32 i = 0; i < embedding_num; ++i) {
-        ivf_parts_storage_->AppendOneEmbeddingWithStat(part_ids[i],
-                                                       embedding_ptr + i * embedding_dimension_,
-                                                       start_segment_offset + i,
-                                                       &ivf_centroids_storage_);
-    }
+    AppendEmbeddingsT(embedding_ptr, embedding_num, [start_segment_offset](const u32 i) { return start_segment_offset + i; });
     embedding_count_ += embedding_num;
     row_count_ += embedding_num;
 }
@@ -243,24 +250,39 @@ void IVF_Index_Storage::AddEmbeddingBatchT(const SegmentOffset *segment_offset_p
                                            const EmbeddingDataTypeToCppTypeT<embedding_data_type> *embedding_ptr,
                                            const u32 embedding_num) {
     assert(embedding_data_type == embedding_data_type_);
+    AppendEmbeddingsT(embedding_ptr, embedding_num, [segment_offset_ptr](const u32 i) { return segment_offset_ptr[i]; });
+    embedding_count_ += embedding_num;
+    row_count_ += embedding_num;
+}
+
+template <typename EmbeddingElementT, typename GetSegmentOffset>
+void IVF_Index_Storage::AppendEmbeddingsT(const EmbeddingElementT *embedding_ptr, const u32 embedding_num, GetSegmentOffset &&get_segment_offset) {
     assert(ivf_centroids_storage_.embedding_dimension() == embedding_dimension_);
     assert(ivf_centroids_storage_.centroids_num() == ivf_parts_storage_->centroids_num());
     const auto [embedding_f32_ptr, _] = GetF32Ptr(embedding_ptr, embedding_num * embedding_dimension_);
+    const auto [thread_pool, task_num] = GetIVFBuildThreadPool(ivf_option_.build_threads_);
+    const u32 centroids_num = ivf_centroids_storage_.centroids_num();
     auto part_ids = Vector<u32>(embedding_num, std::numeric_limits<u32>::max());
-    search_top_1_without_dis<f32>(embedding_dimension_,
-                                  embedding_num,
-                                  embedding_f32_ptr,
-                                  ivf_centroids_storage_.centroids_num(),
-                                  ivf_centroids_storage_.data(),
-                                  part_ids.data());
-    for (u32 i = 0; i < embedding_num; ++i) {
-        ivf_parts_storage_->AppendOneEmbeddingWithStat(part_ids[i],
-                                                       embedding_ptr + i * embedding_dimension_,
-                                                       segment_offset_ptr[i],
-                                                       &ivf_centroids_storage_);
-    }
-    embedding_count_ += embedding_num;
-    row_count_ += embedding_num;
+    ParallelForRanges(thread_pool, task_num, embedding_num, kIVFBuildRangeSize, [&](const u32 begin, const u32 end) {
+        search_top_1_without_dis<f32>(embedding_dimension_,
+                                      end - begin,
+                                      embedding_f32_ptr + static_cast<SizeT>(begin) * embedding_dimension_,
+                                      centroids_num,
+                                      ivf_centroids_storage_.data(),
+                                      part_ids.data() + begin);
+    });
+    // parts are independent, so every task appends the embeddings of its own range of parts, in input order
+    ThreadPool *append_thread_pool = embedding_num < kIVFBuildRangeSize ? nullptr : thread_pool;
+    ParallelForRanges(append_thread_pool, task_num, centroids_num, 1, [&](const u32 part_begin, const u32 part_end) {
+        for (u32 i = 0; i < embedding_num; ++i) {
+            if (const u32 part_id = part_ids[i]; part_id >= part_begin && part_id < part_end) {
+                ivf_parts_storage_->AppendOneEmbeddingWithStat(part_id,
+                                                               embedding_ptr + static_cast<SizeT>(i) * embedding_dimension_,
+                                                               get_segment_offset(i),
+                                                               &ivf_centroids_storage_);
+            }
+        }
+    });
 }
 
 template <EmbeddingDataType embedding_data_type>
@@ -268,22 +290,7 @@ void IVF_Index_Storage::AddMultiVectorT(const SegmentOffset segment_offset,
                                         const EmbeddingDataTypeToCppTypeT<embedding_data_type> *multi_vector_ptr,
                                         const u32 embedding_num) {
     assert(embedding_data_type == embedding_data_type_);
-    assert(ivf_centroids_storage_.embedding_dimension() == embedding_dimension_);
-    assert(ivf_centroids_storage_.centroids_num() == ivf_parts_storage_->centroids_num());
-    const auto [embedding_f32_ptr, _] = GetF32Ptr(multi_vector_ptr, embedding_num * embedding_dimension_);
-    auto part_ids = Vector<u32>(embedding_num, std::numeric_limits<u32>::max());
-    search_top_1_without_dis<f32>(embedding_dimension_,
-                                  embedding_num,
-                                  embedding_f32_ptr,
-                                  ivf_centroids_storage_.centroids_num(),
-                                  ivf_centroids_storage_.data(),
-                                  part_ids.data());
-    for (u32 i = 0; i < embedding_num; ++i) {
-        ivf_parts_storage_->AppendOneEmbeddingWithStat(part_ids[i],
-                                                       multi_vector_ptr + i * embedding_dimension_,
-                                                       segment_offset,
-                                                       &ivf_centroids_storage_);
-    }
+    AppendEmbeddingsT(multi_vector_ptr, embedding_num, [segment_offset](u32) { return segment_offset; });
     embedding_count_ += embedding_num;
     ++row_count_;
 }
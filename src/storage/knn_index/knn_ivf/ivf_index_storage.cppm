@@ -55,7 +55,8 @@ public:
 class IVF_Parts_Storage {
     const u32 embedding_dimension_ = 0;
     const u32 centroids_num_ = 0;
-    SizeT memory_used_ = 0;
+    // embeddings of different parts are appended concurrently when building
+    Atomic<SizeT> memory_used_ = 0;
 
 protected:
     void IncreaseMemoryUsage(SizeT mem_usage) { memory_used_ += mem_usage; }
@@ -147,6 +148,8 @@ private:
                             u32 embedding_num);
     template <EmbeddingDataType embedding_data_type>
     void AddMultiVectorT(SegmentOffset segment_offset, const EmbeddingDataTypeToCppTypeT<embedding_data_type> *multi_vector_ptr, u32 embedding_num);
+    template <typename EmbeddingElementT, typename GetSegmentOffset>
+    void AppendEmbeddingsT(const EmbeddingElementT *embedding_ptr, u32 embedding_num, GetSegmentOffset &&get_segment_offset);
 };
 
 inline auto ApplyEmbeddingDataTypeToFunc(const EmbeddingDataType embedding_data_type, auto func, auto default_f) {
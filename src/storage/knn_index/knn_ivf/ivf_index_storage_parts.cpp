@@ -40,11 +40,15 @@ import mlas_matrix_multiply;
 import vector_distance;
 import index_base;
 import knn_expr;
+import simd_functions;
+import pq_fast_scan_simd_funcs;
+import ivf_index_pq_code_storage;
 
 namespace infinity {
 
 struct SearchIndexPartsReuseContext {
     UniquePtr<f32[]> pq_query_ip_table_;
+    UniquePtr<PQFastScanLUT> pq_fast_scan_ip_lut_;
     u32 dim_ = 0;
     const f32 *x_ptr_ = nullptr;
     const f32 *a_ptr_ = nullptr;
@@ -337,12 +341,13 @@ public:
         assert(subspace_dimension_ * subspace_num_ == embedding_dimension());
         assert((embedding_dimension() << subspace_centroid_bits_) == subspace_dimension_ * expect_subspace_centroid_num_ * subspace_num_);
         row_memory_cost_ = sizeof(SegmentOffset);
-        // subspace_centroid_bits_ in [4, 8) -> 0.5 byte per subspace
-        if (subspace_centroid_bits_ >= 4 && subspace_centroid_bits_ < 8) {
-            row_memory_cost_ += subspace_num_ / 2;
-        } else if (subspace_centroid_bits_ >= 8 && subspace_centroid_bits_ < 12) {
+        // same rounding of subspace_centroid_bits_ as GetPQCodeStorage
+        if (subspace_centroid_bits_ <= 4) {
+            // 0.5 byte per subspace, stored in subspace pairs of the fast scan blocks
+            row_memory_cost_ += (subspace_num_ + 1) / 2;
+        } else if (subspace_centroid_bits_ <= 8) {
             row_memory_cost_ += subspace_num_;
-        } else if (subspace_centroid_bits_ >= 12 && subspace_centroid_bits_ < 16) {
+        } else if (subspace_centroid_bits_ <= 12) {
             row_memory_cost_ += subspace_num_ * 3 / 2;
         } else {
             row_memory_cost_ += subspace_num_ * 2;
@@ -885,160 +890,6 @@ public:
     }
 };
 
-// PQ storage
-struct PQ_Code_Storage {
-    const u64 subspace_num_ = 0;
-    explicit PQ_Code_Storage(const u32 subspace_num) : subspace_num_(subspace_num) {}
-    virtual ~PQ_Code_Storage() = default;
-    virtual void Save(LocalFileHandle &file_handle) const = 0;
-    virtual void Load(LocalFileHandle &file_handle) = 0;
-    virtual void ExtractCodes(u32 idx, u32 *output_codes) const = 0;
-    virtual void AppendCodes(const u32 *input_codes) = 0;
-};
-
-template <std::unsigned_integral T>
-struct PQ_Code_StorageB : PQ_Code_Storage {
-    u64 last_code_id_ = 0;
-    Vector<T> storage_{};
-    using PQ_Code_Storage::PQ_Code_Storage;
-    void Save(LocalFileHandle &file_handle) const final {
-        file_handle.Append(&last_code_id_, sizeof(last_code_id_));
-        const u32 storage_size = storage_.size();
-        file_handle.Append(&storage_size, sizeof(storage_size));
-        file_handle.Append(storage_.data(), storage_.size() * sizeof(T));
-    }
-    void Load(LocalFileHandle &file_handle) final {
-        file_handle.Read(&last_code_id_, sizeof(last_code_id_));
-        u32 storage_size = 0;
-        file_handle.Read(&storage_size, sizeof(storage_size));
-        storage_.resize(storage_size);
-        file_handle.Read(storage_.data(), storage_size * sizeof(T));
-    }
-};
-
-template <u32 storage_bits>
-struct PQ_Code_StorageT;
-
-// 4 bits per code
-template <>
-struct PQ_Code_StorageT<4> final : PQ_Code_StorageB<u8> {
-    using PQ_Code_StorageB<u8>::PQ_Code_StorageB;
-    void ExtractCodes(const u32 idx, u32 *output_codes) const override {
-        auto read_pos = idx * subspace_num_;
-        for (u32 i = 0; i < subspace_num_; ++i) {
-            const auto access_pos = read_pos >> 1;
-            output_codes[i] = ((read_pos & 1) ? (storage_[access_pos] >> 4) : (storage_[access_pos] & 0xf));
-            ++read_pos;
-        }
-    }
-    void AppendCodes(const u32 *input_codes) override {
-        storage_.resize((last_code_id_ + subspace_num_ + 1) / 2);
-        auto write_pos = last_code_id_;
-        for (u32 i = 0; i < subspace_num_; ++i) {
-            const auto access_pos = write_pos >> 1;
-            const auto input_code = input_codes[i];
-            storage_[access_pos] |= (write_pos & 1) ? (input_code << 4) : input_code;
-            ++write_pos;
-        }
-        last_code_id_ += subspace_num_;
-    }
-};
-
-// 8 bits per code
-template <>
-struct PQ_Code_StorageT<8> final : PQ_Code_StorageB<u8> {
-    using PQ_Code_StorageB<u8>::PQ_Code_StorageB;
-    void ExtractCodes(const u32 idx, u32 *output_codes) const override {
-        auto read_pos = idx * subspace_num_;
-        for (u32 i = 0; i < subspace_num_; ++i) {
-            output_codes[i] = storage_[read_pos];
-            ++read_pos;
-        }
-    }
-    void AppendCodes(const u32 *input_codes) override {
-        storage_.resize(last_code_id_ + subspace_num_);
-        auto write_pos = last_code_id_;
-        for (u32 i = 0; i < subspace_num_; ++i) {
-            storage_[write_pos] = input_codes[i];
-            ++write_pos;
-        }
-        last_code_id_ += subspace_num_;
-    }
-};
-
-// 12 bits per code
-// 3 * 4 bits
-template <>
-struct PQ_Code_StorageT<12> final : PQ_Code_StorageB<u8> {
-    using PQ_Code_StorageB<u8>::PQ_Code_StorageB;
-    void ExtractCodes(const u32 idx, u32 *output_codes) const override {
-        const auto half_read_pos = idx * subspace_num_ * 3;
-        auto byte_pos = half_read_pos >> 1;
-        bool is_odd = half_read_pos & 1;
-        for (u32 i = 0; i < subspace_num_; ++i) {
-            const auto pack_16 = (static_cast<u32>(storage_[byte_pos]) | (static_cast<u32>(storage_[byte_pos + 1]) << 8));
-            output_codes[i] = is_odd ? (pack_16 >> 4) : (pack_16 & 0xfff);
-            byte_pos += is_odd ? 2 : 1;
-            is_odd = !is_odd;
-        }
-    }
-    void AppendCodes(const u32 *input_codes) override {
-        storage_.resize(((last_code_id_ + subspace_num_) * 3 + 1) / 2);
-        const auto half_write_pos = last_code_id_ * 3;
-        auto byte_pos = half_write_pos >> 1;
-        bool is_odd = half_write_pos & 1;
-        for (u32 i = 0; i < subspace_num_; ++i) {
-            const auto write_16 = is_odd ? (input_codes[i] << 4) : input_codes[i];
-            storage_[byte_pos] |= (write_16 & 0xff);
-            storage_[byte_pos + 1] |= (write_16 >> 8);
-            byte_pos += is_odd ? 2 : 1;
-            is_odd = !is_odd;
-        }
-        last_code_id_ += subspace_num_;
-    }
-};
-
-// 16 bits per code
-template <>
-struct PQ_Code_StorageT<16> final : PQ_Code_StorageB<u16> {
-    using PQ_Code_StorageB<u16>::PQ_Code_StorageB;
-    void ExtractCodes(const u32 idx, u32 *output_codes) const override {
-        auto read_pos = idx * subspace_num_;
-        for (u32 i = 0; i < subspace_num_; ++i) {
-            output_codes[i] = storage_[read_pos];
-            ++read_pos;
-        }
-    }
-    void AppendCodes(const u32 *input_codes) override {
-        storage_.resize(last_code_id_ + subspace_num_);
-        auto write_pos = last_code_id_;
-        for (u32 i = 0; i < subspace_num_; ++i) {
-            storage_[write_pos] = input_codes[i];
-            ++write_pos;
-        }
-        last_code_id_ += subspace_num_;
-    }
-};
-
-template <typename = void>
-UniquePtr<PQ_Code_Storage> GetPQCodeStorageT(const u32 subspace_num, const u32 subspace_bits) {
-    UnrecoverableError(fmt::format("Invalid subspace_bits: {}, expect number no bigger than 16.", subspace_bits));
-    return {};
-}
-
-template <u32 I, u32... J>
-    requires(I == std::min({I, J...}))
-UniquePtr<PQ_Code_Storage> GetPQCodeStorageT(const u32 subspace_num, const u32 subspace_bits) {
-    if (I >= subspace_bits) {
-        return MakeUnique<PQ_Code_StorageT<I>>(subspace_num);
-    }
-    return GetPQCodeStorageT<J...>(subspace_num, subspace_bits);
-}
-
-UniquePtr<PQ_Code_Storage> GetPQCodeStorage(const u32 subspace_num, const u32 subspace_bits) {
-    return GetPQCodeStorageT<4, 8, 12, 16>(subspace_num, subspace_bits);
-}
-
 template <EmbeddingDataType src_embedding_data_type>
 class IVF_Part_Storage_PQ final : public IVF_Part_Storage {
     using ColumnEmbeddingElementT = EmbeddingDataTypeToCppTypeT<src_embedding_data_type>;
@@ -1149,6 +1000,20 @@ public:
                 if (!ip_table) {
                     ip_table = ivf_parts_storage.GetIPTable(query_f32);
                 }
+                if (pq_code_storage_->FastScanBlocks()) {
+                    auto &fast_scan_lut = context.pq_fast_scan_ip_lut_;
+                    if (!fast_scan_lut) {
+                        fast_scan_lut = MakeUnique<PQFastScanLUT>(subspace_num, real_subspace_centroid_num, [&](const u32 j, const u32 c) {
+                            return ip_table[j * real_subspace_centroid_num + c];
+                        });
+                    }
+                    FastScanCodes(*fast_scan_lut, [&](const f32 d, const SegmentOffset segment_offset) {
+                        if (satisfy_filter_func(segment_offset)) {
+                            add_result_func(query_centroid_ip + d, segment_offset);
+                        }
+                    });
+                    break;
+                }
                 const auto encoded_codes = MakeUniqueForOverwrite<u32[]>(subspace_num_);
                 for (u32 i = 0; i < total_embedding_num; ++i) {
                     const auto segment_offset = embedding_segment_offset(i);
@@ -1200,6 +1065,18 @@ public:
                 }
                 const auto residual_query_l2 = L2NormSquare<f32>(residual_query.get(), dimension);
                 const auto residual_ip_table = ivf_parts_storage.GetIPTable(residual_query.get());
+                if (pq_code_storage_->FastScanBlocks()) {
+                    const PQFastScanLUT fast_scan_lut(subspace_num, real_subspace_centroid_num, [&](const u32 j, const u32 c) {
+                        return -2.0f * (residual_ip_table[j * real_subspace_centroid_num + c] +
+                                        ivf_parts_storage.subspace_centroid_norms_neg_half_at_subspace(j)[c]);
+                    });
+                    FastScanCodes(fast_scan_lut, [&](const f32 d, const SegmentOffset segment_offset) {
+                        if (satisfy_filter_func(segment_offset)) {
+                            add_result_func(residual_query_l2 + d, segment_offset);
+                        }
+                    });
+                    break;
+                }
                 const auto encoded_codes = MakeUniqueForOverwrite<u32[]>(subspace_num_);
                 for (u32 i = 0; i < total_embedding_num; ++i) {
                     const auto segment_offset = embedding_segment_offset(i);
@@ -1224,6 +1101,25 @@ public:
             }
         }
     }
+
+    // scan 4-bit codes block by block, estimated distances are approximate (quantized lut)
+    template <typename ResultHandler>
+    void FastScanCodes(const PQFastScanLUT &fast_scan_lut, ResultHandler &&result_handler) const {
+        const u8 *blocks = pq_code_storage_->FastScanBlocks();
+        const u32 subspace_pair_num = (subspace_num_ + 1) / 2;
+        const u32 block_bytes = PQFastScanBlockBytes(subspace_pair_num);
+        const auto fast_scan_func = GetSIMD_FUNCTIONS().PQFastScan_func_ptr_;
+        const auto total_embedding_num = embedding_num();
+        u16 distances[PQ_FAST_SCAN_BLOCK_SIZE];
+        for (u32 block_start = 0; block_start < total_embedding_num; block_start += PQ_FAST_SCAN_BLOCK_SIZE) {
+            fast_scan_func(blocks, fast_scan_lut.lut_.data(), subspace_pair_num, distances);
+            blocks += block_bytes;
+            const u32 block_end = std::min<u32>(block_start + PQ_FAST_SCAN_BLOCK_SIZE, total_embedding_num);
+            for (u32 i = block_start; i < block_end; ++i) {
+                result_handler(fast_scan_lut.Decode(distances[i - block_start]), embedding_segment_offset(i));
+            }
+        }
+    }
 };
 
 UniquePtr<IVF_Part_Storage> IVF_Part_Storage::Make(const u32 part_id,
@@ -15,6 +15,7 @@
 module;
 
 #include <cstring>
+#include <future>
 #include <random>
 export module kmeans_partition;
 
@@ -46,6 +47,27 @@ inline Vector<u32> RandomPermutatePartially(const u32 vector_count, u32 random_n
     return permutation;
 }
 
+// Run fn(begin, end) over [0, total), split into at most task_num ranges of at least min_range_size on thread_pool.
+// Runs on the calling thread if thread_pool is nullptr or there is only one range.
+export template <typename Fn>
+void ParallelForRanges(ThreadPool *thread_pool, const u32 task_num, const u32 total, const u32 min_range_size, Fn &&fn) {
+    const u32 range_num = thread_pool == nullptr ? 1 : std::min(task_num, (total + min_range_size - 1) / min_range_size);
+    if (range_num <= 1) {
+        fn(0u, total);
+        return;
+    }
+    const u32 range_size = (total + range_num - 1) / range_num;
+    Vector<std::future<void>> futs;
+    futs.reserve(range_num);
+    for (u32 begin = 0; begin < total; begin += range_size) {
+        const u32 end = std::min(begin + range_size, total);
+        futs.emplace_back(thread_pool->push([&fn, begin, end](int) { fn(begin, end); }));
+    }
+    for (auto &fut : futs) {
+        fut.get();
+    }
+}
+
 // normalize centroids
 template <typename CentroidType>
 inline void NormalizeCentroids(const u32 dimension, const u32 partition_num, CentroidType *centroids) {
@@ -64,6 +86,7 @@ inline void NormalizeCentroids(const u32 dimension, const u32 partition_num, Cen
 // CentroidsType: the type to calculate centroids
 // partition_num: the number of partitions, default to sqrt(vector_count)
 // iteration_max: the max iteration count, default to 10
+// thread_pool, task_num: assign training vectors to partitions with at most task_num tasks on thread_pool
 constexpr int default_iteration_max = 10;
 export template <typename ElemType, typename CentroidsOutputType>
 [[nodiscard]] u32 GetKMeansCentroids(const MetricType metric,
@@ -75,7 +98,9 @@ export template <typename ElemType, typename CentroidsOutputType>
                                      u32 iteration_max = 0,
                                      u32 min_points_per_centroid = 32,
                                      u32 max_points_per_centroid = 256,
-                                     float centroids_num_ratio = 1.0f) {
+                                     float centroids_num_ratio = 1.0f,
+                                     ThreadPool *thread_pool = nullptr,
+                                     u32 task_num = 1) {
     using CentroidsType = f32;
     switch (metric) {
         case MetricType::kMetricL2:
@@ -210,13 +235,15 @@ export template <typename ElemType, typename CentroidsOutputType>
         {
             // search top 1
             auto search_top_1_with_dis = GetSIMD_FUNCTIONS().SearchTop1WithDisF32U32_func_ptr_;
-            search_top_1_with_dis(dimension,
-                                  training_data_num,
-                                  training_data,
-                                  partition_num,
-                                  centroids,
-                                  training_data_partition_id.data(),
-                                  partition_element_distance.data());
+            ParallelForRanges(thread_pool, task_num, training_data_num, 1024, [&](const u32 begin, const u32 end) {
+                search_top_1_with_dis(dimension,
+                                      end - begin,
+                                      training_data + static_cast<SizeT>(begin) * dimension,
+                                      partition_num,
+                                      centroids,
+                                      training_data_partition_id.data() + begin,
+                                      partition_element_distance.data() + begin);
+            });
             // Clear partition_element_count
             memset(partition_element_count.data(), 0, sizeof(u32) * partition_num);
             // calculate partition_element_count
@@ -31,6 +31,7 @@ import virtual_store;
 import infinity_exception;
 import logger;
 import data_file_worker;
+import column_encoding;
 import var_file_worker;
 import catalog_delta_entry;
 import internal_types;
@@ -104,7 +105,8 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewBlockColumnEntry(const BlockEnt
                                                   block_entry->block_dir(),
                                                   block_column_entry->file_name_,
                                                   total_data_size,
-                                                  buffer_mgr->persistence_manager());
+                                                  buffer_mgr->persistence_manager(),
+                                                  ColumnEncodingInfo::Make(*column_type));
 
     block_column_entry->buffer_ = buffer_mgr->AllocateBufferObject(std::move(file_worker));
     block_column_entry->buffer_->AddObjRc();
@@ -132,7 +134,8 @@ UniquePtr<BlockColumnEntry> BlockColumnEntry::NewReplayBlockColumnEntry(const Bl
                                                   block_entry->block_dir(),
                                                   column_entry->file_name_,
                                                   total_data_size,
-                                                  buffer_manager->persistence_manager());
+                                                  buffer_manager->persistence_manager(),
+                                                  ColumnEncodingInfo::Make(*column_type));
 
     column_entry->buffer_ = buffer_manager->GetBufferObject(std::move(file_worker), true /*restart*/);
     column_entry->buffer_->AddObjRc();
@@ -193,9 +196,10 @@ Vector<String> BlockColumnEntry::FilePaths() const {
     return res;
 }
 
-void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT start_row_count, SizeT checkpoint_row_count) {
+void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT start_row_count, SizeT checkpoint_row_count, bool sealed) {
     // TODO: Opt, Flush certain row_count content
     DataType *column_type = block_column_entry->column_type_.get();
+    const DataFileWorkerSaveCtx save_ctx(sealed);
     switch (column_type->type()) {
         case LogicalType::kBoolean:
         case LogicalType::kTinyInt:
@@ -224,7 +228,7 @@ void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT start_r
         case LogicalType::kRowID: {
             //            SizeT buffer_size = row_count * column_type->Size();
             LOG_TRACE(fmt::format("Saving {}", block_column_entry->column_id()));
-            block_column_entry->buffer_->Save();
+            block_column_entry->buffer_->Save(save_ctx);
             LOG_TRACE(fmt::format("Saved {}", block_column_entry->column_id()));
 
             break;
@@ -236,7 +240,7 @@ void BlockColumnEntry::Flush(BlockColumnEntry *block_column_entry, SizeT start_r
         case LogicalType::kVarchar: {
             //            SizeT buffer_size = row_count * column_type->Size();
             LOG_TRACE(fmt::format("Saving column {}", block_column_entry->column_id()));
-            block_column_entry->buffer_->Save();
+            block_column_entry->buffer_->Save(save_ctx);
             LOG_TRACE(fmt::format("Saved column {}", block_column_entry->column_id()));
 
             std::shared_lock lock(block_column_entry->mutex_);
@@ -273,7 +277,7 @@ void BlockColumnEntry::FlushColumn(TxnTimeStamp checkpoint_ts) {
         return;
     }
     SizeT row_cnt = block_entry_->row_count(checkpoint_ts);
-    BlockColumnEntry::Flush(this, 0, row_cnt);
+    BlockColumnEntry::Flush(this, 0, row_cnt, row_cnt == block_entry_->row_capacity());
 }
 
 void BlockColumnEntry::DropColumn() {
@@ -118,7 +118,8 @@ public:
     void SetLastChunkOff(u64 offset) { last_chunk_offset_ = offset; }
 
 public:
-    static void Flush(BlockColumnEntry *block_column_entry, SizeT start_row_count, SizeT checkpoint_row_count);
+    // `sealed`: no more rows are appended to the block, the column data file can be encoded
+    static void Flush(BlockColumnEntry *block_column_entry, SizeT start_row_count, SizeT checkpoint_row_count, bool sealed);
 
     void FlushColumn(TxnTimeStamp checkpoint_ts);
 
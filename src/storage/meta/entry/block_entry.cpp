@@ -33,12 +33,15 @@ import version_file_worker;
 import column_vector;
 import roaring_bitmap;
 import block_version;
+import croaring;
 import cleanup_scanner;
 import buffer_manager;
 import buffer_obj;
 import logical_type;
 import infinity_context;
 import virtual_store;
+import persistence_manager;
+import persist_result_handler;
 
 namespace infinity {
 
@@ -188,6 +191,33 @@ ColumnVector BlockEntry::GetConstColumnVector(BufferManager *buffer_mgr, ColumnI
     return block_column_entry->GetConstColumnVector(buffer_mgr, row_count);
 }
 
+void BlockEntry::PrefetchColumns(BufferManager *buffer_mgr, const Vector<SizeT> &column_ids) const {
+    Vector<BufferObj *> buffers;
+    for (SizeT column_id : column_ids) {
+        if (column_id >= columns_.size()) {
+            continue;
+        }
+        BlockColumnEntry *block_column_entry = GetColumnBlockEntry(column_id);
+        if (BufferObj *buffer = block_column_entry->buffer(); buffer != nullptr) {
+            buffers.push_back(buffer);
+        }
+        for (SizeT i = 0; i < block_column_entry->OutlineBufferCount(); ++i) {
+            buffers.push_back(block_column_entry->GetOutlineBuffer(i));
+        }
+    }
+    if (PersistenceManager *pm = buffer_mgr->persistence_manager(); pm != nullptr && !pm->local_storage()) {
+        // Start downloading the column files from object storage first, the files of a block are usually in one object
+        Vector<String> file_paths;
+        for (BufferObj *buffer : buffers) {
+            file_paths.push_back(buffer->GetFilename());
+        }
+        PersistResultHandler(pm).Prefetch(file_paths);
+    }
+    for (BufferObj *buffer : buffers) {
+        buffer_mgr->Prefetch(buffer);
+    }
+}
+
 SizeT BlockEntry::row_count(TxnTimeStamp check_ts) const {
     std::shared_lock lock(rw_locker_);
     if (check_ts >= max_row_ts_)
@@ -206,18 +236,43 @@ Pair<BlockOffset, BlockOffset> BlockEntry::GetVisibleRange(TxnTimeStamp start_ts
     const auto *block_version = reinterpret_cast<const BlockVersion *>(block_version_handle.GetData());
 
     BlockOffset block_offset_end = block_version->GetRowCount(begin_ts);
-    while (block_offset_begin < block_offset_end && block_version->CheckDelete(block_offset_begin, begin_ts)) {
+    const auto delete_snapshot = GetDeleteSnapshotNoLock(block_version, begin_ts);
+    const Roaring &deleted_rows = delete_snapshot->deleted_rows_;
+    if (deleted_rows.isEmpty()) {
+        return {block_offset_begin, std::max(block_offset_begin, block_offset_end)};
+    }
+    while (block_offset_begin < block_offset_end && deleted_rows.contains(block_offset_begin)) {
         block_offset_begin++;
     }
-    BlockOffset row_idx;
-    for (row_idx = block_offset_begin; row_idx < block_offset_end; ++row_idx) {
-        if (block_version->CheckDelete(row_idx, begin_ts)) {
-            break;
+    BlockOffset row_idx = block_offset_end;
+    if (block_offset_begin < block_offset_end) {
+        RoaringSetBitForwardIterator next_deleted = deleted_rows.begin();
+        next_deleted.equalorlarger(block_offset_begin);
+        if (next_deleted != deleted_rows.end() && *next_deleted < block_offset_end) {
+            row_idx = *next_deleted;
         }
+    } else {
+        row_idx = block_offset_begin;
     }
     return {block_offset_begin, row_idx};
 }
 
+SharedPtr<const BlockDeleteSnapshot> BlockEntry::GetDeleteSnapshotNoLock(const BlockVersion *block_version, TxnTimeStamp check_ts) const {
+    SharedPtr<const BlockDeleteSnapshot> delete_snapshot;
+    {
+        std::lock_guard lock(delete_snapshot_mutex_);
+        if (delete_snapshot_.get() == nullptr) {
+            delete_snapshot_ = block_version->GetDeleteSnapshot(MAX_TIMESTAMP);
+        }
+        delete_snapshot = delete_snapshot_;
+    }
+    if (delete_snapshot->max_delete_ts_ <= check_ts) {
+        return delete_snapshot;
+    }
+    // an older snapshot does not see some of the deletes
+    return block_version->GetDeleteSnapshot(check_ts);
+}
+
 bool BlockEntry::CheckRowVisible(BlockOffset block_offset, TxnTimeStamp check_ts, bool check_append) const {
     std::shared_lock lock(rw_locker_);
 
@@ -235,14 +290,19 @@ void BlockEntry::CheckRowsVisible(Vector<u32> &segment_offsets, TxnTimeStamp che
     if (min_row_ts_ > check_ts)
         return;
 
-    Vector<u32> segment_offsets2;
-    segment_offsets2.reserve(segment_offsets.size());
     auto block_version_handle = this->version_buffer_object_->Load();
     const auto *block_version = reinterpret_cast<const BlockVersion *>(block_version_handle.GetData());
+    const auto delete_snapshot = GetDeleteSnapshotNoLock(block_version, check_ts);
+    const Roaring &deleted_rows = delete_snapshot->deleted_rows_;
+    if (deleted_rows.isEmpty()) {
+        return;
+    }
 
+    Vector<u32> segment_offsets2;
+    segment_offsets2.reserve(segment_offsets.size());
     for (const auto segment_offset : segment_offsets) {
         BlockOffset off = segment_offset & BLOCK_OFFSET_MASK;
-        if (!block_version->CheckDelete(off, check_ts)) {
+        if (!deleted_rows.contains(off)) {
             segment_offsets2.push_back(segment_offset);
         }
     }
@@ -259,11 +319,13 @@ void BlockEntry::CheckRowsVisible(Bitmask &segment_offsets, TxnTimeStamp check_t
     const auto *block_version = reinterpret_cast<const BlockVersion *>(block_version_handle.GetData());
 
     BlockOffset block_offset_end = block_version->GetRowCount(check_ts);
-    for (BlockOffset off = 0; off < block_offset_end; off++) {
-        if (block_version->CheckDelete(off, check_ts)) {
-            SegmentOffset segment_offset = (SegmentOffset(block_id_) << BLOCK_OFFSET_SHIFT) | SegmentOffset(off);
-            segment_offsets.SetFalse(segment_offset);
+    const auto delete_snapshot = GetDeleteSnapshotNoLock(block_version, check_ts);
+    for (const u32 off : delete_snapshot->deleted_rows_) {
+        if (off >= block_offset_end) {
+            break;
         }
+        SegmentOffset segment_offset = (SegmentOffset(block_id_) << BLOCK_OFFSET_SHIFT) | SegmentOffset(off);
+        segment_offsets.SetFalse(segment_offset);
     }
 }
 
@@ -282,21 +344,24 @@ bool BlockEntry::CheckDeleteConflict(const Vector<BlockOffset> &block_offsets, T
 }
 
 void BlockEntry::SetDeleteBitmask(TxnTimeStamp query_ts, Bitmask &bitmask) const {
-    BlockOffset read_offset = 0;
-    while (true) {
-        auto [row_begin, row_end] = GetVisibleRange(query_ts, read_offset);
-        if (row_begin == row_end) {
+    std::shared_lock lock(rw_locker_);
+    TxnTimeStamp begin_ts = std::min(query_ts, this->max_row_ts_);
+
+    auto block_version_handle = this->version_buffer_object_->Load();
+    const auto *block_version = reinterpret_cast<const BlockVersion *>(block_version_handle.GetData());
+
+    BlockOffset block_offset_end = block_version->GetRowCount(begin_ts);
+    const auto delete_snapshot = GetDeleteSnapshotNoLock(block_version, begin_ts);
+    for (const u32 offset : delete_snapshot->deleted_rows_) {
+        if (offset >= block_offset_end) {
             break;
         }
-        for (BlockOffset offset = read_offset; offset < row_begin; ++offset) {
-            bitmask.SetFalse(offset);
-        }
-        read_offset = row_end;
-    }
-    // FIXME: read row_count_ is not thread safe
-    for (BlockOffset offset = read_offset; offset < block_row_count_; ++offset) {
         bitmask.SetFalse(offset);
     }
+    // rows appended after query_ts
+    if (block_offset_end < block_row_count_) {
+        bitmask.SetFalseRange(block_offset_end, block_row_count_);
+    }
 }
 
 u16 BlockEntry::AppendData(TransactionID txn_id,
@@ -356,6 +421,10 @@ SizeT BlockEntry::DeleteData(TransactionID txn_id, TxnTimeStamp commit_ts, const
 
     auto block_version_handle = version_buffer_object_->Load();
     auto *block_version = reinterpret_cast<BlockVersion *>(block_version_handle.GetDataMut());
+    {
+        std::lock_guard snapshot_lock(delete_snapshot_mutex_);
+        delete_snapshot_.reset();
+    }
 
     SizeT delete_row_n = 0;
     for (BlockOffset block_offset : rows) {
@@ -447,12 +516,12 @@ void BlockEntry::DropColumns(const Vector<ColumnID> &column_ids, TxnTableStore *
     }
 }
 
-void BlockEntry::FlushDataNoLock(SizeT start_row_count, SizeT checkpoint_row_count) {
+void BlockEntry::FlushDataNoLock(SizeT start_row_count, SizeT checkpoint_row_count, bool sealed) {
     SizeT column_count = this->columns_.size();
     SizeT column_idx = 0;
     while (column_idx < column_count) {
         BlockColumnEntry *block_column_entry = this->columns_[column_idx].get();
-        BlockColumnEntry::Flush(block_column_entry, start_row_count, checkpoint_row_count);
+        BlockColumnEntry::Flush(block_column_entry, start_row_count, checkpoint_row_count, sealed);
         LOG_TRACE(fmt::format("ColumnData {} is flushed", block_column_entry->column_id()));
         ++column_idx;
     }
@@ -484,7 +553,8 @@ void BlockEntry::Flush(TxnTimeStamp checkpoint_ts) {
         SizeT checkpoint_row_count = block_version->GetRowCount(checkpoint_ts);
 
         LOG_TRACE("Block entry flush before flush data");
-        FlushDataNoLock(this->checkpoint_row_count_, checkpoint_row_count);
+        // A full block takes no more appends, an unsealed one is written again at the next checkpoint
+        FlushDataNoLock(this->checkpoint_row_count_, checkpoint_row_count, checkpoint_row_count == this->row_capacity_);
 
         LOG_TRACE(fmt::format("BlockEntry::Flush: last_ckp_ts: {}, last_ckp_row_count: {} current ckp ts: {} current_ckp_row_count {}",
                               this->checkpoint_ts_,
@@ -502,7 +572,8 @@ void BlockEntry::Flush(TxnTimeStamp checkpoint_ts) {
     }
 }
 
-void BlockEntry::FlushForImport() { FlushDataNoLock(0, this->block_row_count_); }
+// Imported and compacted blocks are written once
+void BlockEntry::FlushForImport() { FlushDataNoLock(0, this->block_row_count_, true); }
 
 void BlockEntry::LoadFilterBinaryData(const String &block_filter_data) { fast_rough_filter_->DeserializeFromString(block_filter_data); }
 
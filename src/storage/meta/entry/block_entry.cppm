@@ -159,6 +159,9 @@ public:
 
     ColumnVector GetConstColumnVector(BufferManager *buffer_mgr, ColumnID column_id) const;
 
+    // Read the files of the columns in background, hidden column ids are skipped.
+    void PrefetchColumns(BufferManager *buffer_mgr, const Vector<SizeT> &column_ids) const;
+
     FastRoughFilter *GetFastRoughFilter() { return fast_rough_filter_.get(); }
 
     const FastRoughFilter *GetFastRoughFilter() const { return fast_rough_filter_.get(); }
@@ -200,7 +203,10 @@ public:
 
     SizeT GetStorageSize() const;
 private:
-    void FlushDataNoLock(SizeT start_row_count, SizeT checkpoint_row_count);
+    void FlushDataNoLock(SizeT start_row_count, SizeT checkpoint_row_count, bool sealed);
+
+    // Rows deleted as seen by check_ts, requires rw_locker_ held.
+    SharedPtr<const BlockDeleteSnapshot> GetDeleteSnapshotNoLock(const BlockVersion *block_version, TxnTimeStamp check_ts) const;
 
     bool FlushVersionNoLock(TxnTimeStamp checkpoint_ts);
 
@@ -228,6 +234,10 @@ protected:
     // checkpoint state
     u16 checkpoint_row_count_{0};
 
+    // All deleted rows of the block, shared by the readers whose timestamp sees every delete. Dropped by DeleteData.
+    mutable std::mutex delete_snapshot_mutex_{};
+    mutable SharedPtr<const BlockDeleteSnapshot> delete_snapshot_{};
+
     // Column data
     Vector<UniquePtr<BlockColumnEntry>> columns_{};
     Vector<UniquePtr<BlockColumnEntry>> dropped_columns_{};
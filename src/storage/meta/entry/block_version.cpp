@@ -14,6 +14,7 @@
 
 module;
 
+#include <bit>
 #include <fstream>
 
 module block_version;
@@ -27,6 +28,7 @@ import column_vector;
 import serialize;
 import local_file_handle;
 import status;
+import croaring;
 
 namespace infinity {
 
@@ -192,4 +194,26 @@ bool BlockVersion::CheckDelete(i32 offset, TxnTimeStamp check_ts) const {
     return deleted_[offset] != 0 && deleted_[offset] <= check_ts;
 }
 
+UniquePtr<BlockDeleteSnapshot> BlockVersion::GetDeleteSnapshot(TxnTimeStamp check_ts) const {
+    auto snapshot = MakeUnique<BlockDeleteSnapshot>();
+    const SizeT row_count = deleted_.size();
+    const TxnTimeStamp *deleted = deleted_.data();
+    for (SizeT word_begin = 0; word_begin < row_count; word_begin += 64) {
+        const SizeT word_size = std::min<SizeT>(64, row_count - word_begin);
+        // deleted[i] != 0 && deleted[i] <= check_ts, branch free so that the loop is vectorized
+        u64 word = 0;
+        for (SizeT i = 0; i < word_size; ++i) {
+            word |= u64(deleted[word_begin + i] - 1 < check_ts) << i;
+        }
+        while (word != 0) {
+            const SizeT row = word_begin + std::countr_zero(word);
+            snapshot->deleted_rows_.add(row);
+            snapshot->max_delete_ts_ = std::max(snapshot->max_delete_ts_, deleted[row]);
+            word &= word - 1;
+        }
+    }
+    snapshot->deleted_rows_.runOptimize();
+    return snapshot;
+}
+
 } // namespace infinity
\ No newline at end of file
@@ -18,6 +18,7 @@ export module block_version;
 
 import stl;
 import local_file_handle;
+import croaring;
 
 namespace infinity {
 
@@ -37,6 +38,12 @@ struct CreateField {
     static CreateField LoadFromFile(LocalFileHandle *file_handle);
 };
 
+// Offsets of the rows of a block deleted at or before some timestamp
+export struct BlockDeleteSnapshot {
+    TxnTimeStamp max_delete_ts_{}; // newest delete timestamp among deleted_rows_, 0 if there is none
+    Roaring deleted_rows_{};
+};
+
 export struct BlockVersion {
     constexpr static std::string_view PATH = "version";
 
@@ -66,6 +73,9 @@ export struct BlockVersion {
 
     bool CheckDelete(i32 offset, TxnTimeStamp check_ts) const;
 
+    // Collect all rows deleted at or before check_ts, the delete timestamps are compared 64 rows at a time.
+    UniquePtr<BlockDeleteSnapshot> GetDeleteSnapshot(TxnTimeStamp check_ts) const;
+
     TxnTimeStamp latest_change_ts() const { return latest_change_ts_; }
 
 private:
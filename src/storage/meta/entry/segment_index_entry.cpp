@@ -60,6 +60,7 @@ import txn_store;
 import secondary_index_in_mem;
 import ivf_index_data_in_mem;
 import ivf_index_data;
+import diskann_index_in_chunk;
 import emvb_index;
 import emvb_index_in_mem;
 import bmp_util;
@@ -548,10 +549,20 @@ void SegmentIndexEntry::PopulateEntirely(const SegmentEntry *segment_entry, Txn
             dumped_memindex_entry = MemIndexDump();
             break;
         }
-        case IndexType::kDiskAnn: { // TODO
-            UniquePtr<String> err_msg =
-                MakeUnique<String>(fmt::format("{} PopulateEntirely is not supported yet", IndexInfo::IndexTypeToString(index_base->index_type_)));
-            LOG_WARN(*err_msg);
+        case IndexType::kDiskAnn: {
+            const u32 row_count = segment_entry->row_count();
+            if (row_count <= DISKANN_NUM_CENTERS) {
+                // Too few rows to train the pq, the knn scan searches the rows not covered by a chunk by brute force.
+                LOG_TRACE(fmt::format("Segment {} has {} rows, skip building DiskAnn index", seg_id, row_count));
+                break;
+            }
+            SharedPtr<ChunkIndexEntry> diskann_chunk_index_entry = CreateDiskAnnIndexChunkIndexEntry(base_row_id, row_count, buffer_mgr);
+            this->AddChunkIndexEntry(diskann_chunk_index_entry);
+            BufferHandle handle = diskann_chunk_index_entry->GetIndex();
+            auto data_ptr = static_cast<DiskAnnIndexInChunk *>(handle.GetDataMut());
+            data_ptr->BuildDiskAnnIndex(base_row_id, row_count, segment_entry, column_def, buffer_mgr);
+            diskann_chunk_index_entry->SaveIndexFile();
+            dumped_memindex_entry = std::move(diskann_chunk_index_entry);
             break;
         }
         default: {
@@ -756,6 +767,12 @@ void SegmentIndexEntry::OptIndex(IndexBase *index_base,
                             UnrecoverableError("Invalid index type.");
                         } else {
                             using HnswIndexDataType = typename std::remove_pointer_t<T>::DataType;
+                            if (index->IsInPlace()) {
+                                // The chunk is searched in its mapped file, which is read only
+                                auto *p = index->Materialize().release();
+                                delete index;
+                                index = p;
+                            }
                             if (params->compress_to_lvq) {
                                 if constexpr (IsAnyOf<HnswIndexDataType, i8, u8>) {
                                     UnrecoverableError("Invalid index type.");
@@ -919,7 +936,8 @@ ChunkIndexEntry *SegmentIndexEntry::RebuildChunkIndexEntries(TxnTableStore *txn_
                         CappedOneColumnIterator<DataType, true /*check ts*/> iter(segment_entry, buffer_mgr, column_def->id(), begin_ts, row_count);
                         HnswInsertConfig insert_config;
                         insert_config.optimize_ = true;
-                        index->InsertVecs(std::move(iter), insert_config);
+                        SizeT mem_usage{};
+                        memory_hnsw_index->InsertVecs(index, std::move(iter), insert_config, mem_usage);
                     }
                 },
                 abstract_hnsw);
@@ -1022,6 +1040,11 @@ SharedPtr<ChunkIndexEntry> SegmentIndexEntry::CreateIVFIndexChunkIndexEntry(RowI
     return ChunkIndexEntry::NewIVFIndexChunkIndexEntry(chunk_id, this, "", base_rowid, row_count, buffer_mgr);
 }
 
+SharedPtr<ChunkIndexEntry> SegmentIndexEntry::CreateDiskAnnIndexChunkIndexEntry(RowID base_rowid, u32 row_count, BufferManager *buffer_mgr) {
+    ChunkID chunk_id = this->GetNextChunkID();
+    return ChunkIndexEntry::NewDiskAnnIndexChunkIndexEntry(chunk_id, this, "", base_rowid, row_count, buffer_mgr);
+}
+
 SharedPtr<ChunkIndexEntry> SegmentIndexEntry::CreateEMVBIndexChunkIndexEntry(RowID base_rowid, u32 row_count, BufferManager *buffer_mgr) {
     ChunkID chunk_id = this->GetNextChunkID();
     return ChunkIndexEntry::NewEMVBIndexChunkIndexEntry(chunk_id, this, "", base_rowid, row_count, buffer_mgr);
@@ -172,6 +172,12 @@ public:
         return {chunk_index_entries_, memory_ivf_index_};
     }
 
+    // DiskAnn index has no memory index, rows appended after the chunks are built are not indexed
+    Vector<SharedPtr<ChunkIndexEntry>> GetDiskAnnIndexSnapshot() {
+        std::shared_lock lock(rw_locker_);
+        return chunk_index_entries_;
+    }
+
     Tuple<Vector<SharedPtr<ChunkIndexEntry>>, SharedPtr<SecondaryIndexInMem>> GetSecondaryIndexSnapshot() {
         std::shared_lock lock(rw_locker_);
         return {chunk_index_entries_, memory_secondary_index_};
@@ -197,6 +203,8 @@ public:
 
     SharedPtr<ChunkIndexEntry> CreateIVFIndexChunkIndexEntry(RowID base_rowid, u32 row_count, BufferManager *buffer_mgr);
 
+    SharedPtr<ChunkIndexEntry> CreateDiskAnnIndexChunkIndexEntry(RowID base_rowid, u32 row_count, BufferManager *buffer_mgr);
+
     SharedPtr<ChunkIndexEntry> CreateEMVBIndexChunkIndexEntry(RowID base_rowid, u32 row_count, BufferManager *buffer_mgr);
 
     SharedPtr<ChunkIndexEntry> CreateBMPIndexChunkIndexEntry(RowID base_rowid, u32 row_count, BufferManager *buffer_mgr, SizeT index_size);
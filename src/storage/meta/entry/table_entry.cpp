@@ -418,7 +418,8 @@ void TableEntry::Import(SharedPtr<SegmentEntry> segment_entry, Txn *txn) {
             case IndexType::kEMVB:
             case IndexType::kIVF:
             case IndexType::kHnsw:
-            case IndexType::kBMP: {
+            case IndexType::kBMP:
+            case IndexType::kDiskAnn: {
                 // support realtime index
                 break;
             }
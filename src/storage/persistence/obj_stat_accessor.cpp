@@ -30,7 +30,7 @@ namespace infinity {
 
 ObjectStatMap::~ObjectStatMap() {
     [[maybe_unused]] SizeT sum_ref_count = 0;
-    for (const auto &lru_iter : lru_list_) {
+    for (const auto &lru_iter : using_list_) {
         if (lru_iter.obj_stat_.ref_count_ > 0) {
             LOG_ERROR(fmt::format("Object {} still has ref count {}", lru_iter.key_, lru_iter.obj_stat_.ref_count_));
         }
@@ -47,7 +47,7 @@ ObjStat *ObjectStatMap::Get(const String &key) {
     LRUListIter lru_iter = map_iter->second;
     ObjStat *obj_stat = &lru_iter->obj_stat_;
     if (obj_stat->ref_count_ == 0) {
-        using_list_.splice(using_list_.begin(), lru_list_, lru_iter);
+        MoveToFront(lru_iter, using_list_);
     }
     ++obj_stat->ref_count_;
     return obj_stat;
@@ -75,36 +75,35 @@ Pair<bool, ObjStat *> ObjectStatMap::Release(const String &key) {
     if (obj_stat->ref_count_ > 0) {
         return {false, obj_stat};
     }
-    lru_list_.splice(lru_list_.begin(), using_list_, lru_iter);
+    MoveToFront(lru_iter, UnusedList(*obj_stat));
     return {true, obj_stat};
 }
 
 void ObjectStatMap::PutNew(const String &key, ObjStat obj_stat) {
     auto map_iter = obj_map_.find(key);
     if (map_iter != obj_map_.end()) {
-        map_iter->second->obj_stat_ = std::move(obj_stat);
+        LRUListIter lru_iter = map_iter->second;
+        lru_iter->obj_stat_ = std::move(obj_stat);
+        MoveToFront(lru_iter, lru_iter->obj_stat_.ref_count_ > 0 ? using_list_ : UnusedList(lru_iter->obj_stat_));
         LOG_DEBUG(fmt::format("PutNew: {} is already in object map", key));
         return;
     }
-    lru_list_.emplace_front(key, std::move(obj_stat));
-    obj_map_.emplace(key, lru_list_.begin());
+    LRUList &list = obj_stat.ref_count_ > 0 ? using_list_ : UnusedList(obj_stat);
+    list.emplace_front(key, std::move(obj_stat));
+    list.begin()->list_ = &list;
+    obj_map_.emplace(key, list.begin());
 }
 
-void ObjectStatMap::Recover(const String &key) {
+void ObjectStatMap::Touch(const String &key) {
     auto map_iter = obj_map_.find(key);
     if (map_iter == obj_map_.end()) {
-        UnrecoverableError(fmt::format("Recover object {} not found", key));
+        UnrecoverableError(fmt::format("Touch object {} not found", key));
     }
     LRUListIter lru_iter = map_iter->second;
-    ObjStat &obj_stat = lru_iter->obj_stat_;
-    if (obj_stat.ref_count_ > 0) {
-        UnrecoverableError(fmt::format("Recover object {} ref count is {}", key, lru_iter->obj_stat_.ref_count_));
-    }
-    lru_list_.splice(lru_list_.begin(), cleanuped_list_, lru_iter);
-    auto expect = ObjCached::kNotCached;
-    if (not obj_stat.cached_.compare_exchange_strong(expect, ObjCached::kCached)) {
-        UnrecoverableError(fmt::format("Recover object {} not cleaned", key));
+    if (lru_iter->obj_stat_.ref_count_ > 0) {
+        return;
     }
+    MoveToFront(lru_iter, UnusedList(lru_iter->obj_stat_));
 }
 
 Optional<ObjStat> ObjectStatMap::Invalidate(const String &key) {
@@ -121,11 +120,7 @@ Optional<ObjStat> ObjectStatMap::Invalidate(const String &key) {
     if (cached == ObjCached::kDownloading) {
         UnrecoverableError(fmt::format("Invalidate object {} is downloading", key));
     }
-    if (cached == ObjCached::kCached) {
-        lru_list_.erase(lru_iter);
-    } else {
-        cleanuped_list_.erase(lru_iter);
-    }
+    lru_iter->list_->erase(lru_iter);
     obj_map_.erase(map_iter);
     return obj_stat;
 }
@@ -139,14 +134,19 @@ LRUListEntry *ObjectStatMap::EnvictLast() {
     if (obj_stat.ref_count_ > 0) {
         UnrecoverableError(fmt::format("EnvictLast object {} ref count is {}", lru_iter->key_, obj_stat.ref_count_));
     }
-    auto expect = ObjCached::kCached;
-    if (not obj_stat.cached_.compare_exchange_strong(expect, ObjCached::kNotCached)) {
-        UnrecoverableError(fmt::format("EnvictLast object {} is already cleaned", lru_iter->key_));
+    if (obj_stat.cached_.load() == ObjCached::kDownloading) {
+        UnrecoverableError(fmt::format("EnvictLast object {} is downloading", lru_iter->key_));
     }
-    cleanuped_list_.splice(cleanuped_list_.begin(), lru_list_, lru_iter);
+    obj_stat.cached_.store(ObjCached::kNotCached);
+    MoveToFront(lru_iter, cleanuped_list_);
     return &(*lru_iter);
 }
 
+void ObjectStatMap::MoveToFront(LRUListIter lru_iter, LRUList &list) {
+    list.splice(list.begin(), *lru_iter->list_, lru_iter);
+    lru_iter->list_ = &list;
+}
+
 // ObjectStatAccessor_LocalStorage
 
 ObjectStatAccessor_LocalStorage::~ObjectStatAccessor_LocalStorage() {
@@ -262,17 +262,7 @@ ObjectStatAccessor_ObjectStorage::ObjectStatAccessor_ObjectStorage(SizeT disk_ca
 
 ObjectStatAccessor_ObjectStorage::~ObjectStatAccessor_ObjectStorage() = default;
 
-ObjStat *ObjectStatAccessor_ObjectStorage::Get(const String &key) {
-    ObjStat *obj_stat = obj_map_.Get(key);
-    if (obj_stat == nullptr) {
-        return nullptr;
-    }
-    if (disk_used_ < obj_stat->obj_size_) {
-        UnrecoverableError(fmt::format("Object {} size {} is larger than disk used {}", key, obj_stat->obj_size_, disk_used_));
-    }
-    disk_used_ -= obj_stat->obj_size_;
-    return obj_stat;
-}
+ObjStat *ObjectStatAccessor_ObjectStorage::Get(const String &key) { return obj_map_.Get(key); }
 
 ObjStat *ObjectStatAccessor_ObjectStorage::GetNoCount(const String &key) { return obj_map_.GetNoCount(key); }
 
@@ -281,7 +271,6 @@ ObjStat *ObjectStatAccessor_ObjectStorage::Release(const String &key, Vector<Str
     if (!release_ok) {
         return obj_stat;
     }
-    disk_used_ += obj_stat->obj_size_;
     if (disk_used_ > disk_capacity_limit_) {
         Envict(drop_keys);
     }
@@ -289,24 +278,59 @@ ObjStat *ObjectStatAccessor_ObjectStorage::Release(const String &key, Vector<Str
 }
 
 void ObjectStatAccessor_ObjectStorage::PutNew(const String &key, ObjStat obj_stat, Vector<String> &drop_keys) {
+    // The new object is written to workspace before it's uploaded, so it's fully cached
+    if (ObjStat *old_stat = obj_map_.GetNoCount(key); old_stat != nullptr) {
+        disk_used_ -= old_stat->CachedSize();
+    }
+    obj_stat.cached_ranges_.clear();
+    SizeT obj_size = obj_stat.obj_size_;
+    obj_stat.AddCachedRange(Range{.start_ = 0, .end_ = obj_size});
+    obj_stat.cached_ = ObjCached::kCached;
     obj_map_.PutNew(key, std::move(obj_stat));
-    disk_used_ += obj_stat.obj_size_;
+    disk_used_ += obj_size;
     if (disk_used_ > disk_capacity_limit_) {
         Envict(drop_keys);
     }
 }
 
-void ObjectStatAccessor_ObjectStorage::PutNoCount(const String &key, ObjStat obj_stat) { obj_map_.PutNew(key, std::move(obj_stat)); }
+void ObjectStatAccessor_ObjectStorage::PutNoCount(const String &key, ObjStat obj_stat) {
+    if (ObjStat *old_stat = obj_map_.GetNoCount(key); old_stat != nullptr) {
+        // Only update the persisted attributes, the ref count and the localdisk cache state are kept
+        old_stat->obj_size_ = obj_stat.obj_size_;
+        old_stat->parts_ = obj_stat.parts_;
+        old_stat->deleted_ranges_ = std::move(obj_stat.deleted_ranges_);
+        return;
+    }
+    obj_stat.ref_count_ = 0;
+    obj_stat.cached_ranges_.clear();
+    obj_stat.cached_ = ObjCached::kNotCached;
+    obj_map_.PutNew(key, std::move(obj_stat));
+}
 
 Optional<ObjStat> ObjectStatAccessor_ObjectStorage::Invalidate(const String &key) {
     Optional<ObjStat> obj_stat = obj_map_.Invalidate(key);
     if (!obj_stat.has_value()) {
         return None;
     }
-    disk_used_ -= obj_stat->obj_size_;
+    disk_used_ -= obj_stat->CachedSize();
     return obj_stat;
 }
 
+void ObjectStatAccessor_ObjectStorage::AddCachedRange(const String &key, const Range &range, Vector<String> &drop_keys) {
+    ObjStat *obj_stat = obj_map_.GetNoCount(key);
+    if (obj_stat == nullptr) {
+        UnrecoverableError(fmt::format("AddCachedRange object {} not found", key));
+    }
+    if (range.end_ > obj_stat->obj_size_) {
+        UnrecoverableError(fmt::format("AddCachedRange object {} range [{}, {}) exceeds size {}", key, range.start_, range.end_, obj_stat->obj_size_));
+    }
+    disk_used_ += obj_stat->AddCachedRange(range);
+    obj_map_.Touch(key);
+    if (disk_used_ > disk_capacity_limit_) {
+        Envict(drop_keys);
+    }
+}
+
 void ObjectStatAccessor_ObjectStorage::CheckValid(SizeT current_object_size) {
     for (const auto &[obj_key, lru_iter] : obj_map_.obj_map()) {
         lru_iter->obj_stat_.CheckValid(obj_key, current_object_size);
@@ -336,6 +360,7 @@ void ObjectStatAccessor_ObjectStorage::Deserialize(const nlohmann::json &obj) {
         String obj_key = json_pair["obj_key"];
         ObjStat obj_stat;
         obj_stat.Deserialize(json_pair["obj_stat"]);
+        // The cached ranges are added when the object is found under workspace
         obj_stat.cached_ = ObjCached::kNotCached;
         obj_map_.PutNew(obj_key, std::move(obj_stat));
         LOG_TRACE(fmt::format("Deserialize added object {}", obj_key));
@@ -357,7 +382,8 @@ bool ObjectStatAccessor_ObjectStorage::Envict(Vector<String> &drop_keys) {
             break;
         }
         drop_keys.push_back(lru_entry->key_);
-        disk_used_ -= lru_entry->obj_stat_.obj_size_;
+        disk_used_ -= lru_entry->obj_stat_.CachedSize();
+        lru_entry->obj_stat_.cached_ranges_.clear();
     }
     if (disk_used_ > disk_capacity_limit_) {
         LOG_WARN(fmt::format("Envict disk used {} is larger than disk capacity limit {}", disk_used_, disk_capacity_limit_));
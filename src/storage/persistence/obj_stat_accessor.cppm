@@ -27,6 +27,7 @@ struct LRUListEntry {
 
     String key_{};
     ObjStat obj_stat_{};
+    List<LRUListEntry> *list_{}; // the list which the entry is in
 };
 
 class ObjectStatMap {
@@ -44,17 +45,17 @@ public:
     // Get stat of object[key], and not update lru and ref count
     ObjStat *GetNoCount(const String &key);
 
-    // Release object[key], decrease ref count by 1, if ref count 1 -> 0, move from using_list to lru_list
-    // called when object file is closed, return true if object[key] exists and ref count -> 0
+    // Release object[key], decrease ref count by 1, if ref count 1 -> 0, move from using_list to lru_list, or to cleanuped_list if no range
+    // of the object is cached. called when object file is closed, return true if object[key] exists and ref count -> 0
     Pair<bool, ObjStat *> Release(const String &key);
 
     // Add new object to cache.
     // the object[key] is not in obj_map, add key->obj_stat mapping. called by checkpoint.
     void PutNew(const String &key, ObjStat obj_stat);
 
-    // Recover old object
-    // the object[key] must in obj_map, and must in cleanuped_list. called when download cleanuped object from remote storage to local cache
-    void Recover(const String &key);
+    // Touch object[key]
+    // move the unused object[key] to the front of lru_list, or to cleanuped_list if no range of it is cached. called when its cached ranges change
+    void Touch(const String &key);
 
     // Invalidate object[key]
     // called when the object[key] should be cleaned up in remote storage. remove mapping and return the obj_stat if exists
@@ -62,10 +63,17 @@ public:
 
     // Envict old object
     // move the last object in lru_list to cleanuped_list. called when disk used over limit, return nullptr if lru_list is empty
+    // the cached ranges of the returned object are kept for the caller to account them
     LRUListEntry *EnvictLast();
 
     const LRUMap &obj_map() const { return obj_map_; }
 
+private:
+    void MoveToFront(LRUListIter lru_iter, LRUList &list);
+
+    // The list an unused object belongs to
+    LRUList &UnusedList(const ObjStat &obj_stat) { return obj_stat.cached_ranges_.empty() ? cleanuped_list_ : lru_list_; }
+
 private:
     LRUMap obj_map_{};
     LRUList lru_list_{};
@@ -155,6 +163,10 @@ public:
 
     HashMap<String, ObjStat> GetAllObjects() const override;
 
+    // Add range of object[key] to localdisk cache. called when the range is downloaded or found under workspace on startup
+    void AddCachedRange(const String &key, const Range &range, Vector<String> &drop_keys);
+
+    // Sum size of the cached ranges of all objects
     SizeT disk_used() const { return disk_used_; }
 
 private:
@@ -15,6 +15,7 @@
 module;
 
 #include <__iterator/next.h>
+#include <__iterator/prev.h>
 
 module obj_status;
 
@@ -117,4 +118,48 @@ void ObjStat::CheckValid(const String &obj_key, SizeT current_object_size) const
     }
 }
 
+bool ObjStat::RangeCached(const Range &range) const {
+    if (range.start_ >= range.end_) {
+        return true;
+    }
+    // cached_ranges_ doesn't overlap, so only the last range starting at or before range.start_ may cover it
+    auto it = cached_ranges_.upper_bound(Range{.start_ = range.start_, .end_ = range.start_});
+    if (it == cached_ranges_.begin()) {
+        return false;
+    }
+    return std::prev(it)->Cover(range);
+}
+
+SizeT ObjStat::AddCachedRange(const Range &range) {
+    if (range.start_ >= range.end_) {
+        return 0;
+    }
+    Range merged = range;
+    SizeT covered_size = 0;
+    auto it = cached_ranges_.upper_bound(Range{.start_ = range.start_, .end_ = range.start_});
+    if (it != cached_ranges_.begin() && std::prev(it)->end_ >= range.start_) {
+        it = std::prev(it);
+    }
+    while (it != cached_ranges_.end() && it->start_ <= range.end_) {
+        SizeT overlap_start = std::max(it->start_, range.start_);
+        SizeT overlap_end = std::min(it->end_, range.end_);
+        if (overlap_start < overlap_end) {
+            covered_size += overlap_end - overlap_start;
+        }
+        merged.start_ = std::min(merged.start_, it->start_);
+        merged.end_ = std::max(merged.end_, it->end_);
+        it = cached_ranges_.erase(it);
+    }
+    cached_ranges_.insert(merged);
+    return range.end_ - range.start_ - covered_size;
+}
+
+SizeT ObjStat::CachedSize() const {
+    SizeT cached_size = 0;
+    for (const auto &range : cached_ranges_) {
+        cached_size += range.end_ - range.start_;
+    }
+    return cached_size;
+}
+
 } // namespace infinity
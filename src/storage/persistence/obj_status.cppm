@@ -45,12 +45,15 @@ export struct ObjStat {
     Set<Range> deleted_ranges_{};
 
     Atomic<ObjCached> cached_ = ObjCached::kCached; // whether the object is in localdisk cache
+    Set<Range> cached_ranges_{};                     // byte ranges in localdisk cache, only tracked with object storage and not persisted
 
     ObjStat() = default;
 
     ObjStat(SizeT obj_size, SizeT parts, SizeT ref_count, ObjCached cached = ObjCached::kCached) : obj_size_(obj_size), parts_(parts), ref_count_(ref_count), cached_(cached) {}
 
-    ObjStat(const ObjStat &other) : obj_size_(other.obj_size_), parts_(other.parts_), ref_count_(other.ref_count_), deleted_ranges_(other.deleted_ranges_), cached_(other.cached_.load()) {}
+    ObjStat(const ObjStat &other)
+        : obj_size_(other.obj_size_), parts_(other.parts_), ref_count_(other.ref_count_), deleted_ranges_(other.deleted_ranges_),
+          cached_(other.cached_.load()), cached_ranges_(other.cached_ranges_) {}
 
     ObjStat &operator=(const ObjStat &other) {
         if (this != &other) {
@@ -59,11 +62,14 @@ export struct ObjStat {
             ref_count_ = other.ref_count_;
             deleted_ranges_ = other.deleted_ranges_;
             cached_.store(other.cached_.load());
+            cached_ranges_ = other.cached_ranges_;
         }
         return *this;
     }
 
-    ObjStat(ObjStat &&other) : obj_size_(other.obj_size_), parts_(other.parts_), ref_count_(other.ref_count_), deleted_ranges_(std::move(other.deleted_ranges_)), cached_(other.cached_.load()) {}
+    ObjStat(ObjStat &&other)
+        : obj_size_(other.obj_size_), parts_(other.parts_), ref_count_(other.ref_count_), deleted_ranges_(std::move(other.deleted_ranges_)),
+          cached_(other.cached_.load()), cached_ranges_(std::move(other.cached_ranges_)) {}
 
     ObjStat &operator=(ObjStat &&other) {
         if (this != &other) {
@@ -72,6 +78,7 @@ export struct ObjStat {
             ref_count_ = other.ref_count_;
             deleted_ranges_ = std::move(other.deleted_ranges_);
             cached_.store(other.cached_.load());
+            cached_ranges_ = std::move(other.cached_ranges_);
         }
         return *this;
     }
@@ -87,6 +94,17 @@ export struct ObjStat {
     static ObjStat ReadBufAdv(const char *&buf);
 
     void CheckValid(const String &obj_key, SizeT current_object_size) const;
+
+    // Whether the range is in localdisk cache
+    bool RangeCached(const Range &range) const;
+
+    // Whether the whole object is in localdisk cache
+    bool FullyCached() const { return RangeCached(Range{.start_ = 0, .end_ = obj_size_}); }
+
+    // Add range to cached_ranges_ and merge it with the overlapping or adjacent ones, returns the number of newly cached bytes
+    SizeT AddCachedRange(const Range &range);
+
+    SizeT CachedSize() const;
 };
 
 }
\ No newline at end of file
@@ -52,7 +52,9 @@ void PersistResultHandler::HandleWriteResult(const PersistWriteResult &result) {
 }
 
 ObjAddr PersistResultHandler::HandleReadResult(const PersistReadResult &result) {
-    if (result.obj_stat_ != nullptr) {
+    if (result.obj_stat_ != nullptr && !pm_->local_storage()) {
+        DownloadPart(result);
+    } else if (result.obj_stat_ != nullptr) {
         ObjCached expect = ObjCached::kNotCached;
         Atomic<ObjCached> &cached = result.obj_stat_->cached_;
         if (cached.compare_exchange_strong(expect, ObjCached::kDownloading)) {
@@ -75,4 +77,67 @@ ObjAddr PersistResultHandler::HandleReadResult(const PersistReadResult &result)
     return result.obj_addr_;
 }
 
+void PersistResultHandler::DownloadPart(const PersistReadResult &result) {
+    const ObjAddr &obj_addr = result.obj_addr_;
+    Atomic<ObjCached> &cached = result.obj_stat_->cached_;
+    VirtualStore::AddRequestCount();
+    while (true) {
+        // Only one download of an object runs at a time, the others wait and check again
+        ObjCached expect = ObjCached::kNotCached;
+        if (cached.compare_exchange_strong(expect, ObjCached::kDownloading)) {
+            if (!pm_->PartCached(obj_addr)) {
+                String read_path = pm_->GetObjPath(obj_addr.obj_key_);
+                LOG_TRACE(fmt::format("GetObjCache download object {} range [{}, {}).",
+                                      read_path,
+                                      obj_addr.part_offset_,
+                                      obj_addr.part_offset_ + obj_addr.part_size_));
+                VirtualStore::DownloadObjectRange(read_path, obj_addr.obj_key_, obj_addr.part_offset_, obj_addr.part_size_);
+                VirtualStore::AddCacheMissCount();
+            }
+            HandleWriteResult(pm_->AddCachedPart(obj_addr));
+            cached.notify_all();
+            return;
+        }
+        if (expect == ObjCached::kCached) {
+            return;
+        }
+        LOG_TRACE(fmt::format("GetObjCache waiting downloading object {}", obj_addr.obj_key_));
+        cached.wait(ObjCached::kDownloading);
+        if (pm_->PartCached(obj_addr)) {
+            return;
+        }
+    }
+}
+
+void PersistResultHandler::Prefetch(const Vector<String> &file_paths) {
+    if (pm_ == nullptr || pm_->local_storage()) {
+        return;
+    }
+    Vector<PersistReadResult> results = pm_->GetObjCacheForPrefetch(file_paths);
+    for (const PersistReadResult &result : results) {
+        const ObjAddr &obj_addr = result.obj_addr_;
+        Atomic<ObjCached> *cached = &result.obj_stat_->cached_;
+        ObjCached expect = ObjCached::kNotCached;
+        if (!cached->compare_exchange_strong(expect, ObjCached::kDownloading)) {
+            // The object is being downloaded, the reader will wait for it
+            HandleWriteResult(pm_->PutObjCacheByKey(obj_addr.obj_key_));
+            continue;
+        }
+        String read_path = pm_->GetObjPath(obj_addr.obj_key_);
+        LOG_TRACE(fmt::format("Prefetch object {} range [{}, {}).", read_path, obj_addr.part_offset_, obj_addr.part_offset_ + obj_addr.part_size_));
+        // The callback runs on a download thread of the object storage processor, so evicted files are removed
+        // in place instead of through DeleteFileBG, which would wait on the processor itself.
+        VirtualStore::PrefetchObjectRange(read_path, obj_addr.obj_key_, obj_addr.part_offset_, obj_addr.part_size_, [pm = pm_, obj_addr, cached] {
+            auto drop_evicted = [pm](const PersistWriteResult &result) {
+                for (const String &drop_key : result.drop_keys_) {
+                    VirtualStore::DeleteFile(pm->GetObjPath(drop_key));
+                }
+            };
+            drop_evicted(pm->AddCachedPart(obj_addr));
+            cached->notify_all();
+            drop_evicted(pm->PutObjCacheByKey(obj_addr.obj_key_));
+        });
+    }
+}
+
 } // namespace infinity
@@ -46,7 +46,13 @@ public:
 
     ObjAddr HandleReadResult(const PersistReadResult &result);
 
+    // Download the parts of the files which are not in localdisk cache in background, only with object storage.
+    void Prefetch(const Vector<String> &file_paths);
+
 private:
+    // Download the part of the file in obj_addr to localdisk cache if it's not there
+    void DownloadPart(const PersistReadResult &result);
+
     PersistenceManager *pm_;
 };
 
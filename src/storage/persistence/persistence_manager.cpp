@@ -61,12 +61,24 @@ ObjAddr ObjAddr::ReadBufAdv(const char *&buf) {
     return ret;
 }
 
-PersistenceManager::PersistenceManager(const String &workspace, const String &data_dir, SizeT object_size_limit, bool local_storage)
+namespace {
+
+Range PartRange(const ObjAddr &obj_addr) { return Range{.start_ = obj_addr.part_offset_, .end_ = obj_addr.part_offset_ + obj_addr.part_size_}; }
+
+} // namespace
+
+PersistenceManager::PersistenceManager(const String &workspace,
+                                       const String &data_dir,
+                                       SizeT object_size_limit,
+                                       bool local_storage,
+                                       SizeT disk_cache_limit)
     : workspace_(workspace), local_data_dir_(data_dir), object_size_limit_(object_size_limit) {
     if (local_storage) {
         objects_ = MakeUnique<ObjectStatAccessor_LocalStorage>();
     } else {
-        UnrecoverableError("Remote storage is not supported yet.");
+        auto object_cache = MakeUnique<ObjectStatAccessor_ObjectStorage>(disk_cache_limit);
+        object_cache_ = object_cache.get();
+        objects_ = std::move(object_cache);
     }
     current_object_key_ = ObjCreate();
     current_object_size_ = 0;
@@ -267,7 +279,12 @@ PersistReadResult PersistenceManager::GetObjCache(const String &file_path) {
     } else if (ObjStat *obj_stat = objects_->Get(it->second.obj_key_); obj_stat != nullptr) {
         LOG_TRACE(fmt::format("GetObjCache object {}, file_path: {}, ref count {}", it->second.obj_key_, file_path, obj_stat->ref_count_));
         String read_path = GetObjPath(result.obj_addr_.obj_key_);
-        if (!VirtualStore::Exists(read_path)) {
+        if (object_cache_ != nullptr) {
+            // Only the part of the file is downloaded from object storage
+            if (!obj_stat->RangeCached(PartRange(it->second))) {
+                result.obj_stat_ = obj_stat;
+            }
+        } else if (!VirtualStore::Exists(read_path)) {
             auto expect = ObjCached::kCached;
             obj_stat->cached_.compare_exchange_strong(expect, ObjCached::kNotCached);
             result.obj_stat_ = obj_stat;
@@ -283,6 +300,121 @@ PersistReadResult PersistenceManager::GetObjCache(const String &file_path) {
     return result;
 }
 
+Vector<PersistReadResult> PersistenceManager::GetObjCacheForPrefetch(const Vector<String> &file_paths) {
+    Vector<PersistReadResult> results;
+    if (object_cache_ == nullptr) {
+        return results;
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    HashMap<String, SizeT> result_idx; // obj_key -> index in results
+    for (const String &file_path : file_paths) {
+        String local_path = RemovePrefix(file_path);
+        auto it = local_path_obj_.find(local_path);
+        if (local_path.empty() || it == local_path_obj_.end() || it->second.part_size_ == 0) {
+            continue;
+        }
+        const ObjAddr &obj_addr = it->second;
+        ObjStat *obj_stat = objects_->GetNoCount(obj_addr.obj_key_);
+        if (obj_stat == nullptr || obj_stat->RangeCached(PartRange(obj_addr))) {
+            // The current object is always in localdisk cache
+            continue;
+        }
+        auto [idx_iter, inserted] = result_idx.emplace(obj_addr.obj_key_, results.size());
+        if (inserted) {
+            PersistReadResult &result = results.emplace_back();
+            result.obj_addr_ = obj_addr;
+            result.obj_stat_ = objects_->Get(obj_addr.obj_key_);
+            continue;
+        }
+        ObjAddr &merged_addr = results[idx_iter->second].obj_addr_;
+        SizeT start = std::min(merged_addr.part_offset_, obj_addr.part_offset_);
+        SizeT end = std::max(merged_addr.part_offset_ + merged_addr.part_size_, obj_addr.part_offset_ + obj_addr.part_size_);
+        merged_addr.part_offset_ = start;
+        merged_addr.part_size_ = end - start;
+    }
+    return results;
+}
+
+bool PersistenceManager::PartCached(const ObjAddr &obj_addr) {
+    std::lock_guard<std::mutex> lock(mtx_);
+    ObjStat *obj_stat = objects_->GetNoCount(obj_addr.obj_key_);
+    if (obj_stat == nullptr) {
+        return obj_addr.obj_key_ == current_object_key_;
+    }
+    if (object_cache_ == nullptr) {
+        return VirtualStore::Exists(GetObjPath(obj_addr.obj_key_));
+    }
+    return obj_stat->RangeCached(PartRange(obj_addr));
+}
+
+PersistWriteResult PersistenceManager::AddCachedPart(const ObjAddr &obj_addr) {
+    PersistWriteResult result;
+    if (object_cache_ == nullptr) {
+        UnrecoverableError("AddCachedPart is called with local storage");
+    }
+
+    std::lock_guard<std::mutex> lock(mtx_);
+    object_cache_->AddCachedRange(obj_addr.obj_key_, PartRange(obj_addr), result.drop_keys_);
+    ObjStat *obj_stat = objects_->GetNoCount(obj_addr.obj_key_);
+    if (!obj_stat->FullyCached()) {
+        obj_stat->cached_.store(ObjCached::kNotCached);
+        return result;
+    }
+    if (obj_stat->parts_ > 1) {
+        // Restore the footer of the composed object, so that the object file is known to be complete after restart
+        String obj_path = GetObjPath(obj_addr.obj_key_);
+        if (VirtualStore::GetFileSize(obj_path) < obj_stat->obj_size_ + sizeof(u32)) {
+            std::fstream obj_file(obj_path, std::ios::in | std::ios::out | std::ios::binary);
+            if (!obj_file.is_open()) {
+                UnrecoverableError(fmt::format("Failed to open file {}.", obj_path));
+            }
+            const u32 compose_format = 1;
+            obj_file.seekp(obj_stat->obj_size_);
+            obj_file.write((char *)&compose_format, sizeof(u32));
+            obj_file.close();
+        }
+    }
+    obj_stat->cached_.store(ObjCached::kCached);
+    LOG_TRACE(fmt::format("AddCachedPart object {} is fully cached", obj_addr.obj_key_));
+    return result;
+}
+
+SizeT PersistenceManager::disk_used() const {
+    std::lock_guard<std::mutex> lock(mtx_);
+    return object_cache_ == nullptr ? 0 : object_cache_->disk_used();
+}
+
+void PersistenceManager::LoadCachedObjNoLock(const String &obj_key, Vector<String> &drop_keys) {
+    ObjStat *obj_stat = objects_->GetNoCount(obj_key);
+    String obj_path = GetObjPath(obj_key);
+    std::error_code ec;
+    SizeT file_size = fs::file_size(obj_path, ec);
+    if (ec) {
+        return;
+    }
+    // A composed object has a footer, which is written after all parts are downloaded
+    SizeT full_size = obj_stat->obj_size_ + (obj_stat->parts_ > 1 ? sizeof(u32) : 0);
+    if (file_size < full_size) {
+        // The downloaded ranges of a partially cached object are unknown after restart
+        LOG_TRACE(fmt::format("Drop partially cached object {}, file size {}, object size {}", obj_key, file_size, full_size));
+        fs::remove(obj_path, ec);
+        return;
+    }
+    object_cache_->AddCachedRange(obj_key, Range{.start_ = 0, .end_ = obj_stat->obj_size_}, drop_keys);
+    obj_stat->cached_.store(ObjCached::kCached);
+}
+
+void PersistenceManager::DropCachedObjs(const Vector<String> &drop_keys) {
+    for (const String &drop_key : drop_keys) {
+        std::error_code ec;
+        fs::remove(GetObjPath(drop_key), ec);
+        if (ec) {
+            LOG_WARN(fmt::format("Failed to remove cached object {}: {}", drop_key, ec.message()));
+        }
+    }
+}
+
 Tuple<SizeT, Status> PersistenceManager::GetFileSize(const String &file_path) {
     PersistReadResult result;
 
@@ -352,6 +484,17 @@ PersistWriteResult PersistenceManager::PutObjCache(const String &file_path) {
     return result;
 }
 
+PersistWriteResult PersistenceManager::PutObjCacheByKey(const String &obj_key) {
+    PersistWriteResult result;
+    std::lock_guard<std::mutex> lock(mtx_);
+    ObjStat *obj_stat = objects_->Release(obj_key, result.drop_keys_);
+    if (obj_stat == nullptr) {
+        UnrecoverableError(fmt::format("PutObjCacheByKey object {} not found", obj_key));
+    }
+    LOG_TRACE(fmt::format("PutObjCacheByKey object {} ref count {}", obj_key, obj_stat->ref_count_));
+    return result;
+}
+
 String PersistenceManager::ObjCreate() { return UUID().to_string(); }
 
 int PersistenceManager::CurrentObjRoomNoLock() { return int(object_size_limit_) - int(current_object_size_); }
@@ -513,8 +656,16 @@ void PersistenceManager::SaveLocalPath(const String &file_path, const ObjAddr &o
 }
 
 void PersistenceManager::SaveObjStat(const ObjAddr &obj_addr, const ObjStat &obj_stat) {
-    std::lock_guard<std::mutex> lock(mtx_);
-    objects_->PutNoCount(obj_addr.obj_key_, obj_stat);
+    Vector<String> drop_keys;
+    {
+        std::lock_guard<std::mutex> lock(mtx_);
+        bool new_object = objects_->GetNoCount(obj_addr.obj_key_) == nullptr;
+        objects_->PutNoCount(obj_addr.obj_key_, obj_stat);
+        if (object_cache_ != nullptr && new_object) {
+            LoadCachedObjNoLock(obj_addr.obj_key_, drop_keys);
+        }
+    }
+    DropCachedObjs(drop_keys);
 }
 
 String PersistenceManager::RemovePrefix(const String &path) {
@@ -582,6 +733,15 @@ void PersistenceManager::Deserialize(const nlohmann::json &obj) {
         local_path_obj_.emplace(path, obj_addr);
         LOG_TRACE(fmt::format("Deserialize added local path {}", path));
     }
+    if (object_cache_ != nullptr) {
+        // Rebuild localdisk cache from the object files under workspace
+        Vector<String> drop_keys;
+        for (const auto &[obj_key, _] : objects_->GetAllObjects()) {
+            LoadCachedObjNoLock(obj_key, drop_keys);
+        }
+        DropCachedObjs(drop_keys);
+        LOG_INFO(fmt::format("Rebuilt localdisk cache of objects, disk used {}", object_cache_->disk_used()));
+    }
 }
 
 HashMap<String, ObjStat> PersistenceManager::GetAllObjects() const {
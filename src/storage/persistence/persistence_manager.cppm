@@ -22,6 +22,7 @@ import third_party;
 import obj_status;
 import obj_stat_accessor;
 import status;
+import default_values;
 
 // A view means a logical plan
 namespace infinity {
@@ -61,8 +62,13 @@ export struct PersistReadResult {
 
 export class PersistenceManager {
 public:
-    // TODO: build cache from existing files under workspace
-    PersistenceManager(const String &workspace, const String &data_dir, SizeT object_size_limit, bool local_storage = true);
+    // With object storage, workspace is a localdisk cache of the objects bounded by disk_cache_limit.
+    // The cache is rebuilt from the object files under workspace when the objects are deserialized.
+    PersistenceManager(const String &workspace,
+                       const String &data_dir,
+                       SizeT object_size_limit,
+                       bool local_storage = true,
+                       SizeT disk_cache_limit = DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT);
 
     ~PersistenceManager();
 
@@ -74,21 +80,36 @@ public:
     // Force finalize current object. Subsequent append on the finalized object is forbidden.
     [[nodiscard]] PersistWriteResult CurrentObjFinalize(bool validate = false);
 
-    // Download the whole object from object store if it's not in cache. Increase refcount and return the cached object file path.
+    // Increase refcount and return where the file is in the cached object.
+    // The object (with local storage) or only the part of the file (with object storage) should be downloaded if obj_stat_ is returned.
     [[nodiscard]] PersistReadResult GetObjCache(const String &local_path);
 
+    // Increase refcount of the objects which have some of the files not in localdisk cache, returns one result per object.
+    // The parts of the files in an object are merged into one range. Each object should be released by PutObjCacheByKey.
+    [[nodiscard]] Vector<PersistReadResult> GetObjCacheForPrefetch(const Vector<String> &file_paths);
+
     Tuple<SizeT, Status> GetFileSize(const String &file_path);
 
     ObjAddr GetObjCacheWithoutCnt(const String &local_path);
 
     [[nodiscard]] PersistWriteResult PutObjCache(const String &file_path);
 
+    [[nodiscard]] PersistWriteResult PutObjCacheByKey(const String &obj_key);
+
+    // Whether the part of obj_addr is in localdisk cache
+    bool PartCached(const ObjAddr &obj_addr);
+
+    // Record the part of obj_addr downloaded to localdisk cache, and end the download of the object.
+    [[nodiscard]] PersistWriteResult AddCachedPart(const ObjAddr &obj_addr);
+
     [[nodiscard]] PersistWriteResult Cleanup(const String &file_path);
 
     /**
      * Utils
      */
     String GetObjPath(const String &obj_key) const { return std::filesystem::path(workspace_).append(obj_key).string(); }
+    bool local_storage() const { return object_cache_ == nullptr; }
+    SizeT disk_used() const;
     nlohmann::json Serialize();
 
     void Deserialize(const nlohmann::json &obj);
@@ -120,6 +141,11 @@ private:
 
     ObjStat GetObjStatByObjAddr(const ObjAddr &obj_addr);
 
+    // Add the object file found under workspace to localdisk cache. Only a fully downloaded object is kept.
+    void LoadCachedObjNoLock(const String &obj_key, Vector<String> &drop_keys);
+
+    void DropCachedObjs(const Vector<String> &drop_keys);
+
     void CheckValid();
 
 public: // for unit test
@@ -135,6 +161,7 @@ private:
     mutable std::mutex mtx_;
     // HashMap<String, ObjStat> objects_;        // obj_key -> ObjStat
     UniquePtr<ObjectStatAccessorBase> objects_; // obj_key -> ObjStat
+    ObjectStatAccessor_ObjectStorage *object_cache_{}; // objects_ with object storage, nullptr with local storage
     HashMap<String, ObjAddr> local_path_obj_;   // local_file_path -> ObjAddr
     // Current unsealed object key
     String current_object_key_;
@@ -24,6 +24,8 @@ import logical_match;
 import physical_match;
 import logical_node_type;
 import logger;
+import third_party;
+import utility;
 
 namespace infinity {
 
@@ -54,79 +56,198 @@ UniquePtr<CacheContent> CacheContent::Clone() const {
     return MakeUnique<CacheContent>(std::move(data_blocks), column_names_);
 }
 
+SizeT CacheContent::MemoryUsage() const {
+    SizeT memory = 0;
+    for (const auto &block : data_blocks_) {
+        memory += block->MemoryUsage();
+    }
+    return memory;
+}
+
+String ResultCacheStatsToString(const ResultCacheStats &stats) {
+    u64 request_count = stats.hit_count_ + stats.miss_count_;
+    double hit_rate = request_count == 0 ? 0 : 100.0 * stats.hit_count_ / request_count;
+    return fmt::format("hits: {}, misses: {}, hit rate: {:.2f}%, evictions: {}, cached results: {}, memory used: {}",
+                       stats.hit_count_,
+                       stats.miss_count_,
+                       hit_rate,
+                       stats.eviction_count_,
+                       stats.cache_num_used_,
+                       Utility::FormatByteSize(stats.memory_used_));
+}
+
+double CacheResultMap::Priority(const CacheEntry &entry) const {
+    // Results of no cost or no memory still count as 1us and 1 byte, so that the hit count keeps ordering them
+    double cost = std::max<u64>(entry.cost_us_, 1);
+    double memory = std::max<SizeT>(entry.memory_, 1);
+    return clock_.load() + cost * (entry.hit_count_ + 1) / memory;
+}
+
+void CacheResultMap::UpdatePriority(Shard &shard, CacheEntry &entry) {
+    shard.priority_order_.erase(entry.priority_);
+    entry.priority_ = {Priority(entry), next_sequence_++};
+    shard.priority_order_.emplace(entry.priority_, &entry);
+}
+
+void CacheResultMap::EraseEntry(Shard &shard, CacheEntry &entry) {
+    shard.priority_order_.erase(entry.priority_);
+    memory_used_ -= entry.memory_;
+    --cache_num_used_;
+    SizeT remove_n = shard.cache_map_.erase(entry.cached_node_.get());
+    if (remove_n != 1) {
+        UnrecoverableError("Failed to remove cache entry from cache_map_");
+    }
+}
+
+bool CacheResultMap::EvictOne() {
+    // Find the lowest priority among the shards, then evict it if it is still the lowest of its shard
+    while (true) {
+        Shard *victim_shard = nullptr;
+        Pair<double, u64> victim_priority{};
+        for (auto &shard : shards_) {
+            std::lock_guard<std::mutex> lock(shard.mtx_);
+            if (shard.priority_order_.empty()) {
+                continue;
+            }
+            const auto &priority = shard.priority_order_.begin()->first;
+            if (victim_shard == nullptr || priority < victim_priority) {
+                victim_shard = &shard;
+                victim_priority = priority;
+            }
+        }
+        if (victim_shard == nullptr) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(victim_shard->mtx_);
+        if (victim_shard->priority_order_.empty() || victim_shard->priority_order_.begin()->first != victim_priority) {
+            // The entry is hit or dropped meanwhile
+            continue;
+        }
+        CacheEntry &victim = *victim_shard->priority_order_.begin()->second;
+        clock_ = std::max(clock_.load(), victim_priority.first);
+        EraseEntry(*victim_shard, victim);
+        ++eviction_count_;
+        return true;
+    }
+}
+
+void CacheResultMap::EvictFor(SizeT new_memory) {
+    while (cache_num_used_ + 1 > cache_num_capacity_ || memory_used_ + new_memory > cache_memory_capacity_) {
+        if (!EvictOne()) {
+            break;
+        }
+    }
+}
+
 bool CacheResultMap::AddCache(
     UniquePtr<CachedNodeBase> cached_node,
     Vector<UniquePtr<DataBlock>> data_blocks,
+    u64 cost_us,
     const std::function<void(UniquePtr<CachedNodeBase>, CacheContent &, Vector<UniquePtr<DataBlock>>)> &update_content_func) {
-    std::lock_guard<std::mutex> lock(mtx_);
-    auto mp_iter = lru_map_.find(cached_node.get());
-    if (mp_iter != lru_map_.end()) {
-        CacheContent &old_content = *mp_iter->second->cache_content_;
-        update_content_func(std::move(cached_node), old_content, std::move(data_blocks));
-        return false;
-    }
-    if (lru_list_.size() >= cache_num_capacity_) {
-        LRUEntry &envict_entry = lru_list_.back();
-        SizeT remove_n = lru_map_.erase(envict_entry.cached_node_.get());
-        if (remove_n != 1) {
-            UnrecoverableError("Failed to remove cache entry from lru_map_");
+    std::lock_guard<std::mutex> insert_lock(insert_mtx_);
+    Shard &shard = ShardOf(*cached_node);
+    {
+        std::lock_guard<std::mutex> lock(shard.mtx_);
+        auto mp_iter = shard.cache_map_.find(cached_node.get());
+        if (mp_iter != shard.cache_map_.end()) {
+            CacheEntry &entry = *mp_iter->second;
+            update_content_func(std::move(cached_node), *entry.cache_content_, std::move(data_blocks));
+            SizeT memory = entry.cache_content_->MemoryUsage();
+            memory_used_ += memory;
+            memory_used_ -= entry.memory_;
+            entry.memory_ = memory;
+            entry.cost_us_ += cost_us;
+            UpdatePriority(shard, entry);
+            return false;
         }
-        lru_list_.pop_back();
     }
-    auto *cached_node_ptr = cached_node.get();
+    if (cache_num_capacity_ == 0) {
+        return false;
+    }
     auto cache_content = MakeShared<CacheContent>(std::move(data_blocks), cached_node->output_names());
-    lru_list_.emplace_front(std::move(cached_node), cache_content);
-    lru_map_.emplace_hint(mp_iter, cached_node_ptr, lru_list_.begin());
+    SizeT memory = cache_content->MemoryUsage();
+    if (memory > cache_memory_capacity_) {
+        LOG_DEBUG(fmt::format("Result of {} bytes exceeds the cache memory capacity", memory));
+        return false;
+    }
+    EvictFor(memory);
+
+    std::lock_guard<std::mutex> lock(shard.mtx_);
+    auto entry = MakeUnique<CacheEntry>();
+    entry->cached_node_ = std::move(cached_node);
+    entry->cache_content_ = std::move(cache_content);
+    entry->memory_ = memory;
+    entry->cost_us_ = cost_us;
+    entry->priority_ = {Priority(*entry), next_sequence_++};
+    shard.priority_order_.emplace(entry->priority_, entry.get());
+    auto *cached_node_ptr = entry->cached_node_.get();
+    shard.cache_map_.emplace(cached_node_ptr, std::move(entry));
+    memory_used_ += memory;
+    ++cache_num_used_;
     return true;
 }
 
 SharedPtr<CacheContent> CacheResultMap::GetCache(const CachedNodeBase &cached_node) {
-    std::lock_guard<std::mutex> lock(mtx_);
-    auto mp_iter = lru_map_.find(&cached_node);
-    if (mp_iter == lru_map_.end()) {
+    Shard &shard = ShardOf(cached_node);
+    std::lock_guard<std::mutex> lock(shard.mtx_);
+    auto mp_iter = shard.cache_map_.find(&cached_node);
+    if (mp_iter == shard.cache_map_.end()) {
         return nullptr;
     }
-    auto iter = mp_iter->second;
-    lru_list_.splice(lru_list_.begin(), lru_list_, iter);
-    return iter->cache_content_;
+    CacheEntry &entry = *mp_iter->second;
+    ++entry.hit_count_;
+    UpdatePriority(shard, entry);
+    return entry.cache_content_;
 }
 
 SizeT CacheResultMap::DropIF(std::function<bool(const CachedNodeBase &)> pred) {
-    std::lock_guard<std::mutex> lock(mtx_);
     SizeT removed = 0;
-    for (auto mp_iter = lru_map_.begin(); mp_iter != lru_map_.end();) {
-        const auto &[cached_node, iter] = *mp_iter;
-        if (pred(*cached_node)) {
-            lru_list_.erase(iter);
-            mp_iter = lru_map_.erase(mp_iter);
-            ++removed;
-        } else {
-            ++mp_iter;
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mtx_);
+        for (auto mp_iter = shard.cache_map_.begin(); mp_iter != shard.cache_map_.end();) {
+            CacheEntry &entry = *mp_iter->second;
+            if (pred(*entry.cached_node_)) {
+                shard.priority_order_.erase(entry.priority_);
+                memory_used_ -= entry.memory_;
+                --cache_num_used_;
+                mp_iter = shard.cache_map_.erase(mp_iter);
+                ++removed;
+            } else {
+                ++mp_iter;
+            }
         }
     }
     return removed;
 }
 
 void CacheResultMap::ResetCacheNumCapacity(SizeT cache_num_capacity) {
-    std::lock_guard<std::mutex> lock(mtx_);
+    std::lock_guard<std::mutex> insert_lock(insert_mtx_);
     cache_num_capacity_ = cache_num_capacity;
-    while (lru_list_.size() > cache_num_capacity_) {
-        LRUEntry &envict_entry = lru_list_.back();
-        SizeT remove_n = lru_map_.erase(envict_entry.cached_node_.get());
-        if (remove_n != 1) {
-            UnrecoverableError("Failed to remove cache entry from lru_map_");
-        }
-        lru_list_.pop_back();
+    while (cache_num_used_ > cache_num_capacity_ && EvictOne()) {
+    }
+}
+
+void CacheResultMap::ResetCacheMemoryCapacity(SizeT cache_memory_capacity) {
+    std::lock_guard<std::mutex> insert_lock(insert_mtx_);
+    cache_memory_capacity_ = cache_memory_capacity;
+    while (memory_used_ > cache_memory_capacity_ && EvictOne()) {
     }
 }
 
 void CacheResultMap::ClearCache() {
-    std::lock_guard<std::mutex> lock(mtx_);
-    lru_list_.clear();
-    lru_map_.clear();
+    std::lock_guard<std::mutex> insert_lock(insert_mtx_);
+    for (auto &shard : shards_) {
+        std::lock_guard<std::mutex> lock(shard.mtx_);
+        for (const auto &[cached_node, entry] : shard.cache_map_) {
+            memory_used_ -= entry->memory_;
+            --cache_num_used_;
+        }
+        shard.priority_order_.clear();
+        shard.cache_map_.clear();
+    }
 }
 
-bool ResultCacheManager::AddCache(UniquePtr<CachedNodeBase> cached_node, Vector<UniquePtr<DataBlock>> data_blocks) {
+bool ResultCacheManager::AddCache(UniquePtr<CachedNodeBase> cached_node, Vector<UniquePtr<DataBlock>> data_blocks, u64 cost_us) {
     if (cached_node == nullptr) {
         return false;
     }
@@ -155,12 +276,13 @@ bool ResultCacheManager::AddCache(UniquePtr<CachedNodeBase> cached_node, Vector<
             old_content = std::move(*updated_content);
         }
     };
-    return cache_map_.AddCache(std::move(cached_node), std::move(data_blocks), update_content_func);
+    return cache_map_.AddCache(std::move(cached_node), std::move(data_blocks), cost_us, update_content_func);
 }
 
 Optional<CacheOutput> ResultCacheManager::GetCache(const CachedNodeBase &cached_node) {
     SharedPtr<CacheContent> cache_content = cache_map_.GetCache(cached_node);
     if (!cache_content) {
+        ++miss_count_;
         return None;
     }
     SharedPtr<Vector<String>> output_names = cached_node.output_names();
@@ -169,10 +291,12 @@ Optional<CacheOutput> ResultCacheManager::GetCache(const CachedNodeBase &cached_
     for (const String &output_name : *output_names) {
         auto column_iter = std::find(cache_content->column_names_->begin(), cache_content->column_names_->end(), output_name);
         if (column_iter == cache_content->column_names_->end()) {
+            ++miss_count_;
             return None;
         }
         column_map.push_back(column_iter - cache_content->column_names_->begin());
     }
+    ++hit_count_;
     return CacheOutput{std::move(cache_content), std::move(column_map)};
 }
 
@@ -191,4 +315,14 @@ SizeT ResultCacheManager::DropTable(const String &schema_name, const String &tab
     return cache_map_.DropIF(pred);
 }
 
+ResultCacheStats ResultCacheManager::GetStats() const {
+    ResultCacheStats stats;
+    stats.hit_count_ = hit_count_;
+    stats.miss_count_ = miss_count_;
+    stats.eviction_count_ = cache_map_.eviction_count();
+    stats.cache_num_used_ = cache_map_.cache_num_used();
+    stats.memory_used_ = cache_map_.memory_used();
+    return stats;
+}
+
 } // namespace infinity
\ No newline at end of file
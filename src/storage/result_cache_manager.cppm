@@ -23,6 +23,7 @@ import cached_node_base;
 import data_block;
 import logical_read_cache;
 import global_resource_usage;
+import default_values;
 
 namespace infinity {
 
@@ -38,6 +39,8 @@ public:
 
     UniquePtr<CacheContent> Clone() const;
 
+    SizeT MemoryUsage() const;
+
     Vector<UniquePtr<DataBlock>> data_blocks_;
     SharedPtr<Vector<String>> column_names_;
 };
@@ -47,6 +50,22 @@ export struct CacheOutput {
     Vector<SizeT> column_map_;
 };
 
+export struct ResultCacheStats {
+    u64 hit_count_{};
+    u64 miss_count_{};
+    u64 eviction_count_{};
+    SizeT cache_num_used_{};
+    SizeT memory_used_{};
+};
+
+export String ResultCacheStatsToString(const ResultCacheStats &stats);
+
+// Cached results are spread over shards by the hash of the cached node, a lookup only locks its own shard.
+// Capacity is shared by all shards: when an insert exceeds the entry count or the memory capacity, the entry with the lowest
+// priority among all shards is evicted. Priority follows GreedyDual-Size-Frequency:
+//     clock + cost * (hits + 1) / bytes
+// where cost is the time spent computing the result, and clock is raised to the priority of each evicted entry so that
+// entries which are no longer hit age out.
 class CacheResultMap {
 public:
     struct CachedLogicalMatchBaseHash {
@@ -61,10 +80,12 @@ public:
         bool operator()(const CachedNodeBase *key1, const CachedNodeBase *key2) const { return key1->Eq(*key2); }
     };
 
-    CacheResultMap(SizeT cache_num_capacity) : cache_num_capacity_(cache_num_capacity) {}
+    CacheResultMap(SizeT cache_num_capacity, SizeT cache_memory_capacity)
+        : cache_num_capacity_(cache_num_capacity), cache_memory_capacity_(cache_memory_capacity) {}
 
     bool AddCache(UniquePtr<CachedNodeBase> cached_node,
                   Vector<UniquePtr<DataBlock>> data_blocks,
+                  u64 cost_us,
                   const std::function<void(UniquePtr<CachedNodeBase>, CacheContent &, Vector<UniquePtr<DataBlock>>)> &update_content_func);
 
     SharedPtr<CacheContent> GetCache(const CachedNodeBase &cached_node);
@@ -73,33 +94,72 @@ public:
 
     void ResetCacheNumCapacity(SizeT cache_num_capacity);
 
+    void ResetCacheMemoryCapacity(SizeT cache_memory_capacity);
+
     void ClearCache();
 
     SizeT cache_num_capacity() const { return cache_num_capacity_; }
 
-    SizeT cache_num_used() { 
-        std::lock_guard<std::mutex> lock(mtx_);
-        return lru_map_.size();
-    }
+    SizeT cache_memory_capacity() const { return cache_memory_capacity_; }
+
+    SizeT cache_num_used() const { return cache_num_used_; }
+
+    SizeT memory_used() const { return memory_used_; }
+
+    u64 eviction_count() const { return eviction_count_; }
 
 private:
-    struct LRUEntry {
+    static constexpr SizeT kShardCount = 16;
+
+    struct CacheEntry {
         UniquePtr<CachedNodeBase> cached_node_;
         SharedPtr<CacheContent> cache_content_;
+        SizeT memory_{};
+        u64 cost_us_{};
+        u64 hit_count_{};
+        // Key of the entry in the priority order of its shard, the sequence number breaks ties by insertion order
+        Pair<double, u64> priority_{};
+    };
+    using CacheMap = HashMap<CachedNodeBase *, UniquePtr<CacheEntry>, CachedLogicalMatchBaseHash, CachedLogicalMatchBaseEq>;
+
+    struct Shard {
+        std::mutex mtx_;
+        CacheMap cache_map_;
+        Map<Pair<double, u64>, CacheEntry *> priority_order_;
     };
-    using LRUList = List<LRUEntry>;
-    using LRUMap = HashMap<CachedNodeBase *, LRUList::iterator, CachedLogicalMatchBaseHash, CachedLogicalMatchBaseEq>;
 
-    std::mutex mtx_;
+    inline Shard &ShardOf(const CachedNodeBase &cached_node) { return shards_[cached_node.Hash() % kShardCount]; }
+
+    double Priority(const CacheEntry &entry) const;
+
+    // Move the entry to its current priority, called with the shard locked
+    void UpdatePriority(Shard &shard, CacheEntry &entry);
+
+    // Erase the entry from its shard, called with the shard locked
+    void EraseEntry(Shard &shard, CacheEntry &entry);
+
+    // Evict until one more entry of new_memory bytes fits in the capacity, called with insert_mtx_ locked
+    void EvictFor(SizeT new_memory);
+
+    bool EvictOne();
 
-    SizeT cache_num_capacity_;
-    LRUList lru_list_;
-    LRUMap lru_map_;
+    // Serializes inserts and evictions, lookups only lock their shard
+    std::mutex insert_mtx_;
+    Array<Shard, kShardCount> shards_;
+
+    Atomic<SizeT> cache_num_capacity_;
+    Atomic<SizeT> cache_memory_capacity_;
+    Atomic<SizeT> cache_num_used_{};
+    Atomic<SizeT> memory_used_{};
+    Atomic<u64> eviction_count_{};
+    Atomic<u64> next_sequence_{};
+    Atomic<double> clock_{};
 };
 
 export class ResultCacheManager {
 public:
-    ResultCacheManager(SizeT cache_num_capacity) : cache_map_(cache_num_capacity) {
+    ResultCacheManager(SizeT cache_num_capacity, SizeT cache_memory_capacity = DEFAULT_CACHE_RESULT_MEMORY)
+        : cache_map_(cache_num_capacity, cache_memory_capacity) {
 #ifdef INFINITY_DEBUG
         GlobalResourceUsage::IncrObjectCount("ResultCacheManager");
 #endif
@@ -110,7 +170,8 @@ public:
 #endif
     }
 
-    bool AddCache(UniquePtr<CachedNodeBase> cached_node, Vector<UniquePtr<DataBlock>> data_blocks);
+    // cost_us is the time spent computing the result, an expensive result is kept longer than a cheap one of the same size
+    bool AddCache(UniquePtr<CachedNodeBase> cached_node, Vector<UniquePtr<DataBlock>> data_blocks, u64 cost_us = 0);
 
     Optional<CacheOutput> GetCache(const CachedNodeBase &cached_node);
 
@@ -118,14 +179,23 @@ public:
 
     void ResetCacheNumCapacity(SizeT cache_num_capacity) { cache_map_.ResetCacheNumCapacity(cache_num_capacity); }
 
+    void ResetCacheMemoryCapacity(SizeT cache_memory_capacity) { cache_map_.ResetCacheMemoryCapacity(cache_memory_capacity); }
+
     void ClearCache() { cache_map_.ClearCache(); }
 
     SizeT cache_num_capacity() const { return cache_map_.cache_num_capacity(); }
 
-    SizeT cache_num_used() { return cache_map_.cache_num_used(); }
+    SizeT cache_memory_capacity() const { return cache_map_.cache_memory_capacity(); }
+
+    SizeT cache_num_used() const { return cache_map_.cache_num_used(); }
+
+    ResultCacheStats GetStats() const;
 
 private:
     CacheResultMap cache_map_;
+
+    Atomic<u64> hit_count_{};
+    Atomic<u64> miss_count_{};
 };
 
 } // namespace infinity
\ No newline at end of file
@@ -128,7 +128,13 @@ Status Storage::InitToAdmin() {
                 persistence_manager_.reset();
             }
             i64 persistence_object_size_limit = config_ptr_->PersistenceObjectSizeLimit();
-            persistence_manager_ = MakeUnique<PersistenceManager>(persistence_dir, config_ptr_->DataDir(), (SizeT)persistence_object_size_limit);
+            bool local_storage = config_ptr_->StorageType() == StorageType::kLocal;
+            SizeT disk_cache_limit = local_storage ? DEFAULT_OBJECT_STORAGE_DISK_CACHE_LIMIT : config_ptr_->ObjectStorageDiskCacheLimit();
+            persistence_manager_ = MakeUnique<PersistenceManager>(persistence_dir,
+                                                                  config_ptr_->DataDir(),
+                                                                  (SizeT)persistence_object_size_limit,
+                                                                  local_storage,
+                                                                  disk_cache_limit);
         }
 
         current_storage_mode_ = StorageMode::kAdmin;
@@ -189,8 +195,9 @@ Status Storage::AdminToReader() {
         result_cache_manager_.reset();
     }
     SizeT cache_result_num = config_ptr_->CacheResultNum();
+    SizeT cache_result_memory = config_ptr_->CacheResultMemory();
     if (result_cache_manager_ == nullptr) {
-        result_cache_manager_ = MakeUnique<ResultCacheManager>(cache_result_num);
+        result_cache_manager_ = MakeUnique<ResultCacheManager>(cache_result_num, cache_result_memory);
     }
 
     // Construct buffer manager
@@ -235,8 +242,9 @@ Status Storage::AdminToWriter() {
         result_cache_manager_.reset();
     }
     SizeT cache_result_num = config_ptr_->CacheResultNum();
+    SizeT cache_result_memory = config_ptr_->CacheResultMemory();
     if (result_cache_manager_ == nullptr) {
-        result_cache_manager_ = MakeUnique<ResultCacheManager>(cache_result_num);
+        result_cache_manager_ = MakeUnique<ResultCacheManager>(cache_result_num, cache_result_memory);
     }
 
     // Construct buffer manager
@@ -440,7 +440,8 @@ AddChunkIndexEntryOp::AddChunkIndexEntryOp(ChunkIndexEntry *chunk_index_entry, T
         case IndexType::kHnsw:
         case IndexType::kEMVB:
         case IndexType::kSecondary:
-        case IndexType::kBMP: {
+        case IndexType::kBMP:
+        case IndexType::kDiskAnn: {
             Path rela_dir = *(segment_index_entry->index_dir());
             String file_name = ChunkIndexEntry::IndexFileName(segment_index_entry->segment_id(), chunk_index_entry->chunk_id_);
             String rela_path = rela_dir / file_name;
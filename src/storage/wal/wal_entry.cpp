@@ -15,6 +15,7 @@
 module;
 
 #include <cassert>
+#include <future>
 #include <sstream>
 #include <vector>
 
@@ -221,7 +222,8 @@ WalChunkIndexInfo::WalChunkIndexInfo(ChunkIndexEntry *chunk_index_entry)
         case IndexType::kEMVB:
         case IndexType::kIVF:
         case IndexType::kSecondary:
-        case IndexType::kBMP: {
+        case IndexType::kBMP:
+        case IndexType::kDiskAnn: {
             String file_name = ChunkIndexEntry::IndexFileName(segment_index_entry->segment_id(), chunk_index_entry->chunk_id_);
             String file_path = Path(*(segment_index_entry->index_dir())) / file_name;
             paths_.push_back(file_path);
@@ -1544,16 +1546,49 @@ Vector<SharedPtr<WalEntry>> WalEntryIterator::GetAllEntries() {
 
 bool WalEntryIterator::IsGood() const { return (is_backward_ && off_ == 0) || (!is_backward_ && off_ == buf_.size()); }
 
-WalListIterator::WalListIterator(const Vector<String> &wal_list) {
+WalListIterator::WalListIterator(const Vector<String> &wal_list, ThreadPool *decode_pool) : decode_pool_(decode_pool) {
     assert(!wal_list.empty());
     for (SizeT i = 0; i < wal_list.size(); ++i) {
         wal_list_.push_back(wal_list[i]);
     }
     PurgeBadEntriesAfterLatestCheckpoint();
+    if (decode_pool_ != nullptr) {
+        return;
+    }
     if (!wal_list_.empty())
         iter_ = WalEntryIterator::Make(wal_list_.front(), true);
 }
 
+void WalListIterator::DecodeNextFiles() {
+    Vector<String> wal_files;
+    while (!wal_list_.empty() && wal_files.size() < (SizeT)decode_pool_->size()) {
+        wal_files.push_back(wal_list_.front());
+        wal_list_.pop_front();
+    }
+    Vector<Vector<SharedPtr<WalEntry>>> file_entries(wal_files.size());
+    Vector<std::future<void>> futs;
+    futs.reserve(wal_files.size());
+    for (SizeT i = 0; i < wal_files.size(); ++i) {
+        futs.emplace_back(decode_pool_->push([&wal_files, &file_entries, i](int id) {
+            auto iter = WalEntryIterator::Make(wal_files[i], true);
+            while (iter->HasNext()) {
+                auto entry = iter->Next();
+                file_entries[i].push_back(entry);
+                if (entry.get() == nullptr) {
+                    LOG_WARN(fmt::format("Found bad wal entry {}@{}", wal_files[i], iter->GetOffset()));
+                    break;
+                }
+            }
+        }));
+    }
+    for (auto &fut : futs) {
+        fut.get();
+    }
+    for (auto &entries : file_entries) {
+        decoded_entries_.insert(decoded_entries_.end(), entries.begin(), entries.end());
+    }
+}
+
 void WalListIterator::PurgeBadEntriesAfterLatestCheckpoint() {
     bool found_checkpoint = false;
     SizeT file_num = 0;
@@ -1604,6 +1639,12 @@ void WalListIterator::PurgeBadEntriesAfterLatestCheckpoint() {
 }
 
 bool WalListIterator::HasNext() {
+    if (decode_pool_ != nullptr) {
+        while (decoded_entries_.empty() && !wal_list_.empty()) {
+            DecodeNextFiles();
+        }
+        return !decoded_entries_.empty();
+    }
     if (iter_.get() == nullptr) {
         return false;
     }
@@ -1623,6 +1664,11 @@ bool WalListIterator::HasNext() {
 }
 
 SharedPtr<WalEntry> WalListIterator::Next() {
+    if (decode_pool_ != nullptr) {
+        auto entry = decoded_entries_.front();
+        decoded_entries_.pop_front();
+        return entry;
+    }
     auto entry = iter_->Next();
     if (entry.get() == nullptr) {
         auto off = iter_->GetOffset();
@@ -595,9 +595,10 @@ private:
 };
 
 // Backward iterator of WAL entries in given WAL files
+// With a decode pool, the next pool size files are read and decoded concurrently whenever the decoded entries run out.
 export class WalListIterator {
 public:
-    explicit WalListIterator(const Vector<String> &wal_list);
+    explicit WalListIterator(const Vector<String> &wal_list, ThreadPool *decode_pool = nullptr);
 
     [[nodiscard]] bool HasNext();
 
@@ -606,8 +607,13 @@ public:
 private:
     // Locate the latest full checkpoint entry, and purge bad entries after it.
     void PurgeBadEntriesAfterLatestCheckpoint();
+    void DecodeNextFiles();
     List<String> wal_list_{};
     UniquePtr<WalEntryIterator> iter_{};
+
+    ThreadPool *decode_pool_{};
+    // Newest first, a nullptr is put after the last good entry of a file with bad entry
+    Deque<SharedPtr<WalEntry>> decoded_entries_{};
 };
 
 } // namespace infinity
@@ -16,6 +16,7 @@ module;
 
 #include <filesystem>
 #include <fstream>
+#include <future>
 #include <thread>
 
 import stl;
@@ -59,11 +60,24 @@ import cluster_manager;
 import admin_statement;
 import cleanup_scanner;
 import global_resource_usage;
+import local_file_handle;
+import config;
 
 module wal_manager;
 
 namespace infinity {
 
+String WalFlushStatsToString(const WalFlushStats &stats) {
+    f64 avg_batch_size = stats.batch_count_ == 0 ? 0 : f64(stats.entry_count_) / stats.batch_count_;
+    u64 avg_sync_time_us = stats.sync_count_ == 0 ? 0 : stats.total_sync_time_us_ / stats.sync_count_;
+    return fmt::format("batches: {}, avg batch size: {:.2f}, syncs: {}, avg sync latency: {}us, max sync latency: {}us",
+                       stats.batch_count_,
+                       avg_batch_size,
+                       stats.sync_count_,
+                       avg_sync_time_us,
+                       stats.max_sync_time_us_);
+}
+
 WalManager::WalManager(Storage *storage,
                        String wal_dir,
                        u64 wal_size_threshold,
@@ -110,11 +124,7 @@ void WalManager::Start() {
         VirtualStore::MakeDirectory(wal_dir_);
     }
     // TODO: recovery from wal checkpoint
-    ofs_ = std::ofstream(wal_path_, std::ios::app | std::ios::binary);
-    if (!ofs_.is_open()) {
-        String error_message = fmt::format("Failed to open wal file: {}", wal_path_);
-        UnrecoverableError(error_message);
-    }
+    OpenWalFile();
     LOG_INFO(fmt::format("Open wal file: {}", wal_path_));
 
     wal_size_ = 0;
@@ -145,7 +155,8 @@ void WalManager::Stop() {
     LOG_TRACE("WalManager::Stop flush thread join");
     flush_thread_.join();
 
-    ofs_.close();
+    // The file handle syncs the file on close
+    wal_file_handle_.reset();
     LOG_INFO("WAL manager is stopped.");
 }
 
@@ -290,9 +301,19 @@ void WalManager::Flush() {
 
     Deque<WalEntry *> log_batch{};
     TxnManager *txn_mgr = storage_->txn_manager();
-    ClusterManager *cluster_manager = nullptr;
     while (running_.load()) {
-        wait_flush_.DequeueBulk(log_batch);
+        if (flush_option_ == FlushOptionType::kFlushPerSecond && has_unsynced_logs_) {
+            // Don't wait for the next batch longer than the sync interval, or the logs of an idle server stay unsynced.
+            auto next_sync_time = last_sync_time_ + std::chrono::seconds(1);
+            auto now = std::chrono::steady_clock::now();
+            if (now >= next_sync_time ||
+                !wait_flush_.DequeueBulkFor(log_batch, std::chrono::ceil<std::chrono::milliseconds>(next_sync_time - now))) {
+                SyncWalFile();
+                continue;
+            }
+        } else {
+            wait_flush_.DequeueBulk(log_batch);
+        }
         if (log_batch.empty()) {
             LOG_WARN("WalManager::Dequeue empty batch logs");
             continue;
@@ -311,6 +332,7 @@ void WalManager::Flush() {
                 // UnrecoverableError(fmt::format("WalEntry of txn_id {} commands is empty", entry->txn_id_));
             }
             if (txn_mgr->InCheckpointProcess(entry->commit_ts_)) {
+                this->WriteStagedLogs();
                 this->SwapWalFile(max_commit_ts_, true);
             }
 
@@ -318,11 +340,12 @@ void WalManager::Flush() {
                 LOG_TRACE(fmt::format("WAL CMD: {}", cmd->ToString()));
             }
 
+            // The entry is serialized into the staging buffer and written with the whole batch
             i32 exp_size = entry->GetSizeInBytes();
-            SharedPtr<String> buf = MakeShared<String>(exp_size, 0);
-            char *ptr = buf->data();
+            char *begin = StageLog(exp_size);
+            char *ptr = begin;
             entry->WriteAdv(ptr);
-            i32 act_size = ptr - buf->data();
+            i32 act_size = ptr - begin;
             if (exp_size != act_size) {
                 String error_message = fmt::format("WalManager::Flush WalEntry estimated size {} differ with the actual one {}, entry {}",
                                                    exp_size,
@@ -330,19 +353,15 @@ void WalManager::Flush() {
                                                    entry->ToString());
                 UnrecoverableError(error_message);
             }
-            ofs_.write(buf->data(), ptr - buf->data());
 
-            if (InfinityContext::instance().GetServerRole() == NodeRole::kLeader) {
-                if (cluster_manager == nullptr) {
-                    cluster_manager = InfinityContext::instance().cluster_manager();
-                }
-                cluster_manager->PrepareLogs(buf);
-            }
+            staged_size_ += act_size;
+            staged_log_sizes_.emplace_back(act_size);
 
             LOG_TRACE(fmt::format("WalManager::Flush done writing wal for txn_id {}, commit_ts {}", entry->txn_id_, entry->commit_ts_));
 
             UpdateCommitState(entry->commit_ts_, wal_size_ + act_size);
         }
+        this->WriteStagedLogs();
 
         if (!running_.load()) {
             break;
@@ -350,21 +369,28 @@ void WalManager::Flush() {
 
         switch (flush_option_) {
             case FlushOptionType::kFlushAtOnce: {
-                ofs_.flush();
+                // Group commit: one sync for the whole batch, the txns of the batch are committed after their logs are durable.
+                SyncWalFile();
                 break;
             }
             case FlushOptionType::kOnlyWrite: {
-                ofs_.flush(); // FIXME: not flush, only write
+                // Write back is left to the OS, the logs survive a process crash but not an OS crash.
                 break;
             }
             case FlushOptionType::kFlushPerSecond: {
-                ofs_.flush(); // FIXME: not flush, flush per second
+                // The txns are committed before sync, at most the last second of logs is lost on an OS crash.
+                has_unsynced_logs_ = true;
+                if (std::chrono::steady_clock::now() >= last_sync_time_ + std::chrono::seconds(1)) {
+                    SyncWalFile();
+                }
                 break;
             }
         }
+        flush_batch_count_.fetch_add(1, std::memory_order_relaxed);
+        flush_entry_count_.fetch_add(log_batch.size(), std::memory_order_relaxed);
 
         if (InfinityContext::instance().GetServerRole() == NodeRole::kLeader) {
-            cluster_manager->SyncLogs();
+            InfinityContext::instance().cluster_manager()->SyncLogs();
         }
 
         for (const auto &entry : log_batch) {
@@ -446,9 +472,86 @@ void WalManager::FlushLogByReplication(const Vector<String> &synced_logs, bool o
     }
 
     for (const String &synced_log : synced_logs) {
-        ofs_.write(synced_log.c_str(), synced_log.size());
+        Status status = wal_file_handle_->Append(synced_log.data(), synced_log.size());
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+    }
+    SyncWalFile();
+}
+
+char *WalManager::StageLog(SizeT log_size) {
+    SizeT required_size = staged_size_ + log_size;
+    if (required_size > staging_buffer_.size()) {
+        SizeT new_size = std::max(staging_buffer_.size() * 2, WAL_STAGING_BUFFER_SIZE);
+        while (new_size < required_size) {
+            new_size *= 2;
+        }
+        staging_buffer_.resize(new_size);
     }
-    ofs_.flush();
+    return staging_buffer_.data() + staged_size_;
+}
+
+void WalManager::WriteStagedLogs() {
+    if (staged_size_ == 0) {
+        return;
+    }
+    Status status = wal_file_handle_->Append(staging_buffer_.data(), staged_size_);
+    if (!status.ok()) {
+        UnrecoverableError(status.message());
+    }
+    if (InfinityContext::instance().GetServerRole() == NodeRole::kLeader) {
+        // The followers and learners are sent the logs as they are written
+        InfinityContext::instance().cluster_manager()->PrepareLogs(staging_buffer_.data(), staged_log_sizes_);
+    }
+    staged_size_ = 0;
+    staged_log_sizes_.clear();
+    // Don't hold the memory grown by a huge batch, such as a bulk insert of embeddings
+    if (staging_buffer_.size() > WAL_STAGING_BUFFER_MAX_SIZE) {
+        staging_buffer_.resize(WAL_STAGING_BUFFER_SIZE);
+        staging_buffer_.shrink_to_fit();
+    }
+}
+
+void WalManager::OpenWalFile() {
+    auto [file_handle, status] = VirtualStore::Open(wal_path_, FileAccessMode::kWrite);
+    if (!status.ok()) {
+        String error_message = fmt::format("Failed to open wal file: {}, {}", wal_path_, status.message());
+        UnrecoverableError(error_message);
+    }
+    // Append to the existing logs
+    file_handle->Seek(file_handle->FileSize());
+    wal_file_handle_ = std::move(file_handle);
+    has_unsynced_logs_ = false;
+    last_sync_time_ = std::chrono::steady_clock::now();
+}
+
+void WalManager::SyncWalFile() {
+    auto begin = std::chrono::steady_clock::now();
+    Status status = wal_file_handle_->SyncData();
+    if (!status.ok()) {
+        UnrecoverableError(status.message());
+    }
+    auto end = std::chrono::steady_clock::now();
+    has_unsynced_logs_ = false;
+    last_sync_time_ = end;
+
+    u64 sync_time_us = std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count();
+    sync_count_.fetch_add(1, std::memory_order_relaxed);
+    total_sync_time_us_.fetch_add(sync_time_us, std::memory_order_relaxed);
+    if (sync_time_us > max_sync_time_us_.load(std::memory_order_relaxed)) {
+        max_sync_time_us_.store(sync_time_us, std::memory_order_relaxed);
+    }
+}
+
+WalFlushStats WalManager::GetFlushStats() const {
+    WalFlushStats stats;
+    stats.batch_count_ = flush_batch_count_.load(std::memory_order_relaxed);
+    stats.entry_count_ = flush_entry_count_.load(std::memory_order_relaxed);
+    stats.sync_count_ = sync_count_.load(std::memory_order_relaxed);
+    stats.total_sync_time_us_ = total_sync_time_us_.load(std::memory_order_relaxed);
+    stats.max_sync_time_us_ = max_sync_time_us_.load(std::memory_order_relaxed);
+    return stats;
 }
 
 bool WalManager::TrySubmitCheckpointTask(SharedPtr<CheckpointTaskBase> ckp_task) {
@@ -610,9 +713,8 @@ i64 WalManager::GetLastCkpWalSize() {
  * current wal file.
  */
 void WalManager::SwapWalFile(const TxnTimeStamp max_commit_ts, bool error_if_duplicate) {
-    if (ofs_.is_open()) {
-        ofs_.close();
-    }
+    // The file handle syncs the file on close
+    wal_file_handle_.reset();
 
     String new_file_path = fmt::format("{}/{}", wal_dir_, WalFile::WalFilename(max_commit_ts));
     LOG_INFO(fmt::format("Wal {} swap to new path: {}", wal_path_, new_file_path));
@@ -635,11 +737,7 @@ void WalManager::SwapWalFile(const TxnTimeStamp max_commit_ts, bool error_if_dup
     }
 
     // Create a new wal file with the original name.
-    ofs_ = std::ofstream(wal_path_, std::ios::app | std::ios::binary);
-    if (!ofs_.is_open()) {
-        String error_message = fmt::format("Failed to open wal file: {}", wal_path_);
-        UnrecoverableError(error_message);
-    }
+    OpenWalFile();
     LOG_INFO(fmt::format("Open new wal file {}", wal_path_));
 }
 
@@ -716,8 +814,12 @@ i64 WalManager::ReplayWalFile(StorageMode targe_storage_mode) {
     String catalog_dir = "";
     TxnTimeStamp last_commit_ts = 0; // last wal commit ts
 
+    // With more than one replay thread, the wal files are decoded concurrently and the entries of different tables are replayed concurrently.
+    SizeT replay_thread_num = storage_->config()->WALReplayThreads();
+    UniquePtr<ThreadPool> replay_pool = replay_thread_num > 1 ? MakeUnique<ThreadPool>(replay_thread_num) : nullptr;
+
     { // if no checkpoint, max_checkpoint_ts is 0
-        WalListIterator iterator(wal_list);
+        WalListIterator iterator(wal_list, replay_pool.get());
         // phase 1: find the max commit ts and catalog path
         LOG_INFO("Replay phase 1: find the max commit ts and catalog path");
         while (iterator.HasNext()) {
@@ -791,6 +893,7 @@ i64 WalManager::ReplayWalFile(StorageMode targe_storage_mode) {
     LOG_INFO(fmt::format("Replay phase 3: replay {} entries", replay_entries.size()));
     std::reverse(replay_entries.begin(), replay_entries.end());
     TransactionID last_txn_id = 0;
+    auto replay_begin = std::chrono::steady_clock::now();
 
     for (SizeT replay_count = 0; replay_count < replay_entries.size(); ++replay_count) {
         if (replay_entries[replay_count]->commit_ts_ < max_checkpoint_ts) {
@@ -802,10 +905,22 @@ i64 WalManager::ReplayWalFile(StorageMode targe_storage_mode) {
         last_commit_ts = replay_entries[replay_count]->commit_ts_;
         last_txn_id = replay_entries[replay_count]->txn_id_;
 
-        LOG_DEBUG(replay_entries[replay_count]->ToString());
-        ReplayWalOptions options{.on_startup_ = false, .is_replay_ = true, .sync_from_leader_ = false};
-        ReplayWalEntry(*replay_entries[replay_count], options);
+        if (replay_pool.get() == nullptr) {
+            LOG_DEBUG(replay_entries[replay_count]->ToString());
+            ReplayWalOptions options{.on_startup_ = false, .is_replay_ = true, .sync_from_leader_ = false};
+            ReplayWalEntry(*replay_entries[replay_count], options);
+        }
     }
+    if (replay_pool.get() != nullptr) {
+        ReplayWalEntriesParallel(replay_entries, *replay_pool);
+    }
+
+    auto replay_time_ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - replay_begin).count();
+    LOG_INFO(fmt::format("Replayed {} entries with {} threads in {} ms, {:.1f} entries/s",
+                         replay_entries.size(),
+                         replay_thread_num,
+                         replay_time_ms,
+                         replay_entries.size() * 1000.0 / std::max<i64>(replay_time_ms, 1)));
 
     LOG_INFO(fmt::format("Latest txn commit_ts: {}, latest txn id: {}", last_commit_ts, last_txn_id));
     storage_->catalog()->next_txn_id_ = last_txn_id;
@@ -1057,6 +1172,87 @@ void WalManager::ReplayWalEntry(const WalEntry &entry, ReplayWalOptions options)
     }
 }
 
+namespace {
+
+// The table written by the entry, if the entry only appends, imports, deletes, compacts or dumps index of one table.
+// Such entries of different tables don't depend on each other.
+Optional<Pair<String, String>> ReplayTableOfEntry(const WalEntry &entry) {
+    Optional<Pair<String, String>> replay_table;
+    for (const auto &cmd : entry.cmds_) {
+        Pair<String, String> table;
+        switch (cmd->GetType()) {
+            case WalCommandType::APPEND: {
+                const auto *append_cmd = static_cast<const WalCmdAppend *>(cmd.get());
+                table = {append_cmd->db_name_, append_cmd->table_name_};
+                break;
+            }
+            case WalCommandType::IMPORT: {
+                const auto *import_cmd = static_cast<const WalCmdImport *>(cmd.get());
+                table = {import_cmd->db_name_, import_cmd->table_name_};
+                break;
+            }
+            case WalCommandType::DELETE: {
+                const auto *delete_cmd = static_cast<const WalCmdDelete *>(cmd.get());
+                table = {delete_cmd->db_name_, delete_cmd->table_name_};
+                break;
+            }
+            case WalCommandType::COMPACT: {
+                const auto *compact_cmd = static_cast<const WalCmdCompact *>(cmd.get());
+                table = {compact_cmd->db_name_, compact_cmd->table_name_};
+                break;
+            }
+            case WalCommandType::DUMP_INDEX: {
+                const auto *dump_index_cmd = static_cast<const WalCmdDumpIndex *>(cmd.get());
+                table = {dump_index_cmd->db_name_, dump_index_cmd->table_name_};
+                break;
+            }
+            default: {
+                return None;
+            }
+        }
+        if (replay_table.has_value() && replay_table.value() != table) {
+            return None;
+        }
+        replay_table = std::move(table);
+    }
+    return replay_table;
+}
+
+} // namespace
+
+void WalManager::ReplayWalEntriesParallel(const Vector<SharedPtr<WalEntry>> &replay_entries, ThreadPool &replay_pool) {
+    ReplayWalOptions options{.on_startup_ = false, .is_replay_ = true, .sync_from_leader_ = false};
+    // The entries waiting to be replayed of each table, in commit order
+    Map<Pair<String, String>, Vector<const WalEntry *>> table_entries;
+    auto replay_table_entries = [&] {
+        Vector<std::future<void>> futs;
+        futs.reserve(table_entries.size());
+        for (const auto &[table, entries] : table_entries) {
+            futs.emplace_back(replay_pool.push([this, &entries, options](int id) {
+                for (const WalEntry *entry : entries) {
+                    ReplayWalEntry(*entry, options);
+                }
+            }));
+        }
+        for (auto &fut : futs) {
+            fut.get();
+        }
+        table_entries.clear();
+    };
+
+    for (const auto &entry : replay_entries) {
+        LOG_DEBUG(entry->ToString());
+        if (auto table = ReplayTableOfEntry(*entry); table.has_value()) {
+            table_entries[std::move(table.value())].push_back(entry.get());
+        } else {
+            // Catalog changes and checkpoints are replayed alone, after all the entries committed before them
+            replay_table_entries();
+            ReplayWalEntry(*entry, options);
+        }
+    }
+    replay_table_entries();
+}
+
 void WalManager::WalCmdCreateDatabaseReplay(const WalCmdCreateDatabase &cmd, TransactionID txn_id, TxnTimeStamp commit_ts) {
     Catalog *catalog = storage_->catalog();
     auto db_dir = MakeShared<String>(cmd.db_dir_tail_);
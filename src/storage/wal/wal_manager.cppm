@@ -23,6 +23,7 @@ import options;
 import catalog_delta_entry;
 import blocking_queue;
 import log_file;
+import local_file_handle;
 
 namespace infinity {
 
@@ -62,6 +63,16 @@ export struct ReplayWalOptions {
     bool sync_from_leader_;
 };
 
+export struct WalFlushStats {
+    u64 batch_count_{};
+    u64 entry_count_{};
+    u64 sync_count_{};
+    u64 total_sync_time_us_{};
+    u64 max_sync_time_us_{};
+};
+
+export String WalFlushStatsToString(const WalFlushStats &stats);
+
 export class WalManager {
 public:
     WalManager(Storage *storage, String wal_dir, u64 wal_size_threshold, u64 delta_checkpoint_interval_wal_bytes, FlushOptionType flush_option);
@@ -108,12 +119,26 @@ public:
 
     void ReplayWalEntry(const WalEntry &entry, ReplayWalOptions options);
 
+    // Replay the entries of different tables concurrently with replay_pool, in commit order for each table
+    void ReplayWalEntriesParallel(const Vector<SharedPtr<WalEntry>> &replay_entries, ThreadPool &replay_pool);
+
     TxnTimeStamp LastCheckpointTS();
 
     Vector<SharedPtr<String>> GetDiffWalEntryString(TxnTimeStamp timestamp) const;
     void UpdateCommitState(TxnTimeStamp commit_ts, i64 wal_size);
 
+    WalFlushStats GetFlushStats() const;
+
 private:
+    // Open wal_path_ for appending
+    void OpenWalFile();
+    // fdatasync the current wal file and record the sync latency
+    void SyncWalFile();
+    // Reserve `log_size` bytes after the staged logs, return the start of the reserved space
+    char *StageLog(SizeT log_size);
+    // Append the staged logs to the wal file
+    void WriteStagedLogs();
+
     // Checkpoint Helper
     void FullCheckpointInner(Txn *txn);
     void DeltaCheckpointInner(Txn *txn);
@@ -169,8 +194,22 @@ private:
     BlockingQueue<WalEntry *> wait_flush_{"WalManager"};
 
     // Only Flush thread access following members
-    std::ofstream ofs_{};
+    UniquePtr<LocalFileHandle> wal_file_handle_{};
     FlushOptionType flush_option_{FlushOptionType::kOnlyWrite};
+    // Some written logs are not synced yet, used by kFlushPerSecond
+    bool has_unsynced_logs_{false};
+    std::chrono::steady_clock::time_point last_sync_time_{};
+    // Reused across batches to serialize the wal entries without allocation, [0, staged_size_) is not written yet
+    Vector<char> staging_buffer_{};
+    SizeT staged_size_{};
+    Vector<SizeT> staged_log_sizes_{}; // size of each staged wal entry
+
+    // Written by Flush thread, read by show variables
+    Atomic<u64> flush_batch_count_{};
+    Atomic<u64> flush_entry_count_{};
+    Atomic<u64> sync_count_{};
+    Atomic<u64> total_sync_time_us_{};
+    Atomic<u64> max_sync_time_us_{};
 
     // Flush and Checkpoint threads access following members
     mutable std::mutex mutex2_{};
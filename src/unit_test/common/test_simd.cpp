@@ -2,6 +2,7 @@
 import base_test;
 import stl;
 import simd_init;
+import pq_fast_scan_simd_funcs;
 
 using namespace infinity;
 
@@ -17,3 +18,37 @@ TEST_F(SimdInitTest, GetSupportedSimdTypesList) {
     alignas(alignof(u16)) u8 v[2] = {1, 0};
     EXPECT_EQ(*reinterpret_cast<const u16 *>(v), 1u);
 }
+
+TEST_F(SimdInitTest, PQFastScan) {
+    constexpr u32 subspace_num = 7;
+    constexpr u32 subspace_pair_num = (subspace_num + 1) / 2;
+    constexpr u32 block_bytes = subspace_pair_num * PQ_FAST_SCAN_BLOCK_SIZE;
+    std::mt19937 rng(0);
+    Vector<u8> codes(PQ_FAST_SCAN_BLOCK_SIZE * subspace_num);
+    Vector<u8> block(block_bytes, 0);
+    Vector<u8> lut(block_bytes, 0);
+    for (u32 k = 0; k < PQ_FAST_SCAN_BLOCK_SIZE; ++k) {
+        for (u32 j = 0; j < subspace_num; ++j) {
+            const u8 code = rng() % 16;
+            codes[k * subspace_num + j] = code;
+            block[(j >> 1) * 32 + (j & 1) * 16 + (k & 15)] |= code << ((k >> 4) << 2);
+        }
+    }
+    for (u32 j = 0; j < subspace_num; ++j) {
+        for (u32 c = 0; c < 16; ++c) {
+            lut[(j >> 1) * 32 + (j & 1) * 16 + c] = rng() % 256;
+        }
+    }
+    u16 simple_distances[PQ_FAST_SCAN_BLOCK_SIZE];
+    u16 distances[PQ_FAST_SCAN_BLOCK_SIZE];
+    PQFastScanSimple(block.data(), lut.data(), subspace_pair_num, simple_distances);
+    GetPQFastScanFuncPtr()(block.data(), lut.data(), subspace_pair_num, distances);
+    for (u32 k = 0; k < PQ_FAST_SCAN_BLOCK_SIZE; ++k) {
+        u32 expected = 0;
+        for (u32 j = 0; j < subspace_num; ++j) {
+            expected += lut[(j >> 1) * 32 + (j & 1) * 16 + codes[k * subspace_num + j]];
+        }
+        EXPECT_EQ(simple_distances[k], expected);
+        EXPECT_EQ(distances[k], expected);
+    }
+}
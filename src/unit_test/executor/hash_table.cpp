@@ -0,0 +1,151 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include <cmath>
+import base_test;
+
+import stl;
+import hash_table;
+import column_vector;
+import value;
+import default_values;
+import internal_types;
+import logical_type;
+import data_type;
+import third_party;
+
+using namespace infinity;
+class HashTableTest : public BaseTest {};
+
+TEST_F(HashTableTest, group_ids) {
+    using namespace infinity;
+
+    Vector<SharedPtr<DataType>> types{MakeShared<DataType>(LogicalType::kInteger), MakeShared<DataType>(LogicalType::kVarchar)};
+
+    HashTable hash_table;
+    hash_table.Init(types);
+
+    // 4096 rows, 100 distinct (integer, varchar) keys, the 7th key is null on the integer column
+    SizeT row_count = 4096;
+    Vector<SharedPtr<ColumnVector>> columns;
+    for (const auto &type : types) {
+        columns.emplace_back(ColumnVector::Make(type));
+        columns.back()->Initialize(ColumnVectorType::kFlat, row_count);
+    }
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        i32 key = row_idx % 100;
+        columns[0]->AppendValue(Value::MakeInt(key));
+        columns[1]->AppendValue(Value::MakeVarchar(fmt::format("key_with_a_long_prefix_{}", key)));
+        if (key == 7) {
+            columns[0]->nulls_ptr_->SetFalse(row_idx);
+        }
+    }
+
+    Vector<u32> group_ids;
+    hash_table.FindOrInsert(columns, row_count, group_ids);
+    EXPECT_EQ(hash_table.GroupCount(), 100u);
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        EXPECT_EQ(group_ids[row_idx], row_idx % 100);
+    }
+
+    // Same keys again map to the same groups
+    hash_table.FindOrInsert(columns, row_count, group_ids);
+    EXPECT_EQ(hash_table.GroupCount(), 100u);
+    hash_table.Find(columns, 100, group_ids);
+    for (SizeT row_idx = 0; row_idx < 100; ++row_idx) {
+        EXPECT_EQ(group_ids[row_idx], row_idx);
+    }
+
+    // Group keys are written back in group id order
+    Vector<SharedPtr<ColumnVector>> output_columns;
+    for (const auto &type : types) {
+        output_columns.emplace_back(ColumnVector::Make(type));
+        output_columns.back()->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+    }
+    hash_table.GetGroupKeys(output_columns, 0, hash_table.GroupCount());
+    EXPECT_EQ(output_columns[0]->Size(), 100u);
+    for (SizeT group_id = 0; group_id < 100; ++group_id) {
+        if (group_id == 7) {
+            EXPECT_FALSE(output_columns[0]->nulls_ptr_->IsTrue(group_id));
+        } else {
+            EXPECT_EQ(output_columns[0]->GetValue(group_id), Value::MakeInt(group_id));
+        }
+        EXPECT_EQ(output_columns[1]->GetValue(group_id), Value::MakeVarchar(fmt::format("key_with_a_long_prefix_{}", group_id)));
+    }
+}
+
+TEST_F(HashTableTest, grow) {
+    using namespace infinity;
+
+    Vector<SharedPtr<DataType>> types{MakeShared<DataType>(LogicalType::kBigInt)};
+    HashTable hash_table;
+    hash_table.Init(types);
+
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    Vector<u32> group_ids;
+    for (SizeT batch = 0; batch < 4; ++batch) {
+        Vector<SharedPtr<ColumnVector>> columns{ColumnVector::Make(types[0])};
+        columns[0]->Initialize(ColumnVectorType::kFlat, row_count);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            columns[0]->AppendValue(Value::MakeBigInt(batch * row_count + row_idx));
+        }
+        hash_table.FindOrInsert(columns, row_count, group_ids);
+        for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+            EXPECT_EQ(group_ids[row_idx], batch * row_count + row_idx);
+        }
+    }
+    EXPECT_EQ(hash_table.GroupCount(), 4 * row_count);
+}
+
+TEST_F(HashTableTest, float_keys) {
+    using namespace infinity;
+
+    Vector<SharedPtr<DataType>> types{MakeShared<DataType>(LogicalType::kFloat), MakeShared<DataType>(LogicalType::kDouble)};
+    HashTable hash_table;
+    hash_table.Init(types);
+
+    // -0.0 equals +0.0, and NaNs with different payloads or signs are one group
+    const f32 nan_f32 = std::numeric_limits<f32>::quiet_NaN();
+    const f64 nan_f64 = std::numeric_limits<f64>::quiet_NaN();
+    Vector<f32> float_keys{0.0f, -0.0f, nan_f32, -nan_f32, std::bit_cast<f32>(0x7f800001u), 1.5f};
+    Vector<f64> double_keys{-0.0, 0.0, -nan_f64, nan_f64, std::bit_cast<f64>(0x7ff0000000000001ull), 1.5};
+    SizeT row_count = float_keys.size();
+    Vector<SharedPtr<ColumnVector>> columns;
+    for (const auto &type : types) {
+        columns.emplace_back(ColumnVector::Make(type));
+        columns.back()->Initialize(ColumnVectorType::kFlat, row_count);
+    }
+    for (SizeT row_idx = 0; row_idx < row_count; ++row_idx) {
+        columns[0]->AppendValue(Value::MakeFloat(float_keys[row_idx]));
+        columns[1]->AppendValue(Value::MakeDouble(double_keys[row_idx]));
+    }
+
+    Vector<u32> group_ids;
+    hash_table.FindOrInsert(columns, row_count, group_ids);
+    EXPECT_EQ(hash_table.GroupCount(), 3u);
+    Vector<u32> expected_group_ids{0, 0, 1, 1, 1, 2};
+    EXPECT_EQ(group_ids, expected_group_ids);
+
+    // the group key of the zeros is +0.0
+    Vector<SharedPtr<ColumnVector>> output_columns;
+    for (const auto &type : types) {
+        output_columns.emplace_back(ColumnVector::Make(type));
+        output_columns.back()->Initialize(ColumnVectorType::kFlat, DEFAULT_VECTOR_SIZE);
+    }
+    hash_table.GetGroupKeys(output_columns, 0, hash_table.GroupCount());
+    EXPECT_FALSE(std::signbit(output_columns[0]->GetValue(0).GetValue<FloatT>()));
+    EXPECT_FALSE(std::signbit(output_columns[1]->GetValue(0).GetValue<DoubleT>()));
+    EXPECT_TRUE(std::isnan(output_columns[0]->GetValue(1).GetValue<FloatT>()));
+}
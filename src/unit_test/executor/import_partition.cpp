@@ -0,0 +1,84 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import import_partition;
+
+using namespace infinity;
+class ImportPartitionTest : public BaseTest {};
+
+TEST_F(ImportPartitionTest, partition_size) {
+    using namespace infinity;
+
+    // Split evenly across the threads
+    EXPECT_EQ(ImportPartitionSize(1000, 4, 10, 1000), 250u);
+    // Not smaller than the minimum
+    EXPECT_EQ(ImportPartitionSize(1000, 4, 400, 1000), 400u);
+    // Not bigger than the maximum
+    EXPECT_EQ(ImportPartitionSize(1000, 2, 10, 100), 100u);
+    EXPECT_EQ(ImportPartitionSize(0, 4, 0, 100), 1u);
+}
+
+TEST_F(ImportPartitionTest, partition_lines) {
+    using namespace infinity;
+
+    // 10 lines of 10 bytes each
+    String content;
+    for (SizeT i = 0; i < 10; ++i) {
+        content += "123456789\n";
+    }
+    auto next_line_start = [&](SizeT offset) {
+        SizeT pos = content.find('\n', offset);
+        return pos == String::npos ? content.size() : pos + 1;
+    };
+
+    Vector<ImportByteRange> ranges = PartitionLines(content.size(), 25, next_line_start);
+    ASSERT_EQ(ranges.size(), 4u);
+    SizeT begin = 0;
+    for (const auto &range : ranges) {
+        EXPECT_EQ(range.begin_, begin);
+        EXPECT_TRUE(range.end_ == content.size() || content[range.end_ - 1] == '\n');
+        begin = range.end_;
+    }
+    EXPECT_EQ(begin, content.size());
+    EXPECT_EQ(ranges[0].end_, 30u);
+
+    // A partition ending right on a line break doesn't take the next line
+    ranges = PartitionLines(content.size(), 20, next_line_start);
+    ASSERT_EQ(ranges.size(), 5u);
+    EXPECT_EQ(ranges[0].end_, 20u);
+
+    // The last line has no line break
+    content.pop_back();
+    ranges = PartitionLines(content.size(), 1000, next_line_start);
+    ASSERT_EQ(ranges.size(), 1u);
+    EXPECT_EQ(ranges[0].end_, content.size());
+}
+
+TEST_F(ImportPartitionTest, partition_row_groups) {
+    using namespace infinity;
+
+    Vector<Vector<int>> partitions = PartitionRowGroups({100, 100, 100, 500, 50, 50}, 200);
+    ASSERT_EQ(partitions.size(), 4u);
+    EXPECT_EQ(partitions[0], (Vector<int>{0, 1}));
+    EXPECT_EQ(partitions[1], (Vector<int>{2}));
+    // A row group bigger than a partition is a partition alone
+    EXPECT_EQ(partitions[2], (Vector<int>{3}));
+    EXPECT_EQ(partitions[3], (Vector<int>{4, 5}));
+
+    EXPECT_TRUE(PartitionRowGroups({}, 200).empty());
+}
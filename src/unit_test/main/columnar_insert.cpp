@@ -0,0 +1,186 @@
+// Copyright(C) 2024 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import infinity;
+import query_result;
+import data_block;
+import value;
+import status;
+import third_party;
+
+using namespace infinity;
+
+class ColumnarInsertTest : public BaseTest {
+protected:
+    void SetUp() override {
+        RemoveDbDirs();
+        Infinity::LocalInit(GetHomeDir());
+        infinity_ = Infinity::LocalConnect();
+        QueryResult result = infinity_->Query("CREATE TABLE columnar_insert (c1 INT, c2 VARCHAR, c3 BOOLEAN, c4 EMBEDDING(FLOAT, 2))");
+        EXPECT_TRUE(result.IsOk());
+    }
+
+    void TearDown() override {
+        infinity_->LocalDisconnect();
+        infinity_.reset();
+        Infinity::LocalUnInit();
+    }
+
+    template <typename T>
+    static String FixedWidthBuffer(const Vector<T> &values) {
+        return String(reinterpret_cast<const char *>(values.data()), values.size() * sizeof(T));
+    }
+
+    // i32 length followed by the bytes of each value
+    static String VarcharBuffer(const Vector<String> &values) {
+        String buffer;
+        for (const auto &value : values) {
+            i32 length = value.size();
+            buffer.append(reinterpret_cast<const char *>(&length), sizeof(length));
+            buffer.append(value);
+        }
+        return buffer;
+    }
+
+    QueryResult InsertColumns(Vector<String> column_names, Vector<String> column_buffers, SizeT row_count) {
+        return infinity_->InsertColumns("default_db", "columnar_insert", std::move(column_names), std::move(column_buffers), row_count);
+    }
+
+    SizeT RowCount() {
+        QueryResult result = infinity_->Query("SELECT COUNT(*) FROM columnar_insert");
+        EXPECT_TRUE(result.IsOk());
+        return result.result_table_->GetDataBlockById(0)->GetValue(0, 0).GetValue<BigIntT>();
+    }
+
+    SharedPtr<Infinity> infinity_{};
+};
+
+TEST_F(ColumnarInsertTest, insert_columns) {
+    // the buffers are matched to the table columns by name
+    QueryResult result = InsertColumns({"c4", "c2", "c1", "c3"},
+                                       {FixedWidthBuffer(Vector<f32>{0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f}),
+                                        VarcharBuffer({"a", "", "a long varchar value which isn't inlined"}),
+                                        FixedWidthBuffer(Vector<i32>{1, 2, 3}),
+                                        FixedWidthBuffer(Vector<u8>{1, 0, 1})},
+                                       3);
+    EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+    EXPECT_EQ(RowCount(), 3u);
+
+    result = infinity_->Query("SELECT c1, c2, c3 FROM columnar_insert ORDER BY c1");
+    EXPECT_TRUE(result.IsOk());
+    SharedPtr<DataBlock> data_block = result.result_table_->GetDataBlockById(0);
+    EXPECT_EQ(data_block->row_count(), 3u);
+    EXPECT_EQ(data_block->GetValue(0, 2).GetValue<IntegerT>(), 3);
+    EXPECT_EQ(data_block->GetValue(1, 1).GetVarchar(), "");
+    EXPECT_EQ(data_block->GetValue(1, 2).GetVarchar(), "a long varchar value which isn't inlined");
+    EXPECT_TRUE(data_block->GetValue(2, 0).GetValue<BooleanT>());
+    EXPECT_FALSE(data_block->GetValue(2, 1).GetValue<BooleanT>());
+}
+
+TEST_F(ColumnarInsertTest, type_mismatch) {
+    String c2 = VarcharBuffer({"a", "b"});
+    String c3 = FixedWidthBuffer(Vector<u8>{1, 0});
+    String c4 = FixedWidthBuffer(Vector<f32>{0, 1, 2, 3});
+
+    // i64 values for an INT column
+    QueryResult result = InsertColumns({"c1", "c2", "c3", "c4"}, {FixedWidthBuffer(Vector<i64>{1, 2}), c2, c3, c4}, 2);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidParameterValue);
+
+    // f64 values for an EMBEDDING(FLOAT, 2) column
+    result = InsertColumns({"c1", "c2", "c3", "c4"}, {FixedWidthBuffer(Vector<i32>{1, 2}), c2, c3, FixedWidthBuffer(Vector<f64>{0, 1, 2, 3})}, 2);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidParameterValue);
+
+    // raw bytes for a VARCHAR column, the first length is past the end of the buffer
+    result = InsertColumns({"c1", "c2", "c3", "c4"}, {FixedWidthBuffer(Vector<i32>{1, 2}), String(8, 'a'), c3, c4}, 2);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidParameterValue);
+
+    // columns which aren't supported by the columnar insert
+    result = infinity_->Query("CREATE TABLE columnar_insert_tensor (c1 INT, c2 TENSOR(FLOAT, 2))");
+    EXPECT_TRUE(result.IsOk());
+    result = infinity_->InsertColumns("default_db", "columnar_insert_tensor", {"c1", "c2"}, {FixedWidthBuffer(Vector<i32>{1}), String(8, '\0')}, 1);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kNotSupported);
+
+    EXPECT_EQ(RowCount(), 0u);
+}
+
+TEST_F(ColumnarInsertTest, null_column) {
+    String c1 = FixedWidthBuffer(Vector<i32>{1, 2});
+    String c2 = VarcharBuffer({"a", "b"});
+    String c3 = FixedWidthBuffer(Vector<u8>{1, 0});
+    String c4 = FixedWidthBuffer(Vector<f32>{0, 1, 2, 3});
+
+    // there is no null value in a column buffer, every column of the table must be given
+    QueryResult result = InsertColumns({"c1", "c2", "c3"}, {c1, c2, c3}, 2);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kColumnCountMismatch);
+
+    // an empty buffer doesn't stand for null values
+    result = InsertColumns({"c1", "c2", "c3", "c4"}, {c1, String(), c3, c4}, 2);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidParameterValue);
+    result = InsertColumns({"c1", "c2", "c3", "c4"}, {String(), c2, c3, c4}, 2);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidParameterValue);
+
+    // names which don't fill the table columns
+    result = InsertColumns({"c1", "c2", "c3", "c5"}, {c1, c2, c3, c4}, 2);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kColumnNotExist);
+    result = InsertColumns({"c1", "c2", "c3", "c1"}, {c1, c2, c3, c1}, 2);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidColumnName);
+
+    EXPECT_EQ(RowCount(), 0u);
+}
+
+TEST_F(ColumnarInsertTest, row_count_mismatch) {
+    String c2 = VarcharBuffer({"a", "b", "c"});
+    String c3 = FixedWidthBuffer(Vector<u8>{1, 0, 1});
+    String c4 = FixedWidthBuffer(Vector<f32>{0, 1, 2, 3, 4, 5});
+
+    // fewer and more values than row_count
+    QueryResult result = InsertColumns({"c1", "c2", "c3", "c4"}, {FixedWidthBuffer(Vector<i32>{1, 2}), c2, c3, c4}, 3);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidParameterValue);
+    result = InsertColumns({"c1", "c2", "c3", "c4"}, {FixedWidthBuffer(Vector<i32>{1, 2, 3, 4}), c2, c3, c4}, 3);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidParameterValue);
+
+    // the varchar buffer holds a value more than row_count
+    result = InsertColumns({"c1", "c2", "c3", "c4"}, {FixedWidthBuffer(Vector<i32>{1, 2, 3}), VarcharBuffer({"a", "b", "c", "d"}), c3, c4}, 3);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidParameterValue);
+
+    // the columns agree with each other but not with row_count
+    result = InsertColumns({"c1", "c2", "c3", "c4"}, {FixedWidthBuffer(Vector<i32>{1, 2, 3}), c2, c3, c4}, 2);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kInvalidParameterValue);
+
+    result = InsertColumns({"c1", "c2", "c3", "c4"}, {String(), String(), String(), String()}, 0);
+    EXPECT_EQ(result.ErrorCode(), ErrorCode::kNotSupported);
+
+    EXPECT_EQ(RowCount(), 0u);
+
+    // more rows than a data block, they are split into several blocks
+    constexpr SizeT kRowCount = 8192 * 2 + 100;
+    Vector<i32> c1_values(kRowCount);
+    std::iota(c1_values.begin(), c1_values.end(), 0);
+    Vector<String> c2_values(kRowCount, "v");
+    result = InsertColumns({"c1", "c2", "c3", "c4"},
+                           {FixedWidthBuffer(c1_values),
+                            VarcharBuffer(c2_values),
+                            FixedWidthBuffer(Vector<u8>(kRowCount, 1)),
+                            FixedWidthBuffer(Vector<f32>(kRowCount * 2, 1.0f))},
+                           kRowCount);
+    EXPECT_TRUE(result.IsOk()) << result.ErrorMsg();
+    EXPECT_EQ(RowCount(), kRowCount);
+    result = infinity_->Query("SELECT SUM(c1) FROM columnar_insert");
+    EXPECT_TRUE(result.IsOk());
+    EXPECT_EQ(result.result_table_->GetDataBlockById(0)->GetValue(0, 0).GetValue<BigIntT>(), i64(kRowCount) * (kRowCount - 1) / 2);
+}
@@ -122,6 +122,7 @@ TEST_F(ConfigTest, test2) {
     EXPECT_EQ(config.ObjectStorageAccessKey(), "minioadmin");
     EXPECT_EQ(config.ObjectStorageSecretKey(), "minioadmin");
     EXPECT_EQ(config.ObjectStorageHttps(), false);
+    EXPECT_EQ(config.ObjectStorageDiskCacheLimit(), 64 * 1024l * 1024l * 1024l);
 
     // buffer
     EXPECT_EQ(config.BufferManagerSize(), 3 * 1024l * 1024l * 1024l);
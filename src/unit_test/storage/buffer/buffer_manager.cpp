@@ -192,6 +192,50 @@ TEST_F(BufferManagerTest, cleanup_test) {
     }
 }
 
+TEST_F(BufferManagerTest, clock_test) {
+    const SizeT file_size = 100;
+    const SizeT file_num = 3;
+
+    // one clock so that the order of the hand is known
+    BufferManager buffer_mgr(2 * file_size, data_dir_, temp_dir_, nullptr, 1);
+    Vector<BufferObj *> buffer_objs;
+    for (SizeT i = 0; i < file_num; ++i) {
+        auto file_name = MakeShared<String>(fmt::format("file_{}", i));
+        auto file_worker = MakeUnique<DataFileWorker>(data_dir_, temp_dir_, MakeShared<String>(""), file_name, file_size, buffer_mgr.persistence_manager());
+        buffer_objs.push_back(buffer_mgr.AllocateBufferObject(std::move(file_worker)));
+    }
+    EXPECT_EQ(buffer_mgr.BufferedObjectCount(), file_num);
+    for (auto *buffer_obj : buffer_objs) {
+        EXPECT_EQ(buffer_mgr.GetBufferObjectById(buffer_obj->id()), buffer_obj);
+    }
+
+    { auto handle0 = buffer_objs[0]->Load(); }
+    { auto handle1 = buffer_objs[1]->Load(); }
+    EXPECT_EQ(buffer_mgr.WaitingGCObjectCount()[0], 2u);
+
+    // the hand clears the reference bits of 0 and 1, then frees 0
+    { auto handle2 = buffer_objs[2]->Load(); }
+    EXPECT_EQ(buffer_objs[0]->status(), BufferStatus::kFreed);
+    EXPECT_EQ(buffer_objs[1]->status(), BufferStatus::kUnloaded);
+    EXPECT_EQ(buffer_objs[2]->status(), BufferStatus::kUnloaded);
+    EXPECT_EQ(buffer_mgr.WaitingGCObjectCount()[0], 2u);
+
+    {
+        // 1 is loaded so the hand skips it, 2 is referenced and gets a second chance before it is freed
+        auto handle1 = buffer_objs[1]->Load();
+        auto handle0 = buffer_objs[0]->Load();
+        EXPECT_EQ(buffer_objs[1]->status(), BufferStatus::kLoaded);
+        EXPECT_EQ(buffer_objs[2]->status(), BufferStatus::kFreed);
+        EXPECT_EQ(buffer_mgr.WaitingGCObjectCount()[0], 0u);
+    }
+    EXPECT_EQ(buffer_mgr.WaitingGCObjectCount()[0], 2u);
+    EXPECT_EQ(buffer_mgr.memory_usage(), 2 * file_size);
+
+    for (auto *buffer_obj : buffer_objs) {
+        buffer_obj->CheckState();
+    }
+}
+
 TEST_F(BufferManagerTest, varfile_test) {
     SizeT buffer_size = 100;
     SizeT file_num = 10;
@@ -275,6 +275,84 @@ TEST_F(BufferObjTest, test1) {
     infinity::InfinityContext::instance().UnInit();
 }
 
+TEST_F(BufferObjTest, test_prefetch) {
+    RemoveDbDirs();
+    std::shared_ptr<std::string> config_path = std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_buffer_obj.toml");
+    infinity::InfinityContext::instance().InitPhase1(config_path);
+    infinity::InfinityContext::instance().InitPhase2();
+
+    SizeT memory_limit = 1024;
+    String data_dir(GetFullDataDir());
+    auto temp_dir = MakeShared<String>(data_dir + "/spill");
+    auto base_dir = MakeShared<String>(GetFullDataDir());
+    auto persistence_dir = MakeShared<String>(data_dir + "/persistence");
+
+    UniquePtr<PersistenceManager> persistence_manager =
+        MakeUnique<PersistenceManager>(*persistence_dir, *base_dir, DEFAULT_PERSISTENCE_OBJECT_SIZE_LIMIT);
+    BufferManager buffer_manager(memory_limit, base_dir, temp_dir, persistence_manager.get());
+
+    SizeT test_size = 1024;
+    auto file_worker1 = MakeUnique<DataFileWorker>(base_dir,
+                                                     temp_dir,
+                                                     MakeShared<String>("dir1"),
+                                                     MakeShared<String>("test1"),
+                                                     test_size,
+                                                     buffer_manager.persistence_manager());
+    auto buf1 = buffer_manager.AllocateBufferObject(std::move(file_worker1));
+    buf1->AddObjRc();
+    auto file_worker2 = MakeUnique<DataFileWorker>(base_dir,
+                                                     temp_dir,
+                                                     MakeShared<String>("dir2"),
+                                                     MakeShared<String>("test2"),
+                                                     test_size,
+                                                     buffer_manager.persistence_manager());
+    auto buf2 = buffer_manager.AllocateBufferObject(std::move(file_worker2));
+    buf2->AddObjRc();
+
+    {
+        auto handle1 = buf1->Load();
+        auto *data1 = static_cast<char *>(handle1.GetDataMut());
+        for (SizeT i = 0; i < test_size; ++i) {
+            data1[i] = i % 128;
+        }
+    }
+    SaveBufferObj(buf1);
+    { auto handle2 = buf2->Load(); }
+    // kUnloaded, kPersistent -> kFreed, kPersistent
+    EXPECT_EQ(buf1->status(), BufferStatus::kFreed);
+    EXPECT_EQ(buf1->type(), BufferType::kPersistent);
+
+    // kFreed, kPersistent -> kUnloaded, kPersistent in background
+    buffer_manager.Prefetch(buf1);
+    for (SizeT i = 0; i < 1000 && buffer_manager.GetLoadStats().prefetch_count_ == 0; ++i) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(buffer_manager.GetLoadStats().prefetch_count_, 1u);
+    EXPECT_EQ(buf1->status(), BufferStatus::kUnloaded);
+    buf1->CheckState();
+
+    {
+        auto handle1 = buf1->Load();
+        const auto *data1 = static_cast<const char *>(handle1.GetData());
+        for (SizeT i = 0; i < test_size; ++i) {
+            EXPECT_EQ(data1[i], char(i % 128));
+        }
+    }
+    BufferLoadStats stats = buffer_manager.GetLoadStats();
+    EXPECT_EQ(stats.prefetch_hit_count_, 1u);
+    EXPECT_EQ(stats.load_count_, 0u);
+
+    // A load of a freed object waits for the read and is counted in the load latency
+    { auto handle2 = buf2->Load(); }
+    EXPECT_EQ(buffer_manager.GetLoadStats().load_count_, 1u);
+    EXPECT_EQ(buf1->status(), BufferStatus::kFreed);
+    { auto handle1 = buf1->Load(); }
+    EXPECT_EQ(buffer_manager.GetLoadStats().load_count_, 2u);
+
+    buffer_manager.Stop();
+    infinity::InfinityContext::instance().UnInit();
+}
+
 // unit test for BufferStatus::kClean transformation
 // TEST_F(BufferObjTest, test_status_clean) {
 //     SizeT memory_limit = 1024;
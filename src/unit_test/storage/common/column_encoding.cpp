@@ -0,0 +1,126 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import column_encoding;
+import data_type;
+import logical_type;
+import third_party;
+
+using namespace infinity;
+
+class ColumnEncodingTest : public BaseTest {
+protected:
+    static void CheckRoundTrip(const ColumnEncodingInfo &info, const char *data, SizeT size, ColumnEncodingType expected_type) {
+        Vector<char> encoded;
+        ColumnEncodingType type = ColumnEncoding::Encode(info, data, size, encoded);
+        EXPECT_EQ(type, expected_type) << ColumnEncodingTypeToString(type);
+        if (type == ColumnEncodingType::kRaw) {
+            EXPECT_TRUE(encoded.empty());
+            return;
+        }
+        EXPECT_LT(encoded.size(), size);
+        Vector<char> decoded(size);
+        ColumnEncoding::Decode(type, encoded.data(), encoded.size(), decoded.data(), size);
+        EXPECT_EQ(std::memcmp(decoded.data(), data, size), 0);
+    }
+};
+
+TEST_F(ColumnEncodingTest, frame_of_reference) {
+    using namespace infinity;
+
+    ColumnEncodingInfo info = ColumnEncodingInfo::Make(DataType(LogicalType::kBigInt));
+    EXPECT_EQ(info.value_width_, sizeof(i64));
+    EXPECT_TRUE(info.is_integer_);
+
+    // values spread over [-1000, 1000) around a large reference
+    Vector<i64> values(8192);
+    for (SizeT i = 0; i < values.size(); ++i) {
+        values[i] = 1'000'000'000'000LL + i64(i * 7919 % 2000) - 1000;
+    }
+    CheckRoundTrip(info, reinterpret_cast<const char *>(values.data()), values.size() * sizeof(i64), ColumnEncodingType::kFrameOfReference);
+
+    // the whole i64 range is still encoded losslessly
+    values[0] = std::numeric_limits<i64>::min();
+    values[1] = std::numeric_limits<i64>::max();
+    Vector<char> encoded;
+    ColumnEncodingType type = ColumnEncoding::Encode(info, reinterpret_cast<const char *>(values.data()), values.size() * sizeof(i64), encoded);
+    if (type != ColumnEncodingType::kRaw) {
+        Vector<i64> decoded(values.size());
+        ColumnEncoding::Decode(type, encoded.data(), encoded.size(), reinterpret_cast<char *>(decoded.data()), decoded.size() * sizeof(i64));
+        EXPECT_EQ(decoded, values);
+    }
+
+    std::mt19937 rng(42);
+    Vector<i16> small_values(8192);
+    for (SizeT i = 0; i < small_values.size(); ++i) {
+        small_values[i] = i16(rng() % 16) - 8;
+    }
+    CheckRoundTrip(ColumnEncodingInfo::Make(DataType(LogicalType::kSmallInt)),
+                   reinterpret_cast<const char *>(small_values.data()),
+                   small_values.size() * sizeof(i16),
+                   ColumnEncodingType::kFrameOfReference);
+}
+
+TEST_F(ColumnEncodingTest, dictionary) {
+    using namespace infinity;
+
+    // low cardinality 16 bytes values, like inline varchar
+    SizeT value_width = 16;
+    Vector<char> data(8192 * value_width);
+    for (SizeT i = 0; i < 8192; ++i) {
+        String value = fmt::format("status_{}", i % 5);
+        std::memcpy(data.data() + i * value_width, value.data(), value.size());
+    }
+    ColumnEncodingInfo info{.value_width_ = value_width, .is_integer_ = false};
+    CheckRoundTrip(info, data.data(), data.size(), ColumnEncodingType::kDictionary);
+}
+
+TEST_F(ColumnEncodingTest, general_codec) {
+    using namespace infinity;
+
+    // runs of the same double
+    Vector<f64> values(8192);
+    for (SizeT i = 0; i < values.size(); ++i) {
+        values[i] = (i / 64) * 0.5;
+    }
+    CheckRoundTrip(ColumnEncodingInfo::Make(DataType(LogicalType::kDouble)),
+                   reinterpret_cast<const char *>(values.data()),
+                   values.size() * sizeof(f64),
+                   ColumnEncodingType::kDictionary);
+
+    // too many distinct values for a dictionary, but repeated in the buffer
+    for (SizeT i = 0; i < values.size(); ++i) {
+        values[i] = (i % 4096) * 0.25;
+    }
+    CheckRoundTrip(ColumnEncodingInfo::Make(DataType(LogicalType::kDouble)),
+                   reinterpret_cast<const char *>(values.data()),
+                   values.size() * sizeof(f64),
+                   ColumnEncodingType::kSnappy);
+
+    // random bytes are written raw
+    std::mt19937 rng(42);
+    Vector<u64> random_values(8192);
+    for (auto &value : random_values) {
+        value = (u64(rng()) << 32) | rng();
+    }
+    CheckRoundTrip(ColumnEncodingInfo::Make(DataType(LogicalType::kDouble)),
+                   reinterpret_cast<const char *>(random_values.data()),
+                   random_values.size() * sizeof(u64),
+                   ColumnEncodingType::kRaw);
+    CheckRoundTrip(ColumnEncodingInfo{}, reinterpret_cast<const char *>(values.data()), values.size() * sizeof(f64), ColumnEncodingType::kRaw);
+}
@@ -35,6 +35,8 @@ import embedding_info;
 import array_info;
 import knn_expr;
 import data_type;
+import selection;
+import column_vector;
 
 using namespace infinity;
 
@@ -300,3 +302,44 @@ TEST_P(DataBlockTest, ReadWrite) {
     EXPECT_NE(data_block2, nullptr);
     EXPECT_EQ(data_block == *data_block2, true);
 }
+
+TEST_P(DataBlockTest, MaterializeSelection) {
+    using namespace infinity;
+
+    Vector<SharedPtr<DataType>> column_types;
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kInteger));
+    column_types.emplace_back(MakeShared<DataType>(LogicalType::kVarchar));
+
+    DataBlock data_block;
+    data_block.Init(column_types);
+    SizeT row_count = DEFAULT_VECTOR_SIZE;
+    for (SizeT i = 0; i < row_count; ++i) {
+        data_block.AppendValue(0, Value::MakeInt(static_cast<i32>(i)));
+        data_block.AppendValue(1, Value::MakeVarchar(fmt::format("varchar_value_longer_than_inline_{}", i)));
+    }
+    data_block.Finalize();
+    EXPECT_EQ(data_block.selected_row_count(), row_count);
+
+    // Every third row is selected, the columns are untouched until materialization
+    auto selection = MakeShared<Selection>();
+    selection->Initialize(row_count);
+    for (SizeT i = 0; i < row_count; i += 3) {
+        selection->Append(i);
+    }
+    SharedPtr<ColumnVector> first_column = data_block.column_vectors[0];
+    data_block.SetSelection(selection);
+    EXPECT_TRUE(data_block.HasSelection());
+    EXPECT_EQ(data_block.row_count(), row_count);
+    SizeT selected_count = (row_count + 2) / 3;
+    EXPECT_EQ(data_block.selected_row_count(), selected_count);
+    EXPECT_EQ(data_block.SelectedRowIndex(2), 6u);
+    EXPECT_EQ(data_block.column_vectors[0], first_column);
+
+    data_block.MaterializeSelection();
+    EXPECT_FALSE(data_block.HasSelection());
+    EXPECT_EQ(data_block.row_count(), selected_count);
+    for (SizeT i = 0; i < selected_count; ++i) {
+        EXPECT_EQ(data_block.GetValue(0, i), Value::MakeInt(static_cast<i32>(i * 3)));
+        EXPECT_EQ(data_block.GetValue(1, i), Value::MakeVarchar(fmt::format("varchar_value_longer_than_inline_{}", i * 3)));
+    }
+}
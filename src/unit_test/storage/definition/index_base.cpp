@@ -23,6 +23,7 @@ import index_hnsw;
 import index_full_text;
 
 import statement_common;
+import serialize;
 
 using namespace infinity;
 class IndexBaseTest : public BaseTest {};
@@ -91,6 +92,105 @@ TEST_F(IndexBaseTest, hnsw_readwrite) {
     EXPECT_EQ(*index_base, *index_base1);
 }
 
+// the layout of IndexIVFOption written before build_threads_ was added
+struct IndexIVFOptionV0 {
+    MetricType metric_ = MetricType::kInvalid;
+    IndexIVFCentroidOption centroid_option_;
+    IndexIVFStorageOption storage_option_;
+};
+
+TEST_F(IndexBaseTest, ivf_read_old_layout) {
+    using namespace infinity;
+
+    Vector<String> columns{"col1"};
+    Vector<InitParameter *> parameters;
+    parameters.emplace_back(new InitParameter("metric", "l2"));
+    parameters.emplace_back(new InitParameter("plain_storage_data_type", "float"));
+    parameters.emplace_back(new InitParameter("build_threads", "4"));
+
+    SharedPtr<IndexIVF> index_ivf = IndexIVF::Make(MakeShared<String>("idx1"), MakeShared<String>("test comment"), "tbl1_idx1", columns, parameters);
+    for (auto parameter : parameters) {
+        delete parameter;
+    }
+    EXPECT_EQ(index_ivf->ivf_option_.build_threads_, 4u);
+
+    // an entry written by an older version
+    IndexIVFOptionV0 option_v0;
+    std::memset(&option_v0, 0, sizeof(option_v0));
+    option_v0.metric_ = index_ivf->ivf_option_.metric_;
+    option_v0.centroid_option_ = index_ivf->ivf_option_.centroid_option_;
+    option_v0.storage_option_ = index_ivf->ivf_option_.storage_option_;
+    int32_t old_size = index_ivf->IndexBase::GetSizeInBytes() + sizeof(IndexIVFOptionV0);
+    Vector<char> old_buf(old_size, char(0));
+    char *ptr = old_buf.data();
+    index_ivf->IndexBase::WriteAdv(ptr);
+    WriteBufAdv(ptr, option_v0);
+    EXPECT_EQ(ptr - old_buf.data(), old_size);
+
+    // build_threads is not written, so the layout is unchanged
+    int32_t exp_size = index_ivf->GetSizeInBytes();
+    EXPECT_EQ(exp_size, old_size);
+    Vector<char> buf(exp_size, char(0));
+    ptr = buf.data();
+    index_ivf->WriteAdv(ptr);
+    EXPECT_EQ(buf, old_buf);
+
+    const char *ptr_r = old_buf.data();
+    int32_t maxbytes = old_size;
+    SharedPtr<IndexBase> index_base1 = IndexBase::ReadAdv(ptr_r, maxbytes);
+    EXPECT_EQ(ptr_r - old_buf.data(), old_size);
+    const auto *index_ivf1 = static_cast<const IndexIVF *>(index_base1.get());
+    EXPECT_EQ(index_ivf1->ivf_option_, index_ivf->ivf_option_);
+    EXPECT_EQ(index_ivf1->ivf_option_.build_threads_, 0u);
+}
+
+TEST_F(IndexBaseTest, hnsw_read_old_layout) {
+    using namespace infinity;
+
+    Vector<String> columns{"col1", "col2"};
+    Vector<InitParameter *> parameters;
+    parameters.emplace_back(new InitParameter("metric", "l2"));
+    parameters.emplace_back(new InitParameter("m", "16"));
+    parameters.emplace_back(new InitParameter("ef_construction", "200"));
+    parameters.emplace_back(new InitParameter("encode", "plain"));
+    parameters.emplace_back(new InitParameter("build_threads", "4"));
+
+    auto index_base = IndexHnsw::Make(MakeShared<String>("idx1"), MakeShared<String>("test comment"), "tbl1_idx1", columns, parameters);
+    for (auto parameter : parameters) {
+        delete parameter;
+    }
+    const auto *index_hnsw = static_cast<const IndexHnsw *>(index_base.get());
+    EXPECT_EQ(index_hnsw->build_threads_, 4u);
+
+    // an entry written by an older version
+    int32_t old_size = index_hnsw->IndexBase::GetSizeInBytes() + sizeof(MetricType) + sizeof(HnswEncodeType) + 3 * sizeof(SizeT);
+    Vector<char> old_buf(old_size, char(0));
+    char *ptr = old_buf.data();
+    index_hnsw->IndexBase::WriteAdv(ptr);
+    WriteBufAdv(ptr, index_hnsw->metric_type_);
+    WriteBufAdv(ptr, index_hnsw->encode_type_);
+    WriteBufAdv(ptr, index_hnsw->M_);
+    WriteBufAdv(ptr, index_hnsw->ef_construction_);
+    WriteBufAdv(ptr, index_hnsw->block_size_);
+    EXPECT_EQ(ptr - old_buf.data(), old_size);
+
+    // build_threads is not written, so the layout is unchanged
+    int32_t exp_size = index_hnsw->GetSizeInBytes();
+    EXPECT_EQ(exp_size, old_size);
+    Vector<char> buf(exp_size, char(0));
+    ptr = buf.data();
+    index_hnsw->WriteAdv(ptr);
+    EXPECT_EQ(buf, old_buf);
+
+    const char *ptr_r = old_buf.data();
+    int32_t maxbytes = old_size;
+    SharedPtr<IndexBase> index_base1 = IndexBase::ReadAdv(ptr_r, maxbytes);
+    EXPECT_EQ(ptr_r - old_buf.data(), old_size);
+    const auto *index_hnsw1 = static_cast<const IndexHnsw *>(index_base1.get());
+    EXPECT_EQ(*index_hnsw1, *index_hnsw);
+    EXPECT_EQ(index_hnsw1->build_threads_, 0u);
+}
+
 TEST_F(IndexBaseTest, full_text_readwrite) {
     using namespace infinity;
 
@@ -88,6 +88,25 @@ public:
 
             test_func(hnsw_index);
 
+            {
+                KnnSearchOption search_option{.ef_ = 10};
+                Vector<const float *> queries;
+                for (int i = 0; i < element_size; i += 7) {
+                    queries.push_back(data.get() + i * dim);
+                }
+                auto batch_results = hnsw_index->KnnSearchBatch(queries.data(), queries.size(), 1, search_option);
+                ASSERT_EQ(batch_results.size(), queries.size());
+                for (SizeT i = 0; i < queries.size(); ++i) {
+                    auto [result_n, d_ptr, l_ptr] = hnsw_index->KnnSearch(queries[i], 1, search_option);
+                    const auto &[batch_result_n, batch_d_ptr, batch_l_ptr] = batch_results[i];
+                    ASSERT_EQ(batch_result_n, result_n);
+                    for (SizeT j = 0; j < result_n; ++j) {
+                        EXPECT_EQ(batch_d_ptr[j], d_ptr[j]);
+                        EXPECT_EQ(batch_l_ptr[j], l_ptr[j]);
+                    }
+                }
+            }
+
             auto [file_handle, status] = VirtualStore::Open(save_dir_ + "/test_hnsw.bin", FileAccessMode::kWrite);
             if (!status.ok()) {
                 UnrecoverableError(status.message());
@@ -105,6 +124,40 @@ public:
 
             test_func(hnsw_index);
         }
+
+        {
+            auto [file_handle, status] = VirtualStore::Open(save_dir_ + "/test_hnsw.bin", FileAccessMode::kRead);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            SizeT file_size = file_handle->FileSize();
+            auto [mmap_data, mmap_status] = file_handle->MmapRead(0, file_size);
+            ASSERT_TRUE(mmap_status.ok());
+
+            auto hnsw_index = Hnsw::LoadFromPtr(mmap_data);
+            ASSERT_NE(hnsw_index, nullptr);
+            EXPECT_TRUE(hnsw_index->IsInPlace());
+            test_func(hnsw_index);
+
+            auto materialized_index = hnsw_index->Materialize();
+            hnsw_index.reset();
+            ASSERT_TRUE(LocalFileHandle::Unmmap(mmap_data, file_size).ok());
+            EXPECT_FALSE(materialized_index->IsInPlace());
+            test_func(materialized_index);
+        }
+
+        { // an index at a misaligned address isn't searched in place
+            auto [file_handle, status] = VirtualStore::Open(save_dir_ + "/test_hnsw.bin", FileAccessMode::kRead);
+            if (!status.ok()) {
+                UnrecoverableError(status.message());
+            }
+            SizeT file_size = file_handle->FileSize();
+            auto buffer = MakeUnique<u64[]>(file_size / sizeof(u64) + 2);
+            char *misaligned_data = reinterpret_cast<char *>(buffer.get()) + 4;
+            file_handle->Read(misaligned_data, file_size);
+
+            EXPECT_EQ(Hnsw::LoadFromPtr(misaligned_data), nullptr);
+        }
     }
 
     template <typename Hnsw, typename CompressedHnsw>
@@ -318,3 +371,55 @@ TEST_F(HnswAlgTest, test6) {
     using CompressedHnsw = KnnHnsw<LVQL2VecStoreType<float, int8_t>, LabelT>;
     TestCompress<Hnsw, CompressedHnsw>();
 }
+
+TEST_F(HnswAlgTest, test7) {
+    // The 1-bit codes only rank roughly, so the candidates are reranked with the raw vectors.
+    using Hnsw = KnnHnsw<RabitqL2VecStoreType<float>, LabelT>;
+    int dim = 128;
+    int M = 16;
+    int ef_construction = 200;
+    int chunk_size = 128;
+    int max_chunk_n = 10;
+    int element_size = max_chunk_n * chunk_size;
+    int candidate_n = 20;
+
+    std::mt19937 rng;
+    rng.seed(0);
+    std::uniform_real_distribution<float> distrib_real;
+
+    auto data = MakeUnique<float[]>(dim * element_size);
+    for (int i = 0; i < dim * element_size; ++i) {
+        data[i] = distrib_real(rng);
+    }
+
+    auto hnsw_index = Hnsw::Make(chunk_size, max_chunk_n, dim, M, ef_construction);
+    auto iter = DenseVectorIter<float, LabelT>(data.get(), dim, element_size);
+    // fit the mean of the codes on the vectors
+    hnsw_index->InsertVecs(std::move(iter), HnswInsertConfig{.optimize_ = true});
+    hnsw_index->Check();
+
+    KnnSearchOption search_option{.ef_ = 100};
+    int correct = 0;
+    for (int i = 0; i < element_size; ++i) {
+        const float *query = data.get() + i * dim;
+        auto [result_n, d_ptr, l_ptr] = hnsw_index->KnnSearch(query, candidate_n, search_option);
+        float min_dist = std::numeric_limits<float>::max();
+        LabelT min_label = -1;
+        for (SizeT j = 0; j < result_n; ++j) {
+            const float *vec = data.get() + l_ptr[j] * dim;
+            float dist = 0;
+            for (int k = 0; k < dim; ++k) {
+                dist += (query[k] - vec[k]) * (query[k] - vec[k]);
+            }
+            if (dist < min_dist) {
+                min_dist = dist;
+                min_label = l_ptr[j];
+            }
+        }
+        if (min_label == (LabelT)i) {
+            ++correct;
+        }
+    }
+    float correct_rate = float(correct) / element_size;
+    EXPECT_GE(correct_rate, 0.95);
+}
@@ -0,0 +1,146 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+import stl;
+import infinity_exception;
+import third_party;
+import virtual_store;
+import local_file_handle;
+import pq_fast_scan_simd_funcs;
+import ivf_index_pq_code_storage;
+
+using namespace infinity;
+
+class PQCodeStorageTest : public BaseTest {
+protected:
+    // two full fast scan blocks and a tail block, with an odd subspace number so that the last subspace pair is half used
+    static constexpr u32 subspace_num_ = 7;
+    static constexpr u32 subspace_pair_num_ = (subspace_num_ + 1) / 2;
+    static constexpr u32 code_num_ = 2 * PQ_FAST_SCAN_BLOCK_SIZE + 6;
+    static constexpr u32 block_num_ = (code_num_ + PQ_FAST_SCAN_BLOCK_SIZE - 1) / PQ_FAST_SCAN_BLOCK_SIZE;
+
+    const String save_path_ = String(GetFullTmpDir()) + "/test_pq_code_storage.bin";
+
+    // code of subspace j of the k-th vector in the fast scan layout
+    static u32 BlockCode(const u8 *blocks, const u32 k, const u32 j) {
+        const u8 *block = blocks + (k / PQ_FAST_SCAN_BLOCK_SIZE) * PQFastScanBlockBytes(subspace_pair_num_);
+        const u32 in_block_id = k % PQ_FAST_SCAN_BLOCK_SIZE;
+        return (block[(j >> 1) * 32 + (j & 1) * 16 + (in_block_id & 15)] >> ((in_block_id >> 4) << 2)) & 0xf;
+    }
+
+    static void CheckCodes(const PQ_Code_StorageT<4> &storage, const Vector<u32> &codes) {
+        ASSERT_EQ(storage.fast_scan_blocks_.size(), block_num_ * PQFastScanBlockBytes(subspace_pair_num_));
+        const u8 *blocks = storage.FastScanBlocks();
+        u32 extracted[subspace_num_];
+        for (u32 k = 0; k < code_num_; ++k) {
+            storage.ExtractCodes(k, extracted);
+            for (u32 j = 0; j < subspace_num_; ++j) {
+                EXPECT_EQ(extracted[j], codes[k * subspace_num_ + j]);
+                EXPECT_EQ(BlockCode(blocks, k, j), codes[k * subspace_num_ + j]);
+            }
+        }
+        // the padding of the tail block scans as code 0
+        for (u32 k = code_num_; k < block_num_ * PQ_FAST_SCAN_BLOCK_SIZE; ++k) {
+            for (u32 j = 0; j < subspace_num_; ++j) {
+                EXPECT_EQ(BlockCode(blocks, k, j), 0u);
+            }
+        }
+    }
+};
+
+TEST_F(PQCodeStorageTest, fast_scan_layout) {
+    std::mt19937 rng(0);
+    Vector<u32> codes(code_num_ * subspace_num_);
+    for (auto &code : codes) {
+        code = rng() % 16;
+    }
+    {
+        PQ_Code_StorageT<4> storage(subspace_num_);
+        for (u32 k = 0; k < code_num_; ++k) {
+            storage.AppendCodes(codes.data() + k * subspace_num_);
+        }
+        CheckCodes(storage, codes);
+
+        auto [file_handle, status] = VirtualStore::Open(save_path_, FileAccessMode::kWrite);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        storage.Save(*file_handle);
+    }
+    {
+        // the file keeps the sequential layout of two codes per byte
+        auto [file_handle, status] = VirtualStore::Open(save_path_, FileAccessMode::kRead);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        u64 last_code_id = 0;
+        file_handle->Read(&last_code_id, sizeof(last_code_id));
+        EXPECT_EQ(last_code_id, code_num_ * subspace_num_);
+        u32 storage_size = 0;
+        file_handle->Read(&storage_size, sizeof(storage_size));
+        ASSERT_EQ(storage_size, (code_num_ * subspace_num_ + 1) / 2);
+        Vector<u8> storage(storage_size);
+        file_handle->Read(storage.data(), storage_size);
+        for (u32 i = 0; i < code_num_ * subspace_num_; ++i) {
+            EXPECT_EQ((i & 1) ? (storage[i >> 1] >> 4) : (storage[i >> 1] & 0xf), codes[i]);
+        }
+    }
+    {
+        auto [file_handle, status] = VirtualStore::Open(save_path_, FileAccessMode::kRead);
+        if (!status.ok()) {
+            UnrecoverableError(status.message());
+        }
+        PQ_Code_StorageT<4> storage(subspace_num_);
+        storage.Load(*file_handle);
+        CheckCodes(storage, codes);
+    }
+}
+
+TEST_F(PQCodeStorageTest, fast_scan_lut) {
+    std::mt19937 rng(0);
+    std::uniform_real_distribution<f32> dist(-10.0f, 10.0f);
+    Vector<f32> table(subspace_num_ * 16);
+    for (auto &v : table) {
+        v = dist(rng);
+    }
+    PQ_Code_StorageT<4> storage(subspace_num_);
+    Vector<u32> codes(code_num_ * subspace_num_);
+    for (u32 k = 0; k < code_num_; ++k) {
+        for (u32 j = 0; j < subspace_num_; ++j) {
+            codes[k * subspace_num_ + j] = rng() % 16;
+        }
+        storage.AppendCodes(codes.data() + k * subspace_num_);
+    }
+
+    const PQFastScanLUT lut(subspace_num_, 16, [&](const u32 j, const u32 c) { return table[j * 16 + c]; });
+    // every table entry is rounded to the nearest quantization step
+    const f32 max_error = subspace_num_ * 0.5f * lut.inv_scale_ + 1e-3f;
+    u16 distances[PQ_FAST_SCAN_BLOCK_SIZE];
+    for (u32 block_id = 0; block_id < block_num_; ++block_id) {
+        PQFastScanSimple(storage.FastScanBlocks() + block_id * PQFastScanBlockBytes(subspace_pair_num_),
+                         lut.lut_.data(),
+                         subspace_pair_num_,
+                         distances);
+        for (u32 i = 0; i < PQ_FAST_SCAN_BLOCK_SIZE && block_id * PQ_FAST_SCAN_BLOCK_SIZE + i < code_num_; ++i) {
+            const u32 k = block_id * PQ_FAST_SCAN_BLOCK_SIZE + i;
+            f32 expected = 0.0f;
+            for (u32 j = 0; j < subspace_num_; ++j) {
+                expected += table[j * 16 + codes[k * subspace_num_ + j]];
+            }
+            EXPECT_NEAR(lut.Decode(distances[i]), expected, max_error);
+        }
+    }
+}
@@ -32,6 +32,7 @@ import logical_type;
 import persistence_manager;
 import default_values;
 import local_file_handle;
+import croaring;
 
 using namespace infinity;
 
@@ -175,3 +176,28 @@ TEST_P(BlockVersionTest, get_delete_ts_test) {
     EXPECT_EQ(res->ToString(2), "0");
     EXPECT_EQ(res->ToString(3), "40");
 }
+
+TEST_P(BlockVersionTest, delete_snapshot_test) {
+    BlockVersion block_version(8192);
+    block_version.Delete(2, 30);
+    block_version.Delete(63, 40);
+    block_version.Delete(64, 30);
+    block_version.Delete(8191, 50);
+
+    auto snapshot = block_version.GetDeleteSnapshot(40);
+    EXPECT_EQ(snapshot->max_delete_ts_, 40u);
+    EXPECT_EQ(snapshot->deleted_rows_.cardinality(), 3u);
+    EXPECT_TRUE(snapshot->deleted_rows_.contains(2));
+    EXPECT_TRUE(snapshot->deleted_rows_.contains(63));
+    EXPECT_TRUE(snapshot->deleted_rows_.contains(64));
+    EXPECT_FALSE(snapshot->deleted_rows_.contains(8191));
+
+    snapshot = block_version.GetDeleteSnapshot(MAX_TIMESTAMP);
+    EXPECT_EQ(snapshot->max_delete_ts_, 50u);
+    EXPECT_EQ(snapshot->deleted_rows_.cardinality(), 4u);
+    EXPECT_TRUE(snapshot->deleted_rows_.contains(8191));
+
+    snapshot = block_version.GetDeleteSnapshot(29);
+    EXPECT_EQ(snapshot->max_delete_ts_, 0u);
+    EXPECT_TRUE(snapshot->deleted_rows_.isEmpty());
+}
@@ -44,3 +44,48 @@ TEST_F(ObjectStatMapTest, test1) {
     stat2 = obj_map.GetNoCount("key2");
     EXPECT_EQ(stat2, nullptr);
 }
+
+TEST_F(ObjectStatMapTest, test2) {
+    SizeT disk_capacity_limit = 100;
+    ObjectStatAccessor_ObjectStorage obj_map(disk_capacity_limit);
+
+    // Objects loaded from checkpoint are not in localdisk cache
+    obj_map.PutNoCount("key1", ObjStat(60, 3, 0));
+    obj_map.PutNoCount("key2", ObjStat(60, 3, 0));
+    EXPECT_EQ(obj_map.disk_used(), 0);
+
+    Vector<String> drop_keys;
+    ObjStat *stat1 = obj_map.Get("key1");
+    EXPECT_EQ(stat1->cached_, ObjCached::kNotCached);
+    EXPECT_FALSE(stat1->RangeCached(Range{.start_ = 0, .end_ = 20}));
+    obj_map.AddCachedRange("key1", Range{.start_ = 0, .end_ = 20}, drop_keys);
+    obj_map.AddCachedRange("key1", Range{.start_ = 10, .end_ = 40}, drop_keys);
+    EXPECT_EQ(obj_map.disk_used(), 40);
+    EXPECT_EQ(stat1->cached_ranges_.size(), 1);
+    EXPECT_TRUE(stat1->RangeCached(Range{.start_ = 5, .end_ = 35}));
+    EXPECT_FALSE(stat1->RangeCached(Range{.start_ = 30, .end_ = 50}));
+    EXPECT_FALSE(stat1->FullyCached());
+    obj_map.Release("key1", drop_keys);
+
+    ObjStat *stat2 = obj_map.Get("key2");
+    obj_map.AddCachedRange("key2", Range{.start_ = 40, .end_ = 60}, drop_keys);
+    obj_map.AddCachedRange("key2", Range{.start_ = 0, .end_ = 40}, drop_keys);
+    EXPECT_TRUE(stat2->FullyCached());
+    EXPECT_EQ(obj_map.disk_used(), 100);
+    EXPECT_EQ(drop_keys.size(), 0);
+
+    // key2 is in use, so the partially cached key1 is envicted
+    obj_map.PutNew("key3", ObjStat(10, 1, 0), drop_keys);
+    ASSERT_EQ(drop_keys.size(), 1);
+    EXPECT_EQ(drop_keys[0], "key1");
+    drop_keys.clear();
+    EXPECT_EQ(obj_map.disk_used(), 70);
+    EXPECT_EQ(stat1->CachedSize(), 0);
+    EXPECT_EQ(stat1->cached_, ObjCached::kNotCached);
+
+    obj_map.Release("key2", drop_keys);
+    EXPECT_EQ(drop_keys.size(), 0);
+    Optional<ObjStat> stat2_opt = obj_map.Invalidate("key2");
+    EXPECT_TRUE(stat2_opt.has_value());
+    EXPECT_EQ(obj_map.disk_used(), 10);
+}
@@ -6,6 +6,8 @@ import virtual_store;
 import third_party;
 import persist_result_handler;
 import local_file_handle;
+import s3_client;
+import status;
 
 using namespace infinity;
 namespace fs = std::filesystem;
@@ -55,6 +57,67 @@ void PersistenceManagerTest::CheckObjData(const String& local_file_path, const S
     handler_->HandleWriteResult(res);
 }
 
+// Object storage backed by a local directory, each bucket is a sub directory
+class LocalDirS3Client : public S3Client {
+public:
+    explicit LocalDirS3Client(String root_dir) : root_dir_(std::move(root_dir)) {}
+
+    Status Init() override { return Status::OK(); }
+    Status UnInit() override { return Status::OK(); }
+
+    Status DownloadObject(const String &bucket_name, const String &object_name, const String &file_path) override {
+        fs::copy_file(ObjectPath(bucket_name, object_name), file_path, fs::copy_options::overwrite_existing);
+        downloaded_bytes_ += fs::file_size(file_path);
+        return Status::OK();
+    }
+
+    Status DownloadObjectRange(const String &bucket_name, const String &object_name, const String &file_path, SizeT offset, SizeT length) override {
+        std::ifstream in_file(ObjectPath(bucket_name, object_name), std::ios::binary);
+        in_file.seekg(offset);
+        String data(length, '\0');
+        in_file.read(data.data(), length);
+        if (!fs::exists(file_path)) {
+            std::ofstream create_file(file_path, std::ios::binary);
+        }
+        std::fstream out_file(file_path, std::ios::in | std::ios::out | std::ios::binary);
+        out_file.seekp(offset);
+        out_file.write(data.data(), length);
+        downloaded_bytes_ += length;
+        return Status::OK();
+    }
+
+    Status UploadObject(const String &bucket_name, const String &object_name, const String &file_path) override {
+        fs::copy_file(file_path, ObjectPath(bucket_name, object_name), fs::copy_options::overwrite_existing);
+        return Status::OK();
+    }
+
+    Status RemoveObject(const String &bucket_name, const String &object_name) override {
+        fs::remove(ObjectPath(bucket_name, object_name));
+        return Status::OK();
+    }
+
+    Status CopyObject(const String &src_bucket_name, const String &src_object_name, const String &dst_bucket_name, const String &dst_object_name) override {
+        fs::copy_file(ObjectPath(src_bucket_name, src_object_name), ObjectPath(dst_bucket_name, dst_object_name), fs::copy_options::overwrite_existing);
+        return Status::OK();
+    }
+
+    Status BucketExists(const String &bucket_name) override {
+        return fs::exists(fs::path(root_dir_) / bucket_name) ? Status::OK() : Status::MinioBucketNotExists(bucket_name);
+    }
+
+    Status MakeBucket(const String &bucket_name) override {
+        fs::create_directories(fs::path(root_dir_) / bucket_name);
+        return Status::OK();
+    }
+
+    SizeT downloaded_bytes_{};
+
+private:
+    String ObjectPath(const String &bucket_name, const String &object_name) const { return fs::path(root_dir_) / bucket_name / object_name; }
+
+    String root_dir_;
+};
+
 TEST_F(PersistenceManagerTest, PersistFileBasic) {
     String file_path = file_dir_ + "/persist_file";
     std::ofstream out_file(file_path);
@@ -191,4 +254,99 @@ TEST_F(PersistenceManagerTest, CleanupBasic) {
     for (const auto& obj_path : obj_paths) {
         ASSERT_FALSE(fs::exists(obj_path));
     }
-}
\ No newline at end of file
+}
+
+TEST_F(PersistenceManagerTest, ObjectStorageRangeCache) {
+    const String bucket = "infinity";
+    LocalDirS3Client s3_client(String(GetFullTmpDir()) + "/persistence_remote");
+    s3_client.MakeBucket(bucket);
+    SizeT disk_cache_limit = 1024;
+    auto remote_pm = MakeUnique<PersistenceManager>(workspace_, file_dir_, ObjSizeLimit, false, disk_cache_limit);
+
+    String file_path_base = file_dir_ + "/range_file";
+    Vector<String> file_paths;
+    Vector<String> persist_keys;
+    for (SizeT i = 0; i < 4; ++i) {
+        String file_path = file_path_base + std::to_string(i);
+        std::ofstream out_file(file_path);
+        out_file << String(20, char('a' + i));
+        out_file.close();
+        file_paths.push_back(file_path);
+        PersistWriteResult result = remote_pm->Persist(file_path, file_path);
+        persist_keys.insert(persist_keys.end(), result.persist_keys_.begin(), result.persist_keys_.end());
+    }
+    PersistWriteResult finalize_result = remote_pm->CurrentObjFinalize();
+    persist_keys.insert(persist_keys.end(), finalize_result.persist_keys_.begin(), finalize_result.persist_keys_.end());
+    ASSERT_EQ(persist_keys.size(), 1);
+    s3_client.UploadObject(bucket, persist_keys[0], remote_pm->GetObjPath(persist_keys[0]));
+    EXPECT_EQ(remote_pm->disk_used(), 80);
+
+    // Start on a node without the object files
+    nlohmann::json pm_json = remote_pm->Serialize();
+    remote_pm.reset();
+    fs::remove_all(workspace_);
+    fs::create_directories(workspace_);
+    remote_pm = MakeUnique<PersistenceManager>(workspace_, file_dir_, ObjSizeLimit, false, disk_cache_limit);
+    remote_pm->Deserialize(pm_json);
+    EXPECT_EQ(remote_pm->disk_used(), 0);
+
+    // Only the part of the read file is downloaded
+    PersistReadResult read_result = remote_pm->GetObjCache(file_paths[2]);
+    ASSERT_NE(read_result.obj_stat_, nullptr);
+    ObjAddr obj_addr = read_result.obj_addr_;
+    EXPECT_FALSE(remote_pm->PartCached(obj_addr));
+    String obj_path = remote_pm->GetObjPath(obj_addr.obj_key_);
+    s3_client.DownloadObjectRange(bucket, obj_addr.obj_key_, obj_path, obj_addr.part_offset_, obj_addr.part_size_);
+    PersistWriteResult write_result = remote_pm->AddCachedPart(obj_addr);
+    EXPECT_TRUE(write_result.drop_keys_.empty());
+    EXPECT_EQ(s3_client.downloaded_bytes_, 20);
+    EXPECT_EQ(remote_pm->disk_used(), 20);
+    EXPECT_TRUE(remote_pm->PartCached(obj_addr));
+    {
+        std::ifstream obj_file(obj_path, std::ios::binary);
+        obj_file.seekg(obj_addr.part_offset_);
+        String data(obj_addr.part_size_, '\0');
+        obj_file.read(data.data(), data.size());
+        EXPECT_EQ(data, String(20, 'c'));
+    }
+    write_result = remote_pm->PutObjCache(file_paths[2]);
+
+    read_result = remote_pm->GetObjCache(file_paths[2]);
+    EXPECT_EQ(read_result.obj_stat_, nullptr);
+    write_result = remote_pm->PutObjCache(file_paths[2]);
+
+    // Prefetch merges the missing parts of the object into one range
+    Vector<PersistReadResult> prefetch_results = remote_pm->GetObjCacheForPrefetch(file_paths);
+    ASSERT_EQ(prefetch_results.size(), 1);
+    const ObjAddr &prefetch_addr = prefetch_results[0].obj_addr_;
+    EXPECT_EQ(prefetch_addr.part_offset_, 0);
+    EXPECT_EQ(prefetch_addr.part_size_, 80);
+    s3_client.DownloadObjectRange(bucket, prefetch_addr.obj_key_, obj_path, prefetch_addr.part_offset_, prefetch_addr.part_size_);
+    write_result = remote_pm->AddCachedPart(prefetch_addr);
+    write_result = remote_pm->PutObjCacheByKey(prefetch_addr.obj_key_);
+    EXPECT_EQ(remote_pm->disk_used(), 80);
+    // The footer is restored once the whole object is downloaded
+    EXPECT_EQ(fs::file_size(obj_path), 80 + sizeof(u32));
+    for (SizeT i = 0; i < file_paths.size(); ++i) {
+        read_result = remote_pm->GetObjCache(file_paths[i]);
+        EXPECT_EQ(read_result.obj_stat_, nullptr);
+        write_result = remote_pm->PutObjCache(file_paths[i]);
+    }
+
+    // Restart and rebuild the cache from workspace
+    pm_json = remote_pm->Serialize();
+    remote_pm = MakeUnique<PersistenceManager>(workspace_, file_dir_, ObjSizeLimit, false, disk_cache_limit);
+    remote_pm->Deserialize(pm_json);
+    EXPECT_EQ(remote_pm->disk_used(), 80);
+    read_result = remote_pm->GetObjCache(file_paths[0]);
+    EXPECT_EQ(read_result.obj_stat_, nullptr);
+    write_result = remote_pm->PutObjCache(file_paths[0]);
+
+    // A partially downloaded object is dropped on restart
+    remote_pm.reset();
+    fs::resize_file(obj_path, 40);
+    remote_pm = MakeUnique<PersistenceManager>(workspace_, file_dir_, ObjSizeLimit, false, disk_cache_limit);
+    remote_pm->Deserialize(pm_json);
+    EXPECT_EQ(remote_pm->disk_used(), 0);
+    EXPECT_FALSE(fs::exists(obj_path));
+}
@@ -135,3 +135,53 @@ TEST(ResultCacheManagerTest, test2) {
     auto res2 = cache_manager.GetCache(*cached_node21);
     EXPECT_FALSE(res2.has_value());
 }
+
+TEST(ResultCacheManagerTest, test3) {
+    auto make_blocks = [](SizeT row_count) {
+        auto block = MakeUnique<DataBlock>();
+        block->Init(Vector<SharedPtr<DataType>>{MakeShared<DataType>(LogicalType::kBigInt)}, row_count);
+        block->Finalize();
+        Vector<UniquePtr<DataBlock>> blocks;
+        blocks.push_back(std::move(block));
+        return blocks;
+    };
+    SizeT block_memory = make_blocks(1024)[0]->MemoryUsage();
+    EXPECT_GE(block_memory, 1024 * sizeof(i64));
+
+    // Room for three results
+    ResultCacheManager cache_manager(100, 3 * block_memory);
+    auto output_names = MakeShared<Vector<String>>(Vector<String>{"col1"});
+
+    // key1 is expensive to compute, key2 and key3 are cheap
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key1", output_names), make_blocks(1024), 1000));
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key2", output_names), make_blocks(1024), 10));
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key3", output_names), make_blocks(1024), 10));
+    EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key3", output_names)).has_value());
+
+    // key2 is cheap and never hit, it is evicted to make room for key4
+    EXPECT_TRUE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key4", output_names), make_blocks(1024), 10));
+    EXPECT_FALSE(cache_manager.GetCache(MockCachedNode("key2", output_names)).has_value());
+    EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key1", output_names)).has_value());
+    EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key3", output_names)).has_value());
+    EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key4", output_names)).has_value());
+
+    // A result bigger than the memory capacity is not cached
+    EXPECT_FALSE(cache_manager.AddCache(MakeUnique<MockCachedNode>("key5", output_names), make_blocks(4096), 1000000));
+
+    ResultCacheStats stats = cache_manager.GetStats();
+    EXPECT_EQ(stats.hit_count_, 4u);
+    EXPECT_EQ(stats.miss_count_, 1u);
+    EXPECT_EQ(stats.eviction_count_, 1u);
+    EXPECT_EQ(stats.cache_num_used_, 3u);
+    EXPECT_EQ(stats.memory_used_, 3 * block_memory);
+
+    // Shrinking the memory capacity evicts the cheapest results
+    cache_manager.ResetCacheMemoryCapacity(block_memory);
+    EXPECT_EQ(cache_manager.cache_num_used(), 1u);
+    EXPECT_TRUE(cache_manager.GetCache(MockCachedNode("key1", output_names)).has_value());
+
+    cache_manager.ClearCache();
+    stats = cache_manager.GetStats();
+    EXPECT_EQ(stats.cache_num_used_, 0u);
+    EXPECT_EQ(stats.memory_used_, 0u);
+}
@@ -0,0 +1,146 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import storage;
+import infinity_context;
+import txn_manager;
+import extra_ddl_info;
+import config;
+import column_def;
+import column_vector;
+import data_type;
+import logical_type;
+import table_def;
+import data_block;
+import txn;
+import catalog;
+import status;
+import internal_types;
+
+using namespace infinity;
+
+class ParallelReplayTest : public BaseTestParamStr {
+protected:
+    static std::shared_ptr<std::string> parallel_replay_config() {
+        return GetParam() == BaseTestParamStr::NULL_CONFIG_PATH
+                   ? std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_parallel_replay.toml")
+                   : std::make_shared<std::string>(std::string(test_data_path()) + "/config/test_parallel_replay_vfs_off.toml");
+    }
+
+    void SetUp() override { CleanupDbDirs(); }
+
+    void TearDown() override {}
+};
+
+INSTANTIATE_TEST_SUITE_P(TestWithDifferentParams,
+                         ParallelReplayTest,
+                         ::testing::Values(BaseTestParamStr::NULL_CONFIG_PATH, BaseTestParamStr::VFS_OFF_CONFIG_PATH));
+
+TEST_P(ParallelReplayTest, interleaved_tables) {
+    std::shared_ptr<std::string> config_path = ParallelReplayTest::parallel_replay_config();
+
+    String db_name = "default_db";
+    auto MakeTableDef = [&](const String &table_name) {
+        auto column_def1 = std::make_shared<ColumnDef>(0, std::make_shared<DataType>(LogicalType::kInteger), "col1", std::set<ConstraintType>());
+        auto column_def2 = std::make_shared<ColumnDef>(1, std::make_shared<DataType>(LogicalType::kVarchar), "col2", std::set<ConstraintType>());
+        return TableDef::Make(MakeShared<String>(db_name), MakeShared<String>(table_name), MakeShared<String>(), {column_def1, column_def2});
+    };
+    auto CreateTable = [&](TxnManager *txn_mgr, const String &table_name) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+        Status status = txn->CreateTable(db_name, MakeTableDef(table_name), ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    };
+    auto AppendRows = [&](TxnManager *txn_mgr, const String &table_name, i32 row_cnt) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("insert table"));
+
+        Vector<SharedPtr<ColumnVector>> column_vectors;
+        column_vectors.push_back(MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kInteger)));
+        column_vectors.push_back(MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kVarchar)));
+        for (auto &column_vector : column_vectors) {
+            column_vector->Initialize();
+        }
+        for (i32 i = 0; i < row_cnt; ++i) {
+            column_vectors[0]->AppendByPtr(reinterpret_cast<const_ptr_t>(&i));
+            std::string v2 = "v2v2v2v2v2v2v2v2v2v2v2v2v2v2v2v2v2v2v2v2";
+            column_vectors[1]->AppendByStringView(v2);
+        }
+        auto data_block = DataBlock::Make();
+        data_block->Init(column_vectors);
+
+        auto [table_entry, status] = txn->GetTableByName(db_name, table_name);
+        EXPECT_TRUE(status.ok());
+        status = txn->Append(table_entry, data_block);
+        ASSERT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    };
+    auto DeleteRows = [&](TxnManager *txn_mgr, const String &table_name, const Vector<RowID> &row_ids) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("delete"));
+        auto [table_entry, status] = txn->GetTableByName(db_name, table_name);
+        EXPECT_TRUE(status.ok());
+        status = txn->Delete(table_entry, row_ids, true);
+        ASSERT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    };
+    auto CheckTable = [&](TxnManager *txn_mgr, const String &table_name, SizeT row_cnt) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("get table"));
+        auto [table_entry, status] = txn->GetTableByName(db_name, table_name);
+        ASSERT_TRUE(status.ok());
+        EXPECT_EQ(table_entry->row_count(), row_cnt);
+        txn_mgr->CommitTxn(txn);
+    };
+
+    {
+        infinity::InfinityContext::instance().InitPhase1(config_path);
+        infinity::InfinityContext::instance().InitPhase2();
+        Storage *storage = InfinityContext::instance().storage();
+        EXPECT_EQ(storage->config()->WALReplayThreads(), 4);
+
+        TxnManager *txn_mgr = storage->txn_manager();
+        CreateTable(txn_mgr, "tb1");
+        CreateTable(txn_mgr, "tb2");
+        for (i32 round = 0; round < 4; ++round) {
+            AppendRows(txn_mgr, "tb1", 2);
+            AppendRows(txn_mgr, "tb2", 3);
+        }
+        DeleteRows(txn_mgr, "tb1", {RowID(0, 0), RowID(0, 1)});
+        // create table is replayed after all the entries committed before it
+        CreateTable(txn_mgr, "tb3");
+        for (i32 round = 0; round < 4; ++round) {
+            AppendRows(txn_mgr, "tb3", 1);
+            AppendRows(txn_mgr, "tb1", 2);
+        }
+        CheckTable(txn_mgr, "tb1", 14);
+        CheckTable(txn_mgr, "tb2", 12);
+        CheckTable(txn_mgr, "tb3", 4);
+        infinity::InfinityContext::instance().UnInit();
+    }
+    { // replay the wal of the three tables
+        infinity::InfinityContext::instance().InitPhase1(config_path);
+        infinity::InfinityContext::instance().InitPhase2();
+        Storage *storage = InfinityContext::instance().storage();
+
+        TxnManager *txn_mgr = storage->txn_manager();
+        CheckTable(txn_mgr, "tb1", 14);
+        CheckTable(txn_mgr, "tb2", 12);
+        CheckTable(txn_mgr, "tb3", 4);
+        AppendRows(txn_mgr, "tb2", 1);
+        CheckTable(txn_mgr, "tb2", 13);
+        infinity::InfinityContext::instance().UnInit();
+    }
+}
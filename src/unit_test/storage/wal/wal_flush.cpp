@@ -0,0 +1,120 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import storage;
+import infinity_context;
+import txn_manager;
+import extra_ddl_info;
+import config;
+import options;
+import column_def;
+import data_type;
+import logical_type;
+import table_def;
+import txn;
+import status;
+import wal_manager;
+import internal_types;
+import third_party;
+
+using namespace infinity;
+
+class WalFlushTest : public BaseTestWithParam<String> {
+protected:
+    void SetUp() override { CleanupDbDirs(); }
+
+    void TearDown() override {}
+
+    SharedPtr<String> WalFlushConfig() const {
+        return MakeShared<String>(fmt::format("{}/config/test_wal_{}.toml", test_data_path(), GetParam()));
+    }
+
+    static void CreateTable(TxnManager *txn_mgr, const String &table_name) {
+        auto column_def = MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kInteger), "col1", std::set<ConstraintType>());
+        auto table_def = TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>(table_name), MakeShared<String>(), {column_def});
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+        Status status = txn->CreateTable("default_db", table_def, ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+
+    static bool TableExists(TxnManager *txn_mgr, const String &table_name) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("get table"));
+        auto [table_entry, status] = txn->GetTableByName("default_db", table_name);
+        txn_mgr->CommitTxn(txn);
+        return status.ok();
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(TestWithDifferentParams, WalFlushTest, ::testing::Values("flush_at_once", "only_write", "flush_per_second"));
+
+TEST_P(WalFlushTest, flush_option) {
+    constexpr SizeT kTableCount = 8;
+    const String flush_option = GetParam();
+    {
+        InfinityContext::instance().InitPhase1(WalFlushConfig());
+        InfinityContext::instance().InitPhase2();
+        Storage *storage = InfinityContext::instance().storage();
+        FlushOptionType flush_option_type = storage->config()->FlushMethodAtCommit();
+        if (flush_option == "flush_at_once") {
+            EXPECT_EQ(flush_option_type, FlushOptionType::kFlushAtOnce);
+        } else if (flush_option == "only_write") {
+            EXPECT_EQ(flush_option_type, FlushOptionType::kOnlyWrite);
+        } else {
+            EXPECT_EQ(flush_option_type, FlushOptionType::kFlushPerSecond);
+        }
+
+        WalManager *wal_manager = storage->wal_manager();
+        TxnManager *txn_mgr = storage->txn_manager();
+        WalFlushStats begin_stats = wal_manager->GetFlushStats();
+        for (SizeT idx = 0; idx < kTableCount; ++idx) {
+            CreateTable(txn_mgr, fmt::format("tb{}", idx));
+        }
+        // A commit returns after the batch of its log is done, so the counters already cover the commits.
+        WalFlushStats stats = wal_manager->GetFlushStats();
+        u64 batch_count = stats.batch_count_ - begin_stats.batch_count_;
+        u64 sync_count = stats.sync_count_ - begin_stats.sync_count_;
+        EXPECT_GE(stats.entry_count_ - begin_stats.entry_count_, kTableCount);
+        EXPECT_GE(batch_count, 1u);
+        EXPECT_LE(batch_count, kTableCount);
+
+        if (flush_option_type == FlushOptionType::kFlushAtOnce) {
+            // Every batch is synced before its transactions are committed.
+            EXPECT_EQ(sync_count, batch_count);
+        } else if (flush_option_type == FlushOptionType::kOnlyWrite) {
+            EXPECT_EQ(sync_count, 0u);
+        } else {
+            // Committed before sync, at most one sync a second. The logs of an idle server are synced within the second.
+            EXPECT_LE(sync_count, batch_count);
+            std::this_thread::sleep_for(std::chrono::milliseconds(1500));
+            WalFlushStats idle_stats = wal_manager->GetFlushStats();
+            EXPECT_GT(idle_stats.sync_count_, begin_stats.sync_count_);
+            EXPECT_EQ(idle_stats.batch_count_, stats.batch_count_);
+        }
+        InfinityContext::instance().UnInit();
+    }
+    { // the committed transactions are replayed whatever the flush option is
+        InfinityContext::instance().InitPhase1(WalFlushConfig());
+        InfinityContext::instance().InitPhase2();
+        TxnManager *txn_mgr = InfinityContext::instance().storage()->txn_manager();
+        for (SizeT idx = 0; idx < kTableCount; ++idx) {
+            EXPECT_TRUE(TableExists(txn_mgr, fmt::format("tb{}", idx)));
+        }
+        InfinityContext::instance().UnInit();
+    }
+}
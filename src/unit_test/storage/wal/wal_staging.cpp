@@ -0,0 +1,150 @@
+// Copyright(C) 2023 InfiniFlow, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     https://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+import base_test;
+
+import stl;
+import storage;
+import infinity_context;
+import txn_manager;
+import extra_ddl_info;
+import column_def;
+import column_vector;
+import data_type;
+import logical_type;
+import table_def;
+import data_block;
+import txn;
+import catalog;
+import status;
+import wal_manager;
+import default_values;
+import internal_types;
+import third_party;
+
+using namespace infinity;
+
+class WalStagingTest : public BaseTest {
+protected:
+    void SetUp() override { CleanupDbDirs(); }
+
+    void TearDown() override {}
+
+    static SharedPtr<String> WalStagingConfig() { return MakeShared<String>(fmt::format("{}/config/test_wal_flush_at_once.toml", test_data_path())); }
+
+    static void CreateTable(TxnManager *txn_mgr, const String &table_name) {
+        auto column_def1 = MakeShared<ColumnDef>(0, MakeShared<DataType>(LogicalType::kInteger), "col1", std::set<ConstraintType>());
+        auto column_def2 = MakeShared<ColumnDef>(1, MakeShared<DataType>(LogicalType::kVarchar), "col2", std::set<ConstraintType>());
+        auto table_def =
+            TableDef::Make(MakeShared<String>("default_db"), MakeShared<String>(table_name), MakeShared<String>(), {column_def1, column_def2});
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("create table"));
+        Status status = txn->CreateTable("default_db", table_def, ConflictType::kError);
+        EXPECT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+
+    static void AppendRows(TxnManager *txn_mgr, const String &table_name, i32 row_cnt, SizeT value_size) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("insert table"));
+        Vector<SharedPtr<ColumnVector>> column_vectors;
+        column_vectors.push_back(MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kInteger)));
+        column_vectors.push_back(MakeShared<ColumnVector>(MakeShared<DataType>(LogicalType::kVarchar)));
+        for (auto &column_vector : column_vectors) {
+            column_vector->Initialize();
+        }
+        for (i32 i = 0; i < row_cnt; ++i) {
+            column_vectors[0]->AppendByPtr(reinterpret_cast<const_ptr_t>(&i));
+            String v2(value_size, 'a' + i % 26);
+            column_vectors[1]->AppendByStringView(v2);
+        }
+        auto data_block = DataBlock::Make();
+        data_block->Init(column_vectors);
+
+        auto [table_entry, status] = txn->GetTableByName("default_db", table_name);
+        EXPECT_TRUE(status.ok());
+        status = txn->Append(table_entry, data_block);
+        ASSERT_TRUE(status.ok());
+        txn_mgr->CommitTxn(txn);
+    }
+
+    static void CheckTable(TxnManager *txn_mgr, const String &table_name, SizeT row_cnt) {
+        auto *txn = txn_mgr->BeginTxn(MakeUnique<String>("get table"));
+        auto [table_entry, status] = txn->GetTableByName("default_db", table_name);
+        ASSERT_TRUE(status.ok());
+        EXPECT_EQ(table_entry->row_count(), row_cnt);
+        txn_mgr->CommitTxn(txn);
+    }
+};
+
+TEST_F(WalStagingTest, batches_across_staging_buffer) {
+    constexpr SizeT kThreadCount = 4;
+    constexpr i32 kRoundCount = 16;
+    // 100 rows of 60KB varchar, a single entry is larger than the staging buffer
+    constexpr i32 kLargeRowCount = 100;
+    constexpr SizeT kLargeValueSize = 60000;
+    static_assert(kLargeRowCount * kLargeValueSize > WAL_STAGING_BUFFER_SIZE);
+
+    {
+        InfinityContext::instance().InitPhase1(WalStagingConfig());
+        InfinityContext::instance().InitPhase2();
+        Storage *storage = InfinityContext::instance().storage();
+        TxnManager *txn_mgr = storage->txn_manager();
+        WalManager *wal_manager = storage->wal_manager();
+        for (SizeT idx = 0; idx < kThreadCount; ++idx) {
+            CreateTable(txn_mgr, fmt::format("tb{}", idx));
+        }
+        WalFlushStats begin_stats = wal_manager->GetFlushStats();
+
+        // concurrent commits are written in the same batches, the large entries grow the staging buffer in the middle of a batch
+        Vector<Thread> threads;
+        for (SizeT idx = 0; idx < kThreadCount; ++idx) {
+            threads.emplace_back([&, idx] {
+                String table_name = fmt::format("tb{}", idx);
+                for (i32 round = 0; round < kRoundCount; ++round) {
+                    if (round % 4 == idx % 4) {
+                        AppendRows(txn_mgr, table_name, kLargeRowCount, kLargeValueSize);
+                    } else {
+                        AppendRows(txn_mgr, table_name, 8, 16);
+                    }
+                }
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        // small entries after the staging buffer is shrunk back
+        for (SizeT idx = 0; idx < kThreadCount; ++idx) {
+            AppendRows(txn_mgr, fmt::format("tb{}", idx), 1, 16);
+        }
+
+        WalFlushStats stats = wal_manager->GetFlushStats();
+        EXPECT_GE(stats.entry_count_ - begin_stats.entry_count_, kThreadCount * (kRoundCount + 1));
+        EXPECT_LE(stats.batch_count_ - begin_stats.batch_count_, stats.entry_count_ - begin_stats.entry_count_);
+        for (SizeT idx = 0; idx < kThreadCount; ++idx) {
+            CheckTable(txn_mgr, fmt::format("tb{}", idx), kLargeRowCount * 4 + 8 * (kRoundCount - 4) + 1);
+        }
+        InfinityContext::instance().UnInit();
+    }
+    { // every entry of the batches is replayed
+        InfinityContext::instance().InitPhase1(WalStagingConfig());
+        InfinityContext::instance().InitPhase2();
+        TxnManager *txn_mgr = InfinityContext::instance().storage()->txn_manager();
+        for (SizeT idx = 0; idx < kThreadCount; ++idx) {
+            CheckTable(txn_mgr, fmt::format("tb{}", idx), kLargeRowCount * 4 + 8 * (kRoundCount - 4) + 1);
+        }
+        AppendRows(txn_mgr, "tb0", 1, 16);
+        CheckTable(txn_mgr, "tb0", kLargeRowCount * 4 + 8 * (kRoundCount - 4) + 2);
+        InfinityContext::instance().UnInit();
+    }
+}
@@ -538,6 +538,16 @@ struct InsertRequest {
 4:  i64 session_id,
 }
 
+// Columnar insert: each column field carries one raw little-endian buffer of row_count values,
+// laid out like the column fields of SelectResponse.
+struct ColumnarInsertRequest {
+1:  string db_name,
+2:  string table_name,
+3:  list<ColumnField> column_fields = [],
+4:  i64 row_count,
+5:  i64 session_id,
+}
+
 struct ImportRequest{
 1:  string db_name,
 2:  string table_name,
@@ -763,6 +773,7 @@ CommonResponse DropDatabase(1:DropDatabaseRequest request),
 CommonResponse CreateTable(1:CreateTableRequest request),
 CommonResponse DropTable(1:DropTableRequest request),
 CommonResponse Insert(1:InsertRequest request),
+CommonResponse ColumnarInsert(1:ColumnarInsertRequest request),
 CommonResponse Import(1:ImportRequest request),
 CommonResponse Export(1:ExportRequest request),
 SelectResponse Select(1:SelectRequest request),
@@ -0,0 +1,96 @@
+import os
+import argparse
+
+
+def generate(generate_if_exists: bool, copy_dir: str):
+    row_n = 10000
+    csv_dir = "./test/data/csv"
+    jsonl_dir = "./test/data/jsonl"
+    slt_dir = "./test/sql/dml/import"
+
+    table_name = "test_import_partition"
+    csv_path = csv_dir + "/test_import_partition.csv"
+    jsonl_path = jsonl_dir + "/test_import_partition.jsonl"
+    slt_path = slt_dir + "/test_import_partition.slt"
+    csv_copy_path = copy_dir + "/test_import_partition.csv"
+    jsonl_copy_path = copy_dir + "/test_import_partition.jsonl"
+
+    os.makedirs(csv_dir, exist_ok=True)
+    os.makedirs(jsonl_dir, exist_ok=True)
+    os.makedirs(slt_dir, exist_ok=True)
+    if (
+        os.path.exists(csv_path)
+        and os.path.exists(jsonl_path)
+        and os.path.exists(slt_path)
+        and not generate_if_exists
+    ):
+        print(
+            "File {}, {} and {} already existed exists. Skip Generating.".format(
+                slt_path, csv_path, jsonl_path
+            )
+        )
+        return
+    with open(csv_path, "w") as csv_file, open(jsonl_path, "w") as jsonl_file:
+        for i in range(row_n):
+            csv_file.write("{},value_{}\n".format(i, i))
+            jsonl_file.write('{{"c1": {}, "c2": "value_{}"}}\n'.format(i, i))
+
+    with open(slt_path, "w") as slt_file:
+        # a partition of at least 1 byte, the small files are split into one partition per import thread
+        slt_file.write("statement ok\n")
+        slt_file.write("SET CONFIG import_partition_size 1;\n")
+        slt_file.write("\n")
+        for file_format, copy_path in (("CSV", csv_copy_path), ("JSONL", jsonl_copy_path)):
+            slt_file.write("statement ok\n")
+            slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
+            slt_file.write("\n")
+            slt_file.write("statement ok\n")
+            slt_file.write("CREATE TABLE {} (c1 int, c2 varchar);\n".format(table_name))
+            slt_file.write("\n")
+            slt_file.write("query I\n")
+            slt_file.write(
+                "COPY {} FROM '{}' WITH ( DELIMITER ',', FORMAT {} );\n".format(
+                    table_name, copy_path, file_format
+                )
+            )
+            slt_file.write("----\n")
+            slt_file.write("\n")
+            slt_file.write("query I\n")
+            slt_file.write("SELECT COUNT(*) FROM {};\n".format(table_name))
+            slt_file.write("----\n")
+            slt_file.write("{}\n".format(row_n))
+            slt_file.write("\n")
+            # the partitions are appended in the order of the file
+            slt_file.write("query IT\n")
+            slt_file.write("SELECT c1, c2 FROM {} ORDER BY ROW_ID();\n".format(table_name))
+            slt_file.write("----\n")
+            for i in range(row_n):
+                slt_file.write("{} value_{}\n".format(i, i))
+            slt_file.write("\n")
+            slt_file.write("statement ok\n")
+            slt_file.write("DROP TABLE {};\n".format(table_name))
+            slt_file.write("\n")
+        slt_file.write("statement ok\n")
+        slt_file.write("SET CONFIG import_partition_size 33554432;\n")
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Generate import partition data for test")
+
+    parser.add_argument(
+        "-g",
+        "--generate",
+        type=bool,
+        default=False,
+        dest="generate_if_exists",
+    )
+    parser.add_argument(
+        "-c",
+        "--copy",
+        type=str,
+        default="/var/infinity/test_data",
+        dest="copy_dir",
+    )
+    args = parser.parse_args()
+    generate(args.generate_if_exists, args.copy_dir)
@@ -0,0 +1,142 @@
+import os
+import argparse
+
+
+def generate(generate_if_exists: bool, copy_dir: str):
+    # one full block of 8192 rows and a partial block after it
+    row_n = 10000
+    block_capacity = 8192
+    csv_dir = "./test/data/csv"
+    slt_dir = "./test/sql/dql"
+
+    table_name = "test_scan_full_block"
+    csv_path = csv_dir + "/test_scan_full_block.csv"
+    slt_path = slt_dir + "/scan_full_block.slt"
+    copy_path = copy_dir + "/test_scan_full_block.csv"
+
+    os.makedirs(csv_dir, exist_ok=True)
+    os.makedirs(slt_dir, exist_ok=True)
+    if os.path.exists(csv_path) and os.path.exists(slt_path) and not generate_if_exists:
+        print(
+            "File {} and {} already existed exists. Skip Generating.".format(
+                slt_path, csv_path
+            )
+        )
+        return
+    with open(csv_path, "w") as csv_file:
+        for i in range(row_n):
+            csv_file.write('{},"[{},{},{}]"\n'.format(i, i, i + 1, i + 2))
+
+    def write_queries(slt_file, deleted_row):
+        rows = [i for i in range(row_n) if i != deleted_row]
+
+        # filter across the boundary of the full block and the partial block
+        begin, end = block_capacity - 8, block_capacity + 8
+        slt_file.write("query II\n")
+        slt_file.write(
+            "SELECT c1, c2 FROM {} WHERE c1 >= {} AND c1 < {} ORDER BY c1;\n".format(
+                table_name, begin, end
+            )
+        )
+        slt_file.write("----\n")
+        for i in rows:
+            if begin <= i < end:
+                slt_file.write("{} [{},{},{}]\n".format(i, i, i + 1, i + 2))
+        slt_file.write("\n")
+
+        # filter around the deleted row in the full block
+        begin, end = 96, 104
+        slt_file.write("query II\n")
+        slt_file.write(
+            "SELECT c1, c2 FROM {} WHERE c1 >= {} AND c1 < {} ORDER BY c1;\n".format(
+                table_name, begin, end
+            )
+        )
+        slt_file.write("----\n")
+        for i in rows:
+            if begin <= i < end:
+                slt_file.write("{} [{},{},{}]\n".format(i, i, i + 1, i + 2))
+        slt_file.write("\n")
+
+        # sort every row of the table, the first rows of the full block come last
+        slt_file.write("query II\n")
+        slt_file.write("SELECT c1, c2 FROM {} ORDER BY c1 DESC;\n".format(table_name))
+        slt_file.write("----\n")
+        for i in reversed(rows):
+            slt_file.write("{} [{},{},{}]\n".format(i, i, i + 1, i + 2))
+        slt_file.write("\n")
+
+        slt_file.write("query IIII\n")
+        slt_file.write(
+            "SELECT COUNT(*), SUM(c1), MIN(c1), MAX(c1) FROM {};\n".format(table_name)
+        )
+        slt_file.write("----\n")
+        slt_file.write(
+            "{} {} {} {}\n".format(len(rows), sum(rows), min(rows), max(rows))
+        )
+        slt_file.write("\n")
+
+        # aggregate over the full block only
+        full_block_rows = [i for i in rows if i < block_capacity]
+        slt_file.write("query II\n")
+        slt_file.write(
+            "SELECT COUNT(*), SUM(c1) FROM {} WHERE c1 < {};\n".format(
+                table_name, block_capacity
+            )
+        )
+        slt_file.write("----\n")
+        slt_file.write("{} {}\n".format(len(full_block_rows), sum(full_block_rows)))
+        slt_file.write("\n")
+
+    with open(slt_path, "w") as slt_file:
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE IF EXISTS {};\n".format(table_name))
+        slt_file.write("\n")
+        slt_file.write("statement ok\n")
+        slt_file.write(
+            "CREATE TABLE {} (c1 int, c2 embedding(int, 3));\n".format(table_name)
+        )
+        slt_file.write("\n")
+        slt_file.write("query I\n")
+        slt_file.write(
+            "COPY {} FROM '{}' WITH ( DELIMITER ',', FORMAT CSV );\n".format(
+                table_name, copy_path
+            )
+        )
+        slt_file.write("----\n")
+        slt_file.write("\n")
+
+        # the full block is passed on without copying, scanning it twice must see the same data
+        write_queries(slt_file, None)
+        write_queries(slt_file, None)
+
+        # a deleted row makes the full block go through the copy path
+        slt_file.write("statement ok\n")
+        slt_file.write("DELETE FROM {} WHERE c1 = 100;\n".format(table_name))
+        slt_file.write("\n")
+        write_queries(slt_file, 100)
+
+        slt_file.write("statement ok\n")
+        slt_file.write("DROP TABLE {};\n".format(table_name))
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(
+        description="Generate full block scan data for test")
+
+    parser.add_argument(
+        "-g",
+        "--generate",
+        type=bool,
+        default=False,
+        dest="generate_if_exists",
+    )
+    parser.add_argument(
+        "-c",
+        "--copy",
+        type=str,
+        default="/var/infinity/test_data",
+        dest="copy_dir",
+    )
+    args = parser.parse_args()
+    generate(args.generate_if_exists, args.copy_dir)
@@ -37,6 +37,8 @@ from generate_tensor_parquet import generate as generate25
 from generate_tensor_array_parquet import generate as generate26
 from generate_multivector_parquet import generate as generate27
 from generate_multivector_knn_scan import generate as generate28
+from generate_import_partition import generate as generate29
+from generate_scan_full_block import generate as generate30
 
 
 class SpinnerThread(threading.Thread):
@@ -192,6 +194,8 @@ if __name__ == "__main__":
     generate26(args.generate_if_exists, args.copy)
     generate27(args.generate_if_exists, args.copy)
     generate28(args.generate_if_exists, args.copy)
+    generate29(args.generate_if_exists, args.copy)
+    generate30(args.generate_if_exists, args.copy)
 
     print("Generate file finshed.")
 